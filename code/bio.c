@@ -143,28 +143,66 @@ brelse(struct buf *b)
 //PAGEBREAK!
 // Blank page.
 
+// Swap I/O.
+// Pages move between memory and the swap area with one
+// multi-sector disk request per call, bypassing the buffer
+// cache: nothing reads the swap area through bread(), so
+// there is no cached copy to keep coherent.
+#define NSWAPBUF 4  // swap requests in flight at once
+
+struct {
+  struct spinlock lock;
+  struct buf buf[NSWAPBUF];
+} swapio;
+
 void
-page_disk_interface(char* page, uint blockno, int param){
-  if(param == 0){
-    // write the page to the disk at blockno
-      struct buf *b;
-    for(int i=0; i<(PGSIZE/BSIZE);i++){
-      b=bget(ROOTDEV,blockno+i);
-      memmove(b->data,page+i*BSIZE,BSIZE);
-      bwrite(b);
-      brelse(b);
-    }
-  }
-  else{
-    // read the page from the disk at blockno
-      struct buf *b;
-    // uint dev = ROOTDEV;
-    for(int i=0; i<(PGSIZE/BSIZE);i++){
-      b=bread(ROOTDEV,blockno+i);
-      memmove(page+i*BSIZE,b->data,BSIZE);
-      bwrite(b);
-      brelse(b);
-    }
+swapioinit(void)
+{
+  struct buf *b;
+
+  initlock(&swapio.lock, "swapio");
+  for(b = swapio.buf; b < swapio.buf+NSWAPBUF; b++)
+    initsleeplock(&b->lock, "swapbuf");
+}
+
+// Transfer n pages between pages[] and the n*PGSIZE/BSIZE
+// consecutive swap blocks starting at blockno.
+// param 0 writes the pages to disk, 1 reads them in.
+void
+page_disk_vec(char **pages, int n, uint blockno, int param)
+{
+  struct buf *b;
+
+  acquire(&swapio.lock);
+  for(;;){
+    for(b = swapio.buf; b < swapio.buf+NSWAPBUF; b++)
+      if(b->refcnt == 0)
+        break;
+    if(b < swapio.buf+NSWAPBUF)
+      break;
+    sleep(&swapio, &swapio.lock);
   }
+  b->refcnt = 1;
+  release(&swapio.lock);
+
+  acquiresleep(&b->lock);
+  b->dev = ROOTDEV;
+  b->blockno = blockno;
+  b->vec = pages;
+  b->nvec = n;
+  b->vecdone = 0;
+  b->flags = (param == 0) ? B_DIRTY : 0;
+  iderw(b);
+  b->vec = 0;
+  releasesleep(&b->lock);
+
+  acquire(&swapio.lock);
+  b->refcnt = 0;
+  wakeup(&swapio);
+  release(&swapio.lock);
+}
 
-}
\ No newline at end of file
+void
+page_disk_interface(char* page, uint blockno, int param){
+  page_disk_vec(&page, 1, blockno, param);
+}
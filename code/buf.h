@@ -8,6 +8,9 @@ struct buf {
   struct buf *next;
   struct buf *qnext; // disk queue
   uchar data[BSIZE];
+  char **vec;        // swap I/O: whole pages to transfer instead of data
+  int nvec;          // number of pages in vec
+  int vecdone;       // pages transferred so far
 };
 #define B_VALID 0x2  // buffer has been read from disk
 #define B_DIRTY 0x4  // buffer needs to be written to disk
@@ -6,51 +6,503 @@
 #include "x86.h"
 #include "proc.h"
 #include "fs.h"
+#include "spinlock.h"
+#include "sleeplock.h"
+#include "file.h"
+#include "tlb.h"
+#include "vmstat.h"
 
 #define SWAPSIZE SWAPBLOCKS
 #define IRON_DOME PTXSHIFT
 #define ONE 1
 #define ZERO 0
 
+#define KSWAPD_LOWWM 32    // default watermarks, in free pages
+#define KSWAPD_HIGHWM 64
+
+#define SWAP_RAMAX 16       // most pages one fault reads in
+#define SWAP_RAWINDOW 8     // default readahead window, in pages
+#define SWAP_CLUSTER 8      // default swap-out cluster, in pages
+
+#define PF_WRITE 0x2        // page fault error code: caused by a write
+
+#define NSLOTS (SWAPSIZE/(PGSIZE/BSIZE))   // page-sized swap slots
+#define SWAPWORDS ((NSLOTS + 31) / 32)
+#define SLOTBIT(slot) (1U << ((slot) % 32))
+
+#define SWAPSHARERS 64     // most PTEs one swap slot can list
+
 struct s1{
-    int attribute_1;
     int attribute_2;
-    pte_t* pte_array[64];
+    pte_t* pte_array[SWAPSHARERS];
     uint refC;
+    int busy;       // being read in by case_swap()
+    int filled;     // page was all fillval; nothing on disk
+    uint fillval;
 };
 
 int reducer(int num){
     return (num - ONE - ONE) / 8;
 }
 
-uint rmap[PHYSTOP >> IRON_DOME];
-pte_t* reverse_map[PHYSTOP >> IRON_DOME][64];
+// Reverse map: for every frame, the PTEs mapping it.  Nearly all
+// frames have one mapper, so the first PTE is kept inline and the
+// rest, if any, spill into chain nodes of RNODEPTES pointers
+// carved out of slab pages.  The chain is newest first: only its
+// head node may be partly filled, so the last entry is always at
+// hand and removal moves it into the hole, in O(1).
+#define RNODEPTES 7
+#define RNODEORDER 1        // slab blocks are 2^RNODEORDER pages
+#define RNODEBOOT 4         // slab blocks set aside at boot
+
+struct rnode {
+    pte_t* pte[RNODEPTES];
+    struct rnode* next;
+};
+
+// Indexed by frame, phystop >> IRON_DOME of each; see rmapinit().
+uint* rmap;
+pte_t** rfirst;
+struct rnode** rmore;
+
+// Back-pointers, so that removing a PTE needs no search.  Every
+// user page table has a shadow page with a word per PTE: for a
+// present PTE, the chain node holding it in its frame's reverse
+// map, or 0 for rfirst; for a swapped PTE, its index in its
+// slot's pte_array.  ptpdx gives each user page table's place in
+// its page directory, so that a PTE leads back to the address it
+// maps when its page has to be flushed from the TLB.
+uint** ptshadow;
+ushort* ptpdx;
+uint nptshadow;
+
+int pt_shadow_alloc(void* pt, uint va){
+    char* sh = kalloc();
+    if(sh == ZERO){
+        return -ONE;
+    }
+    memset(sh, ZERO, PGSIZE);
+    ptshadow[V2P(pt) >> IRON_DOME] = (uint*)sh;
+    ptpdx[V2P(pt) >> IRON_DOME] = PDX(va);
+    __sync_fetch_and_add(&nptshadow, ONE);
+    return ZERO;
+}
+
+void pt_shadow_free(void* pt){
+    uint* sh = ptshadow[V2P(pt) >> IRON_DOME];
+    if(sh != ZERO){
+        ptshadow[V2P(pt) >> IRON_DOME] = ZERO;
+        __sync_fetch_and_sub(&nptshadow, ONE);
+        kfree((char*)sh);
+    }
+}
+
+uint* pte_back(pte_t* pte){
+    uint* sh = ptshadow[V2P(PGROUNDDOWN((uint)pte)) >> IRON_DOME];
+    if(sh == ZERO){
+        panic("pte_back");
+    }
+    return &sh[((uint)pte % PGSIZE) / sizeof(pte_t)];
+}
+
+// The user address the PTE maps.
+uint pte_va(pte_t* pte){
+    uint pdx = ptpdx[V2P(PGROUNDDOWN((uint)pte)) >> IRON_DOME];
+    return (uint)PGADDR(pdx, ((uint)pte % PGSIZE) / sizeof(pte_t), ZERO);
+}
+
+// Chain nodes come from a free list refilled a slab block at a
+// time.  Nodes are taken with a stripe held, so the block comes
+// from kalloc_order(), which never sleeps or reclaims, not from
+// kalloc(), and may not come at all.  fork() then fails, but a
+// swap-in cannot put the page back in its slot, so the last
+// RNODERESERVE free nodes are kept for it: enough to map every
+// sharer of every page one fault reads in.
+#define RNODERESERVE (SWAP_RAMAX * (SWAPSHARERS / RNODEPTES + ONE))
+
+struct {
+    struct spinlock lock;
+    struct rnode* free;
+    uint nfree;     // nodes on the free list
+    uint blocks;    // slab blocks carved into nodes
+    uint used;      // nodes on some chain
+} rnodes;
+
+int rnode_refill(void){
+    char* b = kalloc_order(RNODEORDER);
+    if(b == ZERO){
+        return -ONE;
+    }
+    struct rnode* n = (struct rnode*)b;
+    while((char*)(n + ONE) <= b + (PGSIZE << RNODEORDER)){
+        n->next = rnodes.free;
+        rnodes.free = n;
+        rnodes.nfree = rnodes.nfree + ONE;
+        n = n + ONE;
+    }
+    rnodes.blocks = rnodes.blocks + ONE;
+    return ZERO;
+}
+
+// Returns 0 if there is no node to spare.  Only a swap-in, with
+// reserve set, may take the reserved ones.
+struct rnode* rnode_alloc(int reserve){
+    acquire(&rnodes.lock);
+    uint floor = reserve ? ZERO : RNODERESERVE;
+    if(rnodes.nfree <= floor && rnode_refill() < ZERO){
+        release(&rnodes.lock);
+        return ZERO;
+    }
+    struct rnode* n = rnodes.free;
+    rnodes.free = n->next;
+    rnodes.nfree = rnodes.nfree - ONE;
+    rnodes.used = rnodes.used + ONE;
+    release(&rnodes.lock);
+    n->next = ZERO;
+    return n;
+}
+
+void rnode_free(struct rnode* n){
+    acquire(&rnodes.lock);
+    n->next = rnodes.free;
+    rnodes.free = n;
+    rnodes.nfree = rnodes.nfree + ONE;
+    rnodes.used = rnodes.used - ONE;
+    release(&rnodes.lock);
+}
+
+// Make sure the reserve is whole before a swap-in maps pages.
+// Caller holds swapmap.lock, so no other swap-in can use it up
+// meanwhile.  Returns -1 if there is no memory to refill it.
+int rnode_topup(void){
+    acquire(&rnodes.lock);
+    while(rnodes.nfree < RNODERESERVE){
+        if(rnode_refill() < ZERO){
+            release(&rnodes.lock);
+            return -ONE;
+        }
+    }
+    release(&rnodes.lock);
+    return ZERO;
+}
+
+// The reverse map is guarded by RMAPLOCKS spinlocks striped by
+// frame number, so that faults, fork, exit and swap-out on
+// different CPUs contend only when their frames share a stripe.
+// A stripe covers rmap[f], the PTE pointers for f and the PTEs
+// they point to, for every frame f hashing to it.  Nobody holds
+// two stripes at once.
+//
+// Lock order: ptable.lock, pcache.lock, swapmap.lock, an rmap
+// stripe, rnodes.lock, kmem.lock.  So kfree(), which may take the
+// first three, is never called holding a stripe: dec_rmap() says
+// how many mappings are left, and the caller that takes a frame
+// to none frees it afterwards.
+#define RMAPLOCKS 64
+
+struct spinlock rmaplock[RMAPLOCKS];
+
+struct spinlock* rmap_lock(uint frame){
+    return &rmaplock[frame % RMAPLOCKS];
+}
+
+// Entries in the head node of a frame whose list has n > 1 PTEs.
+int rnode_fill(int n){
+    return (n - 2) % RNODEPTES + ONE;
+}
+
+// Where entry i of frame's PTE list lives.  Caller holds its stripe.
+pte_t** rmap_slot(uint frame, int i){
+    if(i == ZERO){
+        return &rfirst[frame];
+    }
+    i = i - ONE;
+    struct rnode* n = rmore[frame];
+    int k = rnode_fill(rmap[frame]);
+    if(i < k){
+        return &n->pte[i];
+    }
+    i = i - k;
+    n = n->next;
+    while(i >= RNODEPTES){
+        n = n->next;
+        i = i - RNODEPTES;
+    }
+    return &n->pte[i];
+}
+
+pte_t* rmap_pte(uint frame, int i){
+    return *rmap_slot(frame, i);
+}
+
+// Caller holds the frame's stripe.  Returns -1, changing
+// nothing, if a chain node was needed and there was none.  A
+// frame's first mapping never needs one.
+int rmap_add(uint frame, pte_t* pte, int reserve){
+    int m = rmap[frame] - ONE;
+    if(m < ZERO){
+        rfirst[frame] = pte;
+        *pte_back(pte) = ZERO;
+    }
+    else{
+        if(m % RNODEPTES == ZERO){
+            // The head node is full: push a new one.
+            struct rnode* n = rnode_alloc(reserve);
+            if(n == ZERO){
+                return -ONE;
+            }
+            n->next = rmore[frame];
+            rmore[frame] = n;
+        }
+        rmore[frame]->pte[m % RNODEPTES] = pte;
+        *pte_back(pte) = (uint)rmore[frame];
+    }
+    rmap[frame] = rmap[frame] + ONE;
+    return ZERO;
+}
+
+// Caller holds the frame's stripe.  Returns the mappings left.
+// The last entry fills the hole, so entries do not keep their
+// order.
+int rmap_del(uint frame, pte_t* pte){
+    int n = rmap[frame];
+    struct rnode* node = (struct rnode*)*pte_back(pte);
+    pte_t** slot = ZERO;
+    if(node == ZERO){
+        if(n > ZERO && rfirst[frame] == pte){
+            slot = &rfirst[frame];
+        }
+    }
+    else{
+        int i = ZERO;
+        while(i < RNODEPTES){
+            if(node->pte[i] == pte){
+                slot = &node->pte[i];
+                break;
+            }
+            i = i + ONE;
+        }
+    }
+    if(slot == ZERO){
+        panic("Reverse map not found in dec rmap\n");
+    }
+    if(n == ONE){
+        rfirst[frame] = ZERO;
+    }
+    else{
+        struct rnode* head = rmore[frame];
+        int k = rnode_fill(n);
+        pte_t** last = &head->pte[k - ONE];
+        if(last != slot){
+            *slot = *last;
+            *pte_back(*slot) = (uint)node;
+        }
+        *last = ZERO;
+        if(k == ONE){
+            rmore[frame] = head->next;
+            rnode_free(head);
+        }
+    }
+    rmap[frame] = n - ONE;
+    return n - ONE;
+}
+
+// Forget every PTE mapping frame.  Caller holds its stripe.
+void rmap_clear(uint frame){
+    while(rmore[frame] != ZERO){
+        struct rnode* n = rmore[frame];
+        rmore[frame] = n->next;
+        rnode_free(n);
+    }
+    rfirst[frame] = ZERO;
+    rmap[frame] = ZERO;
+}
 
+// Returns -1 if there was no chain node for pte, which cannot
+// happen for a frame just allocated.
+int inc_rmap(pte_t* pte){
+    uint frame = PTE_ADDR(*pte) >> IRON_DOME;
+    acquire(rmap_lock(frame));
+    int r = rmap_add(frame, pte, ZERO);
+    release(rmap_lock(frame));
+    return r;
+}
 
-void inc_rmap(pte_t* pte){
-    uint pa = PTE_ADDR(*pte);
-    int refC = rmap[pa >> IRON_DOME];
-    reverse_map[pa >> IRON_DOME][refC] = pte;
-    // reverse_map_pid[pa >> IRON_DOME][refC] = pid;
-    rmap[pa >> IRON_DOME] = rmap[pa >> IRON_DOME] + ONE;
+// Take pte out of the reverse map of the frame it maps.  Returns
+// how many mappings the frame has left, or -1 if pte no longer
+// maps a present page: kswapd swapped it out or reclaimed it
+// before the stripe was taken.
+int dec_rmap(pte_t* pte){
+    for(;;){
+        pte_t old = *pte;
+        if(!(old & PTE_P)){
+            return -ONE;
+        }
+        uint frame = PTE_ADDR(old) >> IRON_DOME;
+        acquire(rmap_lock(frame));
+        if((*pte & PTE_P) && PTE_ADDR(*pte) == PTE_ADDR(old)){
+            int left = rmap_del(frame, pte);
+            release(rmap_lock(frame));
+            return left;
+        }
+        release(rmap_lock(frame));
+    }
 }
 
-void dec_rmap(pte_t* pte){
-    uint phy = PTE_ADDR(*pte);
+// fork(): map src's frame at dst as well, read-only in both so
+// that a write copies it.  Returns 0, -1 if src no longer maps
+// a present page because kswapd evicted it meanwhile, or -2 if
+// there was no chain node for dst.
+int share_rmap(pte_t* src, pte_t* dst){
+    pte_t old = *src;
+    if(!(old & PTE_P)){
+        return -ONE;
+    }
+    uint frame = PTE_ADDR(old) >> IRON_DOME;
+    acquire(rmap_lock(frame));
+    if(!(*src & PTE_P) || PTE_ADDR(*src) != PTE_ADDR(old)){
+        release(rmap_lock(frame));
+        return -ONE;
+    }
+    if(rmap_add(frame, dst, ZERO) < ZERO){
+        release(rmap_lock(frame));
+        return -2;
+    }
+    *src &= (~PTE_W);
+    *dst = *src;
+    release(rmap_lock(frame));
+    return ZERO;
+}
+
+// Owning process of every page-table page and page directory,
+// so that a PTE pointer taken from the reverse map leads straight
+// to the process whose RSS it counts towards.
+struct proc** ptowner;
+
+void set_pt_owner(void* pt, struct proc* p){
+    ptowner[V2P(pt) >> IRON_DOME] = p;
+}
+
+struct proc* pt_owner(void* pt){
+    return ptowner[V2P(pt) >> IRON_DOME];
+}
+
+// Page tables fork() left shared (see copyuvm() in vm.c): how
+// many page directories beyond the first point at each.  While a
+// table is shared its owner is PT_SHARED, and the pages present
+// in it are counted in res, not in any p->rss: every process
+// pointing at the table has them resident, and proc_rss() adds
+// them in.  When a table stops being shared, pt_claim() moves
+// them to its new owner's RSS.
+struct {
+    struct spinlock lock;
+    ushort* refs;
+    ushort* res;    // present pages in each shared table
+} ptshare;
+
+// Pages present in the page table pt that count towards RSS.
+int pt_present(pte_t* pt){
+    int n = ZERO;
     int i = ZERO;
-    int rC = rmap[phy >> IRON_DOME];
-    while(i< rC){
-        if(reverse_map[phy >> IRON_DOME][i] == pte){
-            break;
+    while(i < NPTENTRIES){
+        if((pt[i] & PTE_P) && !is_zeropage(PTE_ADDR(pt[i]))){
+            n = n + ONE;
         }
         i = i + ONE;
     }
-    if(i == rC){
-        panic("Reverse map not found in dec rmap\n");
+    return n;
+}
+
+// The caller's page directory and another now point at pt.  The
+// first time, its pages move from the owner's RSS to res.  A table
+// whose other sharers have all gone but that no one has claimed
+// yet is still counted there.
+void pt_share(void* pt){
+    acquire(&ptshare.lock);
+    ptshare.refs[V2P(pt) >> IRON_DOME] = ptshare.refs[V2P(pt) >> IRON_DOME] + ONE;
+    release(&ptshare.lock);
+    struct proc* p = pt_owner(pt);
+    if(p == PT_SHARED){
+        return;
     }
-    rmap[phy >> IRON_DOME] = rmap[phy >> IRON_DOME] - ONE;
-    while(i < rC-ONE){
-        reverse_map[phy >> IRON_DOME][i] = reverse_map[phy >> IRON_DOME][i+ONE];
+    set_pt_owner(pt, PT_SHARED);
+    __sync_synchronize();
+    int n = pt_present(pt);
+    __sync_fetch_and_add(&ptshare.res[V2P(pt) >> IRON_DOME], n);
+    if(p != ZERO){
+        p->rss -= n * PGSIZE;
+    }
+}
+
+// pt is no longer shared: make it p's, and move the pages present
+// in it to p's RSS.  p is 0 for a table about to be freed.
+void pt_claim(void* pt, struct proc* p){
+    set_pt_owner(pt, p);
+    __sync_synchronize();
+    uint n = __sync_lock_test_and_set(&ptshare.res[V2P(pt) >> IRON_DOME], ZERO);
+    if(p != ZERO){
+        p->rss += n * PGSIZE;
+    }
+}
+
+// p's resident size: its own pages and those of the shared
+// tables its page directory points at.
+uint proc_rss(struct proc* p){
+    uint rss = p->rss;
+    if(p->pgdir == ZERO){
+        return rss;
+    }
+    uint i = ZERO;
+    while(i < PDX(KERNBASE)){
+        if(p->pgdir[i] & PTE_P){
+            pte_t* pt = (pte_t*)P2V(PTE_ADDR(p->pgdir[i]));
+            if(pt_owner(pt) == PT_SHARED){
+                rss = rss + ptshare.res[V2P(pt) >> IRON_DOME] * PGSIZE;
+            }
+        }
+        i = i + ONE;
+    }
+    return rss;
+}
+
+int pt_shared(void* pt){
+    acquire(&ptshare.lock);
+    int shared = ptshare.refs[V2P(pt) >> IRON_DOME] != ZERO;
+    release(&ptshare.lock);
+    return shared;
+}
+
+// Let go of one reference to pt.  Returns 1 if other page
+// directories still point at it, or 0 if the caller's was the
+// last, and the table is the caller's to keep or free.
+int pt_unshare(void* pt){
+    int shared = ZERO;
+    acquire(&ptshare.lock);
+    if(ptshare.refs[V2P(pt) >> IRON_DOME] != ZERO){
+        ptshare.refs[V2P(pt) >> IRON_DOME] = ptshare.refs[V2P(pt) >> IRON_DOME] - ONE;
+        shared = ONE;
+    }
+    release(&ptshare.lock);
+    return shared;
+}
+
+// Adjust the RSS of every process mapping the frame, in
+// O(sharers), or the count of a shared table mapping it.  Caller
+// holds the frame's stripe.
+void rss_adjust(uint frame, int delta){
+    int i = ZERO;
+    int rC = rmap[frame];
+    struct proc* p;
+    while(i < rC){
+        pte_t* pte = rmap_pte(frame, i);
+        p = pt_owner(pte);
+        if(p == PT_SHARED){
+            __sync_fetch_and_add(&ptshare.res[V2P(PGROUNDDOWN((uint)pte)) >> IRON_DOME],
+                                 delta / PGSIZE);
+        }
+        else if(p != ZERO){
+            p->rss += delta;
+        }
         i = i + ONE;
     }
 }
@@ -63,68 +515,401 @@ void set_rmap(uint pa){
     rmap[pa >> IRON_DOME] = ZERO;
 }
 
-struct s1 swap_table[SWAPSIZE/(PGSIZE/BSIZE)];
+struct s1 swap_table[NSLOTS];
+
+// Swap slot state: the free bitmap, the PTE lists in swap_table
+// and the swap cache.  A spinlock, because flush() and kfree()
+// get here from wait() with ptable.lock held; so never sleep or
+// call wakeup() holding it.
+//
+// map has one bit per slot, set when the slot is free, so that a
+// free slot is found a word at a time with bsf rather than by
+// walking swap_table.  Bits past NSLOTS stay clear.
+//
+// The swap cache remembers, for a frame read in from swap, the
+// slot it came from (plus one).  The slot stays allocated, so if
+// the page is evicted again before anyone dirties it, its PTEs
+// can go back to the slot without a disk write.
+struct {
+    struct spinlock lock;
+    uint map[SWAPWORDS];
+    uint nfree;
+    int* cache;
+    uint ncached;
+    uint cleandrops;
+    uint readwaits;
+} swapmap;
+
+// Swap readahead.  ahead[] marks frames read in ahead of a fault
+// until CLOCK first reaches them: a hit if they were touched by
+// then, a miss if not.
+struct {
+    int window;
+    uint pages;
+    uint hits;
+    uint misses;
+    uchar* ahead;
+} swapra;
+
+// Swap-out clustering: how many pages one eviction may write,
+// and how often it wrote more than one.
+struct {
+    int size;
+    uint clusters;
+    uint pages;
+} swapcl;
+
+// The shared zero page.  Fresh heap pages map it read-only, with
+// no reverse map entry and no RSS charge, until the first write
+// gives them a page of their own in case_cow().  Same-filled pages
+// going to swap are recorded in their slot instead of written.
+char* zeropage;
+
+// Counters bumped from fault paths on any CPU with no lock in
+// common are kept per CPU, indexed by cpuid(), so that no update
+// is lost; swapstat() adds them up.
+void percpu_add(uint* c, int n){
+    pushcli();
+    c[cpuid()] = c[cpuid()] + n;
+    popcli();
+}
+
+uint percpu_sum(uint* c){
+    uint sum = ZERO;
+    int i = ZERO;
+    while(i < NCPU){
+        sum = sum + c[i];
+        i = i + ONE;
+    }
+    return sum;
+}
+
+struct {
+    uint mapped[NCPU];     // PTEs mapping the zero page now
+    uint cows[NCPU];       // writes that gave one a page of its own
+    uint fillouts[NCPU];   // same-filled pages swapped out without I/O
+    uint fillins[NCPU];    // and swapped back in
+    uint lazyzero[NCPU];   // first touches that were reads
+    uint lazyalloc[NCPU];  // first touches that were writes
+} zerocnt;
 
+// Pages of program text and data that exec() left in the file.
+struct {
+    uint pages[NCPU];      // read in by a fault
+    uint bytes[NCPU];      // of file data read for them
+    uint shared[NCPU];     // faults that mapped a page-cache frame
+    uint reclaims[NCPU];   // mapped page-cache frames unmapped and freed
+} filecnt;
 
-void inc_swap_table(pte_t* pte1 , pte_t* pte , int rand){
+int is_zeropage(uint pa){
+    return zeropage != ZERO && pa == V2P(zeropage);
+}
+
+uint zeropage_pa(void){
+    return V2P(zeropage);
+}
+
+void zeropage_ref(int n){
+    percpu_add(zerocnt.mapped, n);
+}
+
+// Sharers faulting on a slot another sharer is reading in sleep
+// on the slot under this lock, never taken inside swapmap.lock.
+struct spinlock swapwait;
+
+// Allocate n consecutive swap slots, so that a cluster of pages
+// can go out in one disk request.  Returns the first slot, or -1
+// if no run that long is free.  Caller holds swapmap.lock.
+int swap_alloc(int n){
+    int w = ZERO;
+    int slot = ZERO;
+    int run = ZERO;
+    if(n == ONE){
+        while(w < SWAPWORDS){
+            if(swapmap.map[w] != ZERO){
+                slot = w * 32 + bsfl(swapmap.map[w]);
+                swapmap.map[w] &= ~SLOTBIT(slot);
+                swapmap.nfree = swapmap.nfree - ONE;
+                return slot;
+            }
+            w = w + ONE;
+        }
+        return -ONE;
+    }
+    while(slot < NSLOTS){
+        if(swapmap.map[slot / 32] == ZERO){
+            // Nothing free in this word: skip it.
+            run = ZERO;
+            slot = (slot / 32 + ONE) * 32;
+            continue;
+        }
+        if(swapmap.map[slot / 32] & SLOTBIT(slot)){
+            run = run + ONE;
+            if(run == n){
+                slot = slot - n + ONE;
+                w = ZERO;
+                while(w < n){
+                    swapmap.map[(slot + w) / 32] &= ~SLOTBIT(slot + w);
+                    w = w + ONE;
+                }
+                swapmap.nfree = swapmap.nfree - n;
+                return slot;
+            }
+        }
+        else{
+            run = ZERO;
+        }
+        slot = slot + ONE;
+    }
+    return -ONE;
+}
+
+void swap_free(int slot){
+    if(slot < ZERO || slot >= NSLOTS || (swapmap.map[slot / 32] & SLOTBIT(slot))){
+        panic("swap_free");
+    }
+    swapmap.map[slot / 32] |= SLOTBIT(slot);
+    swapmap.nfree = swapmap.nfree + ONE;
+    swap_table[slot].filled = ZERO;
+    zswap_drop(slot);
+}
+
+// Take a slot away from some frame in the swap cache, for when
+// every slot is in use.  The frame stays in memory; it will just
+// have to be written out again.  Caller holds swapmap.lock.
+int swapcache_steal(){
+    int i = ZERO;
+    int slot;
+    while(i < (phystop >> IRON_DOME)){
+        if(swapmap.cache[i] != ZERO){
+            slot = swapmap.cache[i] - ONE;
+            swapmap.cache[i] = ZERO;
+            swapmap.ncached = swapmap.ncached - ONE;
+            return slot;
+        }
+        i = i + ONE;
+    }
+    return -ONE;
+}
+
+// Called by kfree(): a frame leaving memory gives up its slot.
+void swapcache_drop(uint pa){
+    swapra.ahead[pa >> IRON_DOME] = ZERO;
+    if(swapmap.cache[pa >> IRON_DOME] == ZERO){
+        return;
+    }
+    acquire(&swapmap.lock);
+    if(swapmap.cache[pa >> IRON_DOME] != ZERO){
+        swap_free(swapmap.cache[pa >> IRON_DOME] - ONE);
+        swapmap.cache[pa >> IRON_DOME] = ZERO;
+        swapmap.ncached = swapmap.ncached - ONE;
+    }
+    release(&swapmap.lock);
+}
+
+struct {
+    uint swapouts;
+    uint swapins;
+} swapcnt;
+
+struct {
+    uint scanned;
+    uint cleared;
+    uint pgfaults[NCPU];   // per CPU, as zerocnt
+} clockcnt;
+
+// Only one swap-out or swap-in updates the swap table and the
+// reverse map at a time; the holder may sleep on the disk.
+struct sleeplock swaplock;
+
+// Background page-out.  kswapd sleeps until kalloc() sees the
+// free page count drop below lowwm, then swaps pages out until
+// highwm pages are free, so that allocations rarely have to
+// wait for a disk write themselves.  A pass that finds nothing
+// to evict leaves it stuck: it then sleeps until the next
+// kswapd_wake() instead of sweeping again at once.
+struct {
+    struct spinlock lock;
+    uint lowwm;
+    uint highwm;
+    int active;
+    int stuck;
+    uint wakeups;
+    uint outs;
+    uint direct;
+    uint oom;
+} kswapd;
+
+void swapstat(struct vmstat* st){
+    st->swapouts = swapcnt.swapouts;
+    st->swapins = swapcnt.swapins;
+    st->lowwm = kswapd.lowwm;
+    st->highwm = kswapd.highwm;
+    st->kswapdwakeups = kswapd.wakeups;
+    st->kswapdouts = kswapd.outs;
+    st->directouts = kswapd.direct;
+    st->pgfaults = percpu_sum(clockcnt.pgfaults);
+    st->clockscanned = clockcnt.scanned;
+    st->clockcleared = clockcnt.cleared;
+    st->swapslots = NSLOTS;
+    st->swapfree = swapmap.nfree;
+    st->swapcached = swapmap.ncached;
+    st->swapcleandrops = swapmap.cleandrops;
+    st->swapreadwaits = swapmap.readwaits;
+    st->rawindow = swapra.window;
+    st->rapages = swapra.pages;
+    st->rahits = swapra.hits;
+    st->ramisses = swapra.misses;
+    st->clustersize = swapcl.size;
+    st->clusters = swapcl.clusters;
+    st->clusterpages = swapcl.pages;
+    zswapstat(st);
+    st->zeromapped = percpu_sum(zerocnt.mapped);
+    st->zerocows = percpu_sum(zerocnt.cows);
+    st->fillouts = percpu_sum(zerocnt.fillouts);
+    st->fillins = percpu_sum(zerocnt.fillins);
+    st->lazyzero = percpu_sum(zerocnt.lazyzero);
+    st->lazyalloc = percpu_sum(zerocnt.lazyalloc);
+    st->oomfails = kswapd.oom;
+    st->filepages = percpu_sum(filecnt.pages);
+    st->filebytes = percpu_sum(filecnt.bytes);
+    st->fileshared = percpu_sum(filecnt.shared);
+    st->filereclaims = percpu_sum(filecnt.reclaims);
+    pcachestat(st);
+    ptsharestat(st);
+    tlbstat(st);
+    st->rmapnodes = rnodes.used;
+    st->rmapkb = ((sizeof(rmap[ZERO]) + sizeof(rfirst[ZERO]) + sizeof(rmore[ZERO]) +
+                   sizeof(ptshadow[ZERO]) + sizeof(ptpdx[ZERO])) * (phystop >> IRON_DOME) +
+                  rnodes.blocks * (PGSIZE << RNODEORDER) + nptshadow * PGSIZE) / 1024;
+}
+
+
+// fork(): add the child's copy pte of the swapped PTE pte1 to its
+// slot.  Returns 0, or -1 if pte1 was swapped back in meanwhile.
+int inc_swap_table(pte_t* pte1 , pte_t* pte , int rand){
     // push this pte in the swap table
     if(rand == ONE){
         panic(" NEVER TO REACH HERE ONLY FOR DEBUGGING \n");
     }
+    acquire(&swapmap.lock);
+    if(!(*pte1 & PTE_SWAPPED) || (*pte1 & PTE_P)){
+        release(&swapmap.lock);
+        return -ONE;
+    }
     uint block_no = reducer(*pte1 >> IRON_DOME);
+    if(swap_table[block_no].refC == SWAPSHARERS){
+        panic("inc_swap_table: too many sharers");
+    }
     swap_table[block_no].pte_array[swap_table[block_no].refC] = pte;
+    *pte_back(pte) = swap_table[block_no].refC;
     swap_table[block_no].refC = swap_table[block_no].refC + ONE;
+    release(&swapmap.lock);
+    return ZERO;
 }
 
 
 void pageswapinit(void){
     int i = ZERO;
-    int limit = SWAPSIZE/(PGSIZE/BSIZE);
-    while(i < limit){
-        swap_table[i].attribute_1 = ONE;
+    while(i < NSLOTS){
+        swapmap.map[i / 32] |= SLOTBIT(i);
         swap_table[i].attribute_2 = 2 + i*(PGSIZE/BSIZE);
         swap_table[i].refC = ZERO;
         // INITIALIZING THE PTE ARRAY
         int j = ZERO;
-        while(j < 64){
+        while(j < SWAPSHARERS){
             swap_table[i].pte_array[j] = ZERO;
             j = j + ONE;
         }
         i = i + ONE;
     }
+    swapmap.nfree = NSLOTS;
     // cprintf("Swap table initialized\n");
 }
 
-void swapout_helper(uint pa, int block){
-    int rC = rmap[pa >> IRON_DOME];
+// Turn every PTE mapping pa into a swapped entry for block, and
+// take the frame's sharers' RSS down with it.  The PTEs go into
+// tb, to be flushed before the page is written or freed.
+// Returns how many PTEs that was: 0 if the last sharer unmapped
+// the page since CLOCK picked it, and it is no longer ours to
+// write or free.
+// Unmap the page at pa from every sharer, pointing their PTEs at
+// block.  Sets *dirty if any sharer had written the page.  The PTE
+// is swapped atomically, so a write through a TLB entry on another
+// CPU either sets PTE_D in time to be seen or faults afterwards.
+// Returns how many PTEs mapped it.
+int swapout_helper(uint pa, int block, struct tlbbatch* tb, int* dirty){
+    uint frame = pa >> IRON_DOME;
+    acquire(rmap_lock(frame));
+    int rC = rmap[frame];
+    rss_adjust(frame, -PGSIZE);
     swap_table[block].refC = rC;
     int block_num = swap_table[block].attribute_2;
     int i = ZERO;
     while( i < rC){
-        swap_table[block].pte_array[i] = reverse_map[pa >> IRON_DOME][i];
-        uint flags = PTE_FLAGS(*reverse_map[pa >> IRON_DOME][i]);
-        *reverse_map[pa >> IRON_DOME][i] = (block_num << IRON_DOME);
-        *reverse_map[pa >> IRON_DOME][i] |= flags;
-        *reverse_map[pa >> IRON_DOME][i] |= PTE_SWAPPED;
-        *reverse_map[pa >> IRON_DOME][i] &= (~PTE_P);
+        pte_t* pte = rmap_pte(frame, i);
+        swap_table[block].pte_array[i] = pte;
+        *pte_back(pte) = i;
+        uint flags = PTE_FLAGS(*pte) & ~(PTE_P | PTE_D);
+        if(xchg(pte, (block_num << IRON_DOME) | flags | PTE_SWAPPED) & PTE_D){
+            *dirty = ONE;
+        }
+        tlb_add(tb, pte);
         i = i + ONE;
     }
-    rmap[pa >> IRON_DOME] = ZERO;
+    rmap_clear(frame);
+    release(rmap_lock(frame));
+    return rC;
 }
 
-void swapin_helper(uint pa, int block){
+// Point block's swapped PTEs at the page now holding it at pa.
+// With ahead, the page was only read ahead: leave PTE_A clear so
+// that CLOCK can tell whether anyone touches it.  The PTEs were
+// not present, so no TLB holds them.  The caller topped up the
+// chain node reserve, which covers every sharer.
+void swapin_helper(uint pa, int block, int ahead){
+    uint frame = pa >> IRON_DOME;
+    acquire(rmap_lock(frame));
     int rC = swap_table[block].refC;
-    rmap[pa >> IRON_DOME] = rC;
     int i = ZERO;
     while(i < rC){
-        reverse_map[pa >> IRON_DOME][i] = swap_table[block].pte_array[i];
+        if(rmap_add(frame, swap_table[block].pte_array[i], ONE) < ZERO){
+            panic("swapin_helper: rmap reserve");
+        }
         uint flags = PTE_FLAGS(*swap_table[block].pte_array[i]);
         *swap_table[block].pte_array[i] = pa;
         *swap_table[block].pte_array[i] |= flags;
         *swap_table[block].pte_array[i] |= PTE_P;
-        *swap_table[block].pte_array[i] &= (~PTE_SWAPPED);
+        *swap_table[block].pte_array[i] &= (~(PTE_SWAPPED | PTE_D));
+        if(ahead){
+            *swap_table[block].pte_array[i] &= (~PTE_A);
+        }
+        i = i + ONE;
+    }
+    swap_table[block].refC = ZERO;
+    rss_adjust(frame, PGSIZE);
+    release(rmap_lock(frame));
+}
+
+// Unmap a page-cache frame from every process mapping it.  Its
+// pages are in the file, so the next touch just faults them in
+// again through case_file().  The PTEs go into tb, to be flushed
+// before the frame is freed.  Called by pcache_reclaim(), with
+// pcache.lock held.  Returns how many PTEs mapped it.
+int file_unmap(uint pa, struct tlbbatch* tb){
+    uint frame = pa >> IRON_DOME;
+    acquire(rmap_lock(frame));
+    int i = ZERO;
+    int rC = rmap[frame];
+    rss_adjust(frame, -PGSIZE);
+    while(i < rC){
+        *rmap_pte(frame, i) = ZERO;
+        tlb_add(tb, rmap_pte(frame, i));
         i = i + ONE;
     }
+    rmap_clear(frame);
+    release(rmap_lock(frame));
+    return rC;
 }
 
 static pte_t*
@@ -139,8 +924,14 @@ walkpgdir(pde_t *pgdir, const void *va, int alloc)
   } else {
     if(!alloc || (pgtab = (pte_t*)kalloc()) == ZERO)
       return ZERO;
+    if(pt_shadow_alloc(pgtab, (uint)va) < ZERO){
+      kfree((char*)pgtab);
+      return ZERO;
+    }
     // Make sure all those PTE_P bits are zero.
     memset(pgtab, ZERO, PGSIZE);
+    // The page table belongs to whoever owns the directory.
+    set_pt_owner(pgtab, pt_owner(pgdir));
     // The permissions here are overly generous, but they can
     // be further restricted by the permissions in the page table
     // entries, if necessary.
@@ -149,129 +940,926 @@ walkpgdir(pde_t *pgdir, const void *va, int alloc)
   return &pgtab[PTX(va)];
 }
 
-void swap_page_out(){
-    pte_t* SQUIRTLE = page_replacement();
-    // Need to decrease RSS for all the processes using this page
-    rss_decrementer(PTE_ADDR(*SQUIRTLE));
-    // cprintf("Swap out page %x\n", PTE_ADDR(*pte));
-    // Now swap out the page pointed by pte
+// CLOCK (second chance) replacement over physical frames.
+// The hand sweeps the frames in order.  A frame whose user PTEs
+// all have PTE_A clear is the victim; otherwise PTE_A is cleared
+// in every sharer and the hand moves on.  Two full turns find a
+// victim if there is any, and the hand stays where it stopped so
+// the next call carries on from there.
+// Frames mapped from a page table without an owner are skipped:
+// exec() and fork() are still filling those page tables in.
+uint clock_hand;
+
+// Returns -1 if the frame may not be swapped out, else whether
+// any of its user PTEs has PTE_A set.  Caller holds its stripe.
+int frame_referenced(uint frame){
     int i = ZERO;
-    int limit = SWAPSIZE/(PGSIZE/BSIZE);
-    while( i < limit){
-        if(swap_table[i].attribute_1 == ONE){
-            break;
+    int rC = rmap[frame];
+    int referenced = ZERO;
+    // Only as many sharers as a swap slot can list.
+    if(rC == ZERO || rC > SWAPSHARERS){
+        return -ONE;
+    }
+    while(i < rC){
+        pte_t* pte = rmap_pte(frame, i);
+        if(!(*pte & PTE_P) || !(*pte & PTE_U) || pt_owner(pte) == ZERO){
+            return -ONE;
+        }
+        if(*pte & PTE_A){
+            referenced = ONE;
         }
         i = i + ONE;
     }
-    if(i == (SWAPSIZE/(PGSIZE/BSIZE))){
-        panic("Swap space full\n");
+    return referenced;
+}
+
+// Returns the victim frame, or -1 if there is none.
+int page_replacement(){
+    uint limit = phystop >> IRON_DOME;
+    uint n = ZERO;
+    while(n < 2 * limit){
+        uint frame = clock_hand;
+        clock_hand = (clock_hand + ONE) % limit;
+        n = n + ONE;
+        if(rmap[frame] == ZERO){
+            continue;
+        }
+        clockcnt.scanned = clockcnt.scanned + ONE;
+        acquire(rmap_lock(frame));
+        int rC = rmap[frame];
+        int referenced = frame_referenced(frame);
+        if(referenced < ZERO){
+            release(rmap_lock(frame));
+            continue;
+        }
+        if(swapra.ahead[frame]){
+            if(referenced){
+                swapra.hits = swapra.hits + ONE;
+            }
+            else{
+                swapra.misses = swapra.misses + ONE;
+            }
+            swapra.ahead[frame] = ZERO;
+        }
+        if(!referenced){
+            release(rmap_lock(frame));
+            return frame;
+        }
+        int i = ZERO;
+        while(i < rC){
+            *rmap_pte(frame, i) &= (~PTE_A);
+            i = i + ONE;
+        }
+        release(rmap_lock(frame));
+        clockcnt.cleared = clockcnt.cleared + ONE;
     }
-    swap_table[i].attribute_1 = ZERO;
-    // swap_table[i].page_perm = PTE_FLAGS(*pte);
-    uint phys_addr = PTE_ADDR(*SQUIRTLE);
-    page_disk_interface((char*)P2V(PTE_ADDR(*SQUIRTLE)), swap_table[i].attribute_2,ZERO);
-    swapout_helper(phys_addr, i);
-    kfree((char*)P2V(phys_addr));
-    // cprintf("Page %x swapped out to block %d\n", (pte), swap_table[i].attribute_2);
+    return -ONE;
 }
 
-void flush(pte_t* page){
-    int block_num = *page >> IRON_DOME;
-    int swap_block = reducer(block_num);
-    // Iterate and find the page in the swap table
+// Record the owner of a finished page directory and of all its
+// user page tables, making its pages eligible for swap-out.
+void set_pgdir_owner(pde_t* pgdir, struct proc* p){
     int i = ZERO;
-    int limit = swap_table[swap_block].refC;
-    while(i < limit){
-        if(swap_table[swap_block].pte_array[i] == page){
-            swap_table[swap_block].pte_array[i] = ZERO;
-            break;
+    set_pt_owner(pgdir, p);
+    while(i < PDX(KERNBASE)){
+        if(pgdir[i] & PTE_P){
+            set_pt_owner(P2V(PTE_ADDR(pgdir[i])), p);
         }
         i = i + ONE;
     }
-    if(i == swap_table[swap_block].refC){
-        panic("Page not found in swap table\n");
+}
+
+// Put page, swapped out to slot, in the compressed pool, writing
+// back the oldest pages there to disk if it is full.  Called with
+// swaplock held.  Returns 0, or -1 if the page must go to disk.
+int swap_to_zswap(int slot, char* page){
+    char* old;
+    int r;
+    for(;;){
+        acquire(&swapmap.lock);
+        if(swapmap.map[slot / 32] & SLOTBIT(slot)){
+            // Its sharers all exited meanwhile.
+            release(&swapmap.lock);
+            return ZERO;
+        }
+        r = zswap_store(slot, page);
+        if(r != -2){
+            release(&swapmap.lock);
+            return r;
+        }
+        r = zswap_evict(&old);
+        release(&swapmap.lock);
+        if(r < ZERO){
+            return -ONE;
+        }
+        page_disk_interface(old, swap_table[r].attribute_2, ZERO);
     }
-    // shift the remaining pages back
-    swap_table[swap_block].refC = swap_table[swap_block].refC - ONE;
-    limit = swap_table[swap_block].refC;
-    while( i < limit){
-        swap_table[swap_block].pte_array[i] = swap_table[swap_block].pte_array[i+ONE];
-        i = i + ONE;
+}
+
+// Store page, swapped out to slot, anywhere but the disk: as a
+// fill value if every word of it is the same, or else in the
+// compressed pool.  Called with swaplock held.  Returns 0, or -1
+// if the page must go to disk.  Every dirty page goes through here
+// before the pool or the disk, so this is where a swap-cache slot
+// being rewritten forgets an old fill value.
+int swap_store(int slot, char* page){
+    uint* w = (uint*)page;
+    int k = ONE;
+    acquire(&swapmap.lock);
+    swap_table[slot].filled = ZERO;
+    release(&swapmap.lock);
+    while(k < PGSIZE / 4 && w[k] == w[ZERO]){
+        k = k + ONE;
     }
-    if(swap_table[swap_block].refC == ZERO){
-        swap_table[swap_block].attribute_1 = ONE;
+    if(k < PGSIZE / 4){
+        return swap_to_zswap(slot, page);
     }
-    
+    acquire(&swapmap.lock);
+    // Unless its sharers all exited meanwhile.
+    if(!(swapmap.map[slot / 32] & SLOTBIT(slot))){
+        swap_table[slot].filled = ONE;
+        swap_table[slot].fillval = w[ZERO];
+        percpu_add(zerocnt.fillouts, ONE);
+    }
+    release(&swapmap.lock);
+    return ZERO;
 }
-void case_swap(uint va, struct proc* p, pte_t* pte){
-    // cprintf(" SWAP IN \n");
-    // uint va = rcr2();
-    // pde_t *pgdir = myproc_pg()->pgdir;
-    // pte_t *pte = walkpgdir(pgdir, (void*)va, 0);
-    int block_num = *pte >> IRON_DOME;
-    // cprintf("pagefault_handler: loading page from disk\n");
-    // myproc_pg()->rss++;
-    // char *page = kalloc();
-    // if(page == 0){
-    //     swap_page_out();
-    // }
-    // page = kalloc();
-    char* flareon = kalloc();
-    page_disk_interface(flareon, block_num,ONE);
 
+// Might the page k entries after the victim's PTE go out with
+// it?  It must be in the same page table and present; called with
+// the victim's stripe held, which keeps that page table alive, so
+// this only looks at the PTE.  cluster_cold() decides.
+int cluster_ok(pte_t* pte, int k){
+    pte_t* q = pte + k;
+    if(PGROUNDDOWN((uint)q) != PGROUNDDOWN((uint)pte)){
+        return ZERO;
+    }
+    return (*q & PTE_P) && (*q & PTE_U);
+}
 
+// Can frame go out in the victim's cluster?  It must be cold, and
+// in neither the swap cache, which already gives it a slot of its
+// own, nor the page cache.  Caller holds swapmap.lock.
+int cluster_cold(uint frame){
+    if(swapmap.cache[frame] != ZERO || pcache_has(frame << IRON_DOME)){
+        return ZERO;
+    }
+    acquire(rmap_lock(frame));
+    int cold = frame_referenced(frame) == ZERO;
+    release(rmap_lock(frame));
+    return cold;
+}
 
-    // cprintf("pagefault_handler: page loaded\n");
-    // // update the page table entry
+// Swap out the page CLOCK picks, together with up to
+// swapcl.size - 1 cold pages that follow it in its page table,
+// into consecutive slots with one disk write, so that they can
+// be read back with one request too.  A page still in the swap
+// cache goes back to its old slot, and is written only if dirty.
+// Returns the number of pages freed, or -1 if no page can be
+// evicted or swap is full.
+int swap_page_out(){
+    char* pg[SWAP_RAMAX];
+    uint fr[SWAP_RAMAX];
+    int mapped[SWAP_RAMAX];
+    struct tlbbatch tb;
+    int victim;
+    int n = ZERO;
+    int k;
+    memset(&tb, ZERO, sizeof(tb));
+    acquiresleep(&swaplock);
+    while(n == ZERO){
+        if((victim = page_replacement()) < ZERO){
+            releasesleep(&swaplock);
+            return -ONE;
+        }
+        if(pcache_has(victim << IRON_DOME)){
+            // Clean program text or data: nothing to write.  If a
+            // write to the file dropped it from the cache since,
+            // its last mapping frees it; look for another victim.
+            if(!pcache_reclaim(victim << IRON_DOME, &tb)){
+                continue;
+            }
+            tlb_flush(&tb);
+            kfree(P2V(victim << IRON_DOME));
+            percpu_add(filecnt.reclaims, ONE);
+            releasesleep(&swaplock);
+            return ONE;
+        }
+        // Gather the cluster while the victim's stripe keeps its
+        // page table from being freed, unless the last sharer let
+        // go of the victim since CLOCK looked at it.
+        acquire(rmap_lock(victim));
+        if(rmap[victim] != ZERO){
+            pte_t* SQUIRTLE = rmap_pte(victim, ZERO);
+            fr[ZERO] = victim;
+            n = ONE;
+            while(swapmap.cache[victim] == ZERO && n < swapcl.size && cluster_ok(SQUIRTLE, n)){
+                fr[n] = PTE_ADDR(SQUIRTLE[n]) >> IRON_DOME;
+                n = n + ONE;
+            }
+        }
+        release(rmap_lock(victim));
+    }
+    // cprintf("Swap out page %x\n", PTE_ADDR(*pte));
+    // A page still in the swap cache need not be written again if
+    // no sharer has dirtied it, which only the PTEs can tell once
+    // they are cleared and flushed; a page going to a new slot
+    // must be written anyway.
+    int dirty = ZERO;
+    acquire(&swapmap.lock);
+    int i = swapmap.cache[victim] - ONE;
+    if(i >= ZERO){
+        n = ONE;
+        swapmap.cache[victim] = ZERO;
+        swapmap.ncached = swapmap.ncached - ONE;
+    }
+    else{
+        k = ONE;
+        while(k < n && cluster_cold(fr[k])){
+            k = k + ONE;
+        }
+        n = k;
+        // Settle for a shorter cluster if no run that long is free.
+        while((i = swap_alloc(n)) < ZERO && n > ONE){
+            n = n - ONE;
+        }
+        if(i < ZERO){
+            i = swapcache_steal();
+        }
+        dirty = ONE;
+    }
+    if(i < ZERO){
+        release(&swapmap.lock);
+        releasesleep(&swaplock);
+        return -ONE;
+    }
+    int freed = ZERO;
+    k = ZERO;
+    while(k < n){
+        pg[k] = (char*)P2V(fr[k] << IRON_DOME);
+        // Unmap the page from every sharer before writing it, so
+        // that a sharer touching it meanwhile waits in case_swap()
+        // for the write instead of changing the page underneath it,
+        // and an exiting sharer drops its swap table entry, not a
+        // stale PTE.
+        mapped[k] = swapout_helper(fr[k] << IRON_DOME, i + k, &tb, &dirty) > ZERO;
+        freed = freed + mapped[k];
+        k = k + ONE;
+    }
+    if(n > ONE){
+        swapcl.clusters = swapcl.clusters + ONE;
+        swapcl.pages = swapcl.pages + n;
+    }
+    release(&swapmap.lock);
+    // No CPU may write the pages through a stale TLB entry while
+    // they are copied out, or once they are freed.  After this,
+    // dirty is final.
+    tlb_flush(&tb);
+    if(dirty){
+        // Keep what we can off the disk; write the runs of pages
+        // that are left with one request each.  A page whose last
+        // sharer went away meanwhile is written with its run, but
+        // its slot is freed below.
+        k = ZERO;
+        while(k < n){
+            if(mapped[k] && swap_store(i + k, pg[k]) == ZERO){
+                k = k + ONE;
+                continue;
+            }
+            int j = k + ONE;
+            while(j < n && !(mapped[j] && swap_store(i + j, pg[j]) == ZERO)){
+                j = j + ONE;
+            }
+            page_disk_vec(pg + k, j - k, swap_table[i + k].attribute_2, ZERO);
+            k = j + ONE;
+        }
+    }
+    acquire(&swapmap.lock);
+    if(!dirty){
+        swapmap.cleandrops = swapmap.cleandrops + ONE;
+    }
+    k = ZERO;
+    while(k < n){
+        if(!mapped[k]){
+            swap_free(i + k);
+        }
+        k = k + ONE;
+    }
+    release(&swapmap.lock);
+    k = ZERO;
+    while(k < n){
+        if(mapped[k]){
+            kfree(pg[k]);
+        }
+        k = k + ONE;
+    }
+    swapcnt.swapouts = swapcnt.swapouts + freed;
+    releasesleep(&swaplock);
+    // cprintf("Page %x swapped out to block %d\n", (pte), swap_table[i].attribute_2);
+    return freed;
+}
+
+// Drop a swapped PTE from its slot's list.  Returns 0, or -1 if
+// another sharer swapped the page back in before swapmap.lock was
+// taken, so that page is now a present PTE.
+int flush(pte_t* page){
+    acquire(&swapmap.lock);
+    if(!(*page & PTE_SWAPPED) || (*page & PTE_P)){
+        release(&swapmap.lock);
+        return -ONE;
+    }
+    int block_num = *page >> IRON_DOME;
     int swap_block = reducer(block_num);
-    swapin_helper(V2P(flareon), swap_block);
+    // The back-pointer gives the page's place in the slot's list;
+    // the last entry moves into it.
+    int i = *pte_back(page);
+    int last = swap_table[swap_block].refC - ONE;
+    if(i > last || swap_table[swap_block].pte_array[i] != page){
+        panic("Page not found in swap table\n");
+    }
+    swap_table[swap_block].pte_array[i] = swap_table[swap_block].pte_array[last];
+    *pte_back(swap_table[swap_block].pte_array[i]) = i;
+    swap_table[swap_block].pte_array[last] = ZERO;
+    swap_table[swap_block].refC = last;
+    // A slot being read in is freed by the reader.
+    if(swap_table[swap_block].refC == ZERO && !swap_table[swap_block].busy){
+        swap_free(swap_block);
+    }
+    release(&swapmap.lock);
+    return ZERO;
+}
+
+// Can the page k entries after pte be read ahead along with the
+// page in slot?  It must be in the same page table and sit in
+// the k'th slot after it, so that one disk request covers both.
+int readahead_ok(pte_t* pte, int k, int slot){
+    pte_t* q = pte + k;
+    if(PGROUNDDOWN((uint)q) != PGROUNDDOWN((uint)pte)){
+        return ZERO;
+    }
+    if(!(*q & PTE_SWAPPED) || reducer(*q >> IRON_DOME) != slot + k){
+        return ZERO;
+    }
+    // A slot whose data sits in the compressed pool or in its
+    // fill value is not on disk.
+    return !swap_table[slot + k].busy && !zswap_has(slot + k) && !swap_table[slot + k].filled;
+}
 
-    // increment the rss for all the processes using this page
-    rss_incrementer(V2P(flareon));
+// Map a page just read from slot into its sharers.  Called with
+// swapmap.lock held; returns 0 if nobody maps it any more and the
+// caller should free the page.  A page read from disk or filled
+// from its slot's fill value keeps the slot in the swap cache; one
+// from the compressed pool no longer has a copy anywhere, so it
+// gives the slot up.
+int swapin_finish(char* page, int slot, int ahead, int keep){
+    swap_table[slot].busy = ZERO;
+    if(swap_table[slot].refC == ZERO){
+        // Every sharer unmapped the page during the read.
+        swap_free(slot);
+        return ZERO;
+    }
+    // // update the page table entry, and the sharers' RSS
+    swapin_helper(V2P(page), slot, ahead);
+    swapcnt.swapins = swapcnt.swapins + ONE;
+    if(!keep){
+        swap_free(slot);
+        return ONE;
+    }
+    // Keep the slot: the page is clean until someone writes it.
+    swapmap.cache[V2P(page) >> IRON_DOME] = slot + ONE;
+    swapmap.ncached = swapmap.ncached + ONE;
+    if(ahead){
+        // Not touched yet: let CLOCK tell whether it was worth it.
+        swapra.ahead[V2P(page) >> IRON_DOME] = ONE;
+        swapra.pages = swapra.pages + ONE;
+    }
+    return ONE;
+}
 
+// Returns 0, or -1 if no page could be found to read into or
+// there were no reverse-map nodes to map it with; the page then
+// stays in its slot.  Also reads ahead the following pages of the same page table
+// whose slots follow the faulting page's, up to swapra.window
+// pages in all, in the same disk request.
+int case_swap(uint va, struct proc* p, pte_t* pte){
+    // cprintf(" SWAP IN \n");
+    char* flareon[SWAP_RAMAX];
+    int n = ZERO;
+    int k;
+    int block_num = *pte >> IRON_DOME;
+    // cprintf("pagefault_handler: loading page from disk\n");
+    flareon[ZERO] = kalloc();
+    if(flareon[ZERO] == ZERO){
+        return -ONE;
+    }
+    // Pages for readahead, if the neighbours look worth it and
+    // memory is plentiful enough not to evict anything for them.
+    int want = ONE;
+    while(want < swapra.window && readahead_ok(pte, want, reducer(block_num))){
+        want = want + ONE;
+    }
+    n = ONE;
+    while(n < want && kfreehint() > kswapd.lowwm + want){
+        if((flareon[n] = kalloc()) == ZERO){
+            break;
+        }
+        n = n + ONE;
+    }
+    want = n;
 
-    // // free the swap slot
-    swap_table[swap_block].attribute_1 = ONE;
-    return;
+    acquiresleep(&swaplock);
+    if(!(*pte & PTE_SWAPPED)){
+        // Another sharer brought the page in while we waited.
+        releasesleep(&swaplock);
+        while(want > ZERO){
+            want = want - ONE;
+            kfree(flareon[want]);
+        }
+        return ZERO;
+    }
+    block_num = *pte >> IRON_DOME;
+    int swap_block = reducer(block_num);
+    acquire(&swapmap.lock);
+    if(swap_table[swap_block].busy){
+        // Another sharer is reading this slot in: wait for its
+        // read rather than issuing a second one, then retry.
+        swapmap.readwaits = swapmap.readwaits + ONE;
+        release(&swapmap.lock);
+        releasesleep(&swaplock);
+        acquire(&swapwait);
+        acquire(&swapmap.lock);
+        while(swap_table[swap_block].busy){
+            release(&swapmap.lock);
+            sleep(&swap_table[swap_block], &swapwait);
+            acquire(&swapmap.lock);
+        }
+        release(&swapmap.lock);
+        release(&swapwait);
+        while(want > ZERO){
+            want = want - ONE;
+            kfree(flareon[want]);
+        }
+        return ZERO;
+    }
+    if(rnode_topup() < ZERO){
+        release(&swapmap.lock);
+        releasesleep(&swaplock);
+        while(want > ZERO){
+            want = want - ONE;
+            kfree(flareon[want]);
+        }
+        return -ONE;
+    }
+    int mapped[SWAP_RAMAX];
+    int keep = -ONE;
+    if(zswap_load(swap_block, flareon[ZERO]) == ZERO){
+        // Still in the compressed pool: no disk read.
+        keep = ZERO;
+    }
+    else if(swap_table[swap_block].filled){
+        k = ZERO;
+        while(k < PGSIZE / 4){
+            ((uint*)flareon[ZERO])[k] = swap_table[swap_block].fillval;
+            k = k + ONE;
+        }
+        percpu_add(zerocnt.fillins, ONE);
+        keep = ONE;
+    }
+    if(keep >= ZERO){
+        mapped[ZERO] = swapin_finish(flareon[ZERO], swap_block, ZERO, keep);
+        release(&swapmap.lock);
+        releasesleep(&swaplock);
+        k = mapped[ZERO];
+        while(k < want){
+            kfree(flareon[k]);
+            k = k + ONE;
+        }
+        return ZERO;
+    }
+    n = ONE;
+    while(n < want && readahead_ok(pte, n, swap_block)){
+        n = n + ONE;
+    }
+    k = ZERO;
+    while(k < n){
+        swap_table[swap_block + k].busy = ONE;
+        k = k + ONE;
+    }
+    release(&swapmap.lock);
+    // Let other swap-ins and swap-outs proceed during the read.
+    releasesleep(&swaplock);
+    page_disk_vec(flareon, n, block_num, ONE);
+
+    // cprintf("pagefault_handler: page loaded\n");
+    acquire(&swapmap.lock);
+    int failed = rnode_topup() < ZERO;
+    k = ZERO;
+    while(k < n){
+        if(failed){
+            // Leave the page in its slot; the fault fails.
+            swap_table[swap_block + k].busy = ZERO;
+            if(swap_table[swap_block + k].refC == ZERO){
+                swap_free(swap_block + k);
+            }
+            mapped[k] = ZERO;
+        }
+        else{
+            mapped[k] = swapin_finish(flareon[k], swap_block + k, k > ZERO, ONE);
+        }
+        k = k + ONE;
+    }
+    release(&swapmap.lock);
+    k = ZERO;
+    while(k < want){
+        if(k >= n || !mapped[k]){
+            kfree(flareon[k]);
+        }
+        k = k + ONE;
+    }
+    acquire(&swapwait);
+    k = ZERO;
+    while(k < n){
+        wakeup(&swap_table[swap_block + k]);
+        k = k + ONE;
+    }
+    release(&swapwait);
+    if(failed){
+        return -ONE;
+    }
+    return ZERO;
 }
 
-void case_cow(uint va, struct proc* p, pte_t* pte){
+// Returns 0, or -1 if there is no memory for the copy.
+int case_cow(uint va, struct proc* p, pte_t* pte){
         if(*pte & PTE_P){
-            if(*pte & PTE_W){
-                panic(" Page fault on a writable page\n");
-            }
             uint pa = PTE_ADDR(*pte);
-            int refC = get_rmap(pa);
             uint flags = PTE_FLAGS(*pte);
-            if(refC == ONE){
-                *pte |= PTE_W;
-                return;
-            }
-            else{
-                dec_rmap(pte);
-                // Allocate a new page
+            if(is_zeropage(pa)){
+                // First write to a page of the zero page.
                 char* new_page = kalloc();
-                // Copy the contents of the old page to the new page
-                memmove(new_page, (char*)P2V(pa), PGSIZE);
-                // Update the page table entry
-                *pte = V2P(new_page) | flags;
-                *pte |= PTE_W;
+                if(new_page == ZERO){
+                    return -ONE;
+                }
+                memset(new_page, ZERO, PGSIZE);
+                *pte = V2P(new_page) | flags | PTE_W | PTE_A;
                 inc_rmap(pte);
-                lcr3(V2P(p->pgdir));
-                return;
+                p->rss += PGSIZE;
+                percpu_add(zerocnt.mapped, -ONE);
+                percpu_add(zerocnt.cows, ONE);
+                tlb_page(va);
+                return ZERO;
+            }
+            // Copy the page unless this is its only mapping, checking
+            // under its stripe that kswapd has not taken it since the
+            // fault; if it has, the retried write faults it back in.
+            uint frame = pa >> IRON_DOME;
+            char* new_page = ZERO;
+            for(;;){
+                acquire(rmap_lock(frame));
+                if(!(*pte & PTE_P) || PTE_ADDR(*pte) != pa){
+                    release(rmap_lock(frame));
+                    if(new_page != ZERO){
+                        kfree(new_page);
+                    }
+                    return ZERO;
+                }
+                // A page-cache frame must keep the file's contents.
+                if(rmap[frame] == ONE && !pcache_has(pa)){
+                    *pte |= PTE_W;
+                    release(rmap_lock(frame));
+                    if(new_page != ZERO){
+                        kfree(new_page);
+                    }
+                    return ZERO;
+                }
+                if(new_page != ZERO){
+                    break;
+                }
+                release(rmap_lock(frame));
+                // Allocate a new page
+                if((new_page = kalloc()) == ZERO){
+                    return -ONE;
+                }
+            }
+            // Copy the contents of the old page to the new page
+            memmove(new_page, (char*)P2V(pa), PGSIZE);
+            int left = rmap_del(frame, pte);
+            // Update the page table entry
+            *pte = V2P(new_page) | flags;
+            *pte |= PTE_W;
+            release(rmap_lock(frame));
+            inc_rmap(pte);
+            tlb_page(va);
+            if(left == ZERO){
+                // The other sharers exited since the fault.
+                kfree(P2V(pa));
             }
+            return ZERO;
         }
+        return -ONE;
 }
 
-void page_fault(){
+// First touch of a heap page that sbrk() only reserved.  A read
+// maps the zero page; a write gets a zeroed page of its own at
+// once, rather than faulting again in case_cow().
+// Returns 0, or -1 if there is no memory for it.
+int case_lazy(uint va, struct proc* p, int write){
+    pte_t* pte = walkpgdir(p->pgdir, (void*)va, ONE);
+    if(pte == ZERO){
+        return -ONE;
+    }
+    if(!write){
+        *pte = zeropage_pa() | PTE_U | PTE_P;
+        percpu_add(zerocnt.mapped, ONE);
+        percpu_add(zerocnt.lazyzero, ONE);
+        return ZERO;
+    }
+    char* mem = kalloc();
+    if(mem == ZERO){
+        return -ONE;
+    }
+    memset(mem, ZERO, PGSIZE);
+    *pte = V2P(mem) | PTE_W | PTE_U | PTE_P | PTE_A;
+    inc_rmap(pte);
+    p->rss += PGSIZE;
+    percpu_add(zerocnt.lazyalloc, ONE);
+    return ZERO;
+}
+
+// The segment with file data on va's page, or 0 if the page
+// is all bss, heap or stack.
+struct seg* file_seg(struct proc* p, uint va){
+    if(p->exe == ZERO){
+        return ZERO;
+    }
+    uint a = PGROUNDDOWN(va);
+    for(int i = ZERO; i < p->nseg; i = i + ONE){
+        struct seg* s = &p->seg[i];
+        if(a >= s->va && a < s->va + s->filesz){
+            return s;
+        }
+    }
+    return ZERO;
+}
+
+// First touch of a program page.  A read maps the frame the page
+// cache holds for it, reading the page from the executable into
+// the cache first if need be; a write gets a copy of its own.
+// Whatever part of the page lies past the segment's file data is
+// zero.  The fault may come from the kernel copying to or from
+// user memory inside a read or write of the executable itself,
+// which then already holds its lock; readi() has released the
+// block it copies from.
+// Returns 0, or -1 if there is no memory or the read fails, which
+// kills the process, failing the kernel's copy if it faulted.
+int case_file(uint va, struct proc* p, struct seg* s, int write){
+    uint a = PGROUNDDOWN(va);
+    uint off = s->off + (a - s->va);
+    uint n = s->filesz - (a - s->va);
+    if(n > PGSIZE){
+        n = PGSIZE;
+    }
+    pte_t* pte = walkpgdir(p->pgdir, (void*)a, ONE);
+    if(pte == ZERO){
+        return -ONE;
+    }
+    if(!write && pcache_map(p->exe, off, n, pte) == ZERO){
+        p->rss += PGSIZE;
+        percpu_add(filecnt.shared, ONE);
+        return ZERO;
+    }
+    char* mem = kalloc();
+    if(mem == ZERO){
+        return -ONE;
+    }
+    if(!write || pcache_copy(p->exe, off, n, mem) < ZERO){
+        memset(mem, ZERO, PGSIZE);
+        int held = holdingsleep(&p->exe->lock);
+        if(!held){
+            ilock(p->exe);
+        }
+        uint gen = pcache_gen(p->exe);
+        int got = readi(p->exe, mem, off, n);
+        if(!held){
+            iunlock(p->exe);
+        }
+        if(got != n){
+            kfree(mem);
+            return -ONE;
+        }
+        percpu_add(filecnt.pages, ONE);
+        percpu_add(filecnt.bytes, n);
+        if(!write){
+            int r = pcache_add(p->exe, off, n, mem, gen, pte);
+            if(r >= ZERO){
+                if(r > ZERO){
+                    kfree(mem);
+                }
+                p->rss += PGSIZE;
+                return ZERO;
+            }
+        }
+    }
+    *pte = V2P(mem) | PTE_W | PTE_U | PTE_P | PTE_A;
+    inc_rmap(pte);
+    p->rss += PGSIZE;
+    return ZERO;
+}
+
+// Returns 0 if the fault was handled, or -1 if the address is
+// not a reserved, swapped or copy-on-write user page, or memory
+// ran out; trap() then fails the copyuser() that faulted, or
+// treats it like any other fault.
+int page_fault(uint err){
     
     uint va = rcr2();
+    percpu_add(clockcnt.pgfaults, ONE);
     struct proc* p = myproc();
+    if(p == ZERO || va >= KERNBASE){
+        return -ONE;
+    }
+    pde_t* pde = &p->pgdir[PDX(va)];
+    if((*pde & PTE_P) && !(*pde & PTE_W)){
+        // A page table fork() left shared: take a copy, and let
+        // the access fault again if it still has to.
+        return ptsplit(p->pgdir, va, p);
+    }
     pte_t* pte = walkpgdir(p->pgdir, (void*)va, ZERO);
+    if(pte == ZERO || *pte == ZERO){
+        if(va >= p->sz){
+            return -ONE;
+        }
+        struct seg* s = file_seg(p, va);
+        if(s != ZERO){
+            return case_file(va, p, s, err & PF_WRITE);
+        }
+        return case_lazy(va, p, err & PF_WRITE);
+    }
     if(*pte & PTE_SWAPPED){
-        case_swap(va, p, pte);
+        return case_swap(va, p, pte);
     }
-    else{
-        case_cow(va, p, pte);
+    if((*pte & PTE_P) && (*pte & PTE_U) && !(*pte & PTE_W)){
+        return case_cow(va, p, pte);
+    }
+    return -ONE;
+}
+
+// Swap out a page from inside kalloc(), because the free
+// lists ran dry before kswapd could refill them.
+// Returns -1 if nothing could be evicted.
+int swap_page_direct(void){
+    // Cached program pages nobody maps are the cheapest to give up.
+    if(pcache_shrink()){
+        kswapd.direct = kswapd.direct + ONE;
+        return ZERO;
+    }
+    int n = swap_page_out();
+    if(n < ZERO){
+        kswapd.oom = kswapd.oom + ONE;
+        return -ONE;
+    }
+    kswapd.direct = kswapd.direct + n;
+    return ZERO;
+}
+
+void kswapd_wake(void){
+    if(kswapd.active || kfreehint() >= kswapd.lowwm){
+        return;
     }
-}
\ No newline at end of file
+    acquire(&kswapd.lock);
+    kswapd.stuck = ZERO;
+    wakeup(&kswapd);
+    release(&kswapd.lock);
+}
+
+void kswapd_run(void){
+    int n;
+    for(;;){
+        acquire(&kswapd.lock);
+        kswapd.active = ZERO;
+        while(num_of_FreePages() >= kswapd.lowwm || kswapd.stuck){
+            sleep(&kswapd, &kswapd.lock);
+        }
+        kswapd.active = ONE;
+        kswapd.wakeups = kswapd.wakeups + ONE;
+        release(&kswapd.lock);
+        while(num_of_FreePages() < kswapd.highwm){
+            if(pcache_shrink()){
+                continue;
+            }
+            if((n = swap_page_out()) < ZERO){
+                // Swap is full or nothing is evictable.
+                acquire(&kswapd.lock);
+                kswapd.stuck = ONE;
+                release(&kswapd.lock);
+                break;
+            }
+            kswapd.outs = kswapd.outs + n;
+        }
+    }
+}
+
+// Size the per-frame tables by the memory there is.  Runs before
+// kinit1(), whose kfree()s already look at rmap[].
+void rmapinit(void){
+    uint frames = phystop >> IRON_DOME;
+    rmap = bootalloc(frames * sizeof(rmap[ZERO]));
+    rfirst = bootalloc(frames * sizeof(rfirst[ZERO]));
+    rmore = bootalloc(frames * sizeof(rmore[ZERO]));
+    ptshadow = bootalloc(frames * sizeof(ptshadow[ZERO]));
+    ptpdx = bootalloc(frames * sizeof(ptpdx[ZERO]));
+    ptowner = bootalloc(frames * sizeof(ptowner[ZERO]));
+    ptshare.refs = bootalloc(frames * sizeof(ptshare.refs[ZERO]));
+    ptshare.res = bootalloc(frames * sizeof(ptshare.res[ZERO]));
+    initlock(&ptshare.lock, "ptshare");
+    swapmap.cache = bootalloc(frames * sizeof(swapmap.cache[ZERO]));
+    swapra.ahead = bootalloc(frames * sizeof(swapra.ahead[ZERO]));
+}
+
+void swapinit(void){
+    for(int i = ZERO; i < RMAPLOCKS; i = i + ONE){
+        initlock(&rmaplock[i], "rmap");
+    }
+    initlock(&rnodes.lock, "rnodes");
+    for(int i = ZERO; i < RNODEBOOT; i = i + ONE){
+        if(rnode_refill() < ZERO){
+            panic("swapinit: rmap nodes");
+        }
+    }
+    uint frames = phystop >> IRON_DOME;
+    uint per = sizeof(rmap[ZERO]) + sizeof(rfirst[ZERO]) + sizeof(rmore[ZERO]) +
+               sizeof(ptshadow[ZERO]);
+    cprintf("rmap: %d bytes/frame, %d KB for %d frames + %d KB of chain nodes (a 64-way table takes %d KB)\n",
+            per, per * frames / 1024, frames,
+            rnodes.blocks * (PGSIZE << RNODEORDER) / 1024,
+            (sizeof(uint) + 64 * sizeof(pte_t*)) * frames / 1024);
+    initsleeplock(&swaplock, "swap");
+    initlock(&swapmap.lock, "swapmap");
+    initlock(&swapwait, "swapwait");
+    initlock(&kswapd.lock, "kswapd");
+    kswapd.lowwm = KSWAPD_LOWWM;
+    kswapd.highwm = KSWAPD_HIGHWM;
+    swapra.window = SWAP_RAWINDOW;
+    swapcl.size = SWAP_CLUSTER;
+    zswapinit();
+    if((zeropage = kalloc()) == ZERO){
+        panic("swapinit: zero page");
+    }
+    memset(zeropage, ZERO, PGSIZE);
+    kthread("kswapd", kswapd_run);
+}
+
+// Set a tunable from vmstat.h, unless value is negative.
+// Returns the old value, or -1 for an unknown param.
+int vmtune(int param, int value){
+    int old = -ONE;
+    acquire(&kswapd.lock);
+    if(param == VM_LOWWM){
+        old = kswapd.lowwm;
+        if(value >= ZERO){
+            kswapd.lowwm = value;
+            if(kswapd.highwm < kswapd.lowwm){
+                kswapd.highwm = kswapd.lowwm;
+            }
+        }
+    }
+    else if(param == VM_HIGHWM){
+        old = kswapd.highwm;
+        if(value >= ZERO){
+            kswapd.highwm = value;
+            if(kswapd.lowwm > kswapd.highwm){
+                kswapd.lowwm = kswapd.highwm;
+            }
+        }
+    }
+    else if(param == VM_READAHEAD){
+        old = swapra.window;
+        if(value >= ZERO){
+            if(value < ONE){
+                value = ONE;
+            }
+            if(value > SWAP_RAMAX){
+                value = SWAP_RAMAX;
+            }
+            swapra.window = value;
+        }
+    }
+    else if(param == VM_CLUSTER){
+        old = swapcl.size;
+        if(value >= ZERO){
+            if(value < ONE){
+                value = ONE;
+            }
+            if(value > SWAP_RAMAX){
+                value = SWAP_RAMAX;
+            }
+            swapcl.size = value;
+        }
+    }
+    else if(param == VM_ZSWAP){
+        old = zswap_enable(value);
+    }
+    release(&kswapd.lock);
+    kswapd_wake();
+    return old;
+}
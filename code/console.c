@@ -232,13 +232,18 @@ consoleintr(int (*getc)(void))
   }
 }
 
+// User memory is copied through buf, outside cons.lock: touching
+// it may fault a page in, which can sleep, or fail.
 int
 consoleread(struct inode *ip, char *dst, int n)
 {
+  char buf[INPUT_BUF];
   uint target;
   int c;
 
   iunlock(ip);
+  if(n > INPUT_BUF)
+    n = INPUT_BUF;
   target = n;
   acquire(&cons.lock);
   while(n > 0){
@@ -259,13 +264,15 @@ consoleread(struct inode *ip, char *dst, int n)
       }
       break;
     }
-    *dst++ = c;
+    buf[target - n] = c;
     --n;
     if(c == '\n')
       break;
   }
   release(&cons.lock);
   ilock(ip);
+  if(copyuser(dst, buf, target - n) < 0)
+    return -1;
 
   return target - n;
 }
@@ -273,13 +280,21 @@ consoleread(struct inode *ip, char *dst, int n)
 int
 consolewrite(struct inode *ip, char *buf, int n)
 {
-  int i;
+  char kbuf[INPUT_BUF];
+  int i, j, m;
 
   iunlock(ip);
-  acquire(&cons.lock);
-  for(i = 0; i < n; i++)
-    consputc(buf[i] & 0xff);
-  release(&cons.lock);
+  for(i = 0; i < n; i += m){
+    m = n - i < INPUT_BUF ? n - i : INPUT_BUF;
+    if(copyuser(kbuf, buf + i, m) < 0){
+      ilock(ip);
+      return -1;
+    }
+    acquire(&cons.lock);
+    for(j = 0; j < m; j++)
+      consputc(kbuf[j] & 0xff);
+    release(&cons.lock);
+  }
   ilock(ip);
 
   return n;
@@ -9,9 +9,12 @@ struct spinlock;
 struct sleeplock;
 struct stat;
 struct superblock;
+struct tlbbatch;
+struct vmstat;
 
 #define PTE_SWAPPED     0x008   // Swapped
 #define PTE_A           0x020   // Accessed
+#define PTE_D           0x040   // Dirty
 typedef uint pte_t;
 // bio.c
 void            binit(void);
@@ -19,6 +22,8 @@ struct buf*     bread(uint, uint);
 void            brelse(struct buf*);
 void            bwrite(struct buf*);
 void            page_disk_interface(char* page, uint blockno, int param);
+void            page_disk_vec(char** pages, int n, uint blockno, int param);
+void            swapioinit(void);
 
 // console.c
 void            consoleinit(void);
@@ -28,6 +33,7 @@ void            panic(char*) __attribute__((noreturn));
 
 // exec.c
 int             exec(char*, char**);
+int             exec_proc(struct proc*, char*, char**);
 
 // file.c
 struct file*    filealloc(void);
@@ -44,6 +50,8 @@ int             dirlink(struct inode*, char*, uint);
 struct inode*   dirlookup(struct inode*, char*, uint*);
 struct inode*   ialloc(uint, short);
 struct inode*   idup(struct inode*);
+struct inode*   iexecdup(struct inode*);
+void            iexecput(struct inode*);
 void            iinit(int dev);
 void            ilock(struct inode*);
 void            iput(struct inode*);
@@ -69,21 +77,30 @@ void            ioapicinit(void);
 
 // kalloc.c
 char*           kalloc(void);
+char*           kalloc_order(int);
 uint            num_of_FreePages(void);
 void            kfree(char*);
-void            kinit1(void*, void*);
-void            kinit2(void*, void*);
+void            kfree_order(char*, int);
+void            kmemstat(struct vmstat*);
+uint            kfreehint(void);
+void            kinit1(void);
+void            kinit2(void);
+void            meminit(void);
+void*           bootalloc(uint);
+extern uint     phystop;
 
 // kbd.c
 void            kbdintr(void);
 
 // lapic.c
 void            cmostime(struct rtcdate *r);
+uint            cmosmem(void);
 int             lapicid(void);
 extern volatile uint*    lapic;
 void            lapiceoi(void);
 void            lapicinit(void);
 void            lapicstartap(uchar, uint);
+void            lapicipi(uchar, int);
 void            microdelay(int);
 
 // log.c
@@ -111,6 +128,7 @@ int             pipewrite(struct pipe*, char*, int);
 int             cpuid(void);
 void            exit(void);
 int             fork(void);
+int             spawn(char*, char**, int*);
 int             growproc(int);
 int             kill(int);
 struct cpu*     mycpu(void);
@@ -126,6 +144,7 @@ int             wait(void);
 void            wakeup(void*);
 void            yield(void);
 void            print_rss(void);
+struct proc*    kthread(char*, void (*)(void));
 
 // swtch.S
 void            swtch(struct context**, struct context*);
@@ -157,9 +176,9 @@ char*           strncpy(char*, const char*, int);
 // syscall.c
 int             argint(int, int*);
 int             argptr(int, char**, int);
-int             argstr(int, char**);
+int             argstr(int, char*, int);
 int             fetchint(uint, int*);
-int             fetchstr(uint, char**);
+int             fetchstr(uint, char*, int);
 void            syscall(void);
 
 // timer.c
@@ -185,29 +204,83 @@ int             allocuvm(pde_t*, uint, uint);
 int             deallocuvm(pde_t*, uint, uint);
 void            freevm(pde_t*);
 void            inituvm(pde_t*, char*, uint);
-int             loaduvm(pde_t*, char*, struct inode*, uint, uint);
 pde_t*          copyuvm(pde_t*, uint,struct proc* p);
 void            switchuvm(struct proc*);
 void            switchkvm(void);
 int             copyout(pde_t*, uint, void*, uint);
+int             copyuser(void*, void*, uint);
 void            clearpteu(pde_t *pgdir, char *uva);
+int             ptsplit(pde_t*, uint, struct proc*);
+void            ptsharestat(struct vmstat*);
+
+// zswap.c
+void            zswapinit(void);
+int             zswap_has(int);
+int             zswap_store(int, char*);
+void            zswap_drop(int);
+int             zswap_load(int, char*);
+int             zswap_evict(char**);
+int             zswap_enable(int);
+void            zswapstat(struct vmstat*);
+
+// tlb.c
+void            tlb_page(uint);
+void            tlb_add(struct tlbbatch*, pte_t*);
+void            tlb_flush(struct tlbbatch*);
+void            tlbintr(void);
+void            tlbstat(struct vmstat*);
+
+// pcache.c
+void            pcacheinit(void);
+uint            pcache_gen(struct inode*);
+int             pcache_map(struct inode*, uint, uint, pte_t*);
+int             pcache_copy(struct inode*, uint, uint, char*);
+int             pcache_add(struct inode*, uint, uint, char*, uint, pte_t*);
+int             pcache_has(uint);
+int             pcache_hold(uint);
+int             pcache_reclaim(uint, struct tlbbatch*);
+int             pcache_shrink(void);
+void            pcache_invalidate(struct inode*);
+void            pcachestat(struct vmstat*);
 
 // number of elements in fixed-size array
 #define NELEM(x) (sizeof(x)/sizeof((x)[0]))
 
 // pageswap.c
 void            pageswapinit(void);
-void            swap_page_out(void);
-void            page_fault(void);
-void            flush(pte_t* page);
+void            rmapinit(void);
+int             swap_page_out(void);
+int             page_fault(uint);
+int             flush(pte_t* page);
 
-pte_t*          page_replacement(void);
+int             page_replacement(void);
 int             deallocuvm_proc(struct proc*,pde_t*, uint, uint);
 void            freevm_proc(struct proc*, pde_t*);
-void            inc_rmap(pte_t* pte);
-void            dec_rmap(pte_t* pte);
+int             inc_rmap(pte_t* pte);
+int             dec_rmap(pte_t* pte);
+int             share_rmap(pte_t* src, pte_t* dst);
+int             pt_shadow_alloc(void* pt, uint va);
+uint            pte_va(pte_t* pte);
+void            pt_shadow_free(void* pt);
 uint            get_rmap(uint pa);
 void            set_rmap(uint pa);
-void            rss_decrementer(uint pa);
-void            rss_incrementer(uint pa);
-void            inc_swap_table(pte_t* pte1 , pte_t* pte2, int rand);
\ No newline at end of file
+void            set_pt_owner(void* pt, struct proc* p);
+struct proc*    pt_owner(void* pt);
+#define PT_SHARED       ((struct proc*)1)  // pt_owner() of a shared page table
+void            pt_share(void* pt);
+void            pt_claim(void* pt, struct proc* p);
+uint            proc_rss(struct proc* p);
+int             pt_shared(void* pt);
+int             pt_unshare(void* pt);
+void            swapstat(struct vmstat*);
+void            swapinit(void);
+int             swap_page_direct(void);
+void            set_pgdir_owner(pde_t*, struct proc*);
+void            kswapd_wake(void);
+int             vmtune(int param, int value);
+void            swapcache_drop(uint pa);
+int             file_unmap(uint pa, struct tlbbatch* tb);
+int             is_zeropage(uint pa);
+uint            zeropage_pa(void);
+void            zeropage_ref(int n);
+int             inc_swap_table(pte_t* pte1 , pte_t* pte2, int rand);
\ No newline at end of file
@@ -9,15 +9,24 @@
 
 int
 exec(char *path, char **argv)
+{
+  return exec_proc(myproc(), path, argv);
+}
+
+// Replace p's user image with path run with argv.  p is either
+// the calling process, or one spawn() has just allocated and that
+// has no image yet.
+int
+exec_proc(struct proc *p, char *path, char **argv)
 {
   char *s, *last;
-  int i, off;
+  int i, off, nseg;
   uint argc, sz, sp, ustack[3+MAXARG+1];
   struct elfhdr elf;
-  struct inode *ip;
+  struct inode *ip, *exe, *oldexe;
+  struct seg seg[NSEG];
   struct proghdr ph;
   pde_t *pgdir, *oldpgdir;
-  struct proc *curproc = myproc();
 
   begin_op();
 
@@ -28,6 +37,7 @@ exec(char *path, char **argv)
   }
   ilock(ip);
   pgdir = 0;
+  exe = 0;
 
   // Check ELF header
   if(readi(ip, (char*)&elf, 0, sizeof(elf)) != sizeof(elf))
@@ -38,8 +48,11 @@ exec(char *path, char **argv)
   if((pgdir = setupkvm()) == 0)
     goto bad;
 
-  // Load program into memory.
+  // Record the program's segments; their pages are read from
+  // ip when first touched (see page_fault()), so ip stays
+  // referenced for as long as the image does.
   sz = 0;
+  nseg = 0;
   for(i=0, off=elf.phoff; i<elf.phnum; i++, off+=sizeof(ph)){
     if(readi(ip, (char*)&ph, off, sizeof(ph)) != sizeof(ph))
       goto bad;
@@ -49,13 +62,20 @@ exec(char *path, char **argv)
       goto bad;
     if(ph.vaddr + ph.memsz < ph.vaddr)
       goto bad;
-    if((sz = allocuvm(pgdir, sz, ph.vaddr + ph.memsz)) == 0)
+    if(ph.vaddr + ph.memsz >= KERNBASE)
       goto bad;
     if(ph.vaddr % PGSIZE != 0)
       goto bad;
-    if(loaduvm(pgdir, (char*)ph.vaddr, ip, ph.off, ph.filesz) < 0)
+    if(nseg == NSEG)
       goto bad;
+    seg[nseg].va = ph.vaddr;
+    seg[nseg].filesz = ph.filesz;
+    seg[nseg].off = ph.off;
+    nseg++;
+    if(ph.vaddr + ph.memsz > sz)
+      sz = ph.vaddr + ph.memsz;
   }
+  exe = iexecdup(ip);
   iunlockput(ip);
   end_op();
   ip = 0;
@@ -91,24 +111,43 @@ exec(char *path, char **argv)
   for(last=s=path; *s; s++)
     if(*s == '/')
       last = s+1;
-  safestrcpy(curproc->name, last, sizeof(curproc->name));
+  safestrcpy(p->name, last, sizeof(p->name));
 
   // Commit to the user image.
-  oldpgdir = curproc->pgdir;
-  curproc->pgdir = pgdir;
-  curproc->sz = sz;
-  curproc->tf->eip = elf.entry;  // main
-  curproc->tf->esp = sp;
-  switchuvm(curproc);
-  freevm(oldpgdir);
+  oldpgdir = p->pgdir;
+  p->pgdir = pgdir;
+  set_pgdir_owner(pgdir, p);
+  p->sz = sz;
+  oldexe = p->exe;
+  p->exe = exe;
+  memmove(p->seg, seg, sizeof(seg));
+  p->nseg = nseg;
+  p->tf->eip = elf.entry;  // main
+  p->tf->esp = sp;
+  if(p == myproc())
+    switchuvm(p);
+  if(oldpgdir)
+    freevm_proc(p, oldpgdir);
+  // The stack and the guard page below it.
+  p->rss = 2*PGSIZE;
+  if(oldexe){
+    begin_op();
+    iexecput(oldexe);
+    end_op();
+  }
   return 0;
 
  bad:
   if(pgdir)
-    freevm(pgdir);
+    freevm_proc(p, pgdir);
   if(ip){
     iunlockput(ip);
     end_op();
   }
+  if(exe){
+    begin_op();
+    iexecput(exe);
+    end_op();
+  }
   return -1;
 }
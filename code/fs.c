@@ -14,6 +14,7 @@
 #include "param.h"
 #include "stat.h"
 #include "mmu.h"
+#include "memlayout.h"
 #include "proc.h"
 #include "spinlock.h"
 #include "sleeplock.h"
@@ -282,6 +283,32 @@ idup(struct inode *ip)
   return ip;
 }
 
+// Increment reference count for ip, which a process is about to
+// run.  exec() reads a program's pages in from the file as they
+// are touched, so writei() refuses to change ip until the last
+// such reference goes with iexecput().  Caller holds ip->lock,
+// or already has such a reference.
+struct inode*
+iexecdup(struct inode *ip)
+{
+  acquire(&icache.lock);
+  ip->ref++;
+  ip->textref++;
+  release(&icache.lock);
+  return ip;
+}
+
+// Drop a reference taken with iexecdup().
+// Must be inside a transaction, as for iput().
+void
+iexecput(struct inode *ip)
+{
+  acquire(&icache.lock);
+  ip->textref--;
+  release(&icache.lock);
+  iput(ip);
+}
+
 // Lock the given inode.
 // Reads the inode from disk if necessary.
 void
@@ -411,6 +438,7 @@ itrunc(struct inode *ip)
   struct buf *bp;
   uint *a;
 
+  pcache_invalidate(ip);
   for(i = 0; i < NDIRECT; i++){
     if(ip->addrs[i]){
       bfree(ip->dev, ip->addrs[i]);
@@ -449,11 +477,15 @@ stati(struct inode *ip, struct stat *st)
 //PAGEBREAK!
 // Read data from inode.
 // Caller must hold ip->lock.
+// User memory is copied to through buf once the block is released:
+// dst may be a page of a running program that case_file() has to
+// read in, perhaps from this very block.
 int
 readi(struct inode *ip, char *dst, uint off, uint n)
 {
   uint tot, m;
   struct buf *bp;
+  char buf[BSIZE];
 
   if(ip->type == T_DEV){
     if(ip->major < 0 || ip->major >= NDEV || !devsw[ip->major].read)
@@ -469,8 +501,15 @@ readi(struct inode *ip, char *dst, uint off, uint n)
   for(tot=0; tot<n; tot+=m, off+=m, dst+=m){
     bp = bread(ip->dev, bmap(ip, off/BSIZE));
     m = min(n - tot, BSIZE - off%BSIZE);
-    memmove(dst, bp->data + off%BSIZE, m);
+    if((uint)dst >= KERNBASE){
+      memmove(dst, bp->data + off%BSIZE, m);
+      brelse(bp);
+      continue;
+    }
+    memmove(buf, bp->data + off%BSIZE, m);
     brelse(bp);
+    if(copyuser(dst, buf, m) < 0)
+      return -1;
   }
   return n;
 }
@@ -490,24 +529,32 @@ writei(struct inode *ip, char *src, uint off, uint n)
     return devsw[ip->major].write(ip, src, n);
   }
 
+  // A running program's image (see iexecdup()).
+  if(ip->textref > 0)
+    return -1;
   if(off > ip->size || off + n < off)
     return -1;
   if(off + n > MAXFILE*BSIZE)
     return -1;
+  if(n > 0)
+    pcache_invalidate(ip);
 
   for(tot=0; tot<n; tot+=m, off+=m, src+=m){
     bp = bread(ip->dev, bmap(ip, off/BSIZE));
     m = min(n - tot, BSIZE - off%BSIZE);
-    memmove(bp->data + off%BSIZE, src, m);
+    if(copyuser(bp->data + off%BSIZE, src, m) < 0){
+      brelse(bp);
+      break;
+    }
     log_write(bp);
     brelse(bp);
   }
 
-  if(n > 0 && off > ip->size){
+  if(tot > 0 && off > ip->size){
     ip->size = off;
     iupdate(ip);
   }
-  return n;
+  return tot == n ? n : -1;
 }
 
 //PAGEBREAK!
@@ -23,6 +23,9 @@
 #define IDE_CMD_WRITE 0x30
 #define IDE_CMD_RDMUL 0xc4
 #define IDE_CMD_WRMUL 0xc5
+#define IDE_CMD_SETMUL 0xc6
+
+#define SECTORS_PER_PAGE (PGSIZE/SECTOR_SIZE)
 
 // idequeue points to the buf now being read/written to the disk.
 // idequeue->qnext points to the next buf to be processed.
@@ -65,6 +68,15 @@ ideinit(void)
     }
   }
 
+  // Swap I/O moves whole pages with READ/WRITE MULTIPLE.
+  // Make disk 1 interrupt once per page rather than per sector.
+  if(havedisk1){
+    idewait(0);
+    outb(0x1f2, SECTORS_PER_PAGE);
+    outb(0x1f7, IDE_CMD_SETMUL);
+    idewait(0);
+  }
+
   // Switch back to disk 0.
   outb(0x1f6, 0xe0 | (0<<4));
 }
@@ -75,25 +87,39 @@ idestart(struct buf *b)
 {
   if(b == 0)
     panic("idestart");
-  if(b->blockno >= FSSIZE)
-    panic("incorrect blockno");
   int sector_per_block =  BSIZE/SECTOR_SIZE;
   int sector = b->blockno * sector_per_block;
   int read_cmd = (sector_per_block == 1) ? IDE_CMD_READ :  IDE_CMD_RDMUL;
   int write_cmd = (sector_per_block == 1) ? IDE_CMD_WRITE : IDE_CMD_WRMUL;
+  int nsect = sector_per_block;
 
   if (sector_per_block > 7) panic("idestart");
 
+  // A page vector goes out as one multi-sector request;
+  // the disk interrupts after each page (see ideinit).
+  if(b->vec){
+    nsect = b->nvec * SECTORS_PER_PAGE;
+    read_cmd = IDE_CMD_RDMUL;
+    write_cmd = IDE_CMD_WRMUL;
+    if(b->nvec <= 0 || nsect > 255)
+      panic("idestart: vec");
+  }
+  if(b->blockno + nsect/sector_per_block > FSSIZE)
+    panic("incorrect blockno");
+
   idewait(0);
   outb(0x3f6, 0);  // generate interrupt
-  outb(0x1f2, sector_per_block);  // number of sectors
+  outb(0x1f2, nsect);  // number of sectors
   outb(0x1f3, sector & 0xff);
   outb(0x1f4, (sector >> 8) & 0xff);
   outb(0x1f5, (sector >> 16) & 0xff);
   outb(0x1f6, 0xe0 | ((b->dev&1)<<4) | ((sector>>24)&0x0f));
   if(b->flags & B_DIRTY){
     outb(0x1f7, write_cmd);
-    outsl(0x1f0, b->data, BSIZE/4);
+    if(b->vec)
+      outsl(0x1f0, b->vec[0], PGSIZE/4);
+    else
+      outsl(0x1f0, b->data, BSIZE/4);
   } else {
     outb(0x1f7, read_cmd);
   }
@@ -112,11 +138,26 @@ ideintr(void)
     release(&idelock);
     return;
   }
-  idequeue = b->qnext;
 
-  // Read data if needed.
-  if(!(b->flags & B_DIRTY) && idewait(1) >= 0)
+  if(b->vec){
+    // One page of a page vector is done.
+    if(!(b->flags & B_DIRTY) && idewait(1) >= 0)
+      insl(0x1f0, b->vec[b->vecdone], PGSIZE/4);
+    b->vecdone++;
+    if(b->vecdone < b->nvec){
+      // Same request continues with the next page.
+      if(b->flags & B_DIRTY){
+        idewait(0);
+        outsl(0x1f0, b->vec[b->vecdone], PGSIZE/4);
+      }
+      release(&idelock);
+      return;
+    }
+  } else if(!(b->flags & B_DIRTY) && idewait(1) >= 0){
+    // Read data if needed.
     insl(0x1f0, b->data, BSIZE/4);
+  }
+  idequeue = b->qnext;
 
   // Wake process waiting for this buf.
   b->flags |= B_VALID;
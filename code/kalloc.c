@@ -1,6 +1,18 @@
 // Physical memory allocator, intended to allocate
 // memory for user processes, kernel stacks, page table pages,
-// and pipe buffers. Allocates 4096-byte pages.
+// and pipe buffers. Allocates 4096-byte pages, or blocks of
+// 2^order physically contiguous pages via kalloc_order().
+//
+// Free memory is kept by a binary buddy allocator: one free
+// list per order, and a block of order k at page index i has
+// its buddy at index i ^ (1 << k).  Freeing a block merges it
+// with its buddy for as long as the buddy is free too.
+//
+// On top of that each CPU caches a few single pages.
+// kalloc() and kfree() normally touch only the calling CPU's
+// cache; pages move between a cache and the buddy lists in
+// batches of KBATCH, so kmem.lock is taken once per batch
+// rather than once per page.
 
 #include "types.h"
 #include "defs.h"
@@ -8,6 +20,15 @@
 #include "memlayout.h"
 #include "mmu.h"
 #include "spinlock.h"
+#include "vmstat.h"
+
+#define KBATCH     16  // pages moved between a CPU cache and the pool
+#define KCACHEMAX  64  // drain a CPU cache once it holds more than this
+
+#define MAXORDER   VM_MAXORDER
+#define B_FREE     0x80  // pgstate: page heads a free block;
+                         // the low bits hold the block's order
+#define BOOTMEM    (16*1024*1024)  // what entrypgdir maps (main.c)
 
 void freerange(void *vstart, void *vend);
 extern char end[]; // first address after kernel loaded from ELF file
@@ -15,33 +36,100 @@ extern char end[]; // first address after kernel loaded from ELF file
 
 struct run {
   struct run *next;
+  struct run *prev;
+};
+
+// Per-CPU free page cache.
+// Lock order: a CPU's kcache.lock before kmem.lock;
+// never hold two kcache locks except in num_of_FreePages().
+struct kcache {
+  struct spinlock lock;
+  uint nfree;
+  struct run *freelist;
 };
 
 struct {
   struct spinlock lock;
   int use_lock;
   uint num_free_pages;  //store number of free pages
-  struct run *freelist;
+  struct run *freelist[MAXORDER+1];
+  uint nblocks[MAXORDER+1];
+  struct kcache cpu[NCPU];
 } kmem;
 
+uint phystop;           // top of the memory in use, at most PHYSTOP
+static char *bootfree;  // next byte for bootalloc(), 0 once kinit1() ran
+static uint bootused;   // bytes bootalloc() gave out
+static uchar *pgstate;  // by frame
+
+// Find out how much memory there is.  The tables kept per frame,
+// here and elsewhere, are sized by it and carved out of the
+// memory just past the kernel by bootalloc() before kinit1()
+// hands the rest out.
+void
+meminit(void)
+{
+  phystop = cmosmem() * 1024;
+  if(phystop > PHYSTOP)
+    phystop = PHYSTOP;
+  phystop = PGROUNDDOWN(phystop);
+  if(phystop < 4*1024*1024)
+    panic("meminit: less than 4MB");
+  bootfree = end;
+  pgstate = bootalloc(phystop >> PTXSHIFT);
+}
+
+// Zeroed memory that is never freed, for per-frame tables.
+// Only until kinit1().
+void*
+bootalloc(uint n)
+{
+  char *v;
+
+  v = bootfree;
+  if(v == 0 || V2P(v + n) > BOOTMEM || V2P(v + n) > phystop)
+    panic("bootalloc");
+  bootfree = v + ((n + 15) & ~15);
+  memset(v, 0, n);
+  return v;
+}
+
+static uint
+bootmem(void)
+{
+  return phystop < BOOTMEM ? phystop : BOOTMEM;
+}
+
 // Initialization happens in two phases.
 // 1. main() calls kinit1() while still using entrypgdir to place just
 // the pages mapped by entrypgdir on free list.
 // 2. main() calls kinit2() with the rest of the physical pages
 // after installing a full page table that maps them on all cores.
+// Until kinit2() sets use_lock, only the buddy lists are used:
+// the per-CPU caches need cpuid(), which needs mpinit().
 void
-kinit1(void *vstart, void *vend)
+kinit1(void)
 {
+  struct kcache *kc;
+  char *vstart;
+
   initlock(&kmem.lock, "kmem");
+  for(kc = kmem.cpu; kc < &kmem.cpu[NCPU]; kc++)
+    initlock(&kc->lock, "kcache");
   kmem.use_lock = 0;
-  freerange(vstart, vend);
+  vstart = bootfree;
+  bootused = vstart - end;
+  bootfree = 0;
+  freerange(vstart, P2V(bootmem()));
 }
 
 void
-kinit2(void *vstart, void *vend)
+kinit2(void)
 {
-  freerange(vstart, vend);
+  freerange(P2V(bootmem()), P2V(phystop));
   kmem.use_lock = 1;
+  cprintf("mem: %d MB, %d KB of it for per-frame tables\n",
+          phystop / (1024*1024), bootused / 1024);
 }
 
 void
@@ -57,6 +145,149 @@ freerange(void *vstart, void *vend)
   }
     
 }
+
+//PAGEBREAK: 30
+// Buddy lists.  Caller holds kmem.lock (or use_lock is 0).
+
+static void
+buddy_push(struct run *r, int order)
+{
+  r->prev = 0;
+  r->next = kmem.freelist[order];
+  if(r->next)
+    r->next->prev = r;
+  kmem.freelist[order] = r;
+  kmem.nblocks[order] += 1;
+  pgstate[V2P(r) >> PTXSHIFT] = B_FREE | order;
+}
+
+static void
+buddy_unlink(struct run *r, int order)
+{
+  if(r->prev)
+    r->prev->next = r->next;
+  else
+    kmem.freelist[order] = r->next;
+  if(r->next)
+    r->next->prev = r->prev;
+  kmem.nblocks[order] -= 1;
+  pgstate[V2P(r) >> PTXSHIFT] = 0;
+}
+
+// Return a block of 2^order pages to the lists,
+// merging it with its buddy as far up as possible.
+static void
+buddy_free(char *v, int order)
+{
+  uint idx, bidx;
+
+  kmem.num_free_pages += 1 << order;
+  idx = V2P(v) >> PTXSHIFT;
+  while(order < MAXORDER){
+    bidx = idx ^ (1 << order);
+    if(bidx >= (phystop >> PTXSHIFT) || pgstate[bidx] != (B_FREE | order))
+      break;
+    buddy_unlink((struct run*)P2V(bidx << PTXSHIFT), order);
+    idx &= bidx;
+    order++;
+  }
+  buddy_push((struct run*)P2V(idx << PTXSHIFT), order);
+}
+
+// Take a block of 2^order pages, splitting a larger
+// block if no block of that order is free.
+static char*
+buddy_alloc(int order)
+{
+  struct run *r;
+  int k;
+
+  for(k = order; k <= MAXORDER; k++)
+    if(kmem.freelist[k])
+      break;
+  if(k > MAXORDER)
+    return 0;
+  r = kmem.freelist[k];
+  buddy_unlink(r, k);
+  while(k > order){
+    k--;
+    buddy_push((struct run*)((char*)r + (PGSIZE << k)), k);
+  }
+  kmem.num_free_pages -= 1 << order;
+  return (char*)r;
+}
+
+//PAGEBREAK: 30
+// Lock and return the calling CPU's cache.
+static struct kcache*
+mykcache(void)
+{
+  struct kcache *kc;
+
+  pushcli();
+  kc = &kmem.cpu[cpuid()];
+  acquire(&kc->lock);
+  popcli();
+  return kc;
+}
+
+// Move up to n pages from the buddy lists into kc.
+// Caller holds kc->lock.
+static void
+kcache_refill(struct kcache *kc, int n)
+{
+  struct run *r;
+
+  acquire(&kmem.lock);
+  while(n-- > 0 && (r = (struct run*)buddy_alloc(0)) != 0){
+    r->next = kc->freelist;
+    kc->freelist = r;
+    kc->nfree += 1;
+  }
+  release(&kmem.lock);
+}
+
+// Move up to n pages from kc back to the buddy lists.
+// Caller holds kc->lock.  Returns the number of pages moved.
+static int
+kcache_drain(struct kcache *kc, int n)
+{
+  struct run *r;
+  int moved = 0;
+
+  acquire(&kmem.lock);
+  while(moved < n && (r = kc->freelist) != 0){
+    kc->freelist = r->next;
+    kc->nfree -= 1;
+    buddy_free((char*)r, 0);
+    moved++;
+  }
+  release(&kmem.lock);
+  return moved;
+}
+
+// The buddy lists and our own cache are empty: push half of
+// some other CPU's cache back to the lists so we can refill.
+// Holds at most one kcache lock at a time.
+static int
+kcache_steal(int self)
+{
+  struct kcache *kc;
+  int i, moved;
+
+  for(i = 0; i < NCPU; i++){
+    if(i == self)
+      continue;
+    kc = &kmem.cpu[i];
+    acquire(&kc->lock);
+    moved = kcache_drain(kc, (kc->nfree + 1) / 2);
+    release(&kc->lock);
+    if(moved)
+      return moved;
+  }
+  return 0;
+}
+
 //PAGEBREAK: 21
 // Free the page of physical memory pointed at by v,
 // which normally should have been returned by a
@@ -66,24 +297,35 @@ void
 kfree(char *v)
 {
   struct run *r;
+  struct kcache *kc;
 
-  if((uint)v % PGSIZE || v < end || V2P(v) >= PHYSTOP)
+  if((uint)v % PGSIZE || v < end || V2P(v) >= phystop)
     panic("kfree");
 
-  // Fill with junk to catch dangling refs.
-  
+  // Still mapped by some page table; the last dec_rmap frees it.
+  if(get_rmap(V2P(v)) != 0)
+    return;
+  // Kept by the page cache for the next process to map it.
+  if(pcache_hold(V2P(v)))
+    return;
+  swapcache_drop(V2P(v));
 
-  if(kmem.use_lock)
-    acquire(&kmem.lock);
-  r = (struct run*)v;
-  if(get_rmap(V2P(v)) == 0){
+  // Fill with junk to catch dangling refs.
   memset(v, 1, PGSIZE);
-  r->next = kmem.freelist;
-  kmem.num_free_pages+=1;
-  kmem.freelist = r;
+  r = (struct run*)v;
+
+  if(!kmem.use_lock){
+    buddy_free(v, 0);
+    return;
   }
-  if(kmem.use_lock)
-    release(&kmem.lock);
+
+  kc = mykcache();
+  r->next = kc->freelist;
+  kc->freelist = r;
+  kc->nfree += 1;
+  if(kc->nfree > KCACHEMAX)
+    kcache_drain(kc, KBATCH);
+  release(&kc->lock);
 }
 
 // Allocate one 4096-byte page of physical memory.
@@ -93,33 +335,153 @@ char*
 kalloc(void)
 {
   struct run *r;
+  struct kcache *kc;
+  int id;
+
+  if(!kmem.use_lock){
+    if((r = (struct run*)buddy_alloc(0)) != 0)
+      return (char*)r;
+  } else {
+    for(;;){
+      kc = mykcache();
+      id = kc - kmem.cpu;
+      if(kc->freelist == 0)
+        kcache_refill(kc, KBATCH);
+      r = kc->freelist;
+      if(r){
+        kc->freelist = r->next;
+        kc->nfree -= 1;
+      }
+      release(&kc->lock);
+      if(r){
+        kswapd_wake();
+        return (char*)r;
+      }
+      if(kcache_steal(id) == 0)
+        break;
+    }
+  }
+  // Nothing free and kswapd has not kept up:
+  // swap out a page ourselves.  If nothing can be evicted
+  // either, fail the allocation and let the caller cope.
+  if(swap_page_direct() < 0)
+    return 0;
+  return kalloc();
+}
+
+// Allocate 2^order physically contiguous pages, aligned to
+// their size.  Single pages are cached per CPU and may hide
+// a buddy, so on failure flush the caches and try once more.
+// Does not swap: evicting one page rarely frees a whole block.
+// Returns 0 if no block is available.
+char*
+kalloc_order(int order)
+{
+  struct kcache *kc;
+  char *v;
+
+  if(order < 0 || order > MAXORDER)
+    panic("kalloc_order");
+  if(order == 0)
+    return kalloc();
 
   if(kmem.use_lock)
     acquire(&kmem.lock);
-  r = kmem.freelist;
-  if(r)
-  {
-    kmem.freelist = r->next;
-    kmem.num_free_pages-=1;
-  }
-    
+  v = buddy_alloc(order);
   if(kmem.use_lock)
     release(&kmem.lock);
-  if(r){
-  return (char*)r;
+  if(v || !kmem.use_lock)
+    return v;
+
+  for(kc = kmem.cpu; kc < &kmem.cpu[NCPU]; kc++){
+    acquire(&kc->lock);
+    kcache_drain(kc, kc->nfree);
+    release(&kc->lock);
   }
-  // Swap out the page pointed by pte
-  swap_page_out();
-  return kalloc();
+  acquire(&kmem.lock);
+  v = buddy_alloc(order);
+  release(&kmem.lock);
+  return v;
 }
+
+// Free a block returned by kalloc_order(order).
+void
+kfree_order(char *v, int order)
+{
+  if(order < 0 || order > MAXORDER)
+    panic("kfree_order");
+  if(order == 0){
+    kfree(v);
+    return;
+  }
+  if((uint)v % (PGSIZE << order) || v < end ||
+     V2P(v) + (PGSIZE << order) > phystop)
+    panic("kfree_order");
+
+  memset(v, 1, PGSIZE << order);
+  if(kmem.use_lock)
+    acquire(&kmem.lock);
+  buddy_free(v, order);
+  if(kmem.use_lock)
+    release(&kmem.lock);
+}
+
+// Free pages in the buddy lists and in every CPU cache.
+// Takes all the cache locks so the count is exact.
 uint 
 num_of_FreePages(void)
 {
+  struct kcache *kc;
+  uint num_free_pages;
+
+  for(kc = kmem.cpu; kc < &kmem.cpu[NCPU]; kc++)
+    acquire(&kc->lock);
   acquire(&kmem.lock);
 
-  uint num_free_pages = kmem.num_free_pages;
+  num_free_pages = kmem.num_free_pages;
+  for(kc = kmem.cpu; kc < &kmem.cpu[NCPU]; kc++)
+    num_free_pages += kc->nfree;
   
   release(&kmem.lock);
+  for(kc = kmem.cpu; kc < &kmem.cpu[NCPU]; kc++)
+    release(&kc->lock);
   
   return num_free_pages;
 }
+
+// Free page count without taking any locks, for
+// deciding whether kswapd needs waking.  May be stale.
+uint
+kfreehint(void)
+{
+  struct kcache *kc;
+  uint n;
+
+  n = kmem.num_free_pages;
+  for(kc = kmem.cpu; kc < &kmem.cpu[NCPU]; kc++)
+    n += kc->nfree;
+  return n;
+}
+
+// Fill in the allocator's part of st.
+void
+kmemstat(struct vmstat *st)
+{
+  struct kcache *kc;
+  int k;
+
+  for(kc = kmem.cpu; kc < &kmem.cpu[NCPU]; kc++)
+    acquire(&kc->lock);
+  acquire(&kmem.lock);
+
+  st->cachedpages = 0;
+  for(kc = kmem.cpu; kc < &kmem.cpu[NCPU]; kc++)
+    st->cachedpages += kc->nfree;
+  st->freepages = kmem.num_free_pages + st->cachedpages;
+  for(k = 0; k <= MAXORDER; k++)
+    st->buddyfree[k] = kmem.nblocks[k];
+
+  release(&kmem.lock);
+  for(kc = kmem.cpu; kc < &kmem.cpu[NCPU]; kc++)
+    release(&kc->lock);
+}
@@ -113,6 +113,16 @@ lapiceoi(void)
     lapicw(EOI, 0);
 }
 
+// Send the CPU whose APIC ID is apicid an interrupt on vector.
+void
+lapicipi(uchar apicid, int vector)
+{
+  lapicw(ICRHI, apicid<<24);
+  lapicw(ICRLO, FIXED | ASSERT | vector);
+  while(lapic[ICRLO] & DELIVS)
+    ;
+}
+
 // Spin for a given number of microseconds.
 // On real hardware would want to tune this dynamically.
 void
@@ -227,3 +237,22 @@ cmostime(struct rtcdate *r)
   *r = t1;
   r->year += 2000;
 }
+
+#define CMOS_EXTLO  0x30    // memory above 1MB, in KB
+#define CMOS_EXTHI  0x31
+#define CMOS_HIGHLO 0x34    // memory above 16MB, in 64KB units
+#define CMOS_HIGHHI 0x35
+
+// Top of physical memory in KB, as the BIOS left it in CMOS.
+// Only memory below 4GB is counted.
+uint
+cmosmem(void)
+{
+  uint kb, high;
+
+  high = cmos_read(CMOS_HIGHLO) | (cmos_read(CMOS_HIGHHI) << 8);
+  if(high)
+    return 16*1024 + high*64;
+  kb = cmos_read(CMOS_EXTLO) | (cmos_read(CMOS_EXTHI) << 8);
+  return 1024 + kb;
+}
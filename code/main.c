@@ -9,7 +9,6 @@
 static void startothers(void);
 static void mpmain(void)  __attribute__((noreturn));
 extern pde_t *kpgdir;
-extern char end[]; // first address after kernel loaded from ELF file
 
 // Bootstrap processor starts running C code here.
 // Allocate a real stack and switch to it, first
@@ -17,7 +16,10 @@ extern char end[]; // first address after kernel loaded from ELF file
 int
 main(void)
 {
-  kinit1(end, P2V(4*1024*1024)); // phys page allocator
+  meminit();       // size physical memory
+  rmapinit();      // per-frame swap and reverse-map tables
+  pcacheinit();    // program page cache
+  kinit1();        // phys page allocator
   kvmalloc();      // kernel page table
   mpinit();        // detect other processors
   lapicinit();     // interrupt controller
@@ -29,11 +31,13 @@ main(void)
   pinit();         // process table
   tvinit();        // trap vectors
   binit();         // buffer cache
+  swapioinit();    // swap I/O buffers
   fileinit();      // file table
   ideinit();       // disk 
   startothers();   // start other processors
-  kinit2(P2V(4*1024*1024), P2V(PHYSTOP)); // must come after startothers()
+  kinit2();        // the rest of memory; must come after startothers()
   userinit();      // first user process
+  swapinit();      // page-out daemon
   mpmain();        // finish this processor's setup
 }
 
@@ -103,8 +107,13 @@ __attribute__((__aligned__(PGSIZE)))
 pde_t entrypgdir[NPDENTRIES] = {
   // Map VA's [0, 4MB) to PA's [0, 4MB)
   [0] = (0) | PTE_P | PTE_W | PTE_PS,
-  // Map VA's [KERNBASE, KERNBASE+4MB) to PA's [0, 4MB)
+  // Map VA's [KERNBASE, KERNBASE+16MB) to PA's [0, 16MB):
+  // the kernel, the tables meminit() sizes, and the first
+  // pages kinit1() frees (BOOTMEM in kalloc.c).
   [KERNBASE>>PDXSHIFT] = (0) | PTE_P | PTE_W | PTE_PS,
+  [(KERNBASE>>PDXSHIFT)+1] = (4<<20) | PTE_P | PTE_W | PTE_PS,
+  [(KERNBASE>>PDXSHIFT)+2] = (8<<20) | PTE_P | PTE_W | PTE_PS,
+  [(KERNBASE>>PDXSHIFT)+3] = (12<<20) | PTE_P | PTE_W | PTE_PS,
 };
 
 //PAGEBREAK!
@@ -39,6 +39,7 @@ void
 iderw(struct buf *b)
 {
   uchar *p;
+  int i;
 
   if(!holdingsleep(&b->lock))
     panic("iderw: buf not locked");
@@ -51,6 +52,21 @@ iderw(struct buf *b)
 
   p = memdisk + b->blockno*BSIZE;
 
+  if(b->vec){
+    if(b->blockno + b->nvec*(PGSIZE/BSIZE) > disksize)
+      panic("iderw: block out of range");
+    for(i = 0; i < b->nvec; i++, p += PGSIZE){
+      if(b->flags & B_DIRTY)
+        memmove(p, b->vec[i], PGSIZE);
+      else
+        memmove(b->vec[i], p, PGSIZE);
+    }
+    b->vecdone = b->nvec;
+    b->flags &= ~B_DIRTY;
+    b->flags |= B_VALID;
+    return;
+  }
+
   if(b->flags & B_DIRTY){
     b->flags &= ~B_DIRTY;
     memmove(p, b->data, BSIZE);
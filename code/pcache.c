@@ -0,0 +1,349 @@
+// Page cache for program files.
+//
+// Pages that page_fault() reads from an executable are kept here,
+// keyed by (dev, inum, file offset, length), so that every process
+// running the same binary maps the same frames.  They are mapped
+// read-only; a write gives the writer a copy in case_cow(), so a
+// cached frame always holds exactly what is in the file.
+//
+// A cached frame is counted in the reverse map like any other, so
+// the frame itself stays in the cache when its last mapping goes
+// (kfree() asks pcache_hold() first) and the next exec of the
+// binary finds it.  Frames nobody maps are what the cache gives
+// back under memory pressure, oldest first.
+//
+// writei() and itrunc() drop the file's entries.  A frame still
+// mapped then just stops being cached, and is freed with its last
+// mapping.  Each hash bucket has a generation, bumped by every
+// such call, so that a page read before a write cannot be added
+// after it.
+
+#include "types.h"
+#include "param.h"
+#include "defs.h"
+#include "mmu.h"
+#include "memlayout.h"
+#include "spinlock.h"
+#include "sleeplock.h"
+#include "fs.h"
+#include "file.h"
+#include "vmstat.h"
+
+#define NPCACHE 256                     // most pages cached
+#define PCHASH 64                       // hash buckets, by file
+
+struct pcentry {
+  uint dev;
+  uint inum;
+  uint off;                             // file offset of the page
+  uint n;                               // bytes from the file
+  char *page;                           // 0 if the entry is free
+  uint stamp;                           // insertion order
+  short next;                           // bucket chain, -1 ends it
+};
+
+static struct {
+  struct spinlock lock;
+  struct pcentry ent[NPCACHE];
+  short head[PCHASH];
+  uint gen[PCHASH];
+  short *frame;                          // entry index + 1, by frame
+  uint stamp;
+  uint npages;
+  uint hits;
+  uint misses;
+  uint drops;
+  uint invalidates;
+} pcache;
+
+static int
+pchash(uint dev, uint inum)
+{
+  return (dev * 31 + inum) % PCHASH;
+}
+
+void
+pcacheinit(void)
+{
+  int i;
+
+  initlock(&pcache.lock, "pcache");
+  pcache.frame = bootalloc((phystop >> PTXSHIFT) * sizeof(pcache.frame[0]));
+  for(i = 0; i < PCHASH; i++)
+    pcache.head[i] = -1;
+}
+
+// Caller holds pcache.lock.
+static struct pcentry*
+pclookup(uint dev, uint inum, uint off, uint n)
+{
+  int i;
+  struct pcentry *e;
+
+  for(i = pcache.head[pchash(dev, inum)]; i >= 0; i = e->next){
+    e = &pcache.ent[i];
+    if(e->dev == dev && e->inum == inum && e->off == off && e->n == n)
+      return e;
+  }
+  return 0;
+}
+
+// Unlink e from its bucket and the frame index.  Returns its page,
+// which the caller frees once it has released pcache.lock if no
+// one maps it.
+static char*
+pcremove(struct pcentry *e)
+{
+  short *pp;
+  char *page;
+  int i;
+
+  i = e - pcache.ent;
+  for(pp = &pcache.head[pchash(e->dev, e->inum)]; *pp != i; pp = &pcache.ent[*pp].next)
+    ;
+  *pp = e->next;
+  page = e->page;
+  pcache.frame[V2P(page) >> PTXSHIFT] = 0;
+  e->page = 0;
+  pcache.npages--;
+  return page;
+}
+
+// Map page read-only at pte.  Returns -1, leaving pte clear, if
+// the reverse map has no room for another mapping of it.
+static int
+pcmap(char *page, pte_t *pte)
+{
+  *pte = V2P(page) | PTE_U | PTE_P | PTE_A;
+  if(inc_rmap(pte) < 0){
+    *pte = 0;
+    return -1;
+  }
+  return 0;
+}
+
+// The generation of ip's bucket, to pass to pcache_add() for a
+// page read from ip now.
+uint
+pcache_gen(struct inode *ip)
+{
+  uint gen;
+
+  acquire(&pcache.lock);
+  gen = pcache.gen[pchash(ip->dev, ip->inum)];
+  release(&pcache.lock);
+  return gen;
+}
+
+// If the n bytes of ip at off are cached, map them at pte and
+// return 0; otherwise, or if the reverse map is full, return -1.
+int
+pcache_map(struct inode *ip, uint off, uint n, pte_t *pte)
+{
+  struct pcentry *e;
+
+  acquire(&pcache.lock);
+  if((e = pclookup(ip->dev, ip->inum, off, n)) == 0){
+    pcache.misses++;
+    release(&pcache.lock);
+    return -1;
+  }
+  if(pcmap(e->page, pte) < 0){
+    release(&pcache.lock);
+    return -1;
+  }
+  pcache.hits++;
+  release(&pcache.lock);
+  return 0;
+}
+
+// If the n bytes of ip at off are cached, copy them to dst and
+// return 0; otherwise return -1.
+int
+pcache_copy(struct inode *ip, uint off, uint n, char *dst)
+{
+  struct pcentry *e;
+
+  acquire(&pcache.lock);
+  if((e = pclookup(ip->dev, ip->inum, off, n)) == 0){
+    release(&pcache.lock);
+    return -1;
+  }
+  memmove(dst, e->page, PGSIZE);
+  pcache.hits++;
+  release(&pcache.lock);
+  return 0;
+}
+
+// Cache page, just read from ip at off, and map it at pte.
+// Returns 0; 1 if another process cached the same page meanwhile
+// and that one is mapped instead, so the caller frees page; or
+// -1 if the file changed since gen or there is no room, here or
+// in the reverse map, and the caller keeps page for itself.
+int
+pcache_add(struct inode *ip, uint off, uint n, char *page, uint gen, pte_t *pte)
+{
+  struct pcentry *e, *victim;
+  char *old;
+  int h, i;
+
+  old = 0;
+  h = pchash(ip->dev, ip->inum);
+  acquire(&pcache.lock);
+  if(pcache.gen[h] != gen){
+    release(&pcache.lock);
+    return -1;
+  }
+  if((e = pclookup(ip->dev, ip->inum, off, n)) != 0){
+    if(pcmap(e->page, pte) < 0){
+      release(&pcache.lock);
+      return -1;
+    }
+    release(&pcache.lock);
+    return 1;
+  }
+  victim = 0;
+  for(i = 0; i < NPCACHE; i++){
+    e = &pcache.ent[i];
+    if(e->page == 0){
+      victim = e;
+      break;
+    }
+    if(get_rmap(V2P(e->page)) == 0 &&
+       (victim == 0 || pcache.stamp - e->stamp > pcache.stamp - victim->stamp))
+      victim = e;
+  }
+  if(victim == 0){
+    release(&pcache.lock);
+    return -1;
+  }
+  if(victim->page)
+    old = pcremove(victim);
+  victim->dev = ip->dev;
+  victim->inum = ip->inum;
+  victim->off = off;
+  victim->n = n;
+  victim->page = page;
+  victim->stamp = pcache.stamp++;
+  victim->next = pcache.head[h];
+  pcache.head[h] = victim - pcache.ent;
+  pcache.frame[V2P(page) >> PTXSHIFT] = victim - pcache.ent + 1;
+  pcache.npages++;
+  pcmap(page, pte);     // page's first mapping: cannot fail
+  release(&pcache.lock);
+  if(old)
+    kfree(old);
+  return 0;
+}
+
+// Is the frame at pa cached?
+int
+pcache_has(uint pa)
+{
+  return pcache.frame[pa >> PTXSHIFT] != 0;
+}
+
+// Called by kfree(): nonzero keeps a cached frame from being
+// freed when its last mapping goes.
+int
+pcache_hold(uint pa)
+{
+  int held;
+
+  acquire(&pcache.lock);
+  held = pcache.frame[pa >> PTXSHIFT] != 0;
+  release(&pcache.lock);
+  return held;
+}
+
+// Reclaim the cached frame at pa, which CLOCK picked: unmap it
+// from every process, adding the PTEs to tb, and stop caching it.
+// Returns 1 if the frame is now the caller's to free once it has
+// flushed tb; or 0 if pcache_invalidate() dropped it meanwhile,
+// and its last mapping frees it.  Doing both under pcache.lock
+// leaves exactly one of them to free the frame.
+int
+pcache_reclaim(uint pa, struct tlbbatch *tb)
+{
+  int i;
+
+  acquire(&pcache.lock);
+  if((i = pcache.frame[pa >> PTXSHIFT]) == 0){
+    release(&pcache.lock);
+    return 0;
+  }
+  file_unmap(pa, tb);
+  pcremove(&pcache.ent[i - 1]);
+  pcache.drops++;
+  release(&pcache.lock);
+  return 1;
+}
+
+// Free the oldest cached frame nobody maps.
+// Returns 1 if a page was freed, 0 if there was none.
+int
+pcache_shrink(void)
+{
+  struct pcentry *e, *victim;
+  char *page;
+  int i;
+
+  victim = 0;
+  acquire(&pcache.lock);
+  for(i = 0; i < NPCACHE; i++){
+    e = &pcache.ent[i];
+    if(e->page == 0 || get_rmap(V2P(e->page)) != 0)
+      continue;
+    if(victim == 0 || pcache.stamp - e->stamp > pcache.stamp - victim->stamp)
+      victim = e;
+  }
+  if(victim == 0){
+    release(&pcache.lock);
+    return 0;
+  }
+  page = pcremove(victim);
+  pcache.drops++;
+  release(&pcache.lock);
+  kfree(page);
+  return 1;
+}
+
+// ip's contents are about to change: drop its pages.
+// Caller holds ip->lock.
+void
+pcache_invalidate(struct inode *ip)
+{
+  struct pcentry *e;
+  char *page;
+  int h, i;
+
+  h = pchash(ip->dev, ip->inum);
+  acquire(&pcache.lock);
+  pcache.gen[h]++;
+  for(;;){
+    for(i = pcache.head[h]; i >= 0; i = e->next){
+      e = &pcache.ent[i];
+      if(e->dev == ip->dev && e->inum == ip->inum)
+        break;
+    }
+    if(i < 0)
+      break;
+    page = pcremove(e);
+    pcache.invalidates++;
+    release(&pcache.lock);
+    // Still mapped: the last dec_rmap() frees it.
+    kfree(page);
+    acquire(&pcache.lock);
+  }
+  release(&pcache.lock);
+}
+
+void
+pcachestat(struct vmstat *st)
+{
+  st->pcachepages = pcache.npages;
+  st->pcachehits = pcache.hits;
+  st->pcachemisses = pcache.misses;
+  st->pcachedrops = pcache.drops;
+  st->pcacheinvalidates = pcache.invalidates;
+}
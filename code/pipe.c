@@ -75,33 +75,44 @@ pipeclose(struct pipe *p, int writable)
 }
 
 //PAGEBREAK: 40
+// User memory is copied through buf, outside p->lock: touching
+// it may fault a page in, which can sleep, or fail.
 int
 pipewrite(struct pipe *p, char *addr, int n)
 {
-  int i;
+  char buf[PIPESIZE];
+  int i, j, m;
 
-  acquire(&p->lock);
-  for(i = 0; i < n; i++){
-    while(p->nwrite == p->nread + PIPESIZE){  //DOC: pipewrite-full
-      if(p->readopen == 0 || myproc()->killed){
-        release(&p->lock);
-        return -1;
+  for(i = 0; i < n; i += m){
+    m = n - i < PIPESIZE ? n - i : PIPESIZE;
+    if(copyuser(buf, addr + i, m) < 0)
+      return -1;
+    acquire(&p->lock);
+    for(j = 0; j < m; j++){
+      while(p->nwrite == p->nread + PIPESIZE){  //DOC: pipewrite-full
+        if(p->readopen == 0 || myproc()->killed){
+          release(&p->lock);
+          return -1;
+        }
+        wakeup(&p->nread);
+        sleep(&p->nwrite, &p->lock);  //DOC: pipewrite-sleep
       }
-      wakeup(&p->nread);
-      sleep(&p->nwrite, &p->lock);  //DOC: pipewrite-sleep
+      p->data[p->nwrite++ % PIPESIZE] = buf[j];
     }
-    p->data[p->nwrite++ % PIPESIZE] = addr[i];
+    wakeup(&p->nread);  //DOC: pipewrite-wakeup1
+    release(&p->lock);
   }
-  wakeup(&p->nread);  //DOC: pipewrite-wakeup1
-  release(&p->lock);
   return n;
 }
 
 int
 piperead(struct pipe *p, char *addr, int n)
 {
+  char buf[PIPESIZE];
   int i;
 
+  if(n > PIPESIZE)
+    n = PIPESIZE;
   acquire(&p->lock);
   while(p->nread == p->nwrite && p->writeopen){  //DOC: pipe-empty
     if(myproc()->killed){
@@ -113,9 +124,11 @@ piperead(struct pipe *p, char *addr, int n)
   for(i = 0; i < n; i++){  //DOC: piperead-copy
     if(p->nread == p->nwrite)
       break;
-    addr[i] = p->data[p->nread++ % PIPESIZE];
+    buf[i] = p->data[p->nread++ % PIPESIZE];
   }
   wakeup(&p->nwrite);  //DOC: piperead-wakeup
   release(&p->lock);
+  if(copyuser(addr, buf, i) < 0)
+    return -1;
   return i;
 }
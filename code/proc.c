@@ -27,50 +27,6 @@ pinit(void)
   initlock(&ptable.lock, "ptable");
 }
 
-static pte_t *
-walkpgdir(pde_t *pgdir, const void *va, int alloc)
-{
-  pde_t *pde;
-  pte_t *pgtab;
-
-  pde = &pgdir[PDX(va)];
-  if(*pde & PTE_P){
-    pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
-  } else {
-    if(!alloc || (pgtab = (pte_t*)kalloc()) == 0)
-      return 0;
-    // Make sure all those PTE_P bits are zero.
-    memset(pgtab, 0, PGSIZE);
-    // The permissions here are overly generous, but they can
-    // be further restricted by the permissions in the page table
-    // entries, if necessary.
-    *pde = V2P(pgtab) | PTE_P | PTE_W | PTE_U;
-  }
-  return &pgtab[PTX(va)];
-}
-
-// pte_t *
-// walkpgdir(pde_t *pgdir, const void *va, int alloc)
-// {
-//   pde_t *pde;
-//   pte_t *pgtab;
-
-//   pde = &pgdir[PDX(va)];
-//   if(*pde & PTE_P){
-//     pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
-//   } else {
-//     if(!alloc || (pgtab = (pte_t*)kalloc()) == 0)
-//       return 0;
-//     // Make sure all those PTE_P bits are zero.
-//     memset(pgtab, 0, PGSIZE);
-//     // The permissions here are overly generous, but they can
-//     // be further restricted by the permissions in the page table
-//     // entries, if necessary.
-//     *pde = V2P(pgtab) | PTE_P | PTE_W | PTE_U;
-//   }
-//   return &pgtab[PTX(va)];
-// }
-
 // Must be called with interrupts disabled
 int
 cpuid() {
@@ -157,6 +113,8 @@ found:
   memset(p->context, 0, sizeof *p->context);
   p->context->eip = (uint)forkret;
   p->rss = PGSIZE;
+  p->exe = 0;
+  p->nseg = 0;
   return p;
 }
 
@@ -173,6 +131,7 @@ userinit(void)
   initproc = p;
   if((p->pgdir = setupkvm()) == 0)
     panic("userinit: out of memory?");
+  set_pt_owner(p->pgdir, p);
   inituvm(p->pgdir, _binary_initcode_start, (int)_binary_initcode_size);
   p->sz = PGSIZE;
   memset(p->tf, 0, sizeof(*p->tf));
@@ -197,6 +156,42 @@ userinit(void)
   release(&ptable.lock);
 }
 
+// A kernel thread's very first scheduling by scheduler()
+// will swtch here.  Like forkret, but "returns" into the
+// thread's function, which kthread() left on the stack.
+void
+kthreadret(void)
+{
+  // Still holding ptable.lock from scheduler.
+  release(&ptable.lock);
+}
+
+// Start a process that runs fn in the kernel and never
+// enters user space; fn must not return.  It runs on a
+// kernel-only page table and owns no user memory, so it
+// is never picked as a swap victim.
+struct proc*
+kthread(char *name, void (*fn)(void))
+{
+  struct proc *p;
+
+  if((p = allocproc()) == 0)
+    panic("kthread: no proc");
+  if((p->pgdir = setupkvm()) == 0)
+    panic("kthread: out of memory?");
+  set_pt_owner(p->pgdir, p);
+  p->sz = 0;
+  p->rss = 0;
+  p->context->eip = (uint)kthreadret;
+  *(uint*)(p->context + 1) = (uint)fn;  // in place of trapret
+  safestrcpy(p->name, name, sizeof(p->name));
+
+  acquire(&ptable.lock);
+  p->state = RUNNABLE;
+  release(&ptable.lock);
+  return p;
+}
+
 // Grow current process's memory by n bytes.
 // Return 0 on success, -1 on failure.
 int
@@ -208,9 +203,11 @@ growproc(int n)
   struct proc *curproc = myproc();
   sz = curproc->sz;
   if(n > 0){
-    if((sz = allocuvm(curproc->pgdir, sz, sz + n)) == 0){
-      return -1;}
-
+    // Just reserve the range; page_fault() maps each page
+    // when it is first touched.
+    if(sz + n < sz || sz + n >= KERNBASE)
+      return -1;
+    sz += n;
   } else if(n < 0){
     if((sz = deallocuvm(curproc->pgdir, sz, sz + n)) == 0){
       return -1;}
@@ -243,6 +240,9 @@ fork(void)
     return -1;
   }
   np->sz = curproc->sz;
+  // Every page the child maps is in a table copyuvm() shared,
+  // and counted there: see proc_rss().
+  np->rss = 0;
   np->parent = curproc;
   *np->tf = *curproc->tf;
 
@@ -253,6 +253,10 @@ fork(void)
     if(curproc->ofile[i])
       np->ofile[i] = filedup(curproc->ofile[i]);
   np->cwd = idup(curproc->cwd);
+  if(curproc->exe)
+    np->exe = iexecdup(curproc->exe);
+  memmove(np->seg, curproc->seg, sizeof(curproc->seg));
+  np->nseg = curproc->nseg;
 
   safestrcpy(np->name, curproc->name, sizeof(curproc->name));
 
@@ -267,6 +271,49 @@ fork(void)
   return pid;
 }
 
+// Create a process running path with argv, without first
+// copying the caller's address space as fork() and exec() would.
+// The child's descriptors 0, 1 and 2 are the caller's fds[0],
+// fds[1] and fds[2], or closed where those are negative; it gets
+// no others.  Returns the child's pid, or -1.
+int
+spawn(char *path, char **argv, int *fds)
+{
+  int i, pid;
+  struct proc *np;
+  struct proc *curproc = myproc();
+
+  if((np = allocproc()) == 0)
+    return -1;
+  *np->tf = *curproc->tf;
+  np->cwd = idup(curproc->cwd);
+  np->pgdir = 0;
+  if(exec_proc(np, path, argv) < 0){
+    begin_op();
+    iput(np->cwd);
+    end_op();
+    np->cwd = 0;
+    kfree(np->kstack);
+    np->kstack = 0;
+    np->state = UNUSED;
+    return -1;
+  }
+  for(i = 0; i < 3; i++)
+    if(fds[i] >= 0)
+      np->ofile[i] = filedup(curproc->ofile[fds[i]]);
+  np->parent = curproc;
+
+  pid = np->pid;
+
+  acquire(&ptable.lock);
+
+  np->state = RUNNABLE;
+
+  release(&ptable.lock);
+
+  return pid;
+}
+
 // Exit the current process.  Does not return.
 // An exited process remains in the zombie state
 // until its parent calls wait() to find out it exited.
@@ -288,6 +335,8 @@ exit(void)
     }
   }
 
+  // The executable stays held until wait() has freed the pages
+  // that may map its page cache; see there.
   begin_op();
   iput(curproc->cwd);
   end_op();
@@ -322,6 +371,7 @@ wait(void)
   struct proc *p;
   int havekids, pid;
   struct proc *curproc = myproc();
+  struct inode *exe;
   
   acquire(&ptable.lock);
   for(;;){
@@ -333,17 +383,25 @@ wait(void)
       havekids = 1;
       if(p->state == ZOMBIE){
         // Found one.
-        // zombie_kill(p->pgdir);
         pid = p->pid;
         kfree(p->kstack);
         p->kstack = 0;
         freevm_proc(p,p->pgdir);
+        // Only now may the executable be written, which drops
+        // its page cache: no page of it is still mapped here.
+        exe = p->exe;
+        p->exe = 0;
         p->pid = 0;
         p->parent = 0;
         p->name[0] = 0;
         p->killed = 0;
         p->state = UNUSED;
         release(&ptable.lock);
+        if(exe){
+          begin_op();
+          iexecput(exe);
+          end_op();
+        }
         return pid;
       }
     }
@@ -369,7 +427,7 @@ void print_rss()
   {
     if((p->state == UNUSED))
       continue;
-    cprintf("((P)) id: %d, state: %d, rss: %d\n",p->pid,p->state,p->rss);
+    cprintf("((P)) id: %d, state: %d, rss: %d\n",p->pid,p->state,proc_rss(p));
   }
   release(&ptable.lock);
 }
@@ -596,169 +654,3 @@ procdump(void)
     cprintf("\n");
   }
 }
-
-
-// Yeh maine bnaya hai // Rajat
-struct proc*
-select_victim_process(void){
-  struct proc *p;
-  uint max_rss = 0;
-  struct proc *victim = 0;
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
-    if(p->rss > max_rss){
-      victim = p;
-      max_rss = p->rss;
-    }
-    else if(p->rss == max_rss){
-      if(victim != 0){
-      if(p->pid < victim->pid){
-        victim = p;
-      }
-      }
-      else{
-        victim = p;
-      }
-    }
-  }
-  return victim;
-}
-
-// Yeh maine bnaya hai // Rajat
-pte_t*
-select_victim_page(struct proc* victim){
-  // cprintf("rss %d\n", victim->rss);
-  // cprintf("Selecting victim page\n");
-  pde_t* pg_dir = victim->pgdir;
-  
-  pte_t* pte;
-  // cprintf("Selecting victim page\n");
-  for(int i=0; i<NPDENTRIES; i++){
-    if(!(pg_dir[i] & PTE_P)){
-      continue;
-    }
-    pte_t* pg_table = (pte_t*) P2V(PTE_ADDR(pg_dir[i])); 
-    for(int j=0; j<NPTENTRIES; j++){
-      /*
-      if((pagetable[j] & PTE_P) && !(pagetable[j] & PTE_A) && 
-          ((char*) P2V(PTE_ADDR(pagetable[j])) > 0x80116650)
-      */
-     if(pg_table[j] & PTE_P){
-      if(pg_table[j] & PTE_U){
-        if(!(pg_table[j] & PTE_A)){
-          pte = &pg_table[j];
-          return pte;
-      }
-     }
-    }
-  }
-  }
-  // // Let's write
-  // pde_t* pg_dir = victim->pgdir;
-  // uint sz = KERNBASE;
-  // uint i;
-  // for(i=0;i<sz;i+=PGSIZE){
-  //   pte_t* pte = walkpgdir(pg_dir, (char*)i, 0);
-  //   if(pte == 0){
-  //     panic("PTE not found");
-  //   }
-  //   if(*pte & PTE_P){
-  //     if(!(*pte & PTE_A)){
-  //       return pte;
-  //     }
-  //   }
-  // }
-
-  return 0;
-}
-
-
-// Yeh maine bnaya hai // Rajat
-void
-clear_access(struct proc* p){
-  // for every 10th access, clear the access bit
-  pde_t* pg_dir = p->pgdir;
-  pte_t* pg_table;
-  uint count = 0;
-  for(int i=0; i<NPDENTRIES; i++){
-    if(!(pg_dir[i] & PTE_P)){
-      continue;
-    }
-    pg_table = (pte_t*) P2V(PTE_ADDR(pg_dir[i]));
-    for(int j=0; j<NPTENTRIES; j++){
-      // if(pg_table[j] & PTE_P){
-        if((pg_table[j] & PTE_A) && (pg_table[j] & PTE_P) && (pg_table[j] & PTE_U)){
-          if(count == 0){
-            pg_table[j] &= (~PTE_A);
-          }
-          count = (count + 1) % 10;
-        }
-    }
-  } 
-
-}
-
-// Yeh maine bnaya hai // Rajat
-pte_t*
-page_replacement(){
-  // cprintf("Page replacement called\n");
-  struct proc* victim = select_victim_process();
-  // victim->rss -= PGSIZE;
-  // cprintf("Victim selected: %d\n", victim->pid);
-  pte_t* pte = select_victim_page(victim);
-  // cprintf("Victim page selected: %x\n", PTE_ADDR(*pte));
-  while(pte == 0){
-    clear_access(victim);
-    pte = select_victim_page(victim);
-  }
-  return pte;
-}
-
-
-
-void rss_decrementer(uint pa){
-    // decrement the rss of the process using this page
-    struct proc* p;
-    for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
-        if(p->state == UNUSED){
-            continue;
-        }
-        pde_t* pg_dir = p->pgdir;
-        uint sz = p->sz;
-        uint i;
-        for(i=0;i<sz;i+=PGSIZE){
-            pte_t* pte = walkpgdir(pg_dir, (char*)i, 0);
-            if(*pte & PTE_P){
-                if(PTE_ADDR(*pte) == pa){
-                    // cprintf("RSS decremented for process %d\n", p->pid);
-                    p->rss -= PGSIZE;
-                    break;
-                    // return;
-                }
-            }
-        }
-    }
-}
-
-void rss_incrementer(uint pa){
-    // increment the rss of the process using this page
-    struct proc* p;
-    for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
-        if(p->state == UNUSED){
-            continue;
-        }
-        pde_t* pg_dir = p->pgdir;
-        uint sz = p->sz;
-        uint i;
-        for(i=0;i<sz;i+=PGSIZE){
-            pte_t* pte = walkpgdir(pg_dir, (char*)i, 0);
-            if(*pte & PTE_P){
-                if(PTE_ADDR(*pte) == pa){
-                    // cprintf("RSS incremented for process %d\n", p->pid);
-                    p->rss += PGSIZE;
-                    break;
-                    // return;
-                }
-            }
-        }
-    }
-}
\ No newline at end of file
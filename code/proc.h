@@ -32,6 +32,16 @@ struct context {
   uint eip;
 };
 
+#define NSEG 4                 // program segments read in on demand
+
+// A loadable ELF segment that exec() left in the executable.
+// page_fault() reads its pages from there on first touch.
+struct seg {
+  uint va;                     // page-aligned start
+  uint filesz;                 // bytes from the file; the rest is bss
+  uint off;                    // file offset of va
+};
+
 enum procstate { UNUSED, EMBRYO, SLEEPING, RUNNABLE, RUNNING, ZOMBIE };
 
 // Per-process state
@@ -49,6 +59,9 @@ struct proc {
   int killed;                  // If non-zero, have been killed
   struct file *ofile[NOFILE];  // Open files
   struct inode *cwd;           // Current directory
+  struct inode *exe;           // Executable backing seg[]
+  struct seg seg[NSEG];        // File-backed program segments
+  int nseg;                    // Number of entries in seg
   char name[16];               // Process name (debugging)
 };
 
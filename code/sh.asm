@@ -0,0 +1,2893 @@
+
+_sh:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  return 0;
+}
+
+int
+main(void)
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	53                   	push   %ebx
+       e:	51                   	push   %ecx
+  static char buf[100];
+  int fd;
+  struct cmd *cmd;
+
+  // Ensure that three file descriptors are open.
+  while((fd = open("console", O_RDWR)) >= 0){
+       f:	eb 10                	jmp    21 <main+0x21>
+      11:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(fd >= 3){
+      18:	83 f8 02             	cmp    $0x2,%eax
+      1b:	0f 8f 1d 01 00 00    	jg     13e <main+0x13e>
+  while((fd = open("console", O_RDWR)) >= 0){
+      21:	83 ec 08             	sub    $0x8,%esp
+      24:	6a 02                	push   $0x2
+      26:	68 e9 14 00 00       	push   $0x14e9
+      2b:	e8 c3 0f 00 00       	call   ff3 <open>
+      30:	83 c4 10             	add    $0x10,%esp
+      33:	85 c0                	test   %eax,%eax
+      35:	79 e1                	jns    18 <main+0x18>
+      37:	eb 2e                	jmp    67 <main+0x67>
+      39:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+int
+fork1(void)
+{
+  int pid;
+
+  pid = fork();
+      40:	e8 66 0f 00 00       	call   fab <fork>
+  if(pid == -1)
+      45:	83 f8 ff             	cmp    $0xffffffff,%eax
+      48:	0f 84 01 01 00 00    	je     14f <main+0x14f>
+    if(spawncmd(cmd) < 0 && fork1() == 0)
+      4e:	85 c0                	test   %eax,%eax
+      50:	0f 84 df 00 00 00    	je     135 <main+0x135>
+    wait();
+      56:	e8 60 0f 00 00       	call   fbb <wait>
+    freecmd(cmd);
+      5b:	83 ec 0c             	sub    $0xc,%esp
+      5e:	53                   	push   %ebx
+      5f:	e8 8c 0c 00 00       	call   cf0 <freecmd>
+      64:	83 c4 10             	add    $0x10,%esp
+  printf(2, "$ ");
+      67:	83 ec 08             	sub    $0x8,%esp
+      6a:	68 48 14 00 00       	push   $0x1448
+      6f:	6a 02                	push   $0x2
+      71:	e8 aa 10 00 00       	call   1120 <printf>
+  memset(buf, 0, nbuf);
+      76:	83 c4 0c             	add    $0xc,%esp
+      79:	6a 64                	push   $0x64
+      7b:	6a 00                	push   $0x0
+      7d:	68 c0 1b 00 00       	push   $0x1bc0
+      82:	e8 a9 0d 00 00       	call   e30 <memset>
+  gets(buf, nbuf);
+      87:	58                   	pop    %eax
+      88:	5a                   	pop    %edx
+      89:	6a 64                	push   $0x64
+      8b:	68 c0 1b 00 00       	push   $0x1bc0
+      90:	e8 fb 0d 00 00       	call   e90 <gets>
+  if(buf[0] == 0) // EOF
+      95:	0f b6 05 c0 1b 00 00 	movzbl 0x1bc0,%eax
+      9c:	83 c4 10             	add    $0x10,%esp
+      9f:	84 c0                	test   %al,%al
+      a1:	0f 84 89 00 00 00    	je     130 <main+0x130>
+    if(buf[0] == 'c' && buf[1] == 'd' && buf[2] == ' '){
+      a7:	3c 63                	cmp    $0x63,%al
+      a9:	75 09                	jne    b4 <main+0xb4>
+      ab:	80 3d c1 1b 00 00 64 	cmpb   $0x64,0x1bc1
+      b2:	74 2c                	je     e0 <main+0xe0>
+    cmd = parsecmd(buf);
+      b4:	83 ec 0c             	sub    $0xc,%esp
+      b7:	68 c0 1b 00 00       	push   $0x1bc0
+      bc:	e8 bf 0b 00 00       	call   c80 <parsecmd>
+    if(spawncmd(cmd) < 0 && fork1() == 0)
+      c1:	89 04 24             	mov    %eax,(%esp)
+    cmd = parsecmd(buf);
+      c4:	89 c3                	mov    %eax,%ebx
+    if(spawncmd(cmd) < 0 && fork1() == 0)
+      c6:	e8 95 00 00 00       	call   160 <spawncmd>
+      cb:	83 c4 10             	add    $0x10,%esp
+      ce:	85 c0                	test   %eax,%eax
+      d0:	79 84                	jns    56 <main+0x56>
+      d2:	e9 69 ff ff ff       	jmp    40 <main+0x40>
+      d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      de:	66 90                	xchg   %ax,%ax
+    if(buf[0] == 'c' && buf[1] == 'd' && buf[2] == ' '){
+      e0:	80 3d c2 1b 00 00 20 	cmpb   $0x20,0x1bc2
+      e7:	75 cb                	jne    b4 <main+0xb4>
+      buf[strlen(buf)-1] = 0;  // chop \n
+      e9:	83 ec 0c             	sub    $0xc,%esp
+      ec:	68 c0 1b 00 00       	push   $0x1bc0
+      f1:	e8 0a 0d 00 00       	call   e00 <strlen>
+      if(chdir(buf+3) < 0)
+      f6:	c7 04 24 c3 1b 00 00 	movl   $0x1bc3,(%esp)
+      buf[strlen(buf)-1] = 0;  // chop \n
+      fd:	c6 80 bf 1b 00 00 00 	movb   $0x0,0x1bbf(%eax)
+      if(chdir(buf+3) < 0)
+     104:	e8 1a 0f 00 00       	call   1023 <chdir>
+     109:	83 c4 10             	add    $0x10,%esp
+     10c:	85 c0                	test   %eax,%eax
+     10e:	0f 89 53 ff ff ff    	jns    67 <main+0x67>
+        printf(2, "cannot cd %s\n", buf+3);
+     114:	51                   	push   %ecx
+     115:	68 c3 1b 00 00       	push   $0x1bc3
+     11a:	68 f1 14 00 00       	push   $0x14f1
+     11f:	6a 02                	push   $0x2
+     121:	e8 fa 0f 00 00       	call   1120 <printf>
+     126:	83 c4 10             	add    $0x10,%esp
+     129:	e9 39 ff ff ff       	jmp    67 <main+0x67>
+     12e:	66 90                	xchg   %ax,%ax
+  exit();
+     130:	e8 7e 0e 00 00       	call   fb3 <exit>
+      runcmd(cmd);
+     135:	83 ec 0c             	sub    $0xc,%esp
+     138:	53                   	push   %ebx
+     139:	e8 92 01 00 00       	call   2d0 <runcmd>
+      close(fd);
+     13e:	83 ec 0c             	sub    $0xc,%esp
+     141:	50                   	push   %eax
+     142:	e8 94 0e 00 00       	call   fdb <close>
+      break;
+     147:	83 c4 10             	add    $0x10,%esp
+     14a:	e9 18 ff ff ff       	jmp    67 <main+0x67>
+    panic("fork");
+     14f:	83 ec 0c             	sub    $0xc,%esp
+     152:	68 4b 14 00 00       	push   $0x144b
+     157:	e8 34 01 00 00       	call   290 <panic>
+     15c:	66 90                	xchg   %ax,%ax
+     15e:	66 90                	xchg   %ax,%ax
+
+00000160 <spawncmd>:
+{
+     160:	55                   	push   %ebp
+     161:	89 e5                	mov    %esp,%ebp
+     163:	57                   	push   %edi
+     164:	56                   	push   %esi
+  pid = -1;
+     165:	be ff ff ff ff       	mov    $0xffffffff,%esi
+{
+     16a:	53                   	push   %ebx
+     16b:	83 ec 4c             	sub    $0x4c,%esp
+     16e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  fds[0] = 0;
+     171:	c7 45 b4 00 00 00 00 	movl   $0x0,-0x4c(%ebp)
+  fds[1] = 1;
+     178:	c7 45 b8 01 00 00 00 	movl   $0x1,-0x48(%ebp)
+  fds[2] = 2;
+     17f:	c7 45 bc 02 00 00 00 	movl   $0x2,-0x44(%ebp)
+  while(cmd && cmd->type == REDIR && n < MAXARGS){
+     186:	85 db                	test   %ebx,%ebx
+     188:	0f 84 96 00 00 00    	je     224 <spawncmd+0xc4>
+     18e:	31 ff                	xor    %edi,%edi
+     190:	eb 43                	jmp    1d5 <spawncmd+0x75>
+     192:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(rcmd->fd > 2 || (fds[rcmd->fd] = open(rcmd->file, rcmd->mode)) < 0)
+     198:	8b 73 14             	mov    0x14(%ebx),%esi
+     19b:	83 fe 02             	cmp    $0x2,%esi
+     19e:	0f 8f 8c 00 00 00    	jg     230 <spawncmd+0xd0>
+     1a4:	83 ec 08             	sub    $0x8,%esp
+     1a7:	ff 73 10             	push   0x10(%ebx)
+     1aa:	ff 73 08             	push   0x8(%ebx)
+     1ad:	e8 41 0e 00 00       	call   ff3 <open>
+     1b2:	83 c4 10             	add    $0x10,%esp
+     1b5:	89 44 b5 b4          	mov    %eax,-0x4c(%ebp,%esi,4)
+     1b9:	85 c0                	test   %eax,%eax
+     1bb:	78 73                	js     230 <spawncmd+0xd0>
+    opened[n++] = fds[rcmd->fd];
+     1bd:	8b 53 14             	mov    0x14(%ebx),%edx
+    cmd = rcmd->cmd;
+     1c0:	8b 5b 04             	mov    0x4(%ebx),%ebx
+    opened[n++] = fds[rcmd->fd];
+     1c3:	83 c7 01             	add    $0x1,%edi
+     1c6:	8d 45 c0             	lea    -0x40(%ebp),%eax
+     1c9:	8b 54 95 b4          	mov    -0x4c(%ebp,%edx,4),%edx
+     1cd:	89 54 bd bc          	mov    %edx,-0x44(%ebp,%edi,4)
+  while(cmd && cmd->type == REDIR && n < MAXARGS){
+     1d1:	85 db                	test   %ebx,%ebx
+     1d3:	74 6b                	je     240 <spawncmd+0xe0>
+     1d5:	83 3b 02             	cmpl   $0x2,(%ebx)
+     1d8:	75 05                	jne    1df <spawncmd+0x7f>
+     1da:	83 ff 0a             	cmp    $0xa,%edi
+     1dd:	75 b9                	jne    198 <spawncmd+0x38>
+  if(cmd && cmd->type == EXEC){
+     1df:	83 3b 01             	cmpl   $0x1,(%ebx)
+     1e2:	75 4c                	jne    230 <spawncmd+0xd0>
+    if(ecmd->argv[0])
+     1e4:	8b 43 04             	mov    0x4(%ebx),%eax
+     1e7:	85 c0                	test   %eax,%eax
+     1e9:	74 45                	je     230 <spawncmd+0xd0>
+      pid = spawn(ecmd->argv[0], ecmd->argv, fds);
+     1eb:	83 ec 04             	sub    $0x4,%esp
+     1ee:	8d 55 b4             	lea    -0x4c(%ebp),%edx
+     1f1:	83 c3 04             	add    $0x4,%ebx
+     1f4:	52                   	push   %edx
+     1f5:	53                   	push   %ebx
+     1f6:	50                   	push   %eax
+     1f7:	e8 77 0e 00 00       	call   1073 <spawn>
+     1fc:	83 c4 10             	add    $0x10,%esp
+     1ff:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < n; i++)
+     201:	85 ff                	test   %edi,%edi
+     203:	74 1f                	je     224 <spawncmd+0xc4>
+     205:	8d 45 c0             	lea    -0x40(%ebp),%eax
+     208:	89 c3                	mov    %eax,%ebx
+     20a:	8d 3c b8             	lea    (%eax,%edi,4),%edi
+     20d:	8d 76 00             	lea    0x0(%esi),%esi
+    close(opened[i]);
+     210:	83 ec 0c             	sub    $0xc,%esp
+     213:	ff 33                	push   (%ebx)
+  for(i = 0; i < n; i++)
+     215:	83 c3 04             	add    $0x4,%ebx
+    close(opened[i]);
+     218:	e8 be 0d 00 00       	call   fdb <close>
+  for(i = 0; i < n; i++)
+     21d:	83 c4 10             	add    $0x10,%esp
+     220:	39 fb                	cmp    %edi,%ebx
+     222:	75 ec                	jne    210 <spawncmd+0xb0>
+}
+     224:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     227:	89 f0                	mov    %esi,%eax
+     229:	5b                   	pop    %ebx
+     22a:	5e                   	pop    %esi
+     22b:	5f                   	pop    %edi
+     22c:	5d                   	pop    %ebp
+     22d:	c3                   	ret
+     22e:	66 90                	xchg   %ax,%ax
+  pid = -1;
+     230:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     235:	eb ca                	jmp    201 <spawncmd+0xa1>
+     237:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     23e:	66 90                	xchg   %ax,%ax
+     240:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     245:	eb c1                	jmp    208 <spawncmd+0xa8>
+     247:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     24e:	66 90                	xchg   %ax,%ax
+
+00000250 <getcmd>:
+{
+     250:	55                   	push   %ebp
+     251:	89 e5                	mov    %esp,%ebp
+     253:	56                   	push   %esi
+     254:	53                   	push   %ebx
+     255:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     258:	8b 75 0c             	mov    0xc(%ebp),%esi
+  printf(2, "$ ");
+     25b:	83 ec 08             	sub    $0x8,%esp
+     25e:	68 48 14 00 00       	push   $0x1448
+     263:	6a 02                	push   $0x2
+     265:	e8 b6 0e 00 00       	call   1120 <printf>
+  memset(buf, 0, nbuf);
+     26a:	83 c4 0c             	add    $0xc,%esp
+     26d:	56                   	push   %esi
+     26e:	6a 00                	push   $0x0
+     270:	53                   	push   %ebx
+     271:	e8 ba 0b 00 00       	call   e30 <memset>
+  gets(buf, nbuf);
+     276:	58                   	pop    %eax
+     277:	5a                   	pop    %edx
+     278:	56                   	push   %esi
+     279:	53                   	push   %ebx
+     27a:	e8 11 0c 00 00       	call   e90 <gets>
+  if(buf[0] == 0) // EOF
+     27f:	83 c4 10             	add    $0x10,%esp
+     282:	80 3b 01             	cmpb   $0x1,(%ebx)
+     285:	19 c0                	sbb    %eax,%eax
+}
+     287:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     28a:	5b                   	pop    %ebx
+     28b:	5e                   	pop    %esi
+     28c:	5d                   	pop    %ebp
+     28d:	c3                   	ret
+     28e:	66 90                	xchg   %ax,%ax
+
+00000290 <panic>:
+{
+     290:	55                   	push   %ebp
+     291:	89 e5                	mov    %esp,%ebp
+     293:	83 ec 0c             	sub    $0xc,%esp
+  printf(2, "%s\n", s);
+     296:	ff 75 08             	push   0x8(%ebp)
+     299:	68 e5 14 00 00       	push   $0x14e5
+     29e:	6a 02                	push   $0x2
+     2a0:	e8 7b 0e 00 00       	call   1120 <printf>
+  exit();
+     2a5:	e8 09 0d 00 00       	call   fb3 <exit>
+     2aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000002b0 <fork1>:
+{
+     2b0:	55                   	push   %ebp
+     2b1:	89 e5                	mov    %esp,%ebp
+     2b3:	83 ec 08             	sub    $0x8,%esp
+  pid = fork();
+     2b6:	e8 f0 0c 00 00       	call   fab <fork>
+  if(pid == -1)
+     2bb:	83 f8 ff             	cmp    $0xffffffff,%eax
+     2be:	74 02                	je     2c2 <fork1+0x12>
+  return pid;
+}
+     2c0:	c9                   	leave
+     2c1:	c3                   	ret
+    panic("fork");
+     2c2:	83 ec 0c             	sub    $0xc,%esp
+     2c5:	68 4b 14 00 00       	push   $0x144b
+     2ca:	e8 c1 ff ff ff       	call   290 <panic>
+     2cf:	90                   	nop
+
+000002d0 <runcmd>:
+{
+     2d0:	55                   	push   %ebp
+     2d1:	89 e5                	mov    %esp,%ebp
+     2d3:	53                   	push   %ebx
+     2d4:	83 ec 14             	sub    $0x14,%esp
+     2d7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(cmd == 0)
+     2da:	85 db                	test   %ebx,%ebx
+     2dc:	74 42                	je     320 <runcmd+0x50>
+  switch(cmd->type){
+     2de:	83 3b 05             	cmpl   $0x5,(%ebx)
+     2e1:	0f 87 e3 00 00 00    	ja     3ca <runcmd+0xfa>
+     2e7:	8b 03                	mov    (%ebx),%eax
+     2e9:	ff 24 85 00 15 00 00 	jmp    *0x1500(,%eax,4)
+    if(ecmd->argv[0] == 0)
+     2f0:	8b 43 04             	mov    0x4(%ebx),%eax
+     2f3:	85 c0                	test   %eax,%eax
+     2f5:	74 29                	je     320 <runcmd+0x50>
+    exec(ecmd->argv[0], ecmd->argv);
+     2f7:	8d 53 04             	lea    0x4(%ebx),%edx
+     2fa:	51                   	push   %ecx
+     2fb:	51                   	push   %ecx
+     2fc:	52                   	push   %edx
+     2fd:	50                   	push   %eax
+     2fe:	e8 e8 0c 00 00       	call   feb <exec>
+    printf(2, "exec %s failed\n", ecmd->argv[0]);
+     303:	83 c4 0c             	add    $0xc,%esp
+     306:	ff 73 04             	push   0x4(%ebx)
+     309:	68 57 14 00 00       	push   $0x1457
+     30e:	6a 02                	push   $0x2
+     310:	e8 0b 0e 00 00       	call   1120 <printf>
+    break;
+     315:	83 c4 10             	add    $0x10,%esp
+     318:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     31f:	90                   	nop
+    exit();
+     320:	e8 8e 0c 00 00       	call   fb3 <exit>
+    if(fork1() == 0)
+     325:	e8 86 ff ff ff       	call   2b0 <fork1>
+     32a:	85 c0                	test   %eax,%eax
+     32c:	75 f2                	jne    320 <runcmd+0x50>
+     32e:	e9 8c 00 00 00       	jmp    3bf <runcmd+0xef>
+    if(pipe(p) < 0)
+     333:	83 ec 0c             	sub    $0xc,%esp
+     336:	8d 45 f0             	lea    -0x10(%ebp),%eax
+     339:	50                   	push   %eax
+     33a:	e8 84 0c 00 00       	call   fc3 <pipe>
+     33f:	83 c4 10             	add    $0x10,%esp
+     342:	85 c0                	test   %eax,%eax
+     344:	0f 88 a2 00 00 00    	js     3ec <runcmd+0x11c>
+    if(fork1() == 0){
+     34a:	e8 61 ff ff ff       	call   2b0 <fork1>
+     34f:	85 c0                	test   %eax,%eax
+     351:	0f 84 a2 00 00 00    	je     3f9 <runcmd+0x129>
+    if(fork1() == 0){
+     357:	e8 54 ff ff ff       	call   2b0 <fork1>
+     35c:	85 c0                	test   %eax,%eax
+     35e:	0f 84 c3 00 00 00    	je     427 <runcmd+0x157>
+    close(p[0]);
+     364:	83 ec 0c             	sub    $0xc,%esp
+     367:	ff 75 f0             	push   -0x10(%ebp)
+     36a:	e8 6c 0c 00 00       	call   fdb <close>
+    close(p[1]);
+     36f:	58                   	pop    %eax
+     370:	ff 75 f4             	push   -0xc(%ebp)
+     373:	e8 63 0c 00 00       	call   fdb <close>
+    wait();
+     378:	e8 3e 0c 00 00       	call   fbb <wait>
+    wait();
+     37d:	e8 39 0c 00 00       	call   fbb <wait>
+    break;
+     382:	83 c4 10             	add    $0x10,%esp
+     385:	eb 99                	jmp    320 <runcmd+0x50>
+    if(fork1() == 0)
+     387:	e8 24 ff ff ff       	call   2b0 <fork1>
+     38c:	85 c0                	test   %eax,%eax
+     38e:	74 2f                	je     3bf <runcmd+0xef>
+    wait();
+     390:	e8 26 0c 00 00       	call   fbb <wait>
+    runcmd(lcmd->right);
+     395:	83 ec 0c             	sub    $0xc,%esp
+     398:	ff 73 08             	push   0x8(%ebx)
+     39b:	e8 30 ff ff ff       	call   2d0 <runcmd>
+    close(rcmd->fd);
+     3a0:	83 ec 0c             	sub    $0xc,%esp
+     3a3:	ff 73 14             	push   0x14(%ebx)
+     3a6:	e8 30 0c 00 00       	call   fdb <close>
+    if(open(rcmd->file, rcmd->mode) < 0){
+     3ab:	58                   	pop    %eax
+     3ac:	5a                   	pop    %edx
+     3ad:	ff 73 10             	push   0x10(%ebx)
+     3b0:	ff 73 08             	push   0x8(%ebx)
+     3b3:	e8 3b 0c 00 00       	call   ff3 <open>
+     3b8:	83 c4 10             	add    $0x10,%esp
+     3bb:	85 c0                	test   %eax,%eax
+     3bd:	78 18                	js     3d7 <runcmd+0x107>
+      runcmd(bcmd->cmd);
+     3bf:	83 ec 0c             	sub    $0xc,%esp
+     3c2:	ff 73 04             	push   0x4(%ebx)
+     3c5:	e8 06 ff ff ff       	call   2d0 <runcmd>
+    panic("runcmd");
+     3ca:	83 ec 0c             	sub    $0xc,%esp
+     3cd:	68 50 14 00 00       	push   $0x1450
+     3d2:	e8 b9 fe ff ff       	call   290 <panic>
+      printf(2, "open %s failed\n", rcmd->file);
+     3d7:	51                   	push   %ecx
+     3d8:	ff 73 08             	push   0x8(%ebx)
+     3db:	68 67 14 00 00       	push   $0x1467
+     3e0:	6a 02                	push   $0x2
+     3e2:	e8 39 0d 00 00       	call   1120 <printf>
+      exit();
+     3e7:	e8 c7 0b 00 00       	call   fb3 <exit>
+      panic("pipe");
+     3ec:	83 ec 0c             	sub    $0xc,%esp
+     3ef:	68 77 14 00 00       	push   $0x1477
+     3f4:	e8 97 fe ff ff       	call   290 <panic>
+      close(1);
+     3f9:	83 ec 0c             	sub    $0xc,%esp
+     3fc:	6a 01                	push   $0x1
+     3fe:	e8 d8 0b 00 00       	call   fdb <close>
+      dup(p[1]);
+     403:	58                   	pop    %eax
+     404:	ff 75 f4             	push   -0xc(%ebp)
+     407:	e8 1f 0c 00 00       	call   102b <dup>
+      close(p[0]);
+     40c:	58                   	pop    %eax
+     40d:	ff 75 f0             	push   -0x10(%ebp)
+     410:	e8 c6 0b 00 00       	call   fdb <close>
+      close(p[1]);
+     415:	58                   	pop    %eax
+     416:	ff 75 f4             	push   -0xc(%ebp)
+     419:	e8 bd 0b 00 00       	call   fdb <close>
+      runcmd(pcmd->left);
+     41e:	5a                   	pop    %edx
+     41f:	ff 73 04             	push   0x4(%ebx)
+     422:	e8 a9 fe ff ff       	call   2d0 <runcmd>
+      close(0);
+     427:	83 ec 0c             	sub    $0xc,%esp
+     42a:	6a 00                	push   $0x0
+     42c:	e8 aa 0b 00 00       	call   fdb <close>
+      dup(p[0]);
+     431:	5a                   	pop    %edx
+     432:	ff 75 f0             	push   -0x10(%ebp)
+     435:	e8 f1 0b 00 00       	call   102b <dup>
+      close(p[0]);
+     43a:	59                   	pop    %ecx
+     43b:	ff 75 f0             	push   -0x10(%ebp)
+     43e:	e8 98 0b 00 00       	call   fdb <close>
+      close(p[1]);
+     443:	58                   	pop    %eax
+     444:	ff 75 f4             	push   -0xc(%ebp)
+     447:	e8 8f 0b 00 00       	call   fdb <close>
+      runcmd(pcmd->right);
+     44c:	58                   	pop    %eax
+     44d:	ff 73 08             	push   0x8(%ebx)
+     450:	e8 7b fe ff ff       	call   2d0 <runcmd>
+     455:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     45c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000460 <execcmd>:
+//PAGEBREAK!
+// Constructors
+
+struct cmd*
+execcmd(void)
+{
+     460:	55                   	push   %ebp
+     461:	89 e5                	mov    %esp,%ebp
+     463:	53                   	push   %ebx
+     464:	83 ec 10             	sub    $0x10,%esp
+  struct execcmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     467:	6a 54                	push   $0x54
+     469:	e8 f2 0e 00 00       	call   1360 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     46e:	83 c4 0c             	add    $0xc,%esp
+     471:	6a 54                	push   $0x54
+  cmd = malloc(sizeof(*cmd));
+     473:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     475:	6a 00                	push   $0x0
+     477:	50                   	push   %eax
+     478:	e8 b3 09 00 00       	call   e30 <memset>
+  cmd->type = EXEC;
+     47d:	c7 03 01 00 00 00    	movl   $0x1,(%ebx)
+  return (struct cmd*)cmd;
+}
+     483:	89 d8                	mov    %ebx,%eax
+     485:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     488:	c9                   	leave
+     489:	c3                   	ret
+     48a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000490 <redircmd>:
+
+struct cmd*
+redircmd(struct cmd *subcmd, char *file, char *efile, int mode, int fd)
+{
+     490:	55                   	push   %ebp
+     491:	89 e5                	mov    %esp,%ebp
+     493:	53                   	push   %ebx
+     494:	83 ec 10             	sub    $0x10,%esp
+  struct redircmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     497:	6a 18                	push   $0x18
+     499:	e8 c2 0e 00 00       	call   1360 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     49e:	83 c4 0c             	add    $0xc,%esp
+     4a1:	6a 18                	push   $0x18
+  cmd = malloc(sizeof(*cmd));
+     4a3:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     4a5:	6a 00                	push   $0x0
+     4a7:	50                   	push   %eax
+     4a8:	e8 83 09 00 00       	call   e30 <memset>
+  cmd->type = REDIR;
+  cmd->cmd = subcmd;
+     4ad:	8b 45 08             	mov    0x8(%ebp),%eax
+  cmd->type = REDIR;
+     4b0:	c7 03 02 00 00 00    	movl   $0x2,(%ebx)
+  cmd->cmd = subcmd;
+     4b6:	89 43 04             	mov    %eax,0x4(%ebx)
+  cmd->file = file;
+     4b9:	8b 45 0c             	mov    0xc(%ebp),%eax
+     4bc:	89 43 08             	mov    %eax,0x8(%ebx)
+  cmd->efile = efile;
+     4bf:	8b 45 10             	mov    0x10(%ebp),%eax
+     4c2:	89 43 0c             	mov    %eax,0xc(%ebx)
+  cmd->mode = mode;
+     4c5:	8b 45 14             	mov    0x14(%ebp),%eax
+     4c8:	89 43 10             	mov    %eax,0x10(%ebx)
+  cmd->fd = fd;
+     4cb:	8b 45 18             	mov    0x18(%ebp),%eax
+     4ce:	89 43 14             	mov    %eax,0x14(%ebx)
+  return (struct cmd*)cmd;
+}
+     4d1:	89 d8                	mov    %ebx,%eax
+     4d3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     4d6:	c9                   	leave
+     4d7:	c3                   	ret
+     4d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     4df:	90                   	nop
+
+000004e0 <pipecmd>:
+
+struct cmd*
+pipecmd(struct cmd *left, struct cmd *right)
+{
+     4e0:	55                   	push   %ebp
+     4e1:	89 e5                	mov    %esp,%ebp
+     4e3:	53                   	push   %ebx
+     4e4:	83 ec 10             	sub    $0x10,%esp
+  struct pipecmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     4e7:	6a 0c                	push   $0xc
+     4e9:	e8 72 0e 00 00       	call   1360 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     4ee:	83 c4 0c             	add    $0xc,%esp
+     4f1:	6a 0c                	push   $0xc
+  cmd = malloc(sizeof(*cmd));
+     4f3:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     4f5:	6a 00                	push   $0x0
+     4f7:	50                   	push   %eax
+     4f8:	e8 33 09 00 00       	call   e30 <memset>
+  cmd->type = PIPE;
+  cmd->left = left;
+     4fd:	8b 45 08             	mov    0x8(%ebp),%eax
+  cmd->type = PIPE;
+     500:	c7 03 03 00 00 00    	movl   $0x3,(%ebx)
+  cmd->left = left;
+     506:	89 43 04             	mov    %eax,0x4(%ebx)
+  cmd->right = right;
+     509:	8b 45 0c             	mov    0xc(%ebp),%eax
+     50c:	89 43 08             	mov    %eax,0x8(%ebx)
+  return (struct cmd*)cmd;
+}
+     50f:	89 d8                	mov    %ebx,%eax
+     511:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     514:	c9                   	leave
+     515:	c3                   	ret
+     516:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     51d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000520 <listcmd>:
+
+struct cmd*
+listcmd(struct cmd *left, struct cmd *right)
+{
+     520:	55                   	push   %ebp
+     521:	89 e5                	mov    %esp,%ebp
+     523:	53                   	push   %ebx
+     524:	83 ec 10             	sub    $0x10,%esp
+  struct listcmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     527:	6a 0c                	push   $0xc
+     529:	e8 32 0e 00 00       	call   1360 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     52e:	83 c4 0c             	add    $0xc,%esp
+     531:	6a 0c                	push   $0xc
+  cmd = malloc(sizeof(*cmd));
+     533:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     535:	6a 00                	push   $0x0
+     537:	50                   	push   %eax
+     538:	e8 f3 08 00 00       	call   e30 <memset>
+  cmd->type = LIST;
+  cmd->left = left;
+     53d:	8b 45 08             	mov    0x8(%ebp),%eax
+  cmd->type = LIST;
+     540:	c7 03 04 00 00 00    	movl   $0x4,(%ebx)
+  cmd->left = left;
+     546:	89 43 04             	mov    %eax,0x4(%ebx)
+  cmd->right = right;
+     549:	8b 45 0c             	mov    0xc(%ebp),%eax
+     54c:	89 43 08             	mov    %eax,0x8(%ebx)
+  return (struct cmd*)cmd;
+}
+     54f:	89 d8                	mov    %ebx,%eax
+     551:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     554:	c9                   	leave
+     555:	c3                   	ret
+     556:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     55d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000560 <backcmd>:
+
+struct cmd*
+backcmd(struct cmd *subcmd)
+{
+     560:	55                   	push   %ebp
+     561:	89 e5                	mov    %esp,%ebp
+     563:	53                   	push   %ebx
+     564:	83 ec 10             	sub    $0x10,%esp
+  struct backcmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     567:	6a 08                	push   $0x8
+     569:	e8 f2 0d 00 00       	call   1360 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     56e:	83 c4 0c             	add    $0xc,%esp
+     571:	6a 08                	push   $0x8
+  cmd = malloc(sizeof(*cmd));
+     573:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     575:	6a 00                	push   $0x0
+     577:	50                   	push   %eax
+     578:	e8 b3 08 00 00       	call   e30 <memset>
+  cmd->type = BACK;
+  cmd->cmd = subcmd;
+     57d:	8b 45 08             	mov    0x8(%ebp),%eax
+  cmd->type = BACK;
+     580:	c7 03 05 00 00 00    	movl   $0x5,(%ebx)
+  cmd->cmd = subcmd;
+     586:	89 43 04             	mov    %eax,0x4(%ebx)
+  return (struct cmd*)cmd;
+}
+     589:	89 d8                	mov    %ebx,%eax
+     58b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     58e:	c9                   	leave
+     58f:	c3                   	ret
+
+00000590 <gettoken>:
+char whitespace[] = " \t\r\n\v";
+char symbols[] = "<|>&;()";
+
+int
+gettoken(char **ps, char *es, char **q, char **eq)
+{
+     590:	55                   	push   %ebp
+     591:	89 e5                	mov    %esp,%ebp
+     593:	57                   	push   %edi
+     594:	56                   	push   %esi
+     595:	53                   	push   %ebx
+     596:	83 ec 0c             	sub    $0xc,%esp
+  char *s;
+  int ret;
+
+  s = *ps;
+     599:	8b 45 08             	mov    0x8(%ebp),%eax
+{
+     59c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     59f:	8b 75 10             	mov    0x10(%ebp),%esi
+  s = *ps;
+     5a2:	8b 38                	mov    (%eax),%edi
+  while(s < es && strchr(whitespace, *s))
+     5a4:	39 df                	cmp    %ebx,%edi
+     5a6:	72 0f                	jb     5b7 <gettoken+0x27>
+     5a8:	eb 25                	jmp    5cf <gettoken+0x3f>
+     5aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    s++;
+     5b0:	83 c7 01             	add    $0x1,%edi
+  while(s < es && strchr(whitespace, *s))
+     5b3:	39 fb                	cmp    %edi,%ebx
+     5b5:	74 18                	je     5cf <gettoken+0x3f>
+     5b7:	0f be 07             	movsbl (%edi),%eax
+     5ba:	83 ec 08             	sub    $0x8,%esp
+     5bd:	50                   	push   %eax
+     5be:	68 b0 1b 00 00       	push   $0x1bb0
+     5c3:	e8 88 08 00 00       	call   e50 <strchr>
+     5c8:	83 c4 10             	add    $0x10,%esp
+     5cb:	85 c0                	test   %eax,%eax
+     5cd:	75 e1                	jne    5b0 <gettoken+0x20>
+  if(q)
+     5cf:	85 f6                	test   %esi,%esi
+     5d1:	74 02                	je     5d5 <gettoken+0x45>
+    *q = s;
+     5d3:	89 3e                	mov    %edi,(%esi)
+  ret = *s;
+     5d5:	0f b6 07             	movzbl (%edi),%eax
+  switch(*s){
+     5d8:	3c 3c                	cmp    $0x3c,%al
+     5da:	0f 8f d0 00 00 00    	jg     6b0 <gettoken+0x120>
+     5e0:	3c 3a                	cmp    $0x3a,%al
+     5e2:	0f 8f bc 00 00 00    	jg     6a4 <gettoken+0x114>
+     5e8:	84 c0                	test   %al,%al
+     5ea:	75 44                	jne    630 <gettoken+0xa0>
+     5ec:	31 f6                	xor    %esi,%esi
+    ret = 'a';
+    while(s < es && !strchr(whitespace, *s) && !strchr(symbols, *s))
+      s++;
+    break;
+  }
+  if(eq)
+     5ee:	8b 4d 14             	mov    0x14(%ebp),%ecx
+     5f1:	85 c9                	test   %ecx,%ecx
+     5f3:	74 05                	je     5fa <gettoken+0x6a>
+    *eq = s;
+     5f5:	8b 45 14             	mov    0x14(%ebp),%eax
+     5f8:	89 38                	mov    %edi,(%eax)
+
+  while(s < es && strchr(whitespace, *s))
+     5fa:	39 df                	cmp    %ebx,%edi
+     5fc:	72 09                	jb     607 <gettoken+0x77>
+     5fe:	eb 1f                	jmp    61f <gettoken+0x8f>
+    s++;
+     600:	83 c7 01             	add    $0x1,%edi
+  while(s < es && strchr(whitespace, *s))
+     603:	39 fb                	cmp    %edi,%ebx
+     605:	74 18                	je     61f <gettoken+0x8f>
+     607:	0f be 07             	movsbl (%edi),%eax
+     60a:	83 ec 08             	sub    $0x8,%esp
+     60d:	50                   	push   %eax
+     60e:	68 b0 1b 00 00       	push   $0x1bb0
+     613:	e8 38 08 00 00       	call   e50 <strchr>
+     618:	83 c4 10             	add    $0x10,%esp
+     61b:	85 c0                	test   %eax,%eax
+     61d:	75 e1                	jne    600 <gettoken+0x70>
+  *ps = s;
+     61f:	8b 45 08             	mov    0x8(%ebp),%eax
+     622:	89 38                	mov    %edi,(%eax)
+  return ret;
+}
+     624:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     627:	89 f0                	mov    %esi,%eax
+     629:	5b                   	pop    %ebx
+     62a:	5e                   	pop    %esi
+     62b:	5f                   	pop    %edi
+     62c:	5d                   	pop    %ebp
+     62d:	c3                   	ret
+     62e:	66 90                	xchg   %ax,%ax
+  switch(*s){
+     630:	79 66                	jns    698 <gettoken+0x108>
+    while(s < es && !strchr(whitespace, *s) && !strchr(symbols, *s))
+     632:	39 df                	cmp    %ebx,%edi
+     634:	72 39                	jb     66f <gettoken+0xdf>
+  if(eq)
+     636:	8b 55 14             	mov    0x14(%ebp),%edx
+     639:	85 d2                	test   %edx,%edx
+     63b:	0f 84 b3 00 00 00    	je     6f4 <gettoken+0x164>
+    *eq = s;
+     641:	8b 45 14             	mov    0x14(%ebp),%eax
+     644:	89 38                	mov    %edi,(%eax)
+  while(s < es && strchr(whitespace, *s))
+     646:	e9 a9 00 00 00       	jmp    6f4 <gettoken+0x164>
+     64b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     64f:	90                   	nop
+    while(s < es && !strchr(whitespace, *s) && !strchr(symbols, *s))
+     650:	0f be 07             	movsbl (%edi),%eax
+     653:	83 ec 08             	sub    $0x8,%esp
+     656:	50                   	push   %eax
+     657:	68 a8 1b 00 00       	push   $0x1ba8
+     65c:	e8 ef 07 00 00       	call   e50 <strchr>
+     661:	83 c4 10             	add    $0x10,%esp
+     664:	85 c0                	test   %eax,%eax
+     666:	75 1f                	jne    687 <gettoken+0xf7>
+      s++;
+     668:	83 c7 01             	add    $0x1,%edi
+    while(s < es && !strchr(whitespace, *s) && !strchr(symbols, *s))
+     66b:	39 fb                	cmp    %edi,%ebx
+     66d:	74 77                	je     6e6 <gettoken+0x156>
+     66f:	0f be 07             	movsbl (%edi),%eax
+     672:	83 ec 08             	sub    $0x8,%esp
+     675:	50                   	push   %eax
+     676:	68 b0 1b 00 00       	push   $0x1bb0
+     67b:	e8 d0 07 00 00       	call   e50 <strchr>
+     680:	83 c4 10             	add    $0x10,%esp
+     683:	85 c0                	test   %eax,%eax
+     685:	74 c9                	je     650 <gettoken+0xc0>
+    ret = 'a';
+     687:	be 61 00 00 00       	mov    $0x61,%esi
+     68c:	e9 5d ff ff ff       	jmp    5ee <gettoken+0x5e>
+     691:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  switch(*s){
+     698:	3c 26                	cmp    $0x26,%al
+     69a:	74 08                	je     6a4 <gettoken+0x114>
+     69c:	8d 48 d8             	lea    -0x28(%eax),%ecx
+     69f:	80 f9 01             	cmp    $0x1,%cl
+     6a2:	77 8e                	ja     632 <gettoken+0xa2>
+  ret = *s;
+     6a4:	0f be f0             	movsbl %al,%esi
+    s++;
+     6a7:	83 c7 01             	add    $0x1,%edi
+    break;
+     6aa:	e9 3f ff ff ff       	jmp    5ee <gettoken+0x5e>
+     6af:	90                   	nop
+  switch(*s){
+     6b0:	3c 3e                	cmp    $0x3e,%al
+     6b2:	75 1c                	jne    6d0 <gettoken+0x140>
+    if(*s == '>'){
+     6b4:	80 7f 01 3e          	cmpb   $0x3e,0x1(%edi)
+     6b8:	74 1f                	je     6d9 <gettoken+0x149>
+    s++;
+     6ba:	83 c7 01             	add    $0x1,%edi
+  ret = *s;
+     6bd:	be 3e 00 00 00       	mov    $0x3e,%esi
+     6c2:	e9 27 ff ff ff       	jmp    5ee <gettoken+0x5e>
+     6c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     6ce:	66 90                	xchg   %ax,%ax
+  switch(*s){
+     6d0:	3c 7c                	cmp    $0x7c,%al
+     6d2:	74 d0                	je     6a4 <gettoken+0x114>
+     6d4:	e9 59 ff ff ff       	jmp    632 <gettoken+0xa2>
+      s++;
+     6d9:	83 c7 02             	add    $0x2,%edi
+      ret = '+';
+     6dc:	be 2b 00 00 00       	mov    $0x2b,%esi
+     6e1:	e9 08 ff ff ff       	jmp    5ee <gettoken+0x5e>
+  if(eq)
+     6e6:	8b 45 14             	mov    0x14(%ebp),%eax
+     6e9:	85 c0                	test   %eax,%eax
+     6eb:	74 05                	je     6f2 <gettoken+0x162>
+    *eq = s;
+     6ed:	8b 45 14             	mov    0x14(%ebp),%eax
+     6f0:	89 18                	mov    %ebx,(%eax)
+      s++;
+     6f2:	89 df                	mov    %ebx,%edi
+    ret = 'a';
+     6f4:	be 61 00 00 00       	mov    $0x61,%esi
+     6f9:	e9 21 ff ff ff       	jmp    61f <gettoken+0x8f>
+     6fe:	66 90                	xchg   %ax,%ax
+
+00000700 <peek>:
+
+int
+peek(char **ps, char *es, char *toks)
+{
+     700:	55                   	push   %ebp
+     701:	89 e5                	mov    %esp,%ebp
+     703:	57                   	push   %edi
+     704:	56                   	push   %esi
+     705:	53                   	push   %ebx
+     706:	83 ec 0c             	sub    $0xc,%esp
+     709:	8b 7d 08             	mov    0x8(%ebp),%edi
+     70c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *s;
+
+  s = *ps;
+     70f:	8b 1f                	mov    (%edi),%ebx
+  while(s < es && strchr(whitespace, *s))
+     711:	39 f3                	cmp    %esi,%ebx
+     713:	72 12                	jb     727 <peek+0x27>
+     715:	eb 28                	jmp    73f <peek+0x3f>
+     717:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     71e:	66 90                	xchg   %ax,%ax
+    s++;
+     720:	83 c3 01             	add    $0x1,%ebx
+  while(s < es && strchr(whitespace, *s))
+     723:	39 de                	cmp    %ebx,%esi
+     725:	74 18                	je     73f <peek+0x3f>
+     727:	0f be 03             	movsbl (%ebx),%eax
+     72a:	83 ec 08             	sub    $0x8,%esp
+     72d:	50                   	push   %eax
+     72e:	68 b0 1b 00 00       	push   $0x1bb0
+     733:	e8 18 07 00 00       	call   e50 <strchr>
+     738:	83 c4 10             	add    $0x10,%esp
+     73b:	85 c0                	test   %eax,%eax
+     73d:	75 e1                	jne    720 <peek+0x20>
+  *ps = s;
+     73f:	89 1f                	mov    %ebx,(%edi)
+  return *s && strchr(toks, *s);
+     741:	0f be 03             	movsbl (%ebx),%eax
+     744:	31 d2                	xor    %edx,%edx
+     746:	84 c0                	test   %al,%al
+     748:	75 0e                	jne    758 <peek+0x58>
+}
+     74a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     74d:	89 d0                	mov    %edx,%eax
+     74f:	5b                   	pop    %ebx
+     750:	5e                   	pop    %esi
+     751:	5f                   	pop    %edi
+     752:	5d                   	pop    %ebp
+     753:	c3                   	ret
+     754:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  return *s && strchr(toks, *s);
+     758:	83 ec 08             	sub    $0x8,%esp
+     75b:	50                   	push   %eax
+     75c:	ff 75 10             	push   0x10(%ebp)
+     75f:	e8 ec 06 00 00       	call   e50 <strchr>
+     764:	83 c4 10             	add    $0x10,%esp
+     767:	31 d2                	xor    %edx,%edx
+     769:	85 c0                	test   %eax,%eax
+     76b:	0f 95 c2             	setne  %dl
+}
+     76e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     771:	5b                   	pop    %ebx
+     772:	89 d0                	mov    %edx,%eax
+     774:	5e                   	pop    %esi
+     775:	5f                   	pop    %edi
+     776:	5d                   	pop    %ebp
+     777:	c3                   	ret
+     778:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     77f:	90                   	nop
+
+00000780 <parseredirs>:
+  return cmd;
+}
+
+struct cmd*
+parseredirs(struct cmd *cmd, char **ps, char *es)
+{
+     780:	55                   	push   %ebp
+     781:	89 e5                	mov    %esp,%ebp
+     783:	57                   	push   %edi
+     784:	56                   	push   %esi
+     785:	53                   	push   %ebx
+     786:	83 ec 2c             	sub    $0x2c,%esp
+     789:	8b 75 0c             	mov    0xc(%ebp),%esi
+     78c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int tok;
+  char *q, *eq;
+
+  while(peek(ps, es, "<>")){
+     78f:	90                   	nop
+     790:	83 ec 04             	sub    $0x4,%esp
+     793:	68 99 14 00 00       	push   $0x1499
+     798:	53                   	push   %ebx
+     799:	56                   	push   %esi
+     79a:	e8 61 ff ff ff       	call   700 <peek>
+     79f:	83 c4 10             	add    $0x10,%esp
+     7a2:	85 c0                	test   %eax,%eax
+     7a4:	0f 84 f6 00 00 00    	je     8a0 <parseredirs+0x120>
+    tok = gettoken(ps, es, 0, 0);
+     7aa:	6a 00                	push   $0x0
+     7ac:	6a 00                	push   $0x0
+     7ae:	53                   	push   %ebx
+     7af:	56                   	push   %esi
+     7b0:	e8 db fd ff ff       	call   590 <gettoken>
+     7b5:	89 c7                	mov    %eax,%edi
+    if(gettoken(ps, es, &q, &eq) != 'a')
+     7b7:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+     7ba:	50                   	push   %eax
+     7bb:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     7be:	50                   	push   %eax
+     7bf:	53                   	push   %ebx
+     7c0:	56                   	push   %esi
+     7c1:	e8 ca fd ff ff       	call   590 <gettoken>
+     7c6:	83 c4 20             	add    $0x20,%esp
+     7c9:	83 f8 61             	cmp    $0x61,%eax
+     7cc:	0f 85 d9 00 00 00    	jne    8ab <parseredirs+0x12b>
+      panic("missing file for redirection");
+    switch(tok){
+     7d2:	83 ff 3c             	cmp    $0x3c,%edi
+     7d5:	74 69                	je     840 <parseredirs+0xc0>
+     7d7:	83 ff 3e             	cmp    $0x3e,%edi
+     7da:	74 05                	je     7e1 <parseredirs+0x61>
+     7dc:	83 ff 2b             	cmp    $0x2b,%edi
+     7df:	75 af                	jne    790 <parseredirs+0x10>
+      break;
+    case '>':
+      cmd = redircmd(cmd, q, eq, O_WRONLY|O_CREATE, 1);
+      break;
+    case '+':  // >>
+      cmd = redircmd(cmd, q, eq, O_WRONLY|O_CREATE, 1);
+     7e1:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+     7e4:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  cmd = malloc(sizeof(*cmd));
+     7e7:	83 ec 0c             	sub    $0xc,%esp
+      cmd = redircmd(cmd, q, eq, O_WRONLY|O_CREATE, 1);
+     7ea:	89 55 d0             	mov    %edx,-0x30(%ebp)
+     7ed:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  cmd = malloc(sizeof(*cmd));
+     7f0:	6a 18                	push   $0x18
+     7f2:	e8 69 0b 00 00       	call   1360 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     7f7:	83 c4 0c             	add    $0xc,%esp
+     7fa:	6a 18                	push   $0x18
+  cmd = malloc(sizeof(*cmd));
+     7fc:	89 c7                	mov    %eax,%edi
+  memset(cmd, 0, sizeof(*cmd));
+     7fe:	6a 00                	push   $0x0
+     800:	50                   	push   %eax
+     801:	e8 2a 06 00 00       	call   e30 <memset>
+  cmd->type = REDIR;
+     806:	c7 07 02 00 00 00    	movl   $0x2,(%edi)
+  cmd->cmd = subcmd;
+     80c:	8b 45 08             	mov    0x8(%ebp),%eax
+      break;
+     80f:	83 c4 10             	add    $0x10,%esp
+  cmd->cmd = subcmd;
+     812:	89 47 04             	mov    %eax,0x4(%edi)
+  cmd->file = file;
+     815:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+     818:	89 4f 08             	mov    %ecx,0x8(%edi)
+  cmd->efile = efile;
+     81b:	8b 55 d0             	mov    -0x30(%ebp),%edx
+  cmd->mode = mode;
+     81e:	c7 47 10 01 02 00 00 	movl   $0x201,0x10(%edi)
+  cmd->efile = efile;
+     825:	89 57 0c             	mov    %edx,0xc(%edi)
+  cmd->fd = fd;
+     828:	c7 47 14 01 00 00 00 	movl   $0x1,0x14(%edi)
+      break;
+     82f:	89 7d 08             	mov    %edi,0x8(%ebp)
+     832:	e9 59 ff ff ff       	jmp    790 <parseredirs+0x10>
+     837:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     83e:	66 90                	xchg   %ax,%ax
+      cmd = redircmd(cmd, q, eq, O_RDONLY, 0);
+     840:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+     843:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  cmd = malloc(sizeof(*cmd));
+     846:	83 ec 0c             	sub    $0xc,%esp
+      cmd = redircmd(cmd, q, eq, O_RDONLY, 0);
+     849:	89 55 d0             	mov    %edx,-0x30(%ebp)
+     84c:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  cmd = malloc(sizeof(*cmd));
+     84f:	6a 18                	push   $0x18
+     851:	e8 0a 0b 00 00       	call   1360 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     856:	83 c4 0c             	add    $0xc,%esp
+     859:	6a 18                	push   $0x18
+  cmd = malloc(sizeof(*cmd));
+     85b:	89 c7                	mov    %eax,%edi
+  memset(cmd, 0, sizeof(*cmd));
+     85d:	6a 00                	push   $0x0
+     85f:	50                   	push   %eax
+     860:	e8 cb 05 00 00       	call   e30 <memset>
+  cmd->cmd = subcmd;
+     865:	8b 45 08             	mov    0x8(%ebp),%eax
+  cmd->file = file;
+     868:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+      break;
+     86b:	89 7d 08             	mov    %edi,0x8(%ebp)
+  cmd->efile = efile;
+     86e:	8b 55 d0             	mov    -0x30(%ebp),%edx
+  cmd->type = REDIR;
+     871:	c7 07 02 00 00 00    	movl   $0x2,(%edi)
+      break;
+     877:	83 c4 10             	add    $0x10,%esp
+  cmd->cmd = subcmd;
+     87a:	89 47 04             	mov    %eax,0x4(%edi)
+  cmd->file = file;
+     87d:	89 4f 08             	mov    %ecx,0x8(%edi)
+  cmd->efile = efile;
+     880:	89 57 0c             	mov    %edx,0xc(%edi)
+  cmd->mode = mode;
+     883:	c7 47 10 00 00 00 00 	movl   $0x0,0x10(%edi)
+  cmd->fd = fd;
+     88a:	c7 47 14 00 00 00 00 	movl   $0x0,0x14(%edi)
+      break;
+     891:	e9 fa fe ff ff       	jmp    790 <parseredirs+0x10>
+     896:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     89d:	8d 76 00             	lea    0x0(%esi),%esi
+    }
+  }
+  return cmd;
+}
+     8a0:	8b 45 08             	mov    0x8(%ebp),%eax
+     8a3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     8a6:	5b                   	pop    %ebx
+     8a7:	5e                   	pop    %esi
+     8a8:	5f                   	pop    %edi
+     8a9:	5d                   	pop    %ebp
+     8aa:	c3                   	ret
+      panic("missing file for redirection");
+     8ab:	83 ec 0c             	sub    $0xc,%esp
+     8ae:	68 7c 14 00 00       	push   $0x147c
+     8b3:	e8 d8 f9 ff ff       	call   290 <panic>
+     8b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     8bf:	90                   	nop
+
+000008c0 <parseexec>:
+  return cmd;
+}
+
+struct cmd*
+parseexec(char **ps, char *es)
+{
+     8c0:	55                   	push   %ebp
+     8c1:	89 e5                	mov    %esp,%ebp
+     8c3:	57                   	push   %edi
+     8c4:	56                   	push   %esi
+     8c5:	53                   	push   %ebx
+     8c6:	83 ec 30             	sub    $0x30,%esp
+     8c9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     8cc:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *q, *eq;
+  int tok, argc;
+  struct execcmd *cmd;
+  struct cmd *ret;
+
+  if(peek(ps, es, "("))
+     8cf:	68 9c 14 00 00       	push   $0x149c
+     8d4:	56                   	push   %esi
+     8d5:	53                   	push   %ebx
+     8d6:	e8 25 fe ff ff       	call   700 <peek>
+     8db:	83 c4 10             	add    $0x10,%esp
+     8de:	85 c0                	test   %eax,%eax
+     8e0:	0f 85 aa 00 00 00    	jne    990 <parseexec+0xd0>
+  cmd = malloc(sizeof(*cmd));
+     8e6:	83 ec 0c             	sub    $0xc,%esp
+     8e9:	89 c7                	mov    %eax,%edi
+     8eb:	6a 54                	push   $0x54
+     8ed:	e8 6e 0a 00 00       	call   1360 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     8f2:	83 c4 0c             	add    $0xc,%esp
+     8f5:	6a 54                	push   $0x54
+     8f7:	6a 00                	push   $0x0
+     8f9:	89 45 d0             	mov    %eax,-0x30(%ebp)
+     8fc:	50                   	push   %eax
+     8fd:	e8 2e 05 00 00       	call   e30 <memset>
+  cmd->type = EXEC;
+     902:	8b 45 d0             	mov    -0x30(%ebp),%eax
+
+  ret = execcmd();
+  cmd = (struct execcmd*)ret;
+
+  argc = 0;
+  ret = parseredirs(ret, ps, es);
+     905:	83 c4 0c             	add    $0xc,%esp
+  cmd->type = EXEC;
+     908:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+  ret = parseredirs(ret, ps, es);
+     90e:	56                   	push   %esi
+     90f:	53                   	push   %ebx
+     910:	50                   	push   %eax
+     911:	e8 6a fe ff ff       	call   780 <parseredirs>
+  while(!peek(ps, es, "|)&;")){
+     916:	83 c4 10             	add    $0x10,%esp
+  ret = parseredirs(ret, ps, es);
+     919:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  while(!peek(ps, es, "|)&;")){
+     91c:	eb 15                	jmp    933 <parseexec+0x73>
+     91e:	66 90                	xchg   %ax,%ax
+    cmd->argv[argc] = q;
+    cmd->eargv[argc] = eq;
+    argc++;
+    if(argc >= MAXARGS)
+      panic("too many args");
+    ret = parseredirs(ret, ps, es);
+     920:	83 ec 04             	sub    $0x4,%esp
+     923:	56                   	push   %esi
+     924:	53                   	push   %ebx
+     925:	ff 75 d4             	push   -0x2c(%ebp)
+     928:	e8 53 fe ff ff       	call   780 <parseredirs>
+     92d:	83 c4 10             	add    $0x10,%esp
+     930:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  while(!peek(ps, es, "|)&;")){
+     933:	83 ec 04             	sub    $0x4,%esp
+     936:	68 b3 14 00 00       	push   $0x14b3
+     93b:	56                   	push   %esi
+     93c:	53                   	push   %ebx
+     93d:	e8 be fd ff ff       	call   700 <peek>
+     942:	83 c4 10             	add    $0x10,%esp
+     945:	85 c0                	test   %eax,%eax
+     947:	75 5f                	jne    9a8 <parseexec+0xe8>
+    if((tok=gettoken(ps, es, &q, &eq)) == 0)
+     949:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+     94c:	50                   	push   %eax
+     94d:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     950:	50                   	push   %eax
+     951:	56                   	push   %esi
+     952:	53                   	push   %ebx
+     953:	e8 38 fc ff ff       	call   590 <gettoken>
+     958:	83 c4 10             	add    $0x10,%esp
+     95b:	85 c0                	test   %eax,%eax
+     95d:	74 49                	je     9a8 <parseexec+0xe8>
+    if(tok != 'a')
+     95f:	83 f8 61             	cmp    $0x61,%eax
+     962:	75 62                	jne    9c6 <parseexec+0x106>
+    cmd->argv[argc] = q;
+     964:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     967:	8b 55 d0             	mov    -0x30(%ebp),%edx
+     96a:	89 44 ba 04          	mov    %eax,0x4(%edx,%edi,4)
+    cmd->eargv[argc] = eq;
+     96e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     971:	89 44 ba 2c          	mov    %eax,0x2c(%edx,%edi,4)
+    argc++;
+     975:	83 c7 01             	add    $0x1,%edi
+    if(argc >= MAXARGS)
+     978:	83 ff 0a             	cmp    $0xa,%edi
+     97b:	75 a3                	jne    920 <parseexec+0x60>
+      panic("too many args");
+     97d:	83 ec 0c             	sub    $0xc,%esp
+     980:	68 a5 14 00 00       	push   $0x14a5
+     985:	e8 06 f9 ff ff       	call   290 <panic>
+     98a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return parseblock(ps, es);
+     990:	89 75 0c             	mov    %esi,0xc(%ebp)
+     993:	89 5d 08             	mov    %ebx,0x8(%ebp)
+  }
+  cmd->argv[argc] = 0;
+  cmd->eargv[argc] = 0;
+  return ret;
+}
+     996:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     999:	5b                   	pop    %ebx
+     99a:	5e                   	pop    %esi
+     99b:	5f                   	pop    %edi
+     99c:	5d                   	pop    %ebp
+    return parseblock(ps, es);
+     99d:	e9 ae 01 00 00       	jmp    b50 <parseblock>
+     9a2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  cmd->argv[argc] = 0;
+     9a8:	8b 45 d0             	mov    -0x30(%ebp),%eax
+     9ab:	c7 44 b8 04 00 00 00 	movl   $0x0,0x4(%eax,%edi,4)
+     9b2:	00 
+  cmd->eargv[argc] = 0;
+     9b3:	c7 44 b8 2c 00 00 00 	movl   $0x0,0x2c(%eax,%edi,4)
+     9ba:	00 
+}
+     9bb:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     9be:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     9c1:	5b                   	pop    %ebx
+     9c2:	5e                   	pop    %esi
+     9c3:	5f                   	pop    %edi
+     9c4:	5d                   	pop    %ebp
+     9c5:	c3                   	ret
+      panic("syntax");
+     9c6:	83 ec 0c             	sub    $0xc,%esp
+     9c9:	68 9e 14 00 00       	push   $0x149e
+     9ce:	e8 bd f8 ff ff       	call   290 <panic>
+     9d3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     9da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000009e0 <parsepipe>:
+{
+     9e0:	55                   	push   %ebp
+     9e1:	89 e5                	mov    %esp,%ebp
+     9e3:	57                   	push   %edi
+     9e4:	56                   	push   %esi
+     9e5:	53                   	push   %ebx
+     9e6:	83 ec 14             	sub    $0x14,%esp
+     9e9:	8b 75 08             	mov    0x8(%ebp),%esi
+     9ec:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  cmd = parseexec(ps, es);
+     9ef:	57                   	push   %edi
+     9f0:	56                   	push   %esi
+     9f1:	e8 ca fe ff ff       	call   8c0 <parseexec>
+  if(peek(ps, es, "|")){
+     9f6:	83 c4 0c             	add    $0xc,%esp
+     9f9:	68 b8 14 00 00       	push   $0x14b8
+  cmd = parseexec(ps, es);
+     9fe:	89 c3                	mov    %eax,%ebx
+  if(peek(ps, es, "|")){
+     a00:	57                   	push   %edi
+     a01:	56                   	push   %esi
+     a02:	e8 f9 fc ff ff       	call   700 <peek>
+     a07:	83 c4 10             	add    $0x10,%esp
+     a0a:	85 c0                	test   %eax,%eax
+     a0c:	75 12                	jne    a20 <parsepipe+0x40>
+}
+     a0e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     a11:	89 d8                	mov    %ebx,%eax
+     a13:	5b                   	pop    %ebx
+     a14:	5e                   	pop    %esi
+     a15:	5f                   	pop    %edi
+     a16:	5d                   	pop    %ebp
+     a17:	c3                   	ret
+     a18:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a1f:	90                   	nop
+    gettoken(ps, es, 0, 0);
+     a20:	6a 00                	push   $0x0
+     a22:	6a 00                	push   $0x0
+     a24:	57                   	push   %edi
+     a25:	56                   	push   %esi
+     a26:	e8 65 fb ff ff       	call   590 <gettoken>
+    cmd = pipecmd(cmd, parsepipe(ps, es));
+     a2b:	58                   	pop    %eax
+     a2c:	5a                   	pop    %edx
+     a2d:	57                   	push   %edi
+     a2e:	56                   	push   %esi
+     a2f:	e8 ac ff ff ff       	call   9e0 <parsepipe>
+  cmd = malloc(sizeof(*cmd));
+     a34:	c7 04 24 0c 00 00 00 	movl   $0xc,(%esp)
+    cmd = pipecmd(cmd, parsepipe(ps, es));
+     a3b:	89 c7                	mov    %eax,%edi
+  cmd = malloc(sizeof(*cmd));
+     a3d:	e8 1e 09 00 00       	call   1360 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     a42:	83 c4 0c             	add    $0xc,%esp
+     a45:	6a 0c                	push   $0xc
+  cmd = malloc(sizeof(*cmd));
+     a47:	89 c6                	mov    %eax,%esi
+  memset(cmd, 0, sizeof(*cmd));
+     a49:	6a 00                	push   $0x0
+     a4b:	50                   	push   %eax
+     a4c:	e8 df 03 00 00       	call   e30 <memset>
+  cmd->left = left;
+     a51:	89 5e 04             	mov    %ebx,0x4(%esi)
+  cmd->right = right;
+     a54:	83 c4 10             	add    $0x10,%esp
+     a57:	89 f3                	mov    %esi,%ebx
+  cmd->type = PIPE;
+     a59:	c7 06 03 00 00 00    	movl   $0x3,(%esi)
+}
+     a5f:	89 d8                	mov    %ebx,%eax
+  cmd->right = right;
+     a61:	89 7e 08             	mov    %edi,0x8(%esi)
+}
+     a64:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     a67:	5b                   	pop    %ebx
+     a68:	5e                   	pop    %esi
+     a69:	5f                   	pop    %edi
+     a6a:	5d                   	pop    %ebp
+     a6b:	c3                   	ret
+     a6c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000a70 <parseline>:
+{
+     a70:	55                   	push   %ebp
+     a71:	89 e5                	mov    %esp,%ebp
+     a73:	57                   	push   %edi
+     a74:	56                   	push   %esi
+     a75:	53                   	push   %ebx
+     a76:	83 ec 24             	sub    $0x24,%esp
+     a79:	8b 75 08             	mov    0x8(%ebp),%esi
+     a7c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  cmd = parsepipe(ps, es);
+     a7f:	57                   	push   %edi
+     a80:	56                   	push   %esi
+     a81:	e8 5a ff ff ff       	call   9e0 <parsepipe>
+  while(peek(ps, es, "&")){
+     a86:	83 c4 10             	add    $0x10,%esp
+  cmd = parsepipe(ps, es);
+     a89:	89 c3                	mov    %eax,%ebx
+  while(peek(ps, es, "&")){
+     a8b:	eb 3b                	jmp    ac8 <parseline+0x58>
+     a8d:	8d 76 00             	lea    0x0(%esi),%esi
+    gettoken(ps, es, 0, 0);
+     a90:	6a 00                	push   $0x0
+     a92:	6a 00                	push   $0x0
+     a94:	57                   	push   %edi
+     a95:	56                   	push   %esi
+     a96:	e8 f5 fa ff ff       	call   590 <gettoken>
+  cmd = malloc(sizeof(*cmd));
+     a9b:	c7 04 24 08 00 00 00 	movl   $0x8,(%esp)
+     aa2:	e8 b9 08 00 00       	call   1360 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     aa7:	83 c4 0c             	add    $0xc,%esp
+     aaa:	6a 08                	push   $0x8
+     aac:	6a 00                	push   $0x0
+     aae:	50                   	push   %eax
+     aaf:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     ab2:	e8 79 03 00 00       	call   e30 <memset>
+  cmd->type = BACK;
+     ab7:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  cmd->cmd = subcmd;
+     aba:	83 c4 10             	add    $0x10,%esp
+  cmd->type = BACK;
+     abd:	c7 02 05 00 00 00    	movl   $0x5,(%edx)
+  cmd->cmd = subcmd;
+     ac3:	89 5a 04             	mov    %ebx,0x4(%edx)
+     ac6:	89 d3                	mov    %edx,%ebx
+  while(peek(ps, es, "&")){
+     ac8:	83 ec 04             	sub    $0x4,%esp
+     acb:	68 ba 14 00 00       	push   $0x14ba
+     ad0:	57                   	push   %edi
+     ad1:	56                   	push   %esi
+     ad2:	e8 29 fc ff ff       	call   700 <peek>
+     ad7:	83 c4 10             	add    $0x10,%esp
+     ada:	85 c0                	test   %eax,%eax
+     adc:	75 b2                	jne    a90 <parseline+0x20>
+  if(peek(ps, es, ";")){
+     ade:	83 ec 04             	sub    $0x4,%esp
+     ae1:	68 b6 14 00 00       	push   $0x14b6
+     ae6:	57                   	push   %edi
+     ae7:	56                   	push   %esi
+     ae8:	e8 13 fc ff ff       	call   700 <peek>
+     aed:	83 c4 10             	add    $0x10,%esp
+     af0:	85 c0                	test   %eax,%eax
+     af2:	75 0c                	jne    b00 <parseline+0x90>
+}
+     af4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     af7:	89 d8                	mov    %ebx,%eax
+     af9:	5b                   	pop    %ebx
+     afa:	5e                   	pop    %esi
+     afb:	5f                   	pop    %edi
+     afc:	5d                   	pop    %ebp
+     afd:	c3                   	ret
+     afe:	66 90                	xchg   %ax,%ax
+    gettoken(ps, es, 0, 0);
+     b00:	6a 00                	push   $0x0
+     b02:	6a 00                	push   $0x0
+     b04:	57                   	push   %edi
+     b05:	56                   	push   %esi
+     b06:	e8 85 fa ff ff       	call   590 <gettoken>
+    cmd = listcmd(cmd, parseline(ps, es));
+     b0b:	58                   	pop    %eax
+     b0c:	5a                   	pop    %edx
+     b0d:	57                   	push   %edi
+     b0e:	56                   	push   %esi
+     b0f:	e8 5c ff ff ff       	call   a70 <parseline>
+  cmd = malloc(sizeof(*cmd));
+     b14:	c7 04 24 0c 00 00 00 	movl   $0xc,(%esp)
+    cmd = listcmd(cmd, parseline(ps, es));
+     b1b:	89 c7                	mov    %eax,%edi
+  cmd = malloc(sizeof(*cmd));
+     b1d:	e8 3e 08 00 00       	call   1360 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     b22:	83 c4 0c             	add    $0xc,%esp
+     b25:	6a 0c                	push   $0xc
+  cmd = malloc(sizeof(*cmd));
+     b27:	89 c6                	mov    %eax,%esi
+  memset(cmd, 0, sizeof(*cmd));
+     b29:	6a 00                	push   $0x0
+     b2b:	50                   	push   %eax
+     b2c:	e8 ff 02 00 00       	call   e30 <memset>
+  cmd->left = left;
+     b31:	89 5e 04             	mov    %ebx,0x4(%esi)
+  cmd->right = right;
+     b34:	83 c4 10             	add    $0x10,%esp
+     b37:	89 f3                	mov    %esi,%ebx
+  cmd->type = LIST;
+     b39:	c7 06 04 00 00 00    	movl   $0x4,(%esi)
+}
+     b3f:	89 d8                	mov    %ebx,%eax
+  cmd->right = right;
+     b41:	89 7e 08             	mov    %edi,0x8(%esi)
+}
+     b44:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     b47:	5b                   	pop    %ebx
+     b48:	5e                   	pop    %esi
+     b49:	5f                   	pop    %edi
+     b4a:	5d                   	pop    %ebp
+     b4b:	c3                   	ret
+     b4c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000b50 <parseblock>:
+{
+     b50:	55                   	push   %ebp
+     b51:	89 e5                	mov    %esp,%ebp
+     b53:	57                   	push   %edi
+     b54:	56                   	push   %esi
+     b55:	53                   	push   %ebx
+     b56:	83 ec 10             	sub    $0x10,%esp
+     b59:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     b5c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(!peek(ps, es, "("))
+     b5f:	68 9c 14 00 00       	push   $0x149c
+     b64:	56                   	push   %esi
+     b65:	53                   	push   %ebx
+     b66:	e8 95 fb ff ff       	call   700 <peek>
+     b6b:	83 c4 10             	add    $0x10,%esp
+     b6e:	85 c0                	test   %eax,%eax
+     b70:	74 4a                	je     bbc <parseblock+0x6c>
+  gettoken(ps, es, 0, 0);
+     b72:	6a 00                	push   $0x0
+     b74:	6a 00                	push   $0x0
+     b76:	56                   	push   %esi
+     b77:	53                   	push   %ebx
+     b78:	e8 13 fa ff ff       	call   590 <gettoken>
+  cmd = parseline(ps, es);
+     b7d:	58                   	pop    %eax
+     b7e:	5a                   	pop    %edx
+     b7f:	56                   	push   %esi
+     b80:	53                   	push   %ebx
+     b81:	e8 ea fe ff ff       	call   a70 <parseline>
+  if(!peek(ps, es, ")"))
+     b86:	83 c4 0c             	add    $0xc,%esp
+     b89:	68 d8 14 00 00       	push   $0x14d8
+  cmd = parseline(ps, es);
+     b8e:	89 c7                	mov    %eax,%edi
+  if(!peek(ps, es, ")"))
+     b90:	56                   	push   %esi
+     b91:	53                   	push   %ebx
+     b92:	e8 69 fb ff ff       	call   700 <peek>
+     b97:	83 c4 10             	add    $0x10,%esp
+     b9a:	85 c0                	test   %eax,%eax
+     b9c:	74 2b                	je     bc9 <parseblock+0x79>
+  gettoken(ps, es, 0, 0);
+     b9e:	6a 00                	push   $0x0
+     ba0:	6a 00                	push   $0x0
+     ba2:	56                   	push   %esi
+     ba3:	53                   	push   %ebx
+     ba4:	e8 e7 f9 ff ff       	call   590 <gettoken>
+  cmd = parseredirs(cmd, ps, es);
+     ba9:	83 c4 0c             	add    $0xc,%esp
+     bac:	56                   	push   %esi
+     bad:	53                   	push   %ebx
+     bae:	57                   	push   %edi
+     baf:	e8 cc fb ff ff       	call   780 <parseredirs>
+}
+     bb4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     bb7:	5b                   	pop    %ebx
+     bb8:	5e                   	pop    %esi
+     bb9:	5f                   	pop    %edi
+     bba:	5d                   	pop    %ebp
+     bbb:	c3                   	ret
+    panic("parseblock");
+     bbc:	83 ec 0c             	sub    $0xc,%esp
+     bbf:	68 bc 14 00 00       	push   $0x14bc
+     bc4:	e8 c7 f6 ff ff       	call   290 <panic>
+    panic("syntax - missing )");
+     bc9:	83 ec 0c             	sub    $0xc,%esp
+     bcc:	68 c7 14 00 00       	push   $0x14c7
+     bd1:	e8 ba f6 ff ff       	call   290 <panic>
+     bd6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     bdd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000be0 <nulterminate>:
+
+// NUL-terminate all the counted strings.
+struct cmd*
+nulterminate(struct cmd *cmd)
+{
+     be0:	55                   	push   %ebp
+     be1:	89 e5                	mov    %esp,%ebp
+     be3:	53                   	push   %ebx
+     be4:	83 ec 04             	sub    $0x4,%esp
+     be7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct execcmd *ecmd;
+  struct listcmd *lcmd;
+  struct pipecmd *pcmd;
+  struct redircmd *rcmd;
+
+  if(cmd == 0)
+     bea:	85 db                	test   %ebx,%ebx
+     bec:	0f 84 7e 00 00 00    	je     c70 <nulterminate+0x90>
+    return 0;
+
+  switch(cmd->type){
+     bf2:	83 3b 05             	cmpl   $0x5,(%ebx)
+     bf5:	77 20                	ja     c17 <nulterminate+0x37>
+     bf7:	8b 03                	mov    (%ebx),%eax
+     bf9:	ff 24 85 18 15 00 00 	jmp    *0x1518(,%eax,4)
+    nulterminate(pcmd->right);
+    break;
+
+  case LIST:
+    lcmd = (struct listcmd*)cmd;
+    nulterminate(lcmd->left);
+     c00:	83 ec 0c             	sub    $0xc,%esp
+     c03:	ff 73 04             	push   0x4(%ebx)
+     c06:	e8 d5 ff ff ff       	call   be0 <nulterminate>
+    nulterminate(lcmd->right);
+     c0b:	58                   	pop    %eax
+     c0c:	ff 73 08             	push   0x8(%ebx)
+     c0f:	e8 cc ff ff ff       	call   be0 <nulterminate>
+    break;
+     c14:	83 c4 10             	add    $0x10,%esp
+    return 0;
+     c17:	89 d8                	mov    %ebx,%eax
+    bcmd = (struct backcmd*)cmd;
+    nulterminate(bcmd->cmd);
+    break;
+  }
+  return cmd;
+}
+     c19:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     c1c:	c9                   	leave
+     c1d:	c3                   	ret
+     c1e:	66 90                	xchg   %ax,%ax
+    nulterminate(bcmd->cmd);
+     c20:	83 ec 0c             	sub    $0xc,%esp
+     c23:	ff 73 04             	push   0x4(%ebx)
+     c26:	e8 b5 ff ff ff       	call   be0 <nulterminate>
+    break;
+     c2b:	83 c4 10             	add    $0x10,%esp
+     c2e:	eb e7                	jmp    c17 <nulterminate+0x37>
+    for(i=0; ecmd->argv[i]; i++)
+     c30:	8b 4b 04             	mov    0x4(%ebx),%ecx
+     c33:	8d 43 08             	lea    0x8(%ebx),%eax
+     c36:	85 c9                	test   %ecx,%ecx
+     c38:	74 dd                	je     c17 <nulterminate+0x37>
+     c3a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      *ecmd->eargv[i] = 0;
+     c40:	8b 50 24             	mov    0x24(%eax),%edx
+    for(i=0; ecmd->argv[i]; i++)
+     c43:	83 c0 04             	add    $0x4,%eax
+      *ecmd->eargv[i] = 0;
+     c46:	c6 02 00             	movb   $0x0,(%edx)
+    for(i=0; ecmd->argv[i]; i++)
+     c49:	8b 50 fc             	mov    -0x4(%eax),%edx
+     c4c:	85 d2                	test   %edx,%edx
+     c4e:	75 f0                	jne    c40 <nulterminate+0x60>
+     c50:	eb c5                	jmp    c17 <nulterminate+0x37>
+     c52:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    nulterminate(rcmd->cmd);
+     c58:	83 ec 0c             	sub    $0xc,%esp
+     c5b:	ff 73 04             	push   0x4(%ebx)
+     c5e:	e8 7d ff ff ff       	call   be0 <nulterminate>
+    *rcmd->efile = 0;
+     c63:	8b 43 0c             	mov    0xc(%ebx),%eax
+    break;
+     c66:	83 c4 10             	add    $0x10,%esp
+    *rcmd->efile = 0;
+     c69:	c6 00 00             	movb   $0x0,(%eax)
+    break;
+     c6c:	eb a9                	jmp    c17 <nulterminate+0x37>
+     c6e:	66 90                	xchg   %ax,%ax
+    return 0;
+     c70:	31 c0                	xor    %eax,%eax
+     c72:	eb a5                	jmp    c19 <nulterminate+0x39>
+     c74:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c7b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     c7f:	90                   	nop
+
+00000c80 <parsecmd>:
+{
+     c80:	55                   	push   %ebp
+     c81:	89 e5                	mov    %esp,%ebp
+     c83:	57                   	push   %edi
+     c84:	56                   	push   %esi
+  cmd = parseline(&s, es);
+     c85:	8d 7d 08             	lea    0x8(%ebp),%edi
+{
+     c88:	53                   	push   %ebx
+     c89:	83 ec 18             	sub    $0x18,%esp
+  es = s + strlen(s);
+     c8c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     c8f:	53                   	push   %ebx
+     c90:	e8 6b 01 00 00       	call   e00 <strlen>
+  cmd = parseline(&s, es);
+     c95:	59                   	pop    %ecx
+     c96:	5e                   	pop    %esi
+  es = s + strlen(s);
+     c97:	01 c3                	add    %eax,%ebx
+  cmd = parseline(&s, es);
+     c99:	53                   	push   %ebx
+     c9a:	57                   	push   %edi
+     c9b:	e8 d0 fd ff ff       	call   a70 <parseline>
+  peek(&s, es, "");
+     ca0:	83 c4 0c             	add    $0xc,%esp
+     ca3:	68 66 14 00 00       	push   $0x1466
+  cmd = parseline(&s, es);
+     ca8:	89 c6                	mov    %eax,%esi
+  peek(&s, es, "");
+     caa:	53                   	push   %ebx
+     cab:	57                   	push   %edi
+     cac:	e8 4f fa ff ff       	call   700 <peek>
+  if(s != es){
+     cb1:	8b 45 08             	mov    0x8(%ebp),%eax
+     cb4:	83 c4 10             	add    $0x10,%esp
+     cb7:	39 d8                	cmp    %ebx,%eax
+     cb9:	75 13                	jne    cce <parsecmd+0x4e>
+  nulterminate(cmd);
+     cbb:	83 ec 0c             	sub    $0xc,%esp
+     cbe:	56                   	push   %esi
+     cbf:	e8 1c ff ff ff       	call   be0 <nulterminate>
+}
+     cc4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     cc7:	89 f0                	mov    %esi,%eax
+     cc9:	5b                   	pop    %ebx
+     cca:	5e                   	pop    %esi
+     ccb:	5f                   	pop    %edi
+     ccc:	5d                   	pop    %ebp
+     ccd:	c3                   	ret
+    printf(2, "leftovers: %s\n", s);
+     cce:	52                   	push   %edx
+     ccf:	50                   	push   %eax
+     cd0:	68 da 14 00 00       	push   $0x14da
+     cd5:	6a 02                	push   $0x2
+     cd7:	e8 44 04 00 00       	call   1120 <printf>
+    panic("syntax");
+     cdc:	c7 04 24 9e 14 00 00 	movl   $0x149e,(%esp)
+     ce3:	e8 a8 f5 ff ff       	call   290 <panic>
+     ce8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     cef:	90                   	nop
+
+00000cf0 <freecmd>:
+
+// Free a parsed command.
+void
+freecmd(struct cmd *cmd)
+{
+     cf0:	55                   	push   %ebp
+     cf1:	89 e5                	mov    %esp,%ebp
+     cf3:	53                   	push   %ebx
+     cf4:	83 ec 04             	sub    $0x4,%esp
+     cf7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct backcmd *bcmd;
+  struct listcmd *lcmd;
+  struct pipecmd *pcmd;
+  struct redircmd *rcmd;
+
+  if(cmd == 0)
+     cfa:	85 db                	test   %ebx,%ebx
+     cfc:	74 62                	je     d60 <freecmd+0x70>
+    return;
+
+  switch(cmd->type){
+     cfe:	8b 03                	mov    (%ebx),%eax
+     d00:	83 f8 04             	cmp    $0x4,%eax
+     d03:	74 0c                	je     d11 <freecmd+0x21>
+     d05:	7f 31                	jg     d38 <freecmd+0x48>
+     d07:	83 f8 02             	cmp    $0x2,%eax
+     d0a:	74 31                	je     d3d <freecmd+0x4d>
+     d0c:	83 f8 03             	cmp    $0x3,%eax
+     d0f:	75 17                	jne    d28 <freecmd+0x38>
+    freecmd(pcmd->right);
+    break;
+
+  case LIST:
+    lcmd = (struct listcmd*)cmd;
+    freecmd(lcmd->left);
+     d11:	83 ec 0c             	sub    $0xc,%esp
+     d14:	ff 73 04             	push   0x4(%ebx)
+     d17:	e8 d4 ff ff ff       	call   cf0 <freecmd>
+    freecmd(lcmd->right);
+     d1c:	58                   	pop    %eax
+     d1d:	ff 73 08             	push   0x8(%ebx)
+     d20:	e8 cb ff ff ff       	call   cf0 <freecmd>
+    break;
+     d25:	83 c4 10             	add    $0x10,%esp
+  case BACK:
+    bcmd = (struct backcmd*)cmd;
+    freecmd(bcmd->cmd);
+    break;
+  }
+  free(cmd);
+     d28:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     d2b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     d2e:	c9                   	leave
+  free(cmd);
+     d2f:	e9 9c 05 00 00       	jmp    12d0 <free>
+     d34:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  switch(cmd->type){
+     d38:	83 f8 05             	cmp    $0x5,%eax
+     d3b:	75 eb                	jne    d28 <freecmd+0x38>
+    freecmd(bcmd->cmd);
+     d3d:	83 ec 0c             	sub    $0xc,%esp
+     d40:	ff 73 04             	push   0x4(%ebx)
+     d43:	e8 a8 ff ff ff       	call   cf0 <freecmd>
+  free(cmd);
+     d48:	89 5d 08             	mov    %ebx,0x8(%ebp)
+    break;
+     d4b:	83 c4 10             	add    $0x10,%esp
+}
+     d4e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     d51:	c9                   	leave
+  free(cmd);
+     d52:	e9 79 05 00 00       	jmp    12d0 <free>
+     d57:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d5e:	66 90                	xchg   %ax,%ax
+}
+     d60:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     d63:	c9                   	leave
+     d64:	c3                   	ret
+     d65:	66 90                	xchg   %ax,%ax
+     d67:	66 90                	xchg   %ax,%ax
+     d69:	66 90                	xchg   %ax,%ax
+     d6b:	66 90                	xchg   %ax,%ax
+     d6d:	66 90                	xchg   %ax,%ax
+     d6f:	90                   	nop
+
+00000d70 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+     d70:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     d71:	31 c0                	xor    %eax,%eax
+{
+     d73:	89 e5                	mov    %esp,%ebp
+     d75:	53                   	push   %ebx
+     d76:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     d79:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     d7c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+     d80:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     d84:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     d87:	83 c0 01             	add    $0x1,%eax
+     d8a:	84 d2                	test   %dl,%dl
+     d8c:	75 f2                	jne    d80 <strcpy+0x10>
+    ;
+  return os;
+}
+     d8e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     d91:	89 c8                	mov    %ecx,%eax
+     d93:	c9                   	leave
+     d94:	c3                   	ret
+     d95:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d9c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000da0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     da0:	55                   	push   %ebp
+     da1:	89 e5                	mov    %esp,%ebp
+     da3:	53                   	push   %ebx
+     da4:	8b 55 08             	mov    0x8(%ebp),%edx
+     da7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+     daa:	0f b6 02             	movzbl (%edx),%eax
+     dad:	84 c0                	test   %al,%al
+     daf:	75 17                	jne    dc8 <strcmp+0x28>
+     db1:	eb 3a                	jmp    ded <strcmp+0x4d>
+     db3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     db7:	90                   	nop
+     db8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+     dbc:	83 c2 01             	add    $0x1,%edx
+     dbf:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+     dc2:	84 c0                	test   %al,%al
+     dc4:	74 1a                	je     de0 <strcmp+0x40>
+    p++, q++;
+     dc6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+     dc8:	0f b6 19             	movzbl (%ecx),%ebx
+     dcb:	38 c3                	cmp    %al,%bl
+     dcd:	74 e9                	je     db8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+     dcf:	29 d8                	sub    %ebx,%eax
+}
+     dd1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     dd4:	c9                   	leave
+     dd5:	c3                   	ret
+     dd6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     ddd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     de0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+     de4:	31 c0                	xor    %eax,%eax
+     de6:	29 d8                	sub    %ebx,%eax
+}
+     de8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     deb:	c9                   	leave
+     dec:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     ded:	0f b6 19             	movzbl (%ecx),%ebx
+     df0:	31 c0                	xor    %eax,%eax
+     df2:	eb db                	jmp    dcf <strcmp+0x2f>
+     df4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     dfb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     dff:	90                   	nop
+
+00000e00 <strlen>:
+
+uint
+strlen(const char *s)
+{
+     e00:	55                   	push   %ebp
+     e01:	89 e5                	mov    %esp,%ebp
+     e03:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+     e06:	80 3a 00             	cmpb   $0x0,(%edx)
+     e09:	74 15                	je     e20 <strlen+0x20>
+     e0b:	31 c0                	xor    %eax,%eax
+     e0d:	8d 76 00             	lea    0x0(%esi),%esi
+     e10:	83 c0 01             	add    $0x1,%eax
+     e13:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     e17:	89 c1                	mov    %eax,%ecx
+     e19:	75 f5                	jne    e10 <strlen+0x10>
+    ;
+  return n;
+}
+     e1b:	89 c8                	mov    %ecx,%eax
+     e1d:	5d                   	pop    %ebp
+     e1e:	c3                   	ret
+     e1f:	90                   	nop
+  for(n = 0; s[n]; n++)
+     e20:	31 c9                	xor    %ecx,%ecx
+}
+     e22:	5d                   	pop    %ebp
+     e23:	89 c8                	mov    %ecx,%eax
+     e25:	c3                   	ret
+     e26:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e2d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000e30 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     e30:	55                   	push   %ebp
+     e31:	89 e5                	mov    %esp,%ebp
+     e33:	57                   	push   %edi
+     e34:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     e37:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     e3a:	8b 45 0c             	mov    0xc(%ebp),%eax
+     e3d:	89 d7                	mov    %edx,%edi
+     e3f:	fc                   	cld
+     e40:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+     e42:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     e45:	89 d0                	mov    %edx,%eax
+     e47:	c9                   	leave
+     e48:	c3                   	ret
+     e49:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000e50 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     e50:	55                   	push   %ebp
+     e51:	89 e5                	mov    %esp,%ebp
+     e53:	8b 45 08             	mov    0x8(%ebp),%eax
+     e56:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     e5a:	0f b6 10             	movzbl (%eax),%edx
+     e5d:	84 d2                	test   %dl,%dl
+     e5f:	75 12                	jne    e73 <strchr+0x23>
+     e61:	eb 1d                	jmp    e80 <strchr+0x30>
+     e63:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     e67:	90                   	nop
+     e68:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     e6c:	83 c0 01             	add    $0x1,%eax
+     e6f:	84 d2                	test   %dl,%dl
+     e71:	74 0d                	je     e80 <strchr+0x30>
+    if(*s == c)
+     e73:	38 d1                	cmp    %dl,%cl
+     e75:	75 f1                	jne    e68 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+     e77:	5d                   	pop    %ebp
+     e78:	c3                   	ret
+     e79:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+     e80:	31 c0                	xor    %eax,%eax
+}
+     e82:	5d                   	pop    %ebp
+     e83:	c3                   	ret
+     e84:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e8b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     e8f:	90                   	nop
+
+00000e90 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     e90:	55                   	push   %ebp
+     e91:	89 e5                	mov    %esp,%ebp
+     e93:	57                   	push   %edi
+     e94:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+     e95:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+     e98:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+     e99:	31 db                	xor    %ebx,%ebx
+{
+     e9b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+     e9e:	eb 27                	jmp    ec7 <gets+0x37>
+    cc = read(0, &c, 1);
+     ea0:	83 ec 04             	sub    $0x4,%esp
+     ea3:	6a 01                	push   $0x1
+     ea5:	56                   	push   %esi
+     ea6:	6a 00                	push   $0x0
+     ea8:	e8 1e 01 00 00       	call   fcb <read>
+    if(cc < 1)
+     ead:	83 c4 10             	add    $0x10,%esp
+     eb0:	85 c0                	test   %eax,%eax
+     eb2:	7e 1d                	jle    ed1 <gets+0x41>
+      break;
+    buf[i++] = c;
+     eb4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+     eb8:	8b 55 08             	mov    0x8(%ebp),%edx
+     ebb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+     ebf:	3c 0a                	cmp    $0xa,%al
+     ec1:	74 10                	je     ed3 <gets+0x43>
+     ec3:	3c 0d                	cmp    $0xd,%al
+     ec5:	74 0c                	je     ed3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+     ec7:	89 df                	mov    %ebx,%edi
+     ec9:	83 c3 01             	add    $0x1,%ebx
+     ecc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+     ecf:	7c cf                	jl     ea0 <gets+0x10>
+     ed1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+     ed3:	8b 45 08             	mov    0x8(%ebp),%eax
+     ed6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+     eda:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     edd:	5b                   	pop    %ebx
+     ede:	5e                   	pop    %esi
+     edf:	5f                   	pop    %edi
+     ee0:	5d                   	pop    %ebp
+     ee1:	c3                   	ret
+     ee2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     ee9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000ef0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+     ef0:	55                   	push   %ebp
+     ef1:	89 e5                	mov    %esp,%ebp
+     ef3:	56                   	push   %esi
+     ef4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     ef5:	83 ec 08             	sub    $0x8,%esp
+     ef8:	6a 00                	push   $0x0
+     efa:	ff 75 08             	push   0x8(%ebp)
+     efd:	e8 f1 00 00 00       	call   ff3 <open>
+  if(fd < 0)
+     f02:	83 c4 10             	add    $0x10,%esp
+     f05:	85 c0                	test   %eax,%eax
+     f07:	78 27                	js     f30 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+     f09:	83 ec 08             	sub    $0x8,%esp
+     f0c:	ff 75 0c             	push   0xc(%ebp)
+     f0f:	89 c3                	mov    %eax,%ebx
+     f11:	50                   	push   %eax
+     f12:	e8 f4 00 00 00       	call   100b <fstat>
+  close(fd);
+     f17:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+     f1a:	89 c6                	mov    %eax,%esi
+  close(fd);
+     f1c:	e8 ba 00 00 00       	call   fdb <close>
+  return r;
+     f21:	83 c4 10             	add    $0x10,%esp
+}
+     f24:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     f27:	89 f0                	mov    %esi,%eax
+     f29:	5b                   	pop    %ebx
+     f2a:	5e                   	pop    %esi
+     f2b:	5d                   	pop    %ebp
+     f2c:	c3                   	ret
+     f2d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+     f30:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     f35:	eb ed                	jmp    f24 <stat+0x34>
+     f37:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f3e:	66 90                	xchg   %ax,%ax
+
+00000f40 <atoi>:
+
+int
+atoi(const char *s)
+{
+     f40:	55                   	push   %ebp
+     f41:	89 e5                	mov    %esp,%ebp
+     f43:	53                   	push   %ebx
+     f44:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+     f47:	0f be 02             	movsbl (%edx),%eax
+     f4a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+     f4d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+     f50:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+     f55:	77 1e                	ja     f75 <atoi+0x35>
+     f57:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f5e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+     f60:	83 c2 01             	add    $0x1,%edx
+     f63:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+     f66:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+     f6a:	0f be 02             	movsbl (%edx),%eax
+     f6d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     f70:	80 fb 09             	cmp    $0x9,%bl
+     f73:	76 eb                	jbe    f60 <atoi+0x20>
+  return n;
+}
+     f75:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     f78:	89 c8                	mov    %ecx,%eax
+     f7a:	c9                   	leave
+     f7b:	c3                   	ret
+     f7c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000f80 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+     f80:	55                   	push   %ebp
+     f81:	89 e5                	mov    %esp,%ebp
+     f83:	57                   	push   %edi
+     f84:	56                   	push   %esi
+     f85:	8b 45 10             	mov    0x10(%ebp),%eax
+     f88:	8b 55 08             	mov    0x8(%ebp),%edx
+     f8b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+     f8e:	85 c0                	test   %eax,%eax
+     f90:	7e 13                	jle    fa5 <memmove+0x25>
+     f92:	01 d0                	add    %edx,%eax
+  dst = vdst;
+     f94:	89 d7                	mov    %edx,%edi
+     f96:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f9d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+     fa0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     fa1:	39 f8                	cmp    %edi,%eax
+     fa3:	75 fb                	jne    fa0 <memmove+0x20>
+  return vdst;
+}
+     fa5:	5e                   	pop    %esi
+     fa6:	89 d0                	mov    %edx,%eax
+     fa8:	5f                   	pop    %edi
+     fa9:	5d                   	pop    %ebp
+     faa:	c3                   	ret
+
+00000fab <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+     fab:	b8 01 00 00 00       	mov    $0x1,%eax
+     fb0:	cd 40                	int    $0x40
+     fb2:	c3                   	ret
+
+00000fb3 <exit>:
+SYSCALL(exit)
+     fb3:	b8 02 00 00 00       	mov    $0x2,%eax
+     fb8:	cd 40                	int    $0x40
+     fba:	c3                   	ret
+
+00000fbb <wait>:
+SYSCALL(wait)
+     fbb:	b8 03 00 00 00       	mov    $0x3,%eax
+     fc0:	cd 40                	int    $0x40
+     fc2:	c3                   	ret
+
+00000fc3 <pipe>:
+SYSCALL(pipe)
+     fc3:	b8 04 00 00 00       	mov    $0x4,%eax
+     fc8:	cd 40                	int    $0x40
+     fca:	c3                   	ret
+
+00000fcb <read>:
+SYSCALL(read)
+     fcb:	b8 05 00 00 00       	mov    $0x5,%eax
+     fd0:	cd 40                	int    $0x40
+     fd2:	c3                   	ret
+
+00000fd3 <write>:
+SYSCALL(write)
+     fd3:	b8 10 00 00 00       	mov    $0x10,%eax
+     fd8:	cd 40                	int    $0x40
+     fda:	c3                   	ret
+
+00000fdb <close>:
+SYSCALL(close)
+     fdb:	b8 15 00 00 00       	mov    $0x15,%eax
+     fe0:	cd 40                	int    $0x40
+     fe2:	c3                   	ret
+
+00000fe3 <kill>:
+SYSCALL(kill)
+     fe3:	b8 06 00 00 00       	mov    $0x6,%eax
+     fe8:	cd 40                	int    $0x40
+     fea:	c3                   	ret
+
+00000feb <exec>:
+SYSCALL(exec)
+     feb:	b8 07 00 00 00       	mov    $0x7,%eax
+     ff0:	cd 40                	int    $0x40
+     ff2:	c3                   	ret
+
+00000ff3 <open>:
+SYSCALL(open)
+     ff3:	b8 0f 00 00 00       	mov    $0xf,%eax
+     ff8:	cd 40                	int    $0x40
+     ffa:	c3                   	ret
+
+00000ffb <mknod>:
+SYSCALL(mknod)
+     ffb:	b8 11 00 00 00       	mov    $0x11,%eax
+    1000:	cd 40                	int    $0x40
+    1002:	c3                   	ret
+
+00001003 <unlink>:
+SYSCALL(unlink)
+    1003:	b8 12 00 00 00       	mov    $0x12,%eax
+    1008:	cd 40                	int    $0x40
+    100a:	c3                   	ret
+
+0000100b <fstat>:
+SYSCALL(fstat)
+    100b:	b8 08 00 00 00       	mov    $0x8,%eax
+    1010:	cd 40                	int    $0x40
+    1012:	c3                   	ret
+
+00001013 <link>:
+SYSCALL(link)
+    1013:	b8 13 00 00 00       	mov    $0x13,%eax
+    1018:	cd 40                	int    $0x40
+    101a:	c3                   	ret
+
+0000101b <mkdir>:
+SYSCALL(mkdir)
+    101b:	b8 14 00 00 00       	mov    $0x14,%eax
+    1020:	cd 40                	int    $0x40
+    1022:	c3                   	ret
+
+00001023 <chdir>:
+SYSCALL(chdir)
+    1023:	b8 09 00 00 00       	mov    $0x9,%eax
+    1028:	cd 40                	int    $0x40
+    102a:	c3                   	ret
+
+0000102b <dup>:
+SYSCALL(dup)
+    102b:	b8 0a 00 00 00       	mov    $0xa,%eax
+    1030:	cd 40                	int    $0x40
+    1032:	c3                   	ret
+
+00001033 <getpid>:
+SYSCALL(getpid)
+    1033:	b8 0b 00 00 00       	mov    $0xb,%eax
+    1038:	cd 40                	int    $0x40
+    103a:	c3                   	ret
+
+0000103b <sbrk>:
+SYSCALL(sbrk)
+    103b:	b8 0c 00 00 00       	mov    $0xc,%eax
+    1040:	cd 40                	int    $0x40
+    1042:	c3                   	ret
+
+00001043 <sleep>:
+SYSCALL(sleep)
+    1043:	b8 0d 00 00 00       	mov    $0xd,%eax
+    1048:	cd 40                	int    $0x40
+    104a:	c3                   	ret
+
+0000104b <uptime>:
+SYSCALL(uptime)
+    104b:	b8 0e 00 00 00       	mov    $0xe,%eax
+    1050:	cd 40                	int    $0x40
+    1052:	c3                   	ret
+
+00001053 <getrss>:
+SYSCALL(getrss)
+    1053:	b8 16 00 00 00       	mov    $0x16,%eax
+    1058:	cd 40                	int    $0x40
+    105a:	c3                   	ret
+
+0000105b <getNumFreePages>:
+SYSCALL(getNumFreePages)
+    105b:	b8 17 00 00 00       	mov    $0x17,%eax
+    1060:	cd 40                	int    $0x40
+    1062:	c3                   	ret
+
+00001063 <getvmstat>:
+SYSCALL(getvmstat)
+    1063:	b8 18 00 00 00       	mov    $0x18,%eax
+    1068:	cd 40                	int    $0x40
+    106a:	c3                   	ret
+
+0000106b <vmtune>:
+SYSCALL(vmtune)
+    106b:	b8 19 00 00 00       	mov    $0x19,%eax
+    1070:	cd 40                	int    $0x40
+    1072:	c3                   	ret
+
+00001073 <spawn>:
+SYSCALL(spawn)
+    1073:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    1078:	cd 40                	int    $0x40
+    107a:	c3                   	ret
+    107b:	66 90                	xchg   %ax,%ax
+    107d:	66 90                	xchg   %ax,%ax
+    107f:	90                   	nop
+
+00001080 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+    1080:	55                   	push   %ebp
+    1081:	89 e5                	mov    %esp,%ebp
+    1083:	57                   	push   %edi
+    1084:	56                   	push   %esi
+    1085:	53                   	push   %ebx
+    1086:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+    1088:	89 d1                	mov    %edx,%ecx
+{
+    108a:	83 ec 3c             	sub    $0x3c,%esp
+    108d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+    1090:	85 d2                	test   %edx,%edx
+    1092:	0f 89 80 00 00 00    	jns    1118 <printint+0x98>
+    1098:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+    109c:	74 7a                	je     1118 <printint+0x98>
+    x = -xx;
+    109e:	f7 d9                	neg    %ecx
+    neg = 1;
+    10a0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+    10a5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+    10a8:	31 f6                	xor    %esi,%esi
+    10aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+    10b0:	89 c8                	mov    %ecx,%eax
+    10b2:	31 d2                	xor    %edx,%edx
+    10b4:	89 f7                	mov    %esi,%edi
+    10b6:	f7 f3                	div    %ebx
+    10b8:	8d 76 01             	lea    0x1(%esi),%esi
+    10bb:	0f b6 92 90 15 00 00 	movzbl 0x1590(%edx),%edx
+    10c2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+    10c6:	89 ca                	mov    %ecx,%edx
+    10c8:	89 c1                	mov    %eax,%ecx
+    10ca:	39 da                	cmp    %ebx,%edx
+    10cc:	73 e2                	jae    10b0 <printint+0x30>
+  if(neg)
+    10ce:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+    10d1:	85 c0                	test   %eax,%eax
+    10d3:	74 07                	je     10dc <printint+0x5c>
+    buf[i++] = '-';
+    10d5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+    10da:	89 f7                	mov    %esi,%edi
+    10dc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+    10df:	8b 75 c0             	mov    -0x40(%ebp),%esi
+    10e2:	01 df                	add    %ebx,%edi
+    10e4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+    10e8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+    10eb:	83 ec 04             	sub    $0x4,%esp
+    10ee:	88 45 d7             	mov    %al,-0x29(%ebp)
+    10f1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+    10f4:	6a 01                	push   $0x1
+    10f6:	50                   	push   %eax
+    10f7:	56                   	push   %esi
+    10f8:	e8 d6 fe ff ff       	call   fd3 <write>
+  while(--i >= 0)
+    10fd:	89 f8                	mov    %edi,%eax
+    10ff:	83 c4 10             	add    $0x10,%esp
+    1102:	83 ef 01             	sub    $0x1,%edi
+    1105:	39 d8                	cmp    %ebx,%eax
+    1107:	75 df                	jne    10e8 <printint+0x68>
+}
+    1109:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    110c:	5b                   	pop    %ebx
+    110d:	5e                   	pop    %esi
+    110e:	5f                   	pop    %edi
+    110f:	5d                   	pop    %ebp
+    1110:	c3                   	ret
+    1111:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+    1118:	31 c0                	xor    %eax,%eax
+    111a:	eb 89                	jmp    10a5 <printint+0x25>
+    111c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001120 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+    1120:	55                   	push   %ebp
+    1121:	89 e5                	mov    %esp,%ebp
+    1123:	57                   	push   %edi
+    1124:	56                   	push   %esi
+    1125:	53                   	push   %ebx
+    1126:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+    1129:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+    112c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+    112f:	0f b6 1e             	movzbl (%esi),%ebx
+    1132:	83 c6 01             	add    $0x1,%esi
+    1135:	84 db                	test   %bl,%bl
+    1137:	74 67                	je     11a0 <printf+0x80>
+    1139:	8d 4d 10             	lea    0x10(%ebp),%ecx
+    113c:	31 d2                	xor    %edx,%edx
+    113e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+    1141:	eb 34                	jmp    1177 <printf+0x57>
+    1143:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1147:	90                   	nop
+    1148:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+    114b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+    1150:	83 f8 25             	cmp    $0x25,%eax
+    1153:	74 18                	je     116d <printf+0x4d>
+  write(fd, &c, 1);
+    1155:	83 ec 04             	sub    $0x4,%esp
+    1158:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    115b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    115e:	6a 01                	push   $0x1
+    1160:	50                   	push   %eax
+    1161:	57                   	push   %edi
+    1162:	e8 6c fe ff ff       	call   fd3 <write>
+    1167:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+    116a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+    116d:	0f b6 1e             	movzbl (%esi),%ebx
+    1170:	83 c6 01             	add    $0x1,%esi
+    1173:	84 db                	test   %bl,%bl
+    1175:	74 29                	je     11a0 <printf+0x80>
+    c = fmt[i] & 0xff;
+    1177:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+    117a:	85 d2                	test   %edx,%edx
+    117c:	74 ca                	je     1148 <printf+0x28>
+      }
+    } else if(state == '%'){
+    117e:	83 fa 25             	cmp    $0x25,%edx
+    1181:	75 ea                	jne    116d <printf+0x4d>
+      if(c == 'd'){
+    1183:	83 f8 25             	cmp    $0x25,%eax
+    1186:	0f 84 24 01 00 00    	je     12b0 <printf+0x190>
+    118c:	83 e8 63             	sub    $0x63,%eax
+    118f:	83 f8 15             	cmp    $0x15,%eax
+    1192:	77 1c                	ja     11b0 <printf+0x90>
+    1194:	ff 24 85 38 15 00 00 	jmp    *0x1538(,%eax,4)
+    119b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    119f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+    11a0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    11a3:	5b                   	pop    %ebx
+    11a4:	5e                   	pop    %esi
+    11a5:	5f                   	pop    %edi
+    11a6:	5d                   	pop    %ebp
+    11a7:	c3                   	ret
+    11a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    11af:	90                   	nop
+  write(fd, &c, 1);
+    11b0:	83 ec 04             	sub    $0x4,%esp
+    11b3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    11b6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+    11ba:	6a 01                	push   $0x1
+    11bc:	52                   	push   %edx
+    11bd:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    11c0:	57                   	push   %edi
+    11c1:	e8 0d fe ff ff       	call   fd3 <write>
+    11c6:	83 c4 0c             	add    $0xc,%esp
+    11c9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    11cc:	6a 01                	push   $0x1
+    11ce:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    11d1:	52                   	push   %edx
+    11d2:	57                   	push   %edi
+    11d3:	e8 fb fd ff ff       	call   fd3 <write>
+        putc(fd, c);
+    11d8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    11db:	31 d2                	xor    %edx,%edx
+    11dd:	eb 8e                	jmp    116d <printf+0x4d>
+    11df:	90                   	nop
+        printint(fd, *ap, 16, 0);
+    11e0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    11e3:	83 ec 0c             	sub    $0xc,%esp
+    11e6:	b9 10 00 00 00       	mov    $0x10,%ecx
+    11eb:	8b 13                	mov    (%ebx),%edx
+    11ed:	6a 00                	push   $0x0
+    11ef:	89 f8                	mov    %edi,%eax
+        ap++;
+    11f1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+    11f4:	e8 87 fe ff ff       	call   1080 <printint>
+        ap++;
+    11f9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    11fc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    11ff:	31 d2                	xor    %edx,%edx
+    1201:	e9 67 ff ff ff       	jmp    116d <printf+0x4d>
+    1206:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    120d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+    1210:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    1213:	8b 18                	mov    (%eax),%ebx
+        ap++;
+    1215:	83 c0 04             	add    $0x4,%eax
+    1218:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+    121b:	85 db                	test   %ebx,%ebx
+    121d:	0f 84 9d 00 00 00    	je     12c0 <printf+0x1a0>
+        while(*s != 0){
+    1223:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+    1226:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+    1228:	84 c0                	test   %al,%al
+    122a:	0f 84 3d ff ff ff    	je     116d <printf+0x4d>
+    1230:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    1233:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+    1236:	89 de                	mov    %ebx,%esi
+    1238:	89 d3                	mov    %edx,%ebx
+    123a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+    1240:	83 ec 04             	sub    $0x4,%esp
+    1243:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+    1246:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+    1249:	6a 01                	push   $0x1
+    124b:	53                   	push   %ebx
+    124c:	57                   	push   %edi
+    124d:	e8 81 fd ff ff       	call   fd3 <write>
+        while(*s != 0){
+    1252:	0f b6 06             	movzbl (%esi),%eax
+    1255:	83 c4 10             	add    $0x10,%esp
+    1258:	84 c0                	test   %al,%al
+    125a:	75 e4                	jne    1240 <printf+0x120>
+      state = 0;
+    125c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+    125f:	31 d2                	xor    %edx,%edx
+    1261:	e9 07 ff ff ff       	jmp    116d <printf+0x4d>
+    1266:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    126d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+    1270:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    1273:	83 ec 0c             	sub    $0xc,%esp
+    1276:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    127b:	8b 13                	mov    (%ebx),%edx
+    127d:	6a 01                	push   $0x1
+    127f:	e9 6b ff ff ff       	jmp    11ef <printf+0xcf>
+    1284:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+    1288:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+    128b:	83 ec 04             	sub    $0x4,%esp
+    128e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+    1291:	8b 03                	mov    (%ebx),%eax
+        ap++;
+    1293:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+    1296:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+    1299:	6a 01                	push   $0x1
+    129b:	52                   	push   %edx
+    129c:	57                   	push   %edi
+    129d:	e8 31 fd ff ff       	call   fd3 <write>
+        ap++;
+    12a2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    12a5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    12a8:	31 d2                	xor    %edx,%edx
+    12aa:	e9 be fe ff ff       	jmp    116d <printf+0x4d>
+    12af:	90                   	nop
+  write(fd, &c, 1);
+    12b0:	83 ec 04             	sub    $0x4,%esp
+    12b3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    12b6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    12b9:	6a 01                	push   $0x1
+    12bb:	e9 11 ff ff ff       	jmp    11d1 <printf+0xb1>
+    12c0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+    12c5:	bb 30 15 00 00       	mov    $0x1530,%ebx
+    12ca:	e9 61 ff ff ff       	jmp    1230 <printf+0x110>
+    12cf:	90                   	nop
+
+000012d0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    12d0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    12d1:	a1 24 1c 00 00       	mov    0x1c24,%eax
+{
+    12d6:	89 e5                	mov    %esp,%ebp
+    12d8:	57                   	push   %edi
+    12d9:	56                   	push   %esi
+    12da:	53                   	push   %ebx
+    12db:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+    12de:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    12e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    12e8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    12ea:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    12ec:	39 ca                	cmp    %ecx,%edx
+    12ee:	73 30                	jae    1320 <free+0x50>
+    12f0:	39 c1                	cmp    %eax,%ecx
+    12f2:	72 04                	jb     12f8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    12f4:	39 c2                	cmp    %eax,%edx
+    12f6:	72 f0                	jb     12e8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    12f8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+    12fb:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+    12fe:	39 f8                	cmp    %edi,%eax
+    1300:	74 2e                	je     1330 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    1302:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+    1305:	8b 42 04             	mov    0x4(%edx),%eax
+    1308:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    130b:	39 f1                	cmp    %esi,%ecx
+    130d:	74 38                	je     1347 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    130f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+    1311:	5b                   	pop    %ebx
+  freep = p;
+    1312:	89 15 24 1c 00 00    	mov    %edx,0x1c24
+}
+    1318:	5e                   	pop    %esi
+    1319:	5f                   	pop    %edi
+    131a:	5d                   	pop    %ebp
+    131b:	c3                   	ret
+    131c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1320:	39 c1                	cmp    %eax,%ecx
+    1322:	72 d0                	jb     12f4 <free+0x24>
+    1324:	eb c2                	jmp    12e8 <free+0x18>
+    1326:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    132d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+    1330:	03 70 04             	add    0x4(%eax),%esi
+    1333:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    1336:	8b 02                	mov    (%edx),%eax
+    1338:	8b 00                	mov    (%eax),%eax
+    133a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+    133d:	8b 42 04             	mov    0x4(%edx),%eax
+    1340:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    1343:	39 f1                	cmp    %esi,%ecx
+    1345:	75 c8                	jne    130f <free+0x3f>
+    p->s.size += bp->s.size;
+    1347:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+    134a:	89 15 24 1c 00 00    	mov    %edx,0x1c24
+    p->s.size += bp->s.size;
+    1350:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    1353:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+    1356:	89 0a                	mov    %ecx,(%edx)
+}
+    1358:	5b                   	pop    %ebx
+    1359:	5e                   	pop    %esi
+    135a:	5f                   	pop    %edi
+    135b:	5d                   	pop    %ebp
+    135c:	c3                   	ret
+    135d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001360 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+    1360:	55                   	push   %ebp
+    1361:	89 e5                	mov    %esp,%ebp
+    1363:	57                   	push   %edi
+    1364:	56                   	push   %esi
+    1365:	53                   	push   %ebx
+    1366:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1369:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+    136c:	8b 15 24 1c 00 00    	mov    0x1c24,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1372:	8d 78 07             	lea    0x7(%eax),%edi
+    1375:	c1 ef 03             	shr    $0x3,%edi
+    1378:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+    137b:	85 d2                	test   %edx,%edx
+    137d:	0f 84 8d 00 00 00    	je     1410 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1383:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    1385:	8b 48 04             	mov    0x4(%eax),%ecx
+    1388:	39 f9                	cmp    %edi,%ecx
+    138a:	73 64                	jae    13f0 <malloc+0x90>
+  if(nu < 4096)
+    138c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    1391:	39 df                	cmp    %ebx,%edi
+    1393:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    1396:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    139d:	eb 0a                	jmp    13a9 <malloc+0x49>
+    139f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    13a0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    13a2:	8b 48 04             	mov    0x4(%eax),%ecx
+    13a5:	39 f9                	cmp    %edi,%ecx
+    13a7:	73 47                	jae    13f0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+    13a9:	89 c2                	mov    %eax,%edx
+    13ab:	39 05 24 1c 00 00    	cmp    %eax,0x1c24
+    13b1:	75 ed                	jne    13a0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+    13b3:	83 ec 0c             	sub    $0xc,%esp
+    13b6:	56                   	push   %esi
+    13b7:	e8 7f fc ff ff       	call   103b <sbrk>
+  if(p == (char*)-1)
+    13bc:	83 c4 10             	add    $0x10,%esp
+    13bf:	83 f8 ff             	cmp    $0xffffffff,%eax
+    13c2:	74 1c                	je     13e0 <malloc+0x80>
+  hp->s.size = nu;
+    13c4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+    13c7:	83 ec 0c             	sub    $0xc,%esp
+    13ca:	83 c0 08             	add    $0x8,%eax
+    13cd:	50                   	push   %eax
+    13ce:	e8 fd fe ff ff       	call   12d0 <free>
+  return freep;
+    13d3:	8b 15 24 1c 00 00    	mov    0x1c24,%edx
+      if((p = morecore(nunits)) == 0)
+    13d9:	83 c4 10             	add    $0x10,%esp
+    13dc:	85 d2                	test   %edx,%edx
+    13de:	75 c0                	jne    13a0 <malloc+0x40>
+        return 0;
+  }
+}
+    13e0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    13e3:	31 c0                	xor    %eax,%eax
+}
+    13e5:	5b                   	pop    %ebx
+    13e6:	5e                   	pop    %esi
+    13e7:	5f                   	pop    %edi
+    13e8:	5d                   	pop    %ebp
+    13e9:	c3                   	ret
+    13ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    13f0:	39 cf                	cmp    %ecx,%edi
+    13f2:	74 4c                	je     1440 <malloc+0xe0>
+        p->s.size -= nunits;
+    13f4:	29 f9                	sub    %edi,%ecx
+    13f6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+    13f9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+    13fc:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+    13ff:	89 15 24 1c 00 00    	mov    %edx,0x1c24
+}
+    1405:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    1408:	83 c0 08             	add    $0x8,%eax
+}
+    140b:	5b                   	pop    %ebx
+    140c:	5e                   	pop    %esi
+    140d:	5f                   	pop    %edi
+    140e:	5d                   	pop    %ebp
+    140f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+    1410:	c7 05 24 1c 00 00 28 	movl   $0x1c28,0x1c24
+    1417:	1c 00 00 
+    base.s.size = 0;
+    141a:	b8 28 1c 00 00       	mov    $0x1c28,%eax
+    base.s.ptr = freep = prevp = &base;
+    141f:	c7 05 28 1c 00 00 28 	movl   $0x1c28,0x1c28
+    1426:	1c 00 00 
+    base.s.size = 0;
+    1429:	c7 05 2c 1c 00 00 00 	movl   $0x0,0x1c2c
+    1430:	00 00 00 
+    if(p->s.size >= nunits){
+    1433:	e9 54 ff ff ff       	jmp    138c <malloc+0x2c>
+    1438:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    143f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    1440:	8b 08                	mov    (%eax),%ecx
+    1442:	89 0a                	mov    %ecx,(%edx)
+    1444:	eb b9                	jmp    13ff <malloc+0x9f>
@@ -52,6 +52,7 @@ struct backcmd {
 int fork1(void);  // Fork but panics on failure.
 void panic(char*);
 struct cmd *parsecmd(char*);
+void freecmd(struct cmd*);
 
 // Execute cmd.  Never returns.
 void
@@ -130,6 +131,41 @@ runcmd(struct cmd *cmd)
   exit();
 }
 
+// Start cmd with spawn() if it is a single command, maybe with
+// redirections, so that the shell does not have to fork itself.
+// Returns the child's pid, or -1 if cmd needs fork1() and
+// runcmd() instead, which then also report any error.
+int
+spawncmd(struct cmd *cmd)
+{
+  int fds[3], opened[MAXARGS], i, n, pid;
+  struct execcmd *ecmd;
+  struct redircmd *rcmd;
+
+  fds[0] = 0;
+  fds[1] = 1;
+  fds[2] = 2;
+  n = 0;
+  pid = -1;
+  // As in runcmd(), an inner redirection of the same fd wins.
+  while(cmd && cmd->type == REDIR && n < MAXARGS){
+    rcmd = (struct redircmd*)cmd;
+    if(rcmd->fd > 2 || (fds[rcmd->fd] = open(rcmd->file, rcmd->mode)) < 0)
+      goto out;
+    opened[n++] = fds[rcmd->fd];
+    cmd = rcmd->cmd;
+  }
+  if(cmd && cmd->type == EXEC){
+    ecmd = (struct execcmd*)cmd;
+    if(ecmd->argv[0])
+      pid = spawn(ecmd->argv[0], ecmd->argv, fds);
+  }
+out:
+  for(i = 0; i < n; i++)
+    close(opened[i]);
+  return pid;
+}
+
 int
 getcmd(char *buf, int nbuf)
 {
@@ -146,6 +182,7 @@ main(void)
 {
   static char buf[100];
   int fd;
+  struct cmd *cmd;
 
   // Ensure that three file descriptors are open.
   while((fd = open("console", O_RDWR)) >= 0){
@@ -164,9 +201,11 @@ main(void)
         printf(2, "cannot cd %s\n", buf+3);
       continue;
     }
-    if(fork1() == 0)
-      runcmd(parsecmd(buf));
+    cmd = parsecmd(buf);
+    if(spawncmd(cmd) < 0 && fork1() == 0)
+      runcmd(cmd);
     wait();
+    freecmd(cmd);
   }
   exit();
 }
@@ -491,3 +530,41 @@ nulterminate(struct cmd *cmd)
   }
   return cmd;
 }
+
+// Free a parsed command.
+void
+freecmd(struct cmd *cmd)
+{
+  struct backcmd *bcmd;
+  struct listcmd *lcmd;
+  struct pipecmd *pcmd;
+  struct redircmd *rcmd;
+
+  if(cmd == 0)
+    return;
+
+  switch(cmd->type){
+  case REDIR:
+    rcmd = (struct redircmd*)cmd;
+    freecmd(rcmd->cmd);
+    break;
+
+  case PIPE:
+    pcmd = (struct pipecmd*)cmd;
+    freecmd(pcmd->left);
+    freecmd(pcmd->right);
+    break;
+
+  case LIST:
+    lcmd = (struct listcmd*)cmd;
+    freecmd(lcmd->left);
+    freecmd(lcmd->right);
+    break;
+
+  case BACK:
+    bcmd = (struct backcmd*)cmd;
+    freecmd(bcmd->cmd);
+    break;
+  }
+  free(cmd);
+}
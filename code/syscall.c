@@ -21,26 +21,24 @@ fetchint(uint addr, int *ip)
 
   if(addr >= curproc->sz || addr+4 > curproc->sz)
     return -1;
-  *ip = *(int*)(addr);
-  return 0;
+  return copyuser(ip, (void*)addr, 4);
 }
 
-// Fetch the nul-terminated string at addr from the current process.
-// Doesn't actually copy the string - just sets *pp to point at it.
+// Copy the nul-terminated string at addr from the current process
+// into buf, which holds max bytes.  The kernel then uses its own
+// copy, which cannot fault.
 // Returns length of string, not including nul.
 int
-fetchstr(uint addr, char **pp)
+fetchstr(uint addr, char *buf, int max)
 {
-  char *s, *ep;
+  int i;
   struct proc *curproc = myproc();
 
-  if(addr >= curproc->sz)
-    return -1;
-  *pp = (char*)addr;
-  ep = (char*)curproc->sz;
-  for(s = *pp; s < ep; s++){
-    if(*s == 0)
-      return s - *pp;
+  for(i = 0; i < max && addr + i < curproc->sz; i++){
+    if(copyuser(buf + i, (char*)addr + i, 1) < 0)
+      return -1;
+    if(buf[i] == 0)
+      return i;
   }
   return -1;
 }
@@ -54,7 +52,8 @@ argint(int n, int *ip)
 
 // Fetch the nth word-sized system call argument as a pointer
 // to a block of memory of size bytes.  Check that the pointer
-// lies within the process address space.
+// lies within the process address space.  The memory itself is
+// read and written with copyuser().
 int
 argptr(int n, char **pp, int size)
 {
@@ -69,17 +68,15 @@ argptr(int n, char **pp, int size)
   return 0;
 }
 
-// Fetch the nth word-sized system call argument as a string pointer.
-// Check that the pointer is valid and the string is nul-terminated.
-// (There is no shared writable memory, so the string can't change
-// between this check and being used by the kernel.)
+// Fetch the nth word-sized system call argument as a string pointer,
+// and copy the nul-terminated string into buf, which holds max bytes.
 int
-argstr(int n, char **pp)
+argstr(int n, char *buf, int max)
 {
   int addr;
   if(argint(n, &addr) < 0)
     return -1;
-  return fetchstr(addr, pp);
+  return fetchstr(addr, buf, max);
 }
 
 extern int sys_chdir(void);
@@ -105,6 +102,9 @@ extern int sys_write(void);
 extern int sys_uptime(void);
 extern int sys_getrss(void);
 extern int sys_getNumFreePages(void);
+extern int sys_getvmstat(void);
+extern int sys_vmtune(void);
+extern int sys_spawn(void);
 
 static int (*syscalls[])(void) = {
 [SYS_fork]    sys_fork,
@@ -130,6 +130,9 @@ static int (*syscalls[])(void) = {
 [SYS_close]   sys_close,
 [SYS_getrss] sys_getrss,
 [SYS_getNumFreePages]   sys_getNumFreePages,
+[SYS_getvmstat] sys_getvmstat,
+[SYS_vmtune]   sys_vmtune,
+[SYS_spawn]    sys_spawn,
 };
 
 void
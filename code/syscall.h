@@ -22,3 +22,6 @@
 #define SYS_close  21
 #define SYS_getrss 22
 #define SYS_getNumFreePages  23
+#define SYS_getvmstat 24
+#define SYS_vmtune 25
+#define SYS_spawn  26
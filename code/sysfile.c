@@ -107,21 +107,23 @@ int
 sys_fstat(void)
 {
   struct file *f;
-  struct stat *st;
+  struct stat *ust, st;
 
-  if(argfd(0, 0, &f) < 0 || argptr(1, (void*)&st, sizeof(*st)) < 0)
+  if(argfd(0, 0, &f) < 0 || argptr(1, (void*)&ust, sizeof(*ust)) < 0)
     return -1;
-  return filestat(f, st);
+  if(filestat(f, &st) < 0)
+    return -1;
+  return copyuser(ust, &st, sizeof(st));
 }
 
 // Create the path new as a link to the same inode as old.
 int
 sys_link(void)
 {
-  char name[DIRSIZ], *new, *old;
+  char name[DIRSIZ], new[MAXPATH], old[MAXPATH];
   struct inode *dp, *ip;
 
-  if(argstr(0, &old) < 0 || argstr(1, &new) < 0)
+  if(argstr(0, old, MAXPATH) < 0 || argstr(1, new, MAXPATH) < 0)
     return -1;
 
   begin_op();
@@ -186,10 +188,10 @@ sys_unlink(void)
 {
   struct inode *ip, *dp;
   struct dirent de;
-  char name[DIRSIZ], *path;
+  char name[DIRSIZ], path[MAXPATH];
   uint off;
 
-  if(argstr(0, &path) < 0)
+  if(argstr(0, path, MAXPATH) < 0)
     return -1;
 
   begin_op();
@@ -285,12 +287,12 @@ create(char *path, short type, short major, short minor)
 int
 sys_open(void)
 {
-  char *path;
+  char path[MAXPATH];
   int fd, omode;
   struct file *f;
   struct inode *ip;
 
-  if(argstr(0, &path) < 0 || argint(1, &omode) < 0)
+  if(argstr(0, path, MAXPATH) < 0 || argint(1, &omode) < 0)
     return -1;
 
   begin_op();
@@ -335,11 +337,11 @@ sys_open(void)
 int
 sys_mkdir(void)
 {
-  char *path;
+  char path[MAXPATH];
   struct inode *ip;
 
   begin_op();
-  if(argstr(0, &path) < 0 || (ip = create(path, T_DIR, 0, 0)) == 0){
+  if(argstr(0, path, MAXPATH) < 0 || (ip = create(path, T_DIR, 0, 0)) == 0){
     end_op();
     return -1;
   }
@@ -352,11 +354,11 @@ int
 sys_mknod(void)
 {
   struct inode *ip;
-  char *path;
+  char path[MAXPATH];
   int major, minor;
 
   begin_op();
-  if((argstr(0, &path)) < 0 ||
+  if((argstr(0, path, MAXPATH)) < 0 ||
      argint(1, &major) < 0 ||
      argint(2, &minor) < 0 ||
      (ip = create(path, T_DEV, major, minor)) == 0){
@@ -371,12 +373,12 @@ sys_mknod(void)
 int
 sys_chdir(void)
 {
-  char *path;
+  char path[MAXPATH];
   struct inode *ip;
   struct proc *curproc = myproc();
   
   begin_op();
-  if(argstr(0, &path) < 0 || (ip = namei(path)) == 0){
+  if(argstr(0, path, MAXPATH) < 0 || (ip = namei(path)) == 0){
     end_op();
     return -1;
   }
@@ -393,40 +395,85 @@ sys_chdir(void)
   return 0;
 }
 
-int
-sys_exec(void)
+// Copy the argument vector at uargv into argv, and the strings
+// it points to into the page buf.  They all go on one stack page
+// in the end, so one page holds them.
+static int
+fetchargv(uint uargv, char **argv, char *buf)
 {
-  char *path, *argv[MAXARG];
-  int i;
-  uint uargv, uarg;
+  int i, n, off;
+  uint uarg;
 
-  if(argstr(0, &path) < 0 || argint(1, (int*)&uargv) < 0){
-    return -1;
-  }
-  memset(argv, 0, sizeof(argv));
+  memset(argv, 0, MAXARG*sizeof(argv[0]));
+  off = 0;
   for(i=0;; i++){
-    if(i >= NELEM(argv))
+    if(i >= MAXARG)
       return -1;
     if(fetchint(uargv+4*i, (int*)&uarg) < 0)
       return -1;
     if(uarg == 0){
       argv[i] = 0;
-      break;
+      return 0;
     }
-    if(fetchstr(uarg, &argv[i]) < 0)
+    if((n = fetchstr(uarg, buf + off, PGSIZE - off)) < 0)
       return -1;
+    argv[i] = buf + off;
+    off += n + 1;
   }
-  return exec(path, argv);
+}
+
+int
+sys_exec(void)
+{
+  char path[MAXPATH], *argv[MAXARG], *buf;
+  int r;
+  uint uargv;
+
+  if(argstr(0, path, MAXPATH) < 0 || argint(1, (int*)&uargv) < 0){
+    return -1;
+  }
+  if((buf = kalloc()) == 0)
+    return -1;
+  r = -1;
+  if(fetchargv(uargv, argv, buf) == 0)
+    r = exec(path, argv);
+  kfree(buf);
+  return r;
+}
+
+// fds is an array of three descriptors; see spawn().
+int
+sys_spawn(void)
+{
+  char path[MAXPATH], *argv[MAXARG], *buf;
+  int i, r, *ufds, fds[3];
+  uint uargv;
+
+  if(argstr(0, path, MAXPATH) < 0 || argint(1, (int*)&uargv) < 0 ||
+     argptr(2, (char**)&ufds, sizeof(fds)) < 0 ||
+     copyuser(fds, ufds, sizeof(fds)) < 0){
+    return -1;
+  }
+  for(i = 0; i < 3; i++)
+    if(fds[i] >= NOFILE || (fds[i] >= 0 && myproc()->ofile[fds[i]] == 0))
+      return -1;
+  if((buf = kalloc()) == 0)
+    return -1;
+  r = -1;
+  if(fetchargv(uargv, argv, buf) == 0)
+    r = spawn(path, argv, fds);
+  kfree(buf);
+  return r;
 }
 
 int
 sys_pipe(void)
 {
-  int *fd;
+  int *ufd, fd[2];
   struct file *rf, *wf;
   int fd0, fd1;
 
-  if(argptr(0, (void*)&fd, 2*sizeof(fd[0])) < 0)
+  if(argptr(0, (void*)&ufd, sizeof(fd)) < 0)
     return -1;
   if(pipealloc(&rf, &wf) < 0)
     return -1;
@@ -440,5 +487,12 @@ sys_pipe(void)
   }
   fd[0] = fd0;
   fd[1] = fd1;
+  if(copyuser(ufd, fd, sizeof(fd)) < 0){
+    myproc()->ofile[fd0] = 0;
+    myproc()->ofile[fd1] = 0;
+    fileclose(rf);
+    fileclose(wf);
+    return -1;
+  }
   return 0;
 }
@@ -6,6 +6,7 @@
 #include "memlayout.h"
 #include "mmu.h"
 #include "proc.h"
+#include "vmstat.h"
 
 
 int
@@ -14,6 +15,35 @@ sys_getNumFreePages(void)
   return num_of_FreePages();  
 }
 
+// copy virtual memory statistics out to user space.
+// They are gathered on the kernel stack, under the allocator's
+// and swap's locks, and copied out once those are released: the
+// user's buffer may need faulting in.
+int
+sys_getvmstat(void)
+{
+  struct vmstat *ust, st;
+
+  if(argptr(0, (void*)&ust, sizeof(*ust)) < 0)
+    return -1;
+  memset(&st, 0, sizeof(st));
+  kmemstat(&st);
+  swapstat(&st);
+  return copyuser(ust, &st, sizeof(st));
+}
+
+// set a VM tunable (see vmstat.h); value < 0 only queries.
+// returns the previous value, or -1 if param is unknown.
+int
+sys_vmtune(void)
+{
+  int param, value;
+
+  if(argint(0, &param) < 0 || argint(1, &value) < 0)
+    return -1;
+  return vmtune(param, value);
+}
+
 int 
 sys_getrss()
 {
@@ -0,0 +1,188 @@
+// TLB invalidation.
+//
+// A PTE that stops being present, or moves to another frame, may
+// still be cached in the TLB of each CPU running an address space
+// that maps it.  There are no global user pages and no PCIDs, so
+// switchuvm()'s load of %cr3 empties a CPU's TLB of user pages,
+// and only the CPUs running such an address space right now need
+// to hear about it:
+//
+//   - the faulting process changes its own PTEs: invlpg the page,
+//     not a reload of %cr3 that throws away every other entry;
+//   - an address space running on no CPU: nothing to do, its next
+//     switchuvm() starts it afresh;
+//   - one running on another CPU: an IPI asks that CPU to invlpg
+//     the pages (a shootdown).
+//
+// kswapd changes other processes' PTEs under their frames' rmap
+// stripes, so tlb_add() only notes which pages and CPUs are
+// concerned, and tlb_flush() does the work, one IPI per CPU for
+// the lot, once the stripes are released.  Waiting for another
+// CPU with a spinlock held could deadlock if it spins on the same
+// lock with interrupts off.
+//
+// A CPU told to flush checks each page against its own page
+// directory, since by then it may be running something else, and
+// for a page table fork() left shared (see copyuvm()) there is no
+// single owner to go by.
+
+#include "types.h"
+#include "param.h"
+#include "defs.h"
+#include "x86.h"
+#include "mmu.h"
+#include "memlayout.h"
+#include "proc.h"
+#include "traps.h"
+#include "tlb.h"
+#include "vmstat.h"
+
+static struct {
+  uint busy;                    // a shootdown is in progress
+  struct tlbbatch *volatile req;  // its batch
+  volatile uint pending;        // CPUs yet to flush it, by bit
+} tlb;
+
+// Counters, per CPU so that CPUs bumping them at once lose
+// nothing; each is updated with interrupts off.
+static struct {
+  uint invlpgs;
+  uint fulls;
+  uint ipis;
+  uint deferred;
+} tlbcnt[NCPU];
+
+// Flush b's pages from this CPU's TLB.
+static void
+tlbrun(struct tlbbatch *b)
+{
+  pde_t *pgdir, pde;
+  uint i;
+
+  if(b->full){
+    lcr3(rcr3());
+    tlbcnt[cpuid()].fulls++;
+    return;
+  }
+  pgdir = (pde_t*)P2V(rcr3());
+  for(i = 0; i < b->n; i++){
+    pde = pgdir[PDX(b->va[i])];
+    if((pde & PTE_P) && PTE_ADDR(pde) == b->pt[i]){
+      invlpg((void*)b->va[i]);
+      tlbcnt[cpuid()].invlpgs++;
+    }
+  }
+}
+
+// Do this CPU's part of a shootdown, if it has one.
+// Interrupts are off.
+static void
+tlbpoll(void)
+{
+  uint bit;
+
+  bit = 1 << cpuid();
+  if(tlb.pending & bit){
+    tlbrun(tlb.req);
+    __sync_fetch_and_and(&tlb.pending, ~bit);
+  }
+}
+
+// Flush the page at va, which the current process has just
+// remapped in its own page table, from this CPU's TLB.
+void
+tlb_page(uint va)
+{
+  pushcli();
+  invlpg((void*)PGROUNDDOWN(va));
+  tlbcnt[cpuid()].invlpgs++;
+  popcli();
+}
+
+// The user PTE pte has just stopped being present, or now maps
+// another frame: add it to b.  Caller holds the lock keeping
+// pte's page table from being freed.
+void
+tlb_add(struct tlbbatch *b, pte_t *pte)
+{
+  struct proc *owner, *p;
+  struct cpu *c;
+  uint mask;
+
+  if(b->n < TLBBATCH){
+    b->va[b->n] = pte_va(pte);
+    b->pt[b->n] = V2P(PGROUNDDOWN((uint)pte));
+    b->n++;
+  } else
+    b->full = 1;
+
+  // A CPU that switches to the address space after the PTE
+  // store is visible reloads %cr3 and cannot see the old entry.
+  __sync_synchronize();
+  owner = pt_owner(pte);
+  mask = 0;
+  for(c = cpus; c < cpus + ncpu; c++){
+    p = c->proc;
+    if(p != 0 && (owner == PT_SHARED || p == owner))
+      mask |= 1 << (c - cpus);
+  }
+  if(mask == 0)
+    tlbcnt[cpuid()].deferred++;
+  b->cpus |= mask;
+}
+
+// Do the flushes b lists and empty it.
+// Caller holds no spinlocks.
+void
+tlb_flush(struct tlbbatch *b)
+{
+  uint self, others;
+  int i;
+
+  pushcli();
+  self = 1 << cpuid();
+  if(b->cpus & self)
+    tlbrun(b);
+  others = b->cpus & ~self;
+  if(others){
+    while(xchg(&tlb.busy, 1) != 0)
+      tlbpoll();
+    tlb.req = b;
+    tlb.pending = others;
+    for(i = 0; i < ncpu; i++){
+      if(others & (1 << i)){
+        lapicipi(cpus[i].apicid, T_TLBFLUSH);
+        tlbcnt[cpuid()].ipis++;
+      }
+    }
+    while(tlb.pending)
+      ;
+    tlb.req = 0;
+    xchg(&tlb.busy, 0);
+  }
+  popcli();
+  b->n = 0;
+  b->full = 0;
+  b->cpus = 0;
+}
+
+// Shootdown IPI.
+void
+tlbintr(void)
+{
+  tlbpoll();
+}
+
+void
+tlbstat(struct vmstat *st)
+{
+  int i;
+
+  st->tlbinvlpgs = st->tlbfulls = st->tlbipis = st->tlbdeferred = 0;
+  for(i = 0; i < NCPU; i++){
+    st->tlbinvlpgs += tlbcnt[i].invlpgs;
+    st->tlbfulls += tlbcnt[i].fulls;
+    st->tlbipis += tlbcnt[i].ipis;
+    st->tlbdeferred += tlbcnt[i].deferred;
+  }
+}
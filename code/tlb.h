@@ -0,0 +1,12 @@
+// TLB invalidations gathered while changing PTEs, and done
+// together by tlb_flush() once the caller has let go of its
+// spinlocks.  See tlb.c.
+#define TLBBATCH 16     // pages flushed one by one; more flushes all
+
+struct tlbbatch {
+  uint n;               // pages listed
+  uint full;            // too many pages: flush everything
+  uint cpus;            // CPUs to flush, by bit
+  uint va[TLBBATCH];    // user address of each page
+  uint pt[TLBBATCH];    // and its page table's physical address
+};
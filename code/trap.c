@@ -10,6 +10,7 @@
 
 // Interrupt descriptor table (shared by all CPUs).
 struct gatedesc idt[256];
+extern char copyuser_insn[], copyuser_fault[];  // in vm.c
 extern uint vectors[];  // in vectors.S: array of 256 entry pointers
 struct spinlock tickslock;
 uint ticks;
@@ -47,10 +48,6 @@ trap(struct trapframe *tf)
   }
 
   switch(tf->trapno){
-  case T_PGFLT:
-    page_fault();
-    lapiceoi();
-    break;
   case T_IRQ0 + IRQ_TIMER:
     if(cpuid() == 0){
       acquire(&tickslock);
@@ -75,12 +72,36 @@ trap(struct trapframe *tf)
     uartintr();
     lapiceoi();
     break;
+  case T_TLBFLUSH:
+    tlbintr();
+    lapiceoi();
+    break;
   case T_IRQ0 + 7:
   case T_IRQ0 + IRQ_SPURIOUS:
     cprintf("cpu%d: spurious interrupt at %x:%x\n",
             cpuid(), tf->cs, tf->eip);
     lapiceoi();
     break;
+  case T_PGFLT:
+    if(page_fault(tf->err) == 0){
+      lapiceoi();
+      break;
+    }
+    if(myproc() && (tf->cs&3) == 0 && tf->eip == (uint)copyuser_insn &&
+       rcr2() < KERNBASE){
+      // A system call's copy of user memory that cannot be
+      // brought in: fail the call, and kill the process as for
+      // the same fault in user space.
+      cprintf("pid %d %s: cannot fault in addr 0x%x--kill proc\n",
+              myproc()->pid, myproc()->name, rcr2());
+      myproc()->killed = 1;
+      tf->eip = (uint)copyuser_fault;
+      lapiceoi();
+      break;
+    }
+    // Not a reserved, swapped or copy-on-write page, or no
+    // memory left to bring it in: kill the process as for
+    // any other fault.
 
   //PAGEBREAK: 13
   default:
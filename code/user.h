@@ -1,5 +1,6 @@
 struct stat;
 struct rtcdate;
+struct vmstat;
 
 // system calls
 int fork(void);
@@ -25,6 +26,9 @@ int sleep(int);
 int uptime(void);
 int getrss(void);
 int getNumFreePages(void);
+int getvmstat(struct vmstat*);
+int vmtune(int, int);
+int spawn(char*, char**, int*);
 
 // ulib.c
 int stat(const char*, struct stat*);
@@ -0,0 +1,10682 @@
+
+_usertests:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  return randstate;
+}
+
+int
+main(int argc, char *argv[])
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	51                   	push   %ecx
+       e:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "usertests starting\n");
+      11:	68 a1 7e 00 00       	push   $0x7ea1
+      16:	6a 01                	push   $0x1
+      18:	e8 a3 65 00 00       	call   65c0 <printf>
+
+  if(open("usertests.ran", 0) >= 0){
+      1d:	59                   	pop    %ecx
+      1e:	58                   	pop    %eax
+      1f:	6a 00                	push   $0x0
+      21:	68 b5 7e 00 00       	push   $0x7eb5
+      26:	e8 68 64 00 00       	call   6493 <open>
+      2b:	83 c4 10             	add    $0x10,%esp
+      2e:	85 c0                	test   %eax,%eax
+      30:	78 13                	js     45 <main+0x45>
+    printf(1, "already ran user tests -- rebuild fs.img\n");
+      32:	52                   	push   %edx
+      33:	52                   	push   %edx
+      34:	68 00 91 00 00       	push   $0x9100
+      39:	6a 01                	push   $0x1
+      3b:	e8 80 65 00 00       	call   65c0 <printf>
+    exit();
+      40:	e8 0e 64 00 00       	call   6453 <exit>
+  }
+  close(open("usertests.ran", O_CREATE));
+      45:	50                   	push   %eax
+      46:	50                   	push   %eax
+      47:	68 00 02 00 00       	push   $0x200
+      4c:	68 b5 7e 00 00       	push   $0x7eb5
+      51:	e8 3d 64 00 00       	call   6493 <open>
+      56:	89 04 24             	mov    %eax,(%esp)
+      59:	e8 1d 64 00 00       	call   647b <close>
+
+  argptest();
+      5e:	e8 1d 61 00 00       	call   6180 <argptest>
+  createdelete();
+      63:	e8 68 3d 00 00       	call   3dd0 <createdelete>
+  linkunlink();
+      68:	e8 03 46 00 00       	call   4670 <linkunlink>
+  concreate();
+      6d:	e8 fe 42 00 00       	call   4370 <concreate>
+  fourfiles();
+      72:	e8 59 3b 00 00       	call   3bd0 <fourfiles>
+  sharedfd();
+      77:	e8 94 39 00 00       	call   3a10 <sharedfd>
+
+  bigargtest();
+      7c:	e8 bf 5d 00 00       	call   5e40 <bigargtest>
+  bigwrite();
+      81:	e8 0a 4f 00 00       	call   4f90 <bigwrite>
+  bigargtest();
+      86:	e8 b5 5d 00 00       	call   5e40 <bigargtest>
+  bsstest();
+      8b:	e8 40 5d 00 00       	call   5dd0 <bsstest>
+  sbrktest();
+      90:	e8 3b 58 00 00       	call   58d0 <sbrktest>
+  validatetest();
+      95:	e8 86 5c 00 00       	call   5d20 <validatetest>
+
+  opentest();
+      9a:	e8 c1 03 00 00       	call   460 <opentest>
+  writetest();
+      9f:	e8 4c 04 00 00       	call   4f0 <writetest>
+  writetest1();
+      a4:	e8 27 06 00 00       	call   6d0 <writetest1>
+  createtest();
+      a9:	e8 f2 07 00 00       	call   8a0 <createtest>
+
+  openiputtest();
+      ae:	e8 ad 02 00 00       	call   360 <openiputtest>
+  exitiputtest();
+      b3:	e8 a8 01 00 00       	call   260 <exitiputtest>
+  iputtest();
+      b8:	e8 c3 00 00 00       	call   180 <iputtest>
+
+  mem();
+      bd:	e8 3e 0d 00 00       	call   e00 <mem>
+  allocbench();
+      c2:	e8 09 0e 00 00       	call   ed0 <allocbench>
+  buddytest();
+      c7:	e8 24 0f 00 00       	call   ff0 <buddytest>
+  swapbench();
+      cc:	e8 bf 0f 00 00       	call   1090 <swapbench>
+  swapseqbench();
+      d1:	e8 0a 13 00 00       	call   13e0 <swapseqbench>
+  kswapdtest();
+      d6:	e8 d5 14 00 00       	call   15b0 <kswapdtest>
+  wsbench();
+      db:	e8 a0 16 00 00       	call   1780 <wsbench>
+  swapfulltest();
+      e0:	e8 4b 18 00 00       	call   1930 <swapfulltest>
+  swapcachetest();
+      e5:	e8 56 19 00 00       	call   1a40 <swapcachetest>
+  readaheadbench();
+      ea:	e8 21 1b 00 00       	call   1c10 <readaheadbench>
+  clusterbench();
+      ef:	e8 7c 1d 00 00       	call   1e70 <clusterbench>
+  zswapbench();
+      f4:	e8 17 20 00 00       	call   2110 <zswapbench>
+  zeropagetest();
+      f9:	e8 72 22 00 00       	call   2370 <zeropagetest>
+  sbrklatency();
+      fe:	e8 6d 25 00 00       	call   2670 <sbrklatency>
+  execbench();
+     103:	e8 18 28 00 00       	call   2920 <execbench>
+  pcachetest();
+     108:	e8 d3 31 00 00       	call   32e0 <pcachetest>
+  rmapstress();
+     10d:	e8 3e 35 00 00       	call   3650 <rmapstress>
+  cowbench();
+     112:	e8 19 37 00 00       	call   3830 <cowbench>
+  forkexecbench();
+     117:	e8 d4 28 00 00       	call   29f0 <forkexecbench>
+  sparseforkbench();
+     11c:	e8 df 29 00 00       	call   2b00 <sparseforkbench>
+  ptsharetest();
+     121:	e8 ca 2a 00 00       	call   2bf0 <ptsharetest>
+  spawnbench();
+     126:	e8 35 2e 00 00       	call   2f60 <spawnbench>
+  tlbtest();
+     12b:	e8 20 30 00 00       	call   3150 <tlbtest>
+  pipe1();
+     130:	e8 4b 09 00 00       	call   a80 <pipe1>
+  preempt();
+     135:	e8 e6 0a 00 00       	call   c20 <preempt>
+  exitwait();
+     13a:	e8 41 0c 00 00       	call   d80 <exitwait>
+
+  rmdot();
+     13f:	e8 3c 52 00 00       	call   5380 <rmdot>
+  fourteen();
+     144:	e8 f7 50 00 00       	call   5240 <fourteen>
+  bigfile();
+     149:	e8 22 4f 00 00       	call   5070 <bigfile>
+  subdir();
+     14e:	e8 5d 47 00 00       	call   48b0 <subdir>
+  linktest();
+     153:	e8 08 40 00 00       	call   4160 <linktest>
+  unlinkread();
+     158:	e8 73 3e 00 00       	call   3fd0 <unlinkread>
+  dirfile();
+     15d:	e8 9e 53 00 00       	call   5500 <dirfile>
+  iref();
+     162:	e8 99 55 00 00       	call   5700 <iref>
+  forktest();
+     167:	e8 b4 56 00 00       	call   5820 <forktest>
+  bigdir(); // slow
+     16c:	e8 0f 46 00 00       	call   4780 <bigdir>
+
+  uio();
+     171:	e8 9a 5f 00 00       	call   6110 <uio>
+
+  exectest();
+     176:	e8 b5 08 00 00       	call   a30 <exectest>
+
+  exit();
+     17b:	e8 d3 62 00 00       	call   6453 <exit>
+
+00000180 <iputtest>:
+{
+     180:	55                   	push   %ebp
+     181:	89 e5                	mov    %esp,%ebp
+     183:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "iput test\n");
+     186:	68 7c 69 00 00       	push   $0x697c
+     18b:	ff 35 d4 9e 00 00    	push   0x9ed4
+     191:	e8 2a 64 00 00       	call   65c0 <printf>
+  if(mkdir("iputdir") < 0){
+     196:	c7 04 24 0f 69 00 00 	movl   $0x690f,(%esp)
+     19d:	e8 19 63 00 00       	call   64bb <mkdir>
+     1a2:	83 c4 10             	add    $0x10,%esp
+     1a5:	85 c0                	test   %eax,%eax
+     1a7:	78 58                	js     201 <iputtest+0x81>
+  if(chdir("iputdir") < 0){
+     1a9:	83 ec 0c             	sub    $0xc,%esp
+     1ac:	68 0f 69 00 00       	push   $0x690f
+     1b1:	e8 0d 63 00 00       	call   64c3 <chdir>
+     1b6:	83 c4 10             	add    $0x10,%esp
+     1b9:	85 c0                	test   %eax,%eax
+     1bb:	0f 88 85 00 00 00    	js     246 <iputtest+0xc6>
+  if(unlink("../iputdir") < 0){
+     1c1:	83 ec 0c             	sub    $0xc,%esp
+     1c4:	68 0c 69 00 00       	push   $0x690c
+     1c9:	e8 d5 62 00 00       	call   64a3 <unlink>
+     1ce:	83 c4 10             	add    $0x10,%esp
+     1d1:	85 c0                	test   %eax,%eax
+     1d3:	78 5a                	js     22f <iputtest+0xaf>
+  if(chdir("/") < 0){
+     1d5:	83 ec 0c             	sub    $0xc,%esp
+     1d8:	68 31 69 00 00       	push   $0x6931
+     1dd:	e8 e1 62 00 00       	call   64c3 <chdir>
+     1e2:	83 c4 10             	add    $0x10,%esp
+     1e5:	85 c0                	test   %eax,%eax
+     1e7:	78 2f                	js     218 <iputtest+0x98>
+  printf(stdout, "iput test ok\n");
+     1e9:	83 ec 08             	sub    $0x8,%esp
+     1ec:	68 b4 69 00 00       	push   $0x69b4
+     1f1:	ff 35 d4 9e 00 00    	push   0x9ed4
+     1f7:	e8 c4 63 00 00       	call   65c0 <printf>
+}
+     1fc:	83 c4 10             	add    $0x10,%esp
+     1ff:	c9                   	leave
+     200:	c3                   	ret
+    printf(stdout, "mkdir failed\n");
+     201:	50                   	push   %eax
+     202:	50                   	push   %eax
+     203:	68 e8 68 00 00       	push   $0x68e8
+     208:	ff 35 d4 9e 00 00    	push   0x9ed4
+     20e:	e8 ad 63 00 00       	call   65c0 <printf>
+    exit();
+     213:	e8 3b 62 00 00       	call   6453 <exit>
+    printf(stdout, "chdir / failed\n");
+     218:	50                   	push   %eax
+     219:	50                   	push   %eax
+     21a:	68 33 69 00 00       	push   $0x6933
+     21f:	ff 35 d4 9e 00 00    	push   0x9ed4
+     225:	e8 96 63 00 00       	call   65c0 <printf>
+    exit();
+     22a:	e8 24 62 00 00       	call   6453 <exit>
+    printf(stdout, "unlink ../iputdir failed\n");
+     22f:	52                   	push   %edx
+     230:	52                   	push   %edx
+     231:	68 17 69 00 00       	push   $0x6917
+     236:	ff 35 d4 9e 00 00    	push   0x9ed4
+     23c:	e8 7f 63 00 00       	call   65c0 <printf>
+    exit();
+     241:	e8 0d 62 00 00       	call   6453 <exit>
+    printf(stdout, "chdir iputdir failed\n");
+     246:	51                   	push   %ecx
+     247:	51                   	push   %ecx
+     248:	68 f6 68 00 00       	push   $0x68f6
+     24d:	ff 35 d4 9e 00 00    	push   0x9ed4
+     253:	e8 68 63 00 00       	call   65c0 <printf>
+    exit();
+     258:	e8 f6 61 00 00       	call   6453 <exit>
+     25d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000260 <exitiputtest>:
+{
+     260:	55                   	push   %ebp
+     261:	89 e5                	mov    %esp,%ebp
+     263:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "exitiput test\n");
+     266:	68 43 69 00 00       	push   $0x6943
+     26b:	ff 35 d4 9e 00 00    	push   0x9ed4
+     271:	e8 4a 63 00 00       	call   65c0 <printf>
+  pid = fork();
+     276:	e8 d0 61 00 00       	call   644b <fork>
+  if(pid < 0){
+     27b:	83 c4 10             	add    $0x10,%esp
+     27e:	85 c0                	test   %eax,%eax
+     280:	0f 88 8a 00 00 00    	js     310 <exitiputtest+0xb0>
+  if(pid == 0){
+     286:	75 50                	jne    2d8 <exitiputtest+0x78>
+    if(mkdir("iputdir") < 0){
+     288:	83 ec 0c             	sub    $0xc,%esp
+     28b:	68 0f 69 00 00       	push   $0x690f
+     290:	e8 26 62 00 00       	call   64bb <mkdir>
+     295:	83 c4 10             	add    $0x10,%esp
+     298:	85 c0                	test   %eax,%eax
+     29a:	0f 88 87 00 00 00    	js     327 <exitiputtest+0xc7>
+    if(chdir("iputdir") < 0){
+     2a0:	83 ec 0c             	sub    $0xc,%esp
+     2a3:	68 0f 69 00 00       	push   $0x690f
+     2a8:	e8 16 62 00 00       	call   64c3 <chdir>
+     2ad:	83 c4 10             	add    $0x10,%esp
+     2b0:	85 c0                	test   %eax,%eax
+     2b2:	0f 88 86 00 00 00    	js     33e <exitiputtest+0xde>
+    if(unlink("../iputdir") < 0){
+     2b8:	83 ec 0c             	sub    $0xc,%esp
+     2bb:	68 0c 69 00 00       	push   $0x690c
+     2c0:	e8 de 61 00 00       	call   64a3 <unlink>
+     2c5:	83 c4 10             	add    $0x10,%esp
+     2c8:	85 c0                	test   %eax,%eax
+     2ca:	78 2c                	js     2f8 <exitiputtest+0x98>
+    exit();
+     2cc:	e8 82 61 00 00       	call   6453 <exit>
+     2d1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  wait();
+     2d8:	e8 7e 61 00 00       	call   645b <wait>
+  printf(stdout, "exitiput test ok\n");
+     2dd:	83 ec 08             	sub    $0x8,%esp
+     2e0:	68 66 69 00 00       	push   $0x6966
+     2e5:	ff 35 d4 9e 00 00    	push   0x9ed4
+     2eb:	e8 d0 62 00 00       	call   65c0 <printf>
+}
+     2f0:	83 c4 10             	add    $0x10,%esp
+     2f3:	c9                   	leave
+     2f4:	c3                   	ret
+     2f5:	8d 76 00             	lea    0x0(%esi),%esi
+      printf(stdout, "unlink ../iputdir failed\n");
+     2f8:	83 ec 08             	sub    $0x8,%esp
+     2fb:	68 17 69 00 00       	push   $0x6917
+     300:	ff 35 d4 9e 00 00    	push   0x9ed4
+     306:	e8 b5 62 00 00       	call   65c0 <printf>
+      exit();
+     30b:	e8 43 61 00 00       	call   6453 <exit>
+    printf(stdout, "fork failed\n");
+     310:	51                   	push   %ecx
+     311:	51                   	push   %ecx
+     312:	68 f4 7d 00 00       	push   $0x7df4
+     317:	ff 35 d4 9e 00 00    	push   0x9ed4
+     31d:	e8 9e 62 00 00       	call   65c0 <printf>
+    exit();
+     322:	e8 2c 61 00 00       	call   6453 <exit>
+      printf(stdout, "mkdir failed\n");
+     327:	52                   	push   %edx
+     328:	52                   	push   %edx
+     329:	68 e8 68 00 00       	push   $0x68e8
+     32e:	ff 35 d4 9e 00 00    	push   0x9ed4
+     334:	e8 87 62 00 00       	call   65c0 <printf>
+      exit();
+     339:	e8 15 61 00 00       	call   6453 <exit>
+      printf(stdout, "child chdir failed\n");
+     33e:	50                   	push   %eax
+     33f:	50                   	push   %eax
+     340:	68 52 69 00 00       	push   $0x6952
+     345:	ff 35 d4 9e 00 00    	push   0x9ed4
+     34b:	e8 70 62 00 00       	call   65c0 <printf>
+      exit();
+     350:	e8 fe 60 00 00       	call   6453 <exit>
+     355:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     35c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000360 <openiputtest>:
+{
+     360:	55                   	push   %ebp
+     361:	89 e5                	mov    %esp,%ebp
+     363:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "openiput test\n");
+     366:	68 78 69 00 00       	push   $0x6978
+     36b:	ff 35 d4 9e 00 00    	push   0x9ed4
+     371:	e8 4a 62 00 00       	call   65c0 <printf>
+  if(mkdir("oidir") < 0){
+     376:	c7 04 24 87 69 00 00 	movl   $0x6987,(%esp)
+     37d:	e8 39 61 00 00       	call   64bb <mkdir>
+     382:	83 c4 10             	add    $0x10,%esp
+     385:	85 c0                	test   %eax,%eax
+     387:	0f 88 9f 00 00 00    	js     42c <openiputtest+0xcc>
+  pid = fork();
+     38d:	e8 b9 60 00 00       	call   644b <fork>
+  if(pid < 0){
+     392:	85 c0                	test   %eax,%eax
+     394:	78 7f                	js     415 <openiputtest+0xb5>
+  if(pid == 0){
+     396:	75 38                	jne    3d0 <openiputtest+0x70>
+    int fd = open("oidir", O_RDWR);
+     398:	83 ec 08             	sub    $0x8,%esp
+     39b:	6a 02                	push   $0x2
+     39d:	68 87 69 00 00       	push   $0x6987
+     3a2:	e8 ec 60 00 00       	call   6493 <open>
+    if(fd >= 0){
+     3a7:	83 c4 10             	add    $0x10,%esp
+     3aa:	85 c0                	test   %eax,%eax
+     3ac:	78 62                	js     410 <openiputtest+0xb0>
+      printf(stdout, "open directory for write succeeded\n");
+     3ae:	83 ec 08             	sub    $0x8,%esp
+     3b1:	68 d4 7e 00 00       	push   $0x7ed4
+     3b6:	ff 35 d4 9e 00 00    	push   0x9ed4
+     3bc:	e8 ff 61 00 00       	call   65c0 <printf>
+      exit();
+     3c1:	e8 8d 60 00 00       	call   6453 <exit>
+     3c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     3cd:	8d 76 00             	lea    0x0(%esi),%esi
+  sleep(1);
+     3d0:	83 ec 0c             	sub    $0xc,%esp
+     3d3:	6a 01                	push   $0x1
+     3d5:	e8 09 61 00 00       	call   64e3 <sleep>
+  if(unlink("oidir") != 0){
+     3da:	c7 04 24 87 69 00 00 	movl   $0x6987,(%esp)
+     3e1:	e8 bd 60 00 00       	call   64a3 <unlink>
+     3e6:	83 c4 10             	add    $0x10,%esp
+     3e9:	85 c0                	test   %eax,%eax
+     3eb:	75 56                	jne    443 <openiputtest+0xe3>
+  wait();
+     3ed:	e8 69 60 00 00       	call   645b <wait>
+  printf(stdout, "openiput test ok\n");
+     3f2:	83 ec 08             	sub    $0x8,%esp
+     3f5:	68 b0 69 00 00       	push   $0x69b0
+     3fa:	ff 35 d4 9e 00 00    	push   0x9ed4
+     400:	e8 bb 61 00 00       	call   65c0 <printf>
+}
+     405:	83 c4 10             	add    $0x10,%esp
+     408:	c9                   	leave
+     409:	c3                   	ret
+     40a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    exit();
+     410:	e8 3e 60 00 00       	call   6453 <exit>
+    printf(stdout, "fork failed\n");
+     415:	52                   	push   %edx
+     416:	52                   	push   %edx
+     417:	68 f4 7d 00 00       	push   $0x7df4
+     41c:	ff 35 d4 9e 00 00    	push   0x9ed4
+     422:	e8 99 61 00 00       	call   65c0 <printf>
+    exit();
+     427:	e8 27 60 00 00       	call   6453 <exit>
+    printf(stdout, "mkdir oidir failed\n");
+     42c:	51                   	push   %ecx
+     42d:	51                   	push   %ecx
+     42e:	68 8d 69 00 00       	push   $0x698d
+     433:	ff 35 d4 9e 00 00    	push   0x9ed4
+     439:	e8 82 61 00 00       	call   65c0 <printf>
+    exit();
+     43e:	e8 10 60 00 00       	call   6453 <exit>
+    printf(stdout, "unlink failed\n");
+     443:	50                   	push   %eax
+     444:	50                   	push   %eax
+     445:	68 a1 69 00 00       	push   $0x69a1
+     44a:	ff 35 d4 9e 00 00    	push   0x9ed4
+     450:	e8 6b 61 00 00       	call   65c0 <printf>
+    exit();
+     455:	e8 f9 5f 00 00       	call   6453 <exit>
+     45a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000460 <opentest>:
+{
+     460:	55                   	push   %ebp
+     461:	89 e5                	mov    %esp,%ebp
+     463:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "open test\n");
+     466:	68 c2 69 00 00       	push   $0x69c2
+     46b:	ff 35 d4 9e 00 00    	push   0x9ed4
+     471:	e8 4a 61 00 00       	call   65c0 <printf>
+  fd = open("echo", 0);
+     476:	58                   	pop    %eax
+     477:	5a                   	pop    %edx
+     478:	6a 00                	push   $0x0
+     47a:	68 55 72 00 00       	push   $0x7255
+     47f:	e8 0f 60 00 00       	call   6493 <open>
+  if(fd < 0){
+     484:	83 c4 10             	add    $0x10,%esp
+     487:	85 c0                	test   %eax,%eax
+     489:	78 36                	js     4c1 <opentest+0x61>
+  close(fd);
+     48b:	83 ec 0c             	sub    $0xc,%esp
+     48e:	50                   	push   %eax
+     48f:	e8 e7 5f 00 00       	call   647b <close>
+  fd = open("doesnotexist", 0);
+     494:	5a                   	pop    %edx
+     495:	59                   	pop    %ecx
+     496:	6a 00                	push   $0x0
+     498:	68 e0 69 00 00       	push   $0x69e0
+     49d:	e8 f1 5f 00 00       	call   6493 <open>
+  if(fd >= 0){
+     4a2:	83 c4 10             	add    $0x10,%esp
+     4a5:	85 c0                	test   %eax,%eax
+     4a7:	79 2f                	jns    4d8 <opentest+0x78>
+  printf(stdout, "open test ok\n");
+     4a9:	83 ec 08             	sub    $0x8,%esp
+     4ac:	68 0b 6a 00 00       	push   $0x6a0b
+     4b1:	ff 35 d4 9e 00 00    	push   0x9ed4
+     4b7:	e8 04 61 00 00       	call   65c0 <printf>
+}
+     4bc:	83 c4 10             	add    $0x10,%esp
+     4bf:	c9                   	leave
+     4c0:	c3                   	ret
+    printf(stdout, "open echo failed!\n");
+     4c1:	50                   	push   %eax
+     4c2:	50                   	push   %eax
+     4c3:	68 cd 69 00 00       	push   $0x69cd
+     4c8:	ff 35 d4 9e 00 00    	push   0x9ed4
+     4ce:	e8 ed 60 00 00       	call   65c0 <printf>
+    exit();
+     4d3:	e8 7b 5f 00 00       	call   6453 <exit>
+    printf(stdout, "open doesnotexist succeeded!\n");
+     4d8:	50                   	push   %eax
+     4d9:	50                   	push   %eax
+     4da:	68 ed 69 00 00       	push   $0x69ed
+     4df:	ff 35 d4 9e 00 00    	push   0x9ed4
+     4e5:	e8 d6 60 00 00       	call   65c0 <printf>
+    exit();
+     4ea:	e8 64 5f 00 00       	call   6453 <exit>
+     4ef:	90                   	nop
+
+000004f0 <writetest>:
+{
+     4f0:	55                   	push   %ebp
+     4f1:	89 e5                	mov    %esp,%ebp
+     4f3:	56                   	push   %esi
+     4f4:	53                   	push   %ebx
+  printf(stdout, "small file test\n");
+     4f5:	83 ec 08             	sub    $0x8,%esp
+     4f8:	68 19 6a 00 00       	push   $0x6a19
+     4fd:	ff 35 d4 9e 00 00    	push   0x9ed4
+     503:	e8 b8 60 00 00       	call   65c0 <printf>
+  fd = open("small", O_CREATE|O_RDWR);
+     508:	58                   	pop    %eax
+     509:	5a                   	pop    %edx
+     50a:	68 02 02 00 00       	push   $0x202
+     50f:	68 2a 6a 00 00       	push   $0x6a2a
+     514:	e8 7a 5f 00 00       	call   6493 <open>
+  if(fd >= 0){
+     519:	83 c4 10             	add    $0x10,%esp
+     51c:	85 c0                	test   %eax,%eax
+     51e:	0f 88 88 01 00 00    	js     6ac <writetest+0x1bc>
+    printf(stdout, "creat small succeeded; ok\n");
+     524:	83 ec 08             	sub    $0x8,%esp
+     527:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < 100; i++){
+     529:	31 db                	xor    %ebx,%ebx
+    printf(stdout, "creat small succeeded; ok\n");
+     52b:	68 30 6a 00 00       	push   $0x6a30
+     530:	ff 35 d4 9e 00 00    	push   0x9ed4
+     536:	e8 85 60 00 00       	call   65c0 <printf>
+     53b:	83 c4 10             	add    $0x10,%esp
+     53e:	66 90                	xchg   %ax,%ax
+    if(write(fd, "aaaaaaaaaa", 10) != 10){
+     540:	83 ec 04             	sub    $0x4,%esp
+     543:	6a 0a                	push   $0xa
+     545:	68 67 6a 00 00       	push   $0x6a67
+     54a:	56                   	push   %esi
+     54b:	e8 23 5f 00 00       	call   6473 <write>
+     550:	83 c4 10             	add    $0x10,%esp
+     553:	83 f8 0a             	cmp    $0xa,%eax
+     556:	0f 85 d9 00 00 00    	jne    635 <writetest+0x145>
+    if(write(fd, "bbbbbbbbbb", 10) != 10){
+     55c:	83 ec 04             	sub    $0x4,%esp
+     55f:	6a 0a                	push   $0xa
+     561:	68 72 6a 00 00       	push   $0x6a72
+     566:	56                   	push   %esi
+     567:	e8 07 5f 00 00       	call   6473 <write>
+     56c:	83 c4 10             	add    $0x10,%esp
+     56f:	83 f8 0a             	cmp    $0xa,%eax
+     572:	0f 85 d6 00 00 00    	jne    64e <writetest+0x15e>
+  for(i = 0; i < 100; i++){
+     578:	83 c3 01             	add    $0x1,%ebx
+     57b:	83 fb 64             	cmp    $0x64,%ebx
+     57e:	75 c0                	jne    540 <writetest+0x50>
+  printf(stdout, "writes ok\n");
+     580:	83 ec 08             	sub    $0x8,%esp
+     583:	68 7d 6a 00 00       	push   $0x6a7d
+     588:	ff 35 d4 9e 00 00    	push   0x9ed4
+     58e:	e8 2d 60 00 00       	call   65c0 <printf>
+  close(fd);
+     593:	89 34 24             	mov    %esi,(%esp)
+     596:	e8 e0 5e 00 00       	call   647b <close>
+  fd = open("small", O_RDONLY);
+     59b:	5b                   	pop    %ebx
+     59c:	5e                   	pop    %esi
+     59d:	6a 00                	push   $0x0
+     59f:	68 2a 6a 00 00       	push   $0x6a2a
+     5a4:	e8 ea 5e 00 00       	call   6493 <open>
+  if(fd >= 0){
+     5a9:	83 c4 10             	add    $0x10,%esp
+  fd = open("small", O_RDONLY);
+     5ac:	89 c3                	mov    %eax,%ebx
+  if(fd >= 0){
+     5ae:	85 c0                	test   %eax,%eax
+     5b0:	0f 88 b1 00 00 00    	js     667 <writetest+0x177>
+    printf(stdout, "open small succeeded ok\n");
+     5b6:	83 ec 08             	sub    $0x8,%esp
+     5b9:	68 88 6a 00 00       	push   $0x6a88
+     5be:	ff 35 d4 9e 00 00    	push   0x9ed4
+     5c4:	e8 f7 5f 00 00       	call   65c0 <printf>
+  i = read(fd, buf, 2000);
+     5c9:	83 c4 0c             	add    $0xc,%esp
+     5cc:	68 d0 07 00 00       	push   $0x7d0
+     5d1:	68 20 c6 00 00       	push   $0xc620
+     5d6:	53                   	push   %ebx
+     5d7:	e8 8f 5e 00 00       	call   646b <read>
+  if(i == 2000){
+     5dc:	83 c4 10             	add    $0x10,%esp
+     5df:	3d d0 07 00 00       	cmp    $0x7d0,%eax
+     5e4:	0f 85 94 00 00 00    	jne    67e <writetest+0x18e>
+    printf(stdout, "read succeeded ok\n");
+     5ea:	83 ec 08             	sub    $0x8,%esp
+     5ed:	68 bc 6a 00 00       	push   $0x6abc
+     5f2:	ff 35 d4 9e 00 00    	push   0x9ed4
+     5f8:	e8 c3 5f 00 00       	call   65c0 <printf>
+  close(fd);
+     5fd:	89 1c 24             	mov    %ebx,(%esp)
+     600:	e8 76 5e 00 00       	call   647b <close>
+  if(unlink("small") < 0){
+     605:	c7 04 24 2a 6a 00 00 	movl   $0x6a2a,(%esp)
+     60c:	e8 92 5e 00 00       	call   64a3 <unlink>
+     611:	83 c4 10             	add    $0x10,%esp
+     614:	85 c0                	test   %eax,%eax
+     616:	78 7d                	js     695 <writetest+0x1a5>
+  printf(stdout, "small file test ok\n");
+     618:	83 ec 08             	sub    $0x8,%esp
+     61b:	68 e4 6a 00 00       	push   $0x6ae4
+     620:	ff 35 d4 9e 00 00    	push   0x9ed4
+     626:	e8 95 5f 00 00       	call   65c0 <printf>
+}
+     62b:	83 c4 10             	add    $0x10,%esp
+     62e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     631:	5b                   	pop    %ebx
+     632:	5e                   	pop    %esi
+     633:	5d                   	pop    %ebp
+     634:	c3                   	ret
+      printf(stdout, "error: write aa %d new file failed\n", i);
+     635:	83 ec 04             	sub    $0x4,%esp
+     638:	53                   	push   %ebx
+     639:	68 f8 7e 00 00       	push   $0x7ef8
+     63e:	ff 35 d4 9e 00 00    	push   0x9ed4
+     644:	e8 77 5f 00 00       	call   65c0 <printf>
+      exit();
+     649:	e8 05 5e 00 00       	call   6453 <exit>
+      printf(stdout, "error: write bb %d new file failed\n", i);
+     64e:	83 ec 04             	sub    $0x4,%esp
+     651:	53                   	push   %ebx
+     652:	68 1c 7f 00 00       	push   $0x7f1c
+     657:	ff 35 d4 9e 00 00    	push   0x9ed4
+     65d:	e8 5e 5f 00 00       	call   65c0 <printf>
+      exit();
+     662:	e8 ec 5d 00 00       	call   6453 <exit>
+    printf(stdout, "error: open small failed!\n");
+     667:	51                   	push   %ecx
+     668:	51                   	push   %ecx
+     669:	68 a1 6a 00 00       	push   $0x6aa1
+     66e:	ff 35 d4 9e 00 00    	push   0x9ed4
+     674:	e8 47 5f 00 00       	call   65c0 <printf>
+    exit();
+     679:	e8 d5 5d 00 00       	call   6453 <exit>
+    printf(stdout, "read failed\n");
+     67e:	52                   	push   %edx
+     67f:	52                   	push   %edx
+     680:	68 c3 73 00 00       	push   $0x73c3
+     685:	ff 35 d4 9e 00 00    	push   0x9ed4
+     68b:	e8 30 5f 00 00       	call   65c0 <printf>
+    exit();
+     690:	e8 be 5d 00 00       	call   6453 <exit>
+    printf(stdout, "unlink small failed\n");
+     695:	50                   	push   %eax
+     696:	50                   	push   %eax
+     697:	68 cf 6a 00 00       	push   $0x6acf
+     69c:	ff 35 d4 9e 00 00    	push   0x9ed4
+     6a2:	e8 19 5f 00 00       	call   65c0 <printf>
+    exit();
+     6a7:	e8 a7 5d 00 00       	call   6453 <exit>
+    printf(stdout, "error: creat small failed!\n");
+     6ac:	50                   	push   %eax
+     6ad:	50                   	push   %eax
+     6ae:	68 4b 6a 00 00       	push   $0x6a4b
+     6b3:	ff 35 d4 9e 00 00    	push   0x9ed4
+     6b9:	e8 02 5f 00 00       	call   65c0 <printf>
+    exit();
+     6be:	e8 90 5d 00 00       	call   6453 <exit>
+     6c3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     6ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000006d0 <writetest1>:
+{
+     6d0:	55                   	push   %ebp
+     6d1:	89 e5                	mov    %esp,%ebp
+     6d3:	56                   	push   %esi
+     6d4:	53                   	push   %ebx
+  printf(stdout, "big files test\n");
+     6d5:	83 ec 08             	sub    $0x8,%esp
+     6d8:	68 f8 6a 00 00       	push   $0x6af8
+     6dd:	ff 35 d4 9e 00 00    	push   0x9ed4
+     6e3:	e8 d8 5e 00 00       	call   65c0 <printf>
+  fd = open("big", O_CREATE|O_RDWR);
+     6e8:	58                   	pop    %eax
+     6e9:	5a                   	pop    %edx
+     6ea:	68 02 02 00 00       	push   $0x202
+     6ef:	68 72 6b 00 00       	push   $0x6b72
+     6f4:	e8 9a 5d 00 00       	call   6493 <open>
+  if(fd < 0){
+     6f9:	83 c4 10             	add    $0x10,%esp
+     6fc:	85 c0                	test   %eax,%eax
+     6fe:	0f 88 61 01 00 00    	js     865 <writetest1+0x195>
+     704:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < MAXFILE; i++){
+     706:	31 db                	xor    %ebx,%ebx
+     708:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     70f:	90                   	nop
+    if(write(fd, buf, 512) != 512){
+     710:	83 ec 04             	sub    $0x4,%esp
+    ((int*)buf)[0] = i;
+     713:	89 1d 20 c6 00 00    	mov    %ebx,0xc620
+    if(write(fd, buf, 512) != 512){
+     719:	68 00 02 00 00       	push   $0x200
+     71e:	68 20 c6 00 00       	push   $0xc620
+     723:	56                   	push   %esi
+     724:	e8 4a 5d 00 00       	call   6473 <write>
+     729:	83 c4 10             	add    $0x10,%esp
+     72c:	3d 00 02 00 00       	cmp    $0x200,%eax
+     731:	0f 85 b3 00 00 00    	jne    7ea <writetest1+0x11a>
+  for(i = 0; i < MAXFILE; i++){
+     737:	83 c3 01             	add    $0x1,%ebx
+     73a:	81 fb 8c 00 00 00    	cmp    $0x8c,%ebx
+     740:	75 ce                	jne    710 <writetest1+0x40>
+  close(fd);
+     742:	83 ec 0c             	sub    $0xc,%esp
+     745:	56                   	push   %esi
+     746:	e8 30 5d 00 00       	call   647b <close>
+  fd = open("big", O_RDONLY);
+     74b:	5b                   	pop    %ebx
+     74c:	5e                   	pop    %esi
+     74d:	6a 00                	push   $0x0
+     74f:	68 72 6b 00 00       	push   $0x6b72
+     754:	e8 3a 5d 00 00       	call   6493 <open>
+  if(fd < 0){
+     759:	83 c4 10             	add    $0x10,%esp
+  fd = open("big", O_RDONLY);
+     75c:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+     75e:	85 c0                	test   %eax,%eax
+     760:	0f 88 e8 00 00 00    	js     84e <writetest1+0x17e>
+  n = 0;
+     766:	31 f6                	xor    %esi,%esi
+     768:	eb 1d                	jmp    787 <writetest1+0xb7>
+     76a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    } else if(i != 512){
+     770:	3d 00 02 00 00       	cmp    $0x200,%eax
+     775:	0f 85 9f 00 00 00    	jne    81a <writetest1+0x14a>
+    if(((int*)buf)[0] != n){
+     77b:	a1 20 c6 00 00       	mov    0xc620,%eax
+     780:	39 f0                	cmp    %esi,%eax
+     782:	75 7f                	jne    803 <writetest1+0x133>
+    n++;
+     784:	83 c6 01             	add    $0x1,%esi
+    i = read(fd, buf, 512);
+     787:	83 ec 04             	sub    $0x4,%esp
+     78a:	68 00 02 00 00       	push   $0x200
+     78f:	68 20 c6 00 00       	push   $0xc620
+     794:	53                   	push   %ebx
+     795:	e8 d1 5c 00 00       	call   646b <read>
+    if(i == 0){
+     79a:	83 c4 10             	add    $0x10,%esp
+     79d:	85 c0                	test   %eax,%eax
+     79f:	75 cf                	jne    770 <writetest1+0xa0>
+      if(n == MAXFILE - 1){
+     7a1:	81 fe 8b 00 00 00    	cmp    $0x8b,%esi
+     7a7:	0f 84 86 00 00 00    	je     833 <writetest1+0x163>
+  close(fd);
+     7ad:	83 ec 0c             	sub    $0xc,%esp
+     7b0:	53                   	push   %ebx
+     7b1:	e8 c5 5c 00 00       	call   647b <close>
+  if(unlink("big") < 0){
+     7b6:	c7 04 24 72 6b 00 00 	movl   $0x6b72,(%esp)
+     7bd:	e8 e1 5c 00 00       	call   64a3 <unlink>
+     7c2:	83 c4 10             	add    $0x10,%esp
+     7c5:	85 c0                	test   %eax,%eax
+     7c7:	0f 88 af 00 00 00    	js     87c <writetest1+0x1ac>
+  printf(stdout, "big files ok\n");
+     7cd:	83 ec 08             	sub    $0x8,%esp
+     7d0:	68 99 6b 00 00       	push   $0x6b99
+     7d5:	ff 35 d4 9e 00 00    	push   0x9ed4
+     7db:	e8 e0 5d 00 00       	call   65c0 <printf>
+}
+     7e0:	83 c4 10             	add    $0x10,%esp
+     7e3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     7e6:	5b                   	pop    %ebx
+     7e7:	5e                   	pop    %esi
+     7e8:	5d                   	pop    %ebp
+     7e9:	c3                   	ret
+      printf(stdout, "error: write big file failed\n", i);
+     7ea:	83 ec 04             	sub    $0x4,%esp
+     7ed:	53                   	push   %ebx
+     7ee:	68 22 6b 00 00       	push   $0x6b22
+     7f3:	ff 35 d4 9e 00 00    	push   0x9ed4
+     7f9:	e8 c2 5d 00 00       	call   65c0 <printf>
+      exit();
+     7fe:	e8 50 5c 00 00       	call   6453 <exit>
+      printf(stdout, "read content of block %d is %d\n",
+     803:	50                   	push   %eax
+     804:	56                   	push   %esi
+     805:	68 40 7f 00 00       	push   $0x7f40
+     80a:	ff 35 d4 9e 00 00    	push   0x9ed4
+     810:	e8 ab 5d 00 00       	call   65c0 <printf>
+      exit();
+     815:	e8 39 5c 00 00       	call   6453 <exit>
+      printf(stdout, "read failed %d\n", i);
+     81a:	83 ec 04             	sub    $0x4,%esp
+     81d:	50                   	push   %eax
+     81e:	68 76 6b 00 00       	push   $0x6b76
+     823:	ff 35 d4 9e 00 00    	push   0x9ed4
+     829:	e8 92 5d 00 00       	call   65c0 <printf>
+      exit();
+     82e:	e8 20 5c 00 00       	call   6453 <exit>
+        printf(stdout, "read only %d blocks from big", n);
+     833:	52                   	push   %edx
+     834:	68 8b 00 00 00       	push   $0x8b
+     839:	68 59 6b 00 00       	push   $0x6b59
+     83e:	ff 35 d4 9e 00 00    	push   0x9ed4
+     844:	e8 77 5d 00 00       	call   65c0 <printf>
+        exit();
+     849:	e8 05 5c 00 00       	call   6453 <exit>
+    printf(stdout, "error: open big failed!\n");
+     84e:	51                   	push   %ecx
+     84f:	51                   	push   %ecx
+     850:	68 40 6b 00 00       	push   $0x6b40
+     855:	ff 35 d4 9e 00 00    	push   0x9ed4
+     85b:	e8 60 5d 00 00       	call   65c0 <printf>
+    exit();
+     860:	e8 ee 5b 00 00       	call   6453 <exit>
+    printf(stdout, "error: creat big failed!\n");
+     865:	50                   	push   %eax
+     866:	50                   	push   %eax
+     867:	68 08 6b 00 00       	push   $0x6b08
+     86c:	ff 35 d4 9e 00 00    	push   0x9ed4
+     872:	e8 49 5d 00 00       	call   65c0 <printf>
+    exit();
+     877:	e8 d7 5b 00 00       	call   6453 <exit>
+    printf(stdout, "unlink big failed\n");
+     87c:	50                   	push   %eax
+     87d:	50                   	push   %eax
+     87e:	68 86 6b 00 00       	push   $0x6b86
+     883:	ff 35 d4 9e 00 00    	push   0x9ed4
+     889:	e8 32 5d 00 00       	call   65c0 <printf>
+    exit();
+     88e:	e8 c0 5b 00 00       	call   6453 <exit>
+     893:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     89a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000008a0 <createtest>:
+{
+     8a0:	55                   	push   %ebp
+     8a1:	89 e5                	mov    %esp,%ebp
+     8a3:	53                   	push   %ebx
+  name[2] = '\0';
+     8a4:	bb 30 00 00 00       	mov    $0x30,%ebx
+{
+     8a9:	83 ec 0c             	sub    $0xc,%esp
+  printf(stdout, "many creates, followed by unlink test\n");
+     8ac:	68 60 7f 00 00       	push   $0x7f60
+     8b1:	ff 35 d4 9e 00 00    	push   0x9ed4
+     8b7:	e8 04 5d 00 00       	call   65c0 <printf>
+  name[0] = 'a';
+     8bc:	c6 05 10 c6 00 00 61 	movb   $0x61,0xc610
+  name[2] = '\0';
+     8c3:	83 c4 10             	add    $0x10,%esp
+     8c6:	c6 05 12 c6 00 00 00 	movb   $0x0,0xc612
+  for(i = 0; i < 52; i++){
+     8cd:	8d 76 00             	lea    0x0(%esi),%esi
+    fd = open(name, O_CREATE|O_RDWR);
+     8d0:	83 ec 08             	sub    $0x8,%esp
+    name[1] = '0' + i;
+     8d3:	88 1d 11 c6 00 00    	mov    %bl,0xc611
+  for(i = 0; i < 52; i++){
+     8d9:	83 c3 01             	add    $0x1,%ebx
+    fd = open(name, O_CREATE|O_RDWR);
+     8dc:	68 02 02 00 00       	push   $0x202
+     8e1:	68 10 c6 00 00       	push   $0xc610
+     8e6:	e8 a8 5b 00 00       	call   6493 <open>
+    close(fd);
+     8eb:	89 04 24             	mov    %eax,(%esp)
+     8ee:	e8 88 5b 00 00       	call   647b <close>
+  for(i = 0; i < 52; i++){
+     8f3:	83 c4 10             	add    $0x10,%esp
+     8f6:	80 fb 64             	cmp    $0x64,%bl
+     8f9:	75 d5                	jne    8d0 <createtest+0x30>
+  name[0] = 'a';
+     8fb:	c6 05 10 c6 00 00 61 	movb   $0x61,0xc610
+  name[2] = '\0';
+     902:	bb 30 00 00 00       	mov    $0x30,%ebx
+     907:	c6 05 12 c6 00 00 00 	movb   $0x0,0xc612
+  for(i = 0; i < 52; i++){
+     90e:	66 90                	xchg   %ax,%ax
+    unlink(name);
+     910:	83 ec 0c             	sub    $0xc,%esp
+    name[1] = '0' + i;
+     913:	88 1d 11 c6 00 00    	mov    %bl,0xc611
+  for(i = 0; i < 52; i++){
+     919:	83 c3 01             	add    $0x1,%ebx
+    unlink(name);
+     91c:	68 10 c6 00 00       	push   $0xc610
+     921:	e8 7d 5b 00 00       	call   64a3 <unlink>
+  for(i = 0; i < 52; i++){
+     926:	83 c4 10             	add    $0x10,%esp
+     929:	80 fb 64             	cmp    $0x64,%bl
+     92c:	75 e2                	jne    910 <createtest+0x70>
+  printf(stdout, "many creates, followed by unlink; ok\n");
+     92e:	83 ec 08             	sub    $0x8,%esp
+     931:	68 88 7f 00 00       	push   $0x7f88
+     936:	ff 35 d4 9e 00 00    	push   0x9ed4
+     93c:	e8 7f 5c 00 00       	call   65c0 <printf>
+}
+     941:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     944:	83 c4 10             	add    $0x10,%esp
+     947:	c9                   	leave
+     948:	c3                   	ret
+     949:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000950 <dirtest>:
+{
+     950:	55                   	push   %ebp
+     951:	89 e5                	mov    %esp,%ebp
+     953:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "mkdir test\n");
+     956:	68 a7 6b 00 00       	push   $0x6ba7
+     95b:	ff 35 d4 9e 00 00    	push   0x9ed4
+     961:	e8 5a 5c 00 00       	call   65c0 <printf>
+  if(mkdir("dir0") < 0){
+     966:	c7 04 24 b3 6b 00 00 	movl   $0x6bb3,(%esp)
+     96d:	e8 49 5b 00 00       	call   64bb <mkdir>
+     972:	83 c4 10             	add    $0x10,%esp
+     975:	85 c0                	test   %eax,%eax
+     977:	78 58                	js     9d1 <dirtest+0x81>
+  if(chdir("dir0") < 0){
+     979:	83 ec 0c             	sub    $0xc,%esp
+     97c:	68 b3 6b 00 00       	push   $0x6bb3
+     981:	e8 3d 5b 00 00       	call   64c3 <chdir>
+     986:	83 c4 10             	add    $0x10,%esp
+     989:	85 c0                	test   %eax,%eax
+     98b:	0f 88 85 00 00 00    	js     a16 <dirtest+0xc6>
+  if(chdir("..") < 0){
+     991:	83 ec 0c             	sub    $0xc,%esp
+     994:	68 33 77 00 00       	push   $0x7733
+     999:	e8 25 5b 00 00       	call   64c3 <chdir>
+     99e:	83 c4 10             	add    $0x10,%esp
+     9a1:	85 c0                	test   %eax,%eax
+     9a3:	78 5a                	js     9ff <dirtest+0xaf>
+  if(unlink("dir0") < 0){
+     9a5:	83 ec 0c             	sub    $0xc,%esp
+     9a8:	68 b3 6b 00 00       	push   $0x6bb3
+     9ad:	e8 f1 5a 00 00       	call   64a3 <unlink>
+     9b2:	83 c4 10             	add    $0x10,%esp
+     9b5:	85 c0                	test   %eax,%eax
+     9b7:	78 2f                	js     9e8 <dirtest+0x98>
+  printf(stdout, "mkdir test ok\n");
+     9b9:	83 ec 08             	sub    $0x8,%esp
+     9bc:	68 f0 6b 00 00       	push   $0x6bf0
+     9c1:	ff 35 d4 9e 00 00    	push   0x9ed4
+     9c7:	e8 f4 5b 00 00       	call   65c0 <printf>
+}
+     9cc:	83 c4 10             	add    $0x10,%esp
+     9cf:	c9                   	leave
+     9d0:	c3                   	ret
+    printf(stdout, "mkdir failed\n");
+     9d1:	50                   	push   %eax
+     9d2:	50                   	push   %eax
+     9d3:	68 e8 68 00 00       	push   $0x68e8
+     9d8:	ff 35 d4 9e 00 00    	push   0x9ed4
+     9de:	e8 dd 5b 00 00       	call   65c0 <printf>
+    exit();
+     9e3:	e8 6b 5a 00 00       	call   6453 <exit>
+    printf(stdout, "unlink dir0 failed\n");
+     9e8:	50                   	push   %eax
+     9e9:	50                   	push   %eax
+     9ea:	68 dc 6b 00 00       	push   $0x6bdc
+     9ef:	ff 35 d4 9e 00 00    	push   0x9ed4
+     9f5:	e8 c6 5b 00 00       	call   65c0 <printf>
+    exit();
+     9fa:	e8 54 5a 00 00       	call   6453 <exit>
+    printf(stdout, "chdir .. failed\n");
+     9ff:	52                   	push   %edx
+     a00:	52                   	push   %edx
+     a01:	68 cb 6b 00 00       	push   $0x6bcb
+     a06:	ff 35 d4 9e 00 00    	push   0x9ed4
+     a0c:	e8 af 5b 00 00       	call   65c0 <printf>
+    exit();
+     a11:	e8 3d 5a 00 00       	call   6453 <exit>
+    printf(stdout, "chdir dir0 failed\n");
+     a16:	51                   	push   %ecx
+     a17:	51                   	push   %ecx
+     a18:	68 b8 6b 00 00       	push   $0x6bb8
+     a1d:	ff 35 d4 9e 00 00    	push   0x9ed4
+     a23:	e8 98 5b 00 00       	call   65c0 <printf>
+    exit();
+     a28:	e8 26 5a 00 00       	call   6453 <exit>
+     a2d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000a30 <exectest>:
+{
+     a30:	55                   	push   %ebp
+     a31:	89 e5                	mov    %esp,%ebp
+     a33:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "exec test\n");
+     a36:	68 ff 6b 00 00       	push   $0x6bff
+     a3b:	ff 35 d4 9e 00 00    	push   0x9ed4
+     a41:	e8 7a 5b 00 00       	call   65c0 <printf>
+  if(exec("echo", echoargv) < 0){
+     a46:	5a                   	pop    %edx
+     a47:	59                   	pop    %ecx
+     a48:	68 d8 9e 00 00       	push   $0x9ed8
+     a4d:	68 55 72 00 00       	push   $0x7255
+     a52:	e8 34 5a 00 00       	call   648b <exec>
+     a57:	83 c4 10             	add    $0x10,%esp
+     a5a:	85 c0                	test   %eax,%eax
+     a5c:	78 02                	js     a60 <exectest+0x30>
+}
+     a5e:	c9                   	leave
+     a5f:	c3                   	ret
+    printf(stdout, "exec echo failed\n");
+     a60:	50                   	push   %eax
+     a61:	50                   	push   %eax
+     a62:	68 0a 6c 00 00       	push   $0x6c0a
+     a67:	ff 35 d4 9e 00 00    	push   0x9ed4
+     a6d:	e8 4e 5b 00 00       	call   65c0 <printf>
+    exit();
+     a72:	e8 dc 59 00 00       	call   6453 <exit>
+     a77:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a7e:	66 90                	xchg   %ax,%ax
+
+00000a80 <pipe1>:
+{
+     a80:	55                   	push   %ebp
+     a81:	89 e5                	mov    %esp,%ebp
+     a83:	57                   	push   %edi
+     a84:	56                   	push   %esi
+  if(pipe(fds) != 0){
+     a85:	8d 45 e0             	lea    -0x20(%ebp),%eax
+{
+     a88:	53                   	push   %ebx
+     a89:	83 ec 28             	sub    $0x28,%esp
+  if(pipe(fds) != 0){
+     a8c:	50                   	push   %eax
+     a8d:	e8 d1 59 00 00       	call   6463 <pipe>
+     a92:	83 c4 10             	add    $0x10,%esp
+     a95:	85 c0                	test   %eax,%eax
+     a97:	0f 85 41 01 00 00    	jne    bde <pipe1+0x15e>
+     a9d:	89 c6                	mov    %eax,%esi
+  pid = fork();
+     a9f:	e8 a7 59 00 00       	call   644b <fork>
+  if(pid == 0){
+     aa4:	85 c0                	test   %eax,%eax
+     aa6:	0f 84 92 00 00 00    	je     b3e <pipe1+0xbe>
+  } else if(pid > 0){
+     aac:	0f 8e 3f 01 00 00    	jle    bf1 <pipe1+0x171>
+    close(fds[1]);
+     ab2:	83 ec 0c             	sub    $0xc,%esp
+     ab5:	ff 75 e4             	push   -0x1c(%ebp)
+    total = 0;
+     ab8:	31 db                	xor    %ebx,%ebx
+    cc = 1;
+     aba:	bf 01 00 00 00       	mov    $0x1,%edi
+    close(fds[1]);
+     abf:	e8 b7 59 00 00       	call   647b <close>
+    while((n = read(fds[0], buf, cc)) > 0){
+     ac4:	83 c4 10             	add    $0x10,%esp
+     ac7:	83 ec 04             	sub    $0x4,%esp
+     aca:	57                   	push   %edi
+     acb:	68 20 c6 00 00       	push   $0xc620
+     ad0:	ff 75 e0             	push   -0x20(%ebp)
+     ad3:	e8 93 59 00 00       	call   646b <read>
+     ad8:	83 c4 10             	add    $0x10,%esp
+     adb:	89 c1                	mov    %eax,%ecx
+     add:	85 c0                	test   %eax,%eax
+     adf:	0f 8e b8 00 00 00    	jle    b9d <pipe1+0x11d>
+        if((buf[i] & 0xff) != (seq++ & 0xff)){
+     ae5:	89 f0                	mov    %esi,%eax
+     ae7:	32 05 20 c6 00 00    	xor    0xc620,%al
+     aed:	0f b6 c0             	movzbl %al,%eax
+     af0:	85 c0                	test   %eax,%eax
+     af2:	75 30                	jne    b24 <pipe1+0xa4>
+     af4:	83 c6 01             	add    $0x1,%esi
+     af7:	eb 0f                	jmp    b08 <pipe1+0x88>
+     af9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b00:	38 90 20 c6 00 00    	cmp    %dl,0xc620(%eax)
+     b06:	75 1c                	jne    b24 <pipe1+0xa4>
+     b08:	8d 14 06             	lea    (%esi,%eax,1),%edx
+      for(i = 0; i < n; i++){
+     b0b:	83 c0 01             	add    $0x1,%eax
+     b0e:	39 c1                	cmp    %eax,%ecx
+     b10:	75 ee                	jne    b00 <pipe1+0x80>
+      cc = cc * 2;
+     b12:	01 ff                	add    %edi,%edi
+      if(cc > sizeof(buf))
+     b14:	b8 00 20 00 00       	mov    $0x2000,%eax
+      total += n;
+     b19:	01 cb                	add    %ecx,%ebx
+      if(cc > sizeof(buf))
+     b1b:	89 d6                	mov    %edx,%esi
+     b1d:	39 c7                	cmp    %eax,%edi
+     b1f:	0f 4f f8             	cmovg  %eax,%edi
+     b22:	eb a3                	jmp    ac7 <pipe1+0x47>
+          printf(1, "pipe1 oops 2\n");
+     b24:	83 ec 08             	sub    $0x8,%esp
+     b27:	68 39 6c 00 00       	push   $0x6c39
+     b2c:	6a 01                	push   $0x1
+     b2e:	e8 8d 5a 00 00       	call   65c0 <printf>
+     b33:	83 c4 10             	add    $0x10,%esp
+}
+     b36:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     b39:	5b                   	pop    %ebx
+     b3a:	5e                   	pop    %esi
+     b3b:	5f                   	pop    %edi
+     b3c:	5d                   	pop    %ebp
+     b3d:	c3                   	ret
+    close(fds[0]);
+     b3e:	83 ec 0c             	sub    $0xc,%esp
+     b41:	ff 75 e0             	push   -0x20(%ebp)
+  seq = 0;
+     b44:	31 db                	xor    %ebx,%ebx
+    close(fds[0]);
+     b46:	e8 30 59 00 00       	call   647b <close>
+     b4b:	83 c4 10             	add    $0x10,%esp
+     b4e:	66 90                	xchg   %ax,%ax
+      for(i = 0; i < 1033; i++)
+     b50:	31 c0                	xor    %eax,%eax
+     b52:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        buf[i] = seq++;
+     b58:	8d 14 03             	lea    (%ebx,%eax,1),%edx
+      for(i = 0; i < 1033; i++)
+     b5b:	83 c0 01             	add    $0x1,%eax
+        buf[i] = seq++;
+     b5e:	88 90 1f c6 00 00    	mov    %dl,0xc61f(%eax)
+      for(i = 0; i < 1033; i++)
+     b64:	3d 09 04 00 00       	cmp    $0x409,%eax
+     b69:	75 ed                	jne    b58 <pipe1+0xd8>
+      if(write(fds[1], buf, 1033) != 1033){
+     b6b:	83 ec 04             	sub    $0x4,%esp
+        buf[i] = seq++;
+     b6e:	81 c3 09 04 00 00    	add    $0x409,%ebx
+      if(write(fds[1], buf, 1033) != 1033){
+     b74:	68 09 04 00 00       	push   $0x409
+     b79:	68 20 c6 00 00       	push   $0xc620
+     b7e:	ff 75 e4             	push   -0x1c(%ebp)
+     b81:	e8 ed 58 00 00       	call   6473 <write>
+     b86:	83 c4 10             	add    $0x10,%esp
+     b89:	3d 09 04 00 00       	cmp    $0x409,%eax
+     b8e:	75 74                	jne    c04 <pipe1+0x184>
+    for(n = 0; n < 5; n++){
+     b90:	81 fb 2d 14 00 00    	cmp    $0x142d,%ebx
+     b96:	75 b8                	jne    b50 <pipe1+0xd0>
+    exit();
+     b98:	e8 b6 58 00 00       	call   6453 <exit>
+    if(total != 5 * 1033){
+     b9d:	81 fb 2d 14 00 00    	cmp    $0x142d,%ebx
+     ba3:	75 26                	jne    bcb <pipe1+0x14b>
+    close(fds[0]);
+     ba5:	83 ec 0c             	sub    $0xc,%esp
+     ba8:	ff 75 e0             	push   -0x20(%ebp)
+     bab:	e8 cb 58 00 00       	call   647b <close>
+    wait();
+     bb0:	e8 a6 58 00 00       	call   645b <wait>
+  printf(1, "pipe1 ok\n");
+     bb5:	5a                   	pop    %edx
+     bb6:	59                   	pop    %ecx
+     bb7:	68 5e 6c 00 00       	push   $0x6c5e
+     bbc:	6a 01                	push   $0x1
+     bbe:	e8 fd 59 00 00       	call   65c0 <printf>
+     bc3:	83 c4 10             	add    $0x10,%esp
+     bc6:	e9 6b ff ff ff       	jmp    b36 <pipe1+0xb6>
+      printf(1, "pipe1 oops 3 total %d\n", total);
+     bcb:	56                   	push   %esi
+     bcc:	53                   	push   %ebx
+     bcd:	68 47 6c 00 00       	push   $0x6c47
+     bd2:	6a 01                	push   $0x1
+     bd4:	e8 e7 59 00 00       	call   65c0 <printf>
+      exit();
+     bd9:	e8 75 58 00 00       	call   6453 <exit>
+    printf(1, "pipe() failed\n");
+     bde:	50                   	push   %eax
+     bdf:	50                   	push   %eax
+     be0:	68 1c 6c 00 00       	push   $0x6c1c
+     be5:	6a 01                	push   $0x1
+     be7:	e8 d4 59 00 00       	call   65c0 <printf>
+    exit();
+     bec:	e8 62 58 00 00       	call   6453 <exit>
+    printf(1, "fork() failed\n");
+     bf1:	50                   	push   %eax
+     bf2:	50                   	push   %eax
+     bf3:	68 68 6c 00 00       	push   $0x6c68
+     bf8:	6a 01                	push   $0x1
+     bfa:	e8 c1 59 00 00       	call   65c0 <printf>
+    exit();
+     bff:	e8 4f 58 00 00       	call   6453 <exit>
+        printf(1, "pipe1 oops 1\n");
+     c04:	57                   	push   %edi
+     c05:	57                   	push   %edi
+     c06:	68 2b 6c 00 00       	push   $0x6c2b
+     c0b:	6a 01                	push   $0x1
+     c0d:	e8 ae 59 00 00       	call   65c0 <printf>
+        exit();
+     c12:	e8 3c 58 00 00       	call   6453 <exit>
+     c17:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c1e:	66 90                	xchg   %ax,%ax
+
+00000c20 <preempt>:
+{
+     c20:	55                   	push   %ebp
+     c21:	89 e5                	mov    %esp,%ebp
+     c23:	57                   	push   %edi
+     c24:	56                   	push   %esi
+     c25:	53                   	push   %ebx
+     c26:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "preempt: ");
+     c29:	68 77 6c 00 00       	push   $0x6c77
+     c2e:	6a 01                	push   $0x1
+     c30:	e8 8b 59 00 00       	call   65c0 <printf>
+  pid1 = fork();
+     c35:	e8 11 58 00 00       	call   644b <fork>
+  if(pid1 == 0)
+     c3a:	83 c4 10             	add    $0x10,%esp
+     c3d:	85 c0                	test   %eax,%eax
+     c3f:	75 07                	jne    c48 <preempt+0x28>
+    for(;;)
+     c41:	eb fe                	jmp    c41 <preempt+0x21>
+     c43:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     c47:	90                   	nop
+     c48:	89 c3                	mov    %eax,%ebx
+  pid2 = fork();
+     c4a:	e8 fc 57 00 00       	call   644b <fork>
+     c4f:	89 c6                	mov    %eax,%esi
+  if(pid2 == 0)
+     c51:	85 c0                	test   %eax,%eax
+     c53:	75 0b                	jne    c60 <preempt+0x40>
+    for(;;)
+     c55:	eb fe                	jmp    c55 <preempt+0x35>
+     c57:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c5e:	66 90                	xchg   %ax,%ax
+  pipe(pfds);
+     c60:	83 ec 0c             	sub    $0xc,%esp
+     c63:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     c66:	50                   	push   %eax
+     c67:	e8 f7 57 00 00       	call   6463 <pipe>
+  pid3 = fork();
+     c6c:	e8 da 57 00 00       	call   644b <fork>
+  if(pid3 == 0){
+     c71:	83 c4 10             	add    $0x10,%esp
+  pid3 = fork();
+     c74:	89 c7                	mov    %eax,%edi
+  if(pid3 == 0){
+     c76:	85 c0                	test   %eax,%eax
+     c78:	75 3e                	jne    cb8 <preempt+0x98>
+    close(pfds[0]);
+     c7a:	83 ec 0c             	sub    $0xc,%esp
+     c7d:	ff 75 e0             	push   -0x20(%ebp)
+     c80:	e8 f6 57 00 00       	call   647b <close>
+    if(write(pfds[1], "x", 1) != 1)
+     c85:	83 c4 0c             	add    $0xc,%esp
+     c88:	6a 01                	push   $0x1
+     c8a:	68 17 78 00 00       	push   $0x7817
+     c8f:	ff 75 e4             	push   -0x1c(%ebp)
+     c92:	e8 dc 57 00 00       	call   6473 <write>
+     c97:	83 c4 10             	add    $0x10,%esp
+     c9a:	83 f8 01             	cmp    $0x1,%eax
+     c9d:	0f 85 b8 00 00 00    	jne    d5b <preempt+0x13b>
+    close(pfds[1]);
+     ca3:	83 ec 0c             	sub    $0xc,%esp
+     ca6:	ff 75 e4             	push   -0x1c(%ebp)
+     ca9:	e8 cd 57 00 00       	call   647b <close>
+     cae:	83 c4 10             	add    $0x10,%esp
+    for(;;)
+     cb1:	eb fe                	jmp    cb1 <preempt+0x91>
+     cb3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     cb7:	90                   	nop
+  close(pfds[1]);
+     cb8:	83 ec 0c             	sub    $0xc,%esp
+     cbb:	ff 75 e4             	push   -0x1c(%ebp)
+     cbe:	e8 b8 57 00 00       	call   647b <close>
+  if(read(pfds[0], buf, sizeof(buf)) != 1){
+     cc3:	83 c4 0c             	add    $0xc,%esp
+     cc6:	68 00 20 00 00       	push   $0x2000
+     ccb:	68 20 c6 00 00       	push   $0xc620
+     cd0:	ff 75 e0             	push   -0x20(%ebp)
+     cd3:	e8 93 57 00 00       	call   646b <read>
+     cd8:	83 c4 10             	add    $0x10,%esp
+     cdb:	83 f8 01             	cmp    $0x1,%eax
+     cde:	75 67                	jne    d47 <preempt+0x127>
+  close(pfds[0]);
+     ce0:	83 ec 0c             	sub    $0xc,%esp
+     ce3:	ff 75 e0             	push   -0x20(%ebp)
+     ce6:	e8 90 57 00 00       	call   647b <close>
+  printf(1, "kill... ");
+     ceb:	58                   	pop    %eax
+     cec:	5a                   	pop    %edx
+     ced:	68 a8 6c 00 00       	push   $0x6ca8
+     cf2:	6a 01                	push   $0x1
+     cf4:	e8 c7 58 00 00       	call   65c0 <printf>
+  kill(pid1);
+     cf9:	89 1c 24             	mov    %ebx,(%esp)
+     cfc:	e8 82 57 00 00       	call   6483 <kill>
+  kill(pid2);
+     d01:	89 34 24             	mov    %esi,(%esp)
+     d04:	e8 7a 57 00 00       	call   6483 <kill>
+  kill(pid3);
+     d09:	89 3c 24             	mov    %edi,(%esp)
+     d0c:	e8 72 57 00 00       	call   6483 <kill>
+  printf(1, "wait... ");
+     d11:	59                   	pop    %ecx
+     d12:	5b                   	pop    %ebx
+     d13:	68 b1 6c 00 00       	push   $0x6cb1
+     d18:	6a 01                	push   $0x1
+     d1a:	e8 a1 58 00 00       	call   65c0 <printf>
+  wait();
+     d1f:	e8 37 57 00 00       	call   645b <wait>
+  wait();
+     d24:	e8 32 57 00 00       	call   645b <wait>
+  wait();
+     d29:	e8 2d 57 00 00       	call   645b <wait>
+  printf(1, "preempt ok\n");
+     d2e:	5e                   	pop    %esi
+     d2f:	5f                   	pop    %edi
+     d30:	68 ba 6c 00 00       	push   $0x6cba
+     d35:	6a 01                	push   $0x1
+     d37:	e8 84 58 00 00       	call   65c0 <printf>
+     d3c:	83 c4 10             	add    $0x10,%esp
+}
+     d3f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     d42:	5b                   	pop    %ebx
+     d43:	5e                   	pop    %esi
+     d44:	5f                   	pop    %edi
+     d45:	5d                   	pop    %ebp
+     d46:	c3                   	ret
+    printf(1, "preempt read error");
+     d47:	83 ec 08             	sub    $0x8,%esp
+     d4a:	68 95 6c 00 00       	push   $0x6c95
+     d4f:	6a 01                	push   $0x1
+     d51:	e8 6a 58 00 00       	call   65c0 <printf>
+     d56:	83 c4 10             	add    $0x10,%esp
+     d59:	eb e4                	jmp    d3f <preempt+0x11f>
+      printf(1, "preempt write error");
+     d5b:	83 ec 08             	sub    $0x8,%esp
+     d5e:	68 81 6c 00 00       	push   $0x6c81
+     d63:	6a 01                	push   $0x1
+     d65:	e8 56 58 00 00       	call   65c0 <printf>
+     d6a:	83 c4 10             	add    $0x10,%esp
+     d6d:	e9 31 ff ff ff       	jmp    ca3 <preempt+0x83>
+     d72:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d79:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000d80 <exitwait>:
+{
+     d80:	55                   	push   %ebp
+     d81:	89 e5                	mov    %esp,%ebp
+     d83:	56                   	push   %esi
+     d84:	be 64 00 00 00       	mov    $0x64,%esi
+     d89:	53                   	push   %ebx
+     d8a:	eb 14                	jmp    da0 <exitwait+0x20>
+     d8c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(pid){
+     d90:	74 68                	je     dfa <exitwait+0x7a>
+      if(wait() != pid){
+     d92:	e8 c4 56 00 00       	call   645b <wait>
+     d97:	39 d8                	cmp    %ebx,%eax
+     d99:	75 2d                	jne    dc8 <exitwait+0x48>
+  for(i = 0; i < 100; i++){
+     d9b:	83 ee 01             	sub    $0x1,%esi
+     d9e:	74 41                	je     de1 <exitwait+0x61>
+    pid = fork();
+     da0:	e8 a6 56 00 00       	call   644b <fork>
+     da5:	89 c3                	mov    %eax,%ebx
+    if(pid < 0){
+     da7:	85 c0                	test   %eax,%eax
+     da9:	79 e5                	jns    d90 <exitwait+0x10>
+      printf(1, "fork failed\n");
+     dab:	83 ec 08             	sub    $0x8,%esp
+     dae:	68 f4 7d 00 00       	push   $0x7df4
+     db3:	6a 01                	push   $0x1
+     db5:	e8 06 58 00 00       	call   65c0 <printf>
+      return;
+     dba:	83 c4 10             	add    $0x10,%esp
+}
+     dbd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     dc0:	5b                   	pop    %ebx
+     dc1:	5e                   	pop    %esi
+     dc2:	5d                   	pop    %ebp
+     dc3:	c3                   	ret
+     dc4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printf(1, "wait wrong pid\n");
+     dc8:	83 ec 08             	sub    $0x8,%esp
+     dcb:	68 c6 6c 00 00       	push   $0x6cc6
+     dd0:	6a 01                	push   $0x1
+     dd2:	e8 e9 57 00 00       	call   65c0 <printf>
+        return;
+     dd7:	83 c4 10             	add    $0x10,%esp
+}
+     dda:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     ddd:	5b                   	pop    %ebx
+     dde:	5e                   	pop    %esi
+     ddf:	5d                   	pop    %ebp
+     de0:	c3                   	ret
+  printf(1, "exitwait ok\n");
+     de1:	83 ec 08             	sub    $0x8,%esp
+     de4:	68 d6 6c 00 00       	push   $0x6cd6
+     de9:	6a 01                	push   $0x1
+     deb:	e8 d0 57 00 00       	call   65c0 <printf>
+     df0:	83 c4 10             	add    $0x10,%esp
+}
+     df3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     df6:	5b                   	pop    %ebx
+     df7:	5e                   	pop    %esi
+     df8:	5d                   	pop    %ebp
+     df9:	c3                   	ret
+      exit();
+     dfa:	e8 54 56 00 00       	call   6453 <exit>
+     dff:	90                   	nop
+
+00000e00 <mem>:
+{
+     e00:	55                   	push   %ebp
+     e01:	89 e5                	mov    %esp,%ebp
+     e03:	56                   	push   %esi
+     e04:	31 f6                	xor    %esi,%esi
+     e06:	53                   	push   %ebx
+  printf(1, "mem test\n");
+     e07:	83 ec 08             	sub    $0x8,%esp
+     e0a:	68 e3 6c 00 00       	push   $0x6ce3
+     e0f:	6a 01                	push   $0x1
+     e11:	e8 aa 57 00 00       	call   65c0 <printf>
+  ppid = getpid();
+     e16:	e8 b8 56 00 00       	call   64d3 <getpid>
+     e1b:	89 c3                	mov    %eax,%ebx
+  if((pid = fork()) == 0){
+     e1d:	e8 29 56 00 00       	call   644b <fork>
+     e22:	83 c4 10             	add    $0x10,%esp
+     e25:	85 c0                	test   %eax,%eax
+     e27:	74 0b                	je     e34 <mem+0x34>
+     e29:	e9 8a 00 00 00       	jmp    eb8 <mem+0xb8>
+     e2e:	66 90                	xchg   %ax,%ax
+      *(char**)m2 = m1;
+     e30:	89 30                	mov    %esi,(%eax)
+     e32:	89 c6                	mov    %eax,%esi
+    while((m2 = malloc(10001)) != 0){
+     e34:	83 ec 0c             	sub    $0xc,%esp
+     e37:	68 11 27 00 00       	push   $0x2711
+     e3c:	e8 bf 59 00 00       	call   6800 <malloc>
+     e41:	83 c4 10             	add    $0x10,%esp
+     e44:	85 c0                	test   %eax,%eax
+     e46:	75 e8                	jne    e30 <mem+0x30>
+    while(m1){
+     e48:	85 f6                	test   %esi,%esi
+     e4a:	74 18                	je     e64 <mem+0x64>
+     e4c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      m2 = *(char**)m1;
+     e50:	89 f0                	mov    %esi,%eax
+      free(m1);
+     e52:	83 ec 0c             	sub    $0xc,%esp
+      m2 = *(char**)m1;
+     e55:	8b 36                	mov    (%esi),%esi
+      free(m1);
+     e57:	50                   	push   %eax
+     e58:	e8 13 59 00 00       	call   6770 <free>
+    while(m1){
+     e5d:	83 c4 10             	add    $0x10,%esp
+     e60:	85 f6                	test   %esi,%esi
+     e62:	75 ec                	jne    e50 <mem+0x50>
+    m1 = malloc(1024*20);
+     e64:	83 ec 0c             	sub    $0xc,%esp
+     e67:	68 00 50 00 00       	push   $0x5000
+     e6c:	e8 8f 59 00 00       	call   6800 <malloc>
+    if(m1 == 0){
+     e71:	83 c4 10             	add    $0x10,%esp
+     e74:	85 c0                	test   %eax,%eax
+     e76:	74 20                	je     e98 <mem+0x98>
+    free(m1);
+     e78:	83 ec 0c             	sub    $0xc,%esp
+     e7b:	50                   	push   %eax
+     e7c:	e8 ef 58 00 00       	call   6770 <free>
+    printf(1, "mem ok\n");
+     e81:	58                   	pop    %eax
+     e82:	5a                   	pop    %edx
+     e83:	68 07 6d 00 00       	push   $0x6d07
+     e88:	6a 01                	push   $0x1
+     e8a:	e8 31 57 00 00       	call   65c0 <printf>
+    exit();
+     e8f:	e8 bf 55 00 00       	call   6453 <exit>
+     e94:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      printf(1, "couldn't allocate mem?!!\n");
+     e98:	83 ec 08             	sub    $0x8,%esp
+     e9b:	68 ed 6c 00 00       	push   $0x6ced
+     ea0:	6a 01                	push   $0x1
+     ea2:	e8 19 57 00 00       	call   65c0 <printf>
+      kill(ppid);
+     ea7:	89 1c 24             	mov    %ebx,(%esp)
+     eaa:	e8 d4 55 00 00       	call   6483 <kill>
+      exit();
+     eaf:	e8 9f 55 00 00       	call   6453 <exit>
+     eb4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+}
+     eb8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     ebb:	5b                   	pop    %ebx
+     ebc:	5e                   	pop    %esi
+     ebd:	5d                   	pop    %ebp
+    wait();
+     ebe:	e9 98 55 00 00       	jmp    645b <wait>
+     ec3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     eca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000ed0 <allocbench>:
+{
+     ed0:	55                   	push   %ebp
+     ed1:	89 e5                	mov    %esp,%ebp
+     ed3:	56                   	push   %esi
+     ed4:	53                   	push   %ebx
+  t0 = uptime();
+     ed5:	bb 04 00 00 00       	mov    $0x4,%ebx
+  printf(stdout, "allocbench test\n");
+     eda:	83 ec 08             	sub    $0x8,%esp
+     edd:	68 0f 6d 00 00       	push   $0x6d0f
+     ee2:	ff 35 d4 9e 00 00    	push   0x9ed4
+     ee8:	e8 d3 56 00 00       	call   65c0 <printf>
+  t0 = uptime();
+     eed:	e8 f9 55 00 00       	call   64eb <uptime>
+     ef2:	83 c4 10             	add    $0x10,%esp
+     ef5:	89 c6                	mov    %eax,%esi
+    if(fork() == 0){
+     ef7:	e8 4f 55 00 00       	call   644b <fork>
+     efc:	85 c0                	test   %eax,%eax
+     efe:	74 6b                	je     f6b <allocbench+0x9b>
+  for(i = 0; i < ABPROCS; i++){
+     f00:	83 eb 01             	sub    $0x1,%ebx
+     f03:	75 f2                	jne    ef7 <allocbench+0x27>
+    wait();
+     f05:	e8 51 55 00 00       	call   645b <wait>
+     f0a:	e8 4c 55 00 00       	call   645b <wait>
+     f0f:	e8 47 55 00 00       	call   645b <wait>
+     f14:	e8 42 55 00 00       	call   645b <wait>
+  t = uptime() - t0;
+     f19:	e8 cd 55 00 00       	call   64eb <uptime>
+  if(t == 0)
+     f1e:	29 f0                	sub    %esi,%eax
+     f20:	89 c1                	mov    %eax,%ecx
+     f22:	b8 00 32 00 00       	mov    $0x3200,%eax
+     f27:	74 3b                	je     f64 <allocbench+0x94>
+  printf(stdout, "allocbench: %d pages in %d ticks, %d pages/tick\n",
+     f29:	31 d2                	xor    %edx,%edx
+     f2b:	f7 f9                	idiv   %ecx
+     f2d:	83 ec 0c             	sub    $0xc,%esp
+     f30:	50                   	push   %eax
+     f31:	51                   	push   %ecx
+     f32:	68 00 32 00 00       	push   $0x3200
+     f37:	68 b0 7f 00 00       	push   $0x7fb0
+     f3c:	ff 35 d4 9e 00 00    	push   0x9ed4
+     f42:	e8 79 56 00 00       	call   65c0 <printf>
+  printf(stdout, "allocbench ok\n");
+     f47:	83 c4 18             	add    $0x18,%esp
+     f4a:	68 38 6d 00 00       	push   $0x6d38
+     f4f:	ff 35 d4 9e 00 00    	push   0x9ed4
+     f55:	e8 66 56 00 00       	call   65c0 <printf>
+}
+     f5a:	83 c4 10             	add    $0x10,%esp
+     f5d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     f60:	5b                   	pop    %ebx
+     f61:	5e                   	pop    %esi
+     f62:	5d                   	pop    %ebp
+     f63:	c3                   	ret
+    t = 1;
+     f64:	b9 01 00 00 00       	mov    $0x1,%ecx
+     f69:	eb c2                	jmp    f2d <allocbench+0x5d>
+      for(j = 0; j < ABROUNDS; j++){
+     f6b:	31 db                	xor    %ebx,%ebx
+     f6d:	8d 76 00             	lea    0x0(%esi),%esi
+        a = sbrk(ABPAGES*4096);
+     f70:	83 ec 0c             	sub    $0xc,%esp
+     f73:	68 00 00 01 00       	push   $0x10000
+     f78:	e8 5e 55 00 00       	call   64db <sbrk>
+        if(a == (char*)0xffffffff){
+     f7d:	83 c4 10             	add    $0x10,%esp
+     f80:	83 f8 ff             	cmp    $0xffffffff,%eax
+     f83:	74 53                	je     fd8 <allocbench+0x108>
+        for(k = 0; k < ABPAGES; k++)
+     f85:	31 d2                	xor    %edx,%edx
+     f87:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f8e:	66 90                	xchg   %ax,%ax
+          a[k*4096] = k;
+     f90:	89 d1                	mov    %edx,%ecx
+     f92:	c1 e1 0c             	shl    $0xc,%ecx
+     f95:	88 14 08             	mov    %dl,(%eax,%ecx,1)
+        for(k = 0; k < ABPAGES; k++)
+     f98:	83 c2 01             	add    $0x1,%edx
+     f9b:	83 fa 10             	cmp    $0x10,%edx
+     f9e:	75 f0                	jne    f90 <allocbench+0xc0>
+        sbrk(-ABPAGES*4096);
+     fa0:	83 ec 0c             	sub    $0xc,%esp
+     fa3:	68 00 00 ff ff       	push   $0xffff0000
+     fa8:	e8 2e 55 00 00       	call   64db <sbrk>
+        if((j & 15) == 0 && fork() == 0)
+     fad:	83 c4 10             	add    $0x10,%esp
+     fb0:	f6 c3 0f             	test   $0xf,%bl
+     fb3:	74 13                	je     fc8 <allocbench+0xf8>
+      for(j = 0; j < ABROUNDS; j++){
+     fb5:	83 c3 01             	add    $0x1,%ebx
+     fb8:	81 fb c8 00 00 00    	cmp    $0xc8,%ebx
+     fbe:	75 b0                	jne    f70 <allocbench+0xa0>
+          exit();
+     fc0:	e8 8e 54 00 00       	call   6453 <exit>
+     fc5:	8d 76 00             	lea    0x0(%esi),%esi
+        if((j & 15) == 0 && fork() == 0)
+     fc8:	e8 7e 54 00 00       	call   644b <fork>
+     fcd:	85 c0                	test   %eax,%eax
+     fcf:	74 ef                	je     fc0 <allocbench+0xf0>
+          wait();
+     fd1:	e8 85 54 00 00       	call   645b <wait>
+     fd6:	eb dd                	jmp    fb5 <allocbench+0xe5>
+          printf(stdout, "allocbench sbrk failed\n");
+     fd8:	83 ec 08             	sub    $0x8,%esp
+     fdb:	68 20 6d 00 00       	push   $0x6d20
+     fe0:	ff 35 d4 9e 00 00    	push   0x9ed4
+     fe6:	e8 d5 55 00 00       	call   65c0 <printf>
+          exit();
+     feb:	e8 63 54 00 00       	call   6453 <exit>
+
+00000ff0 <buddytest>:
+{
+     ff0:	55                   	push   %ebp
+     ff1:	89 e5                	mov    %esp,%ebp
+     ff3:	53                   	push   %ebx
+  if(getvmstat(&st) < 0){
+     ff4:	8d 9d f0 fe ff ff    	lea    -0x110(%ebp),%ebx
+{
+     ffa:	81 ec 1c 01 00 00    	sub    $0x11c,%esp
+  printf(stdout, "buddy test\n");
+    1000:	68 47 6d 00 00       	push   $0x6d47
+    1005:	ff 35 d4 9e 00 00    	push   0x9ed4
+    100b:	e8 b0 55 00 00       	call   65c0 <printf>
+  if(getvmstat(&st) < 0){
+    1010:	89 1c 24             	mov    %ebx,(%esp)
+    1013:	e8 eb 54 00 00       	call   6503 <getvmstat>
+    1018:	83 c4 10             	add    $0x10,%esp
+    101b:	85 c0                	test   %eax,%eax
+    101d:	78 46                	js     1065 <buddytest+0x75>
+  n = st.cachedpages;
+    101f:	8b 95 f4 fe ff ff    	mov    -0x10c(%ebp),%edx
+  for(k = 0; k <= VM_MAXORDER; k++)
+    1025:	31 c9                	xor    %ecx,%ecx
+    1027:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    102e:	66 90                	xchg   %ax,%ax
+    n += st.buddyfree[k] << k;
+    1030:	8b 44 8b 08          	mov    0x8(%ebx,%ecx,4),%eax
+    1034:	d3 e0                	shl    %cl,%eax
+  for(k = 0; k <= VM_MAXORDER; k++)
+    1036:	83 c1 01             	add    $0x1,%ecx
+    n += st.buddyfree[k] << k;
+    1039:	01 c2                	add    %eax,%edx
+  for(k = 0; k <= VM_MAXORDER; k++)
+    103b:	83 f9 0b             	cmp    $0xb,%ecx
+    103e:	75 f0                	jne    1030 <buddytest+0x40>
+  if(n != st.freepages){
+    1040:	8b 8d f0 fe ff ff    	mov    -0x110(%ebp),%ecx
+    printf(stdout, "getvmstat failed\n");
+    1046:	a1 d4 9e 00 00       	mov    0x9ed4,%eax
+  if(n != st.freepages){
+    104b:	39 d1                	cmp    %edx,%ecx
+    104d:	75 2d                	jne    107c <buddytest+0x8c>
+  printf(stdout, "buddy test ok\n");
+    104f:	83 ec 08             	sub    $0x8,%esp
+    1052:	68 65 6d 00 00       	push   $0x6d65
+    1057:	50                   	push   %eax
+    1058:	e8 63 55 00 00       	call   65c0 <printf>
+}
+    105d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1060:	83 c4 10             	add    $0x10,%esp
+    1063:	c9                   	leave
+    1064:	c3                   	ret
+    printf(stdout, "getvmstat failed\n");
+    1065:	50                   	push   %eax
+    1066:	50                   	push   %eax
+    1067:	68 53 6d 00 00       	push   $0x6d53
+    106c:	ff 35 d4 9e 00 00    	push   0x9ed4
+    1072:	e8 49 55 00 00       	call   65c0 <printf>
+    exit();
+    1077:	e8 d7 53 00 00       	call   6453 <exit>
+    printf(stdout, "buddy lists hold %d pages, expected %d\n", n, st.freepages);
+    107c:	51                   	push   %ecx
+    107d:	52                   	push   %edx
+    107e:	68 e4 7f 00 00       	push   $0x7fe4
+    1083:	50                   	push   %eax
+    1084:	e8 37 55 00 00       	call   65c0 <printf>
+    exit();
+    1089:	e8 c5 53 00 00       	call   6453 <exit>
+    108e:	66 90                	xchg   %ax,%ax
+
+00001090 <swapbench>:
+{
+    1090:	55                   	push   %ebp
+    1091:	89 e5                	mov    %esp,%ebp
+    1093:	57                   	push   %edi
+    1094:	56                   	push   %esi
+    1095:	53                   	push   %ebx
+    1096:	81 ec 54 02 00 00    	sub    $0x254,%esp
+  printf(stdout, "swapbench test\n");
+    109c:	68 74 6d 00 00       	push   $0x6d74
+    10a1:	ff 35 d4 9e 00 00    	push   0x9ed4
+    10a7:	e8 14 55 00 00       	call   65c0 <printf>
+  if(pipe(ready) < 0 || pipe(go) < 0){
+    10ac:	8d 85 c8 fd ff ff    	lea    -0x238(%ebp),%eax
+    10b2:	89 04 24             	mov    %eax,(%esp)
+    10b5:	e8 a9 53 00 00       	call   6463 <pipe>
+    10ba:	83 c4 10             	add    $0x10,%esp
+    10bd:	85 c0                	test   %eax,%eax
+    10bf:	0f 88 ca 02 00 00    	js     138f <swapbench+0x2ff>
+    10c5:	83 ec 0c             	sub    $0xc,%esp
+    10c8:	8d 85 d0 fd ff ff    	lea    -0x230(%ebp),%eax
+    10ce:	50                   	push   %eax
+    10cf:	e8 8f 53 00 00       	call   6463 <pipe>
+    10d4:	83 c4 10             	add    $0x10,%esp
+    10d7:	85 c0                	test   %eax,%eax
+    10d9:	0f 88 b0 02 00 00    	js     138f <swapbench+0x2ff>
+  getvmstat(&st0);
+    10df:	83 ec 0c             	sub    $0xc,%esp
+    10e2:	8d 85 d8 fd ff ff    	lea    -0x228(%ebp),%eax
+  for(i = 0; i < SBPROCS; i++){
+    10e8:	31 f6                	xor    %esi,%esi
+  getvmstat(&st0);
+    10ea:	50                   	push   %eax
+    10eb:	e8 13 54 00 00       	call   6503 <getvmstat>
+  n = (st0.freepages + OVERCOMMIT) / SBPROCS;
+    10f0:	8b 9d d8 fd ff ff    	mov    -0x228(%ebp),%ebx
+  t0 = uptime();
+    10f6:	e8 f0 53 00 00       	call   64eb <uptime>
+    10fb:	83 c4 10             	add    $0x10,%esp
+    10fe:	89 85 b4 fd ff ff    	mov    %eax,-0x24c(%ebp)
+  for(i = 0; i < SBPROCS; i++){
+    1104:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(fork() == 0){
+    1108:	e8 3e 53 00 00       	call   644b <fork>
+    110d:	85 c0                	test   %eax,%eax
+    110f:	0f 84 3b 01 00 00    	je     1250 <swapbench+0x1c0>
+  for(i = 0; i < SBPROCS; i++){
+    1115:	83 c6 01             	add    $0x1,%esi
+    1118:	83 fe 10             	cmp    $0x10,%esi
+    111b:	75 eb                	jne    1108 <swapbench+0x78>
+  close(ready[1]);
+    111d:	83 ec 0c             	sub    $0xc,%esp
+    1120:	ff b5 cc fd ff ff    	push   -0x234(%ebp)
+  for(i = 0; i < SBPROCS; i++){
+    1126:	31 db                	xor    %ebx,%ebx
+    1128:	8d bd c7 fd ff ff    	lea    -0x239(%ebp),%edi
+  close(ready[1]);
+    112e:	e8 48 53 00 00       	call   647b <close>
+  close(go[0]);
+    1133:	59                   	pop    %ecx
+    1134:	ff b5 d0 fd ff ff    	push   -0x230(%ebp)
+    113a:	e8 3c 53 00 00       	call   647b <close>
+    113f:	83 c4 10             	add    $0x10,%esp
+    1142:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(read(ready[0], &c, 1) != 1){
+    1148:	83 ec 04             	sub    $0x4,%esp
+    114b:	6a 01                	push   $0x1
+    114d:	57                   	push   %edi
+    114e:	ff b5 c8 fd ff ff    	push   -0x238(%ebp)
+    1154:	e8 12 53 00 00       	call   646b <read>
+    1159:	83 c4 10             	add    $0x10,%esp
+    115c:	83 f8 01             	cmp    $0x1,%eax
+    115f:	0f 85 11 02 00 00    	jne    1376 <swapbench+0x2e6>
+  for(i = 0; i < SBPROCS; i++){
+    1165:	83 c3 01             	add    $0x1,%ebx
+    1168:	83 fb 10             	cmp    $0x10,%ebx
+    116b:	75 db                	jne    1148 <swapbench+0xb8>
+  close(ready[0]);
+    116d:	83 ec 0c             	sub    $0xc,%esp
+    1170:	ff b5 c8 fd ff ff    	push   -0x238(%ebp)
+    1176:	89 c6                	mov    %eax,%esi
+  close(go[1]);
+    1178:	bf 10 00 00 00       	mov    $0x10,%edi
+  close(ready[0]);
+    117d:	e8 f9 52 00 00       	call   647b <close>
+  close(go[1]);
+    1182:	5a                   	pop    %edx
+    1183:	ff b5 d4 fd ff ff    	push   -0x22c(%ebp)
+    1189:	e8 ed 52 00 00       	call   647b <close>
+    118e:	83 c4 10             	add    $0x10,%esp
+    1191:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    wait();
+    1198:	e8 be 52 00 00       	call   645b <wait>
+  for(i = 0; i < SBPROCS; i++)
+    119d:	83 ef 01             	sub    $0x1,%edi
+    11a0:	75 f6                	jne    1198 <swapbench+0x108>
+  t = uptime() - t0;
+    11a2:	e8 44 53 00 00       	call   64eb <uptime>
+    11a7:	8b bd b4 fd ff ff    	mov    -0x24c(%ebp),%edi
+  getvmstat(&st1);
+    11ad:	83 ec 0c             	sub    $0xc,%esp
+  t = uptime() - t0;
+    11b0:	29 f8                	sub    %edi,%eax
+    11b2:	89 85 b0 fd ff ff    	mov    %eax,-0x250(%ebp)
+  getvmstat(&st1);
+    11b8:	8d 85 e0 fe ff ff    	lea    -0x120(%ebp),%eax
+    11be:	50                   	push   %eax
+    11bf:	e8 3f 53 00 00       	call   6503 <getvmstat>
+  if(st1.swapouts == st0.swapouts || st1.swapins == st0.swapins){
+    11c4:	8b 8d 14 ff ff ff    	mov    -0xec(%ebp),%ecx
+    11ca:	8b 85 0c fe ff ff    	mov    -0x1f4(%ebp),%eax
+    11d0:	83 c4 10             	add    $0x10,%esp
+    11d3:	39 c1                	cmp    %eax,%ecx
+    11d5:	0f 84 cb 01 00 00    	je     13a6 <swapbench+0x316>
+    11db:	8b 9d 18 ff ff ff    	mov    -0xe8(%ebp),%ebx
+    11e1:	8b bd 10 fe ff ff    	mov    -0x1f0(%ebp),%edi
+    11e7:	39 fb                	cmp    %edi,%ebx
+    11e9:	0f 84 b7 01 00 00    	je     13a6 <swapbench+0x316>
+  if(t == 0)
+    11ef:	c7 85 b4 fd ff ff 01 	movl   $0x1,-0x24c(%ebp)
+    11f6:	00 00 00 
+    11f9:	8b 95 b0 fd ff ff    	mov    -0x250(%ebp),%edx
+    11ff:	85 d2                	test   %edx,%edx
+    1201:	75 40                	jne    1243 <swapbench+0x1b3>
+         (st1.swapouts - st0.swapouts) / t);
+    1203:	29 c1                	sub    %eax,%ecx
+  printf(stdout, "swapbench: %d swap-outs %d swap-ins in %d ticks, %d swap-outs/tick\n",
+    1205:	31 d2                	xor    %edx,%edx
+    1207:	83 ec 08             	sub    $0x8,%esp
+    120a:	29 fb                	sub    %edi,%ebx
+    120c:	89 c8                	mov    %ecx,%eax
+    120e:	f7 b5 b4 fd ff ff    	divl   -0x24c(%ebp)
+    1214:	50                   	push   %eax
+    1215:	56                   	push   %esi
+    1216:	53                   	push   %ebx
+    1217:	51                   	push   %ecx
+    1218:	68 60 80 00 00       	push   $0x8060
+    121d:	ff 35 d4 9e 00 00    	push   0x9ed4
+    1223:	e8 98 53 00 00       	call   65c0 <printf>
+  printf(stdout, "swapbench ok\n");
+    1228:	83 c4 18             	add    $0x18,%esp
+    122b:	68 cd 6d 00 00       	push   $0x6dcd
+    1230:	ff 35 d4 9e 00 00    	push   0x9ed4
+    1236:	e8 85 53 00 00       	call   65c0 <printf>
+}
+    123b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    123e:	5b                   	pop    %ebx
+    123f:	5e                   	pop    %esi
+    1240:	5f                   	pop    %edi
+    1241:	5d                   	pop    %ebp
+    1242:	c3                   	ret
+  printf(stdout, "swapbench: %d swap-outs %d swap-ins in %d ticks, %d swap-outs/tick\n",
+    1243:	89 95 b4 fd ff ff    	mov    %edx,-0x24c(%ebp)
+    1249:	89 d6                	mov    %edx,%esi
+    124b:	eb b6                	jmp    1203 <swapbench+0x173>
+    124d:	8d 76 00             	lea    0x0(%esi),%esi
+      close(ready[0]);
+    1250:	83 ec 0c             	sub    $0xc,%esp
+    1253:	ff b5 c8 fd ff ff    	push   -0x238(%ebp)
+  n = (st0.freepages + OVERCOMMIT) / SBPROCS;
+    1259:	83 eb 80             	sub    $0xffffff80,%ebx
+    125c:	c1 eb 04             	shr    $0x4,%ebx
+      close(ready[0]);
+    125f:	e8 17 52 00 00       	call   647b <close>
+      close(go[1]);
+    1264:	58                   	pop    %eax
+    1265:	ff b5 d4 fd ff ff    	push   -0x22c(%ebp)
+    126b:	e8 0b 52 00 00       	call   647b <close>
+      a = sbrk(n*4096);
+    1270:	89 d8                	mov    %ebx,%eax
+    1272:	c1 e0 0c             	shl    $0xc,%eax
+    1275:	89 04 24             	mov    %eax,(%esp)
+    1278:	e8 5e 52 00 00       	call   64db <sbrk>
+      if(a == (char*)0xffffffff){
+    127d:	83 c4 10             	add    $0x10,%esp
+      a = sbrk(n*4096);
+    1280:	89 85 b4 fd ff ff    	mov    %eax,-0x24c(%ebp)
+      if(a == (char*)0xffffffff){
+    1286:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1289:	0f 84 2e 01 00 00    	je     13bd <swapbench+0x32d>
+        for(j = 0; j < n; j++){
+    128f:	85 db                	test   %ebx,%ebx
+    1291:	74 33                	je     12c6 <swapbench+0x236>
+      for(k = 0; k < 4; k++){
+    1293:	31 c9                	xor    %ecx,%ecx
+    1295:	89 f0                	mov    %esi,%eax
+          if(k > 0 && a[j*4096] != (char)(i+j)){
+    1297:	89 f7                	mov    %esi,%edi
+    1299:	89 ce                	mov    %ecx,%esi
+    129b:	89 c1                	mov    %eax,%ecx
+    129d:	8b 95 b4 fd ff ff    	mov    -0x24c(%ebp),%edx
+        for(j = 0; j < n; j++){
+    12a3:	31 c0                	xor    %eax,%eax
+          if(k > 0 && a[j*4096] != (char)(i+j)){
+    12a5:	85 f6                	test   %esi,%esi
+    12a7:	75 77                	jne    1320 <swapbench+0x290>
+    12a9:	89 ce                	mov    %ecx,%esi
+    12ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    12af:	90                   	nop
+          a[j*4096] = i+j;
+    12b0:	8d 0c 07             	lea    (%edi,%eax,1),%ecx
+        for(j = 0; j < n; j++){
+    12b3:	83 c0 01             	add    $0x1,%eax
+    12b6:	81 c2 00 10 00 00    	add    $0x1000,%edx
+          a[j*4096] = i+j;
+    12bc:	88 8a 00 f0 ff ff    	mov    %cl,-0x1000(%edx)
+        for(j = 0; j < n; j++){
+    12c2:	39 d8                	cmp    %ebx,%eax
+    12c4:	75 ea                	jne    12b0 <swapbench+0x220>
+    12c6:	8d bd c7 fd ff ff    	lea    -0x239(%ebp),%edi
+          write(ready[1], "x", 1);
+    12cc:	83 ec 04             	sub    $0x4,%esp
+    12cf:	6a 01                	push   $0x1
+    12d1:	68 17 78 00 00       	push   $0x7817
+    12d6:	ff b5 cc fd ff ff    	push   -0x234(%ebp)
+    12dc:	e8 92 51 00 00       	call   6473 <write>
+          close(ready[1]);
+    12e1:	58                   	pop    %eax
+    12e2:	ff b5 cc fd ff ff    	push   -0x234(%ebp)
+    12e8:	e8 8e 51 00 00       	call   647b <close>
+          read(go[0], &c, 1);
+    12ed:	83 c4 0c             	add    $0xc,%esp
+    12f0:	6a 01                	push   $0x1
+    12f2:	57                   	push   %edi
+    12f3:	ff b5 d0 fd ff ff    	push   -0x230(%ebp)
+    12f9:	e8 6d 51 00 00       	call   646b <read>
+      for(k = 0; k < 4; k++){
+    12fe:	b9 01 00 00 00       	mov    $0x1,%ecx
+        for(j = 0; j < n; j++){
+    1303:	83 c4 10             	add    $0x10,%esp
+    1306:	85 db                	test   %ebx,%ebx
+    1308:	75 8b                	jne    1295 <swapbench+0x205>
+      for(k = 0; k < 4; k++){
+    130a:	b8 01 00 00 00       	mov    $0x1,%eax
+    130f:	83 c0 01             	add    $0x1,%eax
+    1312:	83 f8 04             	cmp    $0x4,%eax
+    1315:	74 41                	je     1358 <swapbench+0x2c8>
+        if(k == 0){
+    1317:	85 c0                	test   %eax,%eax
+    1319:	74 b1                	je     12cc <swapbench+0x23c>
+    131b:	eb f2                	jmp    130f <swapbench+0x27f>
+    131d:	8d 76 00             	lea    0x0(%esi),%esi
+    1320:	89 b5 b0 fd ff ff    	mov    %esi,-0x250(%ebp)
+    1326:	89 ce                	mov    %ecx,%esi
+    1328:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    132f:	90                   	nop
+          if(k > 0 && a[j*4096] != (char)(i+j)){
+    1330:	8d 0c 07             	lea    (%edi,%eax,1),%ecx
+    1333:	38 0a                	cmp    %cl,(%edx)
+    1335:	75 26                	jne    135d <swapbench+0x2cd>
+        for(j = 0; j < n; j++){
+    1337:	83 c0 01             	add    $0x1,%eax
+    133a:	81 c2 00 10 00 00    	add    $0x1000,%edx
+    1340:	39 c3                	cmp    %eax,%ebx
+    1342:	75 ec                	jne    1330 <swapbench+0x2a0>
+      for(k = 0; k < 4; k++){
+    1344:	89 f1                	mov    %esi,%ecx
+    1346:	8b b5 b0 fd ff ff    	mov    -0x250(%ebp),%esi
+    134c:	83 c6 01             	add    $0x1,%esi
+    134f:	83 fe 04             	cmp    $0x4,%esi
+    1352:	0f 85 45 ff ff ff    	jne    129d <swapbench+0x20d>
+      exit();
+    1358:	e8 f6 50 00 00       	call   6453 <exit>
+            printf(stdout, "swapbench page %d corrupt\n", j);
+    135d:	83 ec 04             	sub    $0x4,%esp
+    1360:	50                   	push   %eax
+    1361:	68 b2 6d 00 00       	push   $0x6db2
+    1366:	ff 35 d4 9e 00 00    	push   0x9ed4
+    136c:	e8 4f 52 00 00       	call   65c0 <printf>
+            exit();
+    1371:	e8 dd 50 00 00       	call   6453 <exit>
+      printf(stdout, "swapbench: only %d children filled their memory\n", i);
+    1376:	83 ec 04             	sub    $0x4,%esp
+    1379:	53                   	push   %ebx
+    137a:	68 0c 80 00 00       	push   $0x800c
+    137f:	ff 35 d4 9e 00 00    	push   0x9ed4
+    1385:	e8 36 52 00 00       	call   65c0 <printf>
+      exit();
+    138a:	e8 c4 50 00 00       	call   6453 <exit>
+    printf(stdout, "swapbench pipe failed\n");
+    138f:	50                   	push   %eax
+    1390:	50                   	push   %eax
+    1391:	68 84 6d 00 00       	push   $0x6d84
+    1396:	ff 35 d4 9e 00 00    	push   0x9ed4
+    139c:	e8 1f 52 00 00       	call   65c0 <printf>
+    exit();
+    13a1:	e8 ad 50 00 00       	call   6453 <exit>
+    printf(stdout, "swapbench: nothing was swapped\n");
+    13a6:	50                   	push   %eax
+    13a7:	50                   	push   %eax
+    13a8:	68 40 80 00 00       	push   $0x8040
+    13ad:	ff 35 d4 9e 00 00    	push   0x9ed4
+    13b3:	e8 08 52 00 00       	call   65c0 <printf>
+    exit();
+    13b8:	e8 96 50 00 00       	call   6453 <exit>
+        printf(stdout, "swapbench sbrk failed\n");
+    13bd:	50                   	push   %eax
+    13be:	50                   	push   %eax
+    13bf:	68 9b 6d 00 00       	push   $0x6d9b
+    13c4:	ff 35 d4 9e 00 00    	push   0x9ed4
+    13ca:	e8 f1 51 00 00       	call   65c0 <printf>
+        exit();
+    13cf:	e8 7f 50 00 00       	call   6453 <exit>
+    13d4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    13db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    13df:	90                   	nop
+
+000013e0 <swapseqbench>:
+{
+    13e0:	55                   	push   %ebp
+    13e1:	89 e5                	mov    %esp,%ebp
+    13e3:	57                   	push   %edi
+    13e4:	56                   	push   %esi
+    13e5:	53                   	push   %ebx
+    13e6:	81 ec 34 02 00 00    	sub    $0x234,%esp
+  printf(stdout, "swapseqbench test\n");
+    13ec:	68 db 6d 00 00       	push   $0x6ddb
+    13f1:	ff 35 d4 9e 00 00    	push   0x9ed4
+    13f7:	e8 c4 51 00 00       	call   65c0 <printf>
+  getvmstat(&st0);
+    13fc:	8d 8d d8 fd ff ff    	lea    -0x228(%ebp),%ecx
+    1402:	89 0c 24             	mov    %ecx,(%esp)
+    1405:	e8 f9 50 00 00       	call   6503 <getvmstat>
+  npages = st0.freepages + OVERCOMMIT;
+    140a:	8b 85 d8 fd ff ff    	mov    -0x228(%ebp),%eax
+    1410:	8d 90 80 00 00 00    	lea    0x80(%eax),%edx
+  a = sbrk(npages*4096);
+    1416:	89 d6                	mov    %edx,%esi
+    1418:	89 95 d4 fd ff ff    	mov    %edx,-0x22c(%ebp)
+    141e:	c1 e6 0c             	shl    $0xc,%esi
+    1421:	89 34 24             	mov    %esi,(%esp)
+    1424:	e8 b2 50 00 00       	call   64db <sbrk>
+  if(a == (char*)0xffffffff){
+    1429:	83 c4 10             	add    $0x10,%esp
+    142c:	83 f8 ff             	cmp    $0xffffffff,%eax
+    142f:	0f 84 49 01 00 00    	je     157e <swapseqbench+0x19e>
+  for(i = 0; i < npages; i++)
+    1435:	8b 95 d4 fd ff ff    	mov    -0x22c(%ebp),%edx
+    143b:	89 c7                	mov    %eax,%edi
+    143d:	31 c0                	xor    %eax,%eax
+    143f:	8d 8d d8 fd ff ff    	lea    -0x228(%ebp),%ecx
+    1445:	85 d2                	test   %edx,%edx
+    1447:	0f 8e 00 01 00 00    	jle    154d <swapseqbench+0x16d>
+    144d:	8d 76 00             	lea    0x0(%esi),%esi
+    a[i*4096] = i;
+    1450:	89 c3                	mov    %eax,%ebx
+    1452:	c1 e3 0c             	shl    $0xc,%ebx
+    1455:	88 04 1f             	mov    %al,(%edi,%ebx,1)
+  for(i = 0; i < npages; i++)
+    1458:	89 c3                	mov    %eax,%ebx
+    145a:	8d 40 01             	lea    0x1(%eax),%eax
+    145d:	39 c2                	cmp    %eax,%edx
+    145f:	75 ef                	jne    1450 <swapseqbench+0x70>
+  getvmstat(&st0);
+    1461:	83 ec 0c             	sub    $0xc,%esp
+    1464:	51                   	push   %ecx
+    1465:	e8 99 50 00 00       	call   6503 <getvmstat>
+  t0 = uptime();
+    146a:	e8 7c 50 00 00       	call   64eb <uptime>
+    146f:	83 c4 10             	add    $0x10,%esp
+    1472:	89 c2                	mov    %eax,%edx
+    for(i = 0; i < npages; i++){
+    1474:	31 c0                	xor    %eax,%eax
+    1476:	eb 0a                	jmp    1482 <swapseqbench+0xa2>
+    1478:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    147f:	90                   	nop
+    1480:	89 c8                	mov    %ecx,%eax
+      if(a[i*4096] != (char)i){
+    1482:	89 c1                	mov    %eax,%ecx
+    1484:	c1 e1 0c             	shl    $0xc,%ecx
+    1487:	38 04 0f             	cmp    %al,(%edi,%ecx,1)
+    148a:	0f 85 d5 00 00 00    	jne    1565 <swapseqbench+0x185>
+    for(i = 0; i < npages; i++){
+    1490:	8d 48 01             	lea    0x1(%eax),%ecx
+    1493:	39 d8                	cmp    %ebx,%eax
+    1495:	75 e9                	jne    1480 <swapseqbench+0xa0>
+    1497:	31 c0                	xor    %eax,%eax
+    1499:	eb 07                	jmp    14a2 <swapseqbench+0xc2>
+    149b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    149f:	90                   	nop
+    14a0:	89 c8                	mov    %ecx,%eax
+      if(a[i*4096] != (char)i){
+    14a2:	89 c1                	mov    %eax,%ecx
+    14a4:	c1 e1 0c             	shl    $0xc,%ecx
+    14a7:	38 04 0f             	cmp    %al,(%edi,%ecx,1)
+    14aa:	0f 85 b5 00 00 00    	jne    1565 <swapseqbench+0x185>
+    for(i = 0; i < npages; i++){
+    14b0:	8d 48 01             	lea    0x1(%eax),%ecx
+    14b3:	39 c3                	cmp    %eax,%ebx
+    14b5:	75 e9                	jne    14a0 <swapseqbench+0xc0>
+    14b7:	89 95 d4 fd ff ff    	mov    %edx,-0x22c(%ebp)
+  sbrk(-npages*4096);
+    14bd:	f7 de                	neg    %esi
+  t = uptime() - t0;
+    14bf:	e8 27 50 00 00       	call   64eb <uptime>
+    14c4:	8b 95 d4 fd ff ff    	mov    -0x22c(%ebp),%edx
+  getvmstat(&st1);
+    14ca:	83 ec 0c             	sub    $0xc,%esp
+  t = uptime() - t0;
+    14cd:	29 d0                	sub    %edx,%eax
+    14cf:	89 c3                	mov    %eax,%ebx
+  getvmstat(&st1);
+    14d1:	8d 85 e0 fe ff ff    	lea    -0x120(%ebp),%eax
+    14d7:	50                   	push   %eax
+    14d8:	e8 26 50 00 00       	call   6503 <getvmstat>
+  sbrk(-npages*4096);
+    14dd:	89 34 24             	mov    %esi,(%esp)
+    14e0:	e8 f6 4f 00 00       	call   64db <sbrk>
+  if(st1.swapins == st0.swapins){
+    14e5:	8b 8d 18 ff ff ff    	mov    -0xe8(%ebp),%ecx
+    14eb:	8b 85 10 fe ff ff    	mov    -0x1f0(%ebp),%eax
+    14f1:	83 c4 10             	add    $0x10,%esp
+    14f4:	39 c1                	cmp    %eax,%ecx
+    14f6:	0f 84 99 00 00 00    	je     1595 <swapseqbench+0x1b5>
+    t = 1;
+    14fc:	85 db                	test   %ebx,%ebx
+    14fe:	ba 01 00 00 00       	mov    $0x1,%edx
+    1503:	0f 44 da             	cmove  %edx,%ebx
+  n = (st1.swapouts - st0.swapouts) + (st1.swapins - st0.swapins);
+    1506:	03 8d 14 ff ff ff    	add    -0xec(%ebp),%ecx
+    150c:	2b 8d 0c fe ff ff    	sub    -0x1f4(%ebp),%ecx
+  printf(stdout, "swapseqbench: %d pages swapped in %d ticks, %d pages/tick\n",
+    1512:	83 ec 0c             	sub    $0xc,%esp
+  n = (st1.swapouts - st0.swapouts) + (st1.swapins - st0.swapins);
+    1515:	29 c1                	sub    %eax,%ecx
+  printf(stdout, "swapseqbench: %d pages swapped in %d ticks, %d pages/tick\n",
+    1517:	89 c8                	mov    %ecx,%eax
+    1519:	99                   	cltd
+    151a:	f7 fb                	idiv   %ebx
+    151c:	50                   	push   %eax
+    151d:	53                   	push   %ebx
+    151e:	51                   	push   %ecx
+    151f:	68 cc 80 00 00       	push   $0x80cc
+    1524:	ff 35 d4 9e 00 00    	push   0x9ed4
+    152a:	e8 91 50 00 00       	call   65c0 <printf>
+  printf(stdout, "swapseqbench ok\n");
+    152f:	83 c4 18             	add    $0x18,%esp
+    1532:	68 26 6e 00 00       	push   $0x6e26
+    1537:	ff 35 d4 9e 00 00    	push   0x9ed4
+    153d:	e8 7e 50 00 00       	call   65c0 <printf>
+}
+    1542:	83 c4 10             	add    $0x10,%esp
+    1545:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1548:	5b                   	pop    %ebx
+    1549:	5e                   	pop    %esi
+    154a:	5f                   	pop    %edi
+    154b:	5d                   	pop    %ebp
+    154c:	c3                   	ret
+  getvmstat(&st0);
+    154d:	83 ec 0c             	sub    $0xc,%esp
+    1550:	51                   	push   %ecx
+    1551:	e8 ad 4f 00 00       	call   6503 <getvmstat>
+  t0 = uptime();
+    1556:	e8 90 4f 00 00       	call   64eb <uptime>
+    155b:	83 c4 10             	add    $0x10,%esp
+    155e:	89 c2                	mov    %eax,%edx
+    for(i = 0; i < npages; i++){
+    1560:	e9 52 ff ff ff       	jmp    14b7 <swapseqbench+0xd7>
+        printf(stdout, "swapseqbench page %d corrupt\n", i);
+    1565:	83 ec 04             	sub    $0x4,%esp
+    1568:	50                   	push   %eax
+    1569:	68 08 6e 00 00       	push   $0x6e08
+    156e:	ff 35 d4 9e 00 00    	push   0x9ed4
+    1574:	e8 47 50 00 00       	call   65c0 <printf>
+        exit();
+    1579:	e8 d5 4e 00 00       	call   6453 <exit>
+    printf(stdout, "swapseqbench sbrk failed\n");
+    157e:	52                   	push   %edx
+    157f:	52                   	push   %edx
+    1580:	68 ee 6d 00 00       	push   $0x6dee
+    1585:	ff 35 d4 9e 00 00    	push   0x9ed4
+    158b:	e8 30 50 00 00       	call   65c0 <printf>
+    exit();
+    1590:	e8 be 4e 00 00       	call   6453 <exit>
+    printf(stdout, "swapseqbench: nothing was swapped in\n");
+    1595:	50                   	push   %eax
+    1596:	50                   	push   %eax
+    1597:	68 a4 80 00 00       	push   $0x80a4
+    159c:	ff 35 d4 9e 00 00    	push   0x9ed4
+    15a2:	e8 19 50 00 00       	call   65c0 <printf>
+    exit();
+    15a7:	e8 a7 4e 00 00       	call   6453 <exit>
+    15ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000015b0 <kswapdtest>:
+{
+    15b0:	55                   	push   %ebp
+    15b1:	89 e5                	mov    %esp,%ebp
+    15b3:	57                   	push   %edi
+    15b4:	56                   	push   %esi
+    15b5:	53                   	push   %ebx
+    15b6:	81 ec 24 02 00 00    	sub    $0x224,%esp
+  printf(stdout, "kswapd test\n");
+    15bc:	68 37 6e 00 00       	push   $0x6e37
+    15c1:	ff 35 d4 9e 00 00    	push   0x9ed4
+    15c7:	e8 f4 4f 00 00       	call   65c0 <printf>
+  low = vmtune(VM_LOWWM, -1);
+    15cc:	58                   	pop    %eax
+    15cd:	5a                   	pop    %edx
+    15ce:	6a ff                	push   $0xffffffff
+    15d0:	6a 01                	push   $0x1
+    15d2:	e8 34 4f 00 00       	call   650b <vmtune>
+  high = vmtune(VM_HIGHWM, -1);
+    15d7:	59                   	pop    %ecx
+    15d8:	5b                   	pop    %ebx
+    15d9:	6a ff                	push   $0xffffffff
+    15db:	6a 02                	push   $0x2
+  low = vmtune(VM_LOWWM, -1);
+    15dd:	89 c6                	mov    %eax,%esi
+  high = vmtune(VM_HIGHWM, -1);
+    15df:	e8 27 4f 00 00       	call   650b <vmtune>
+  if(low < 0 || high < low){
+    15e4:	83 c4 10             	add    $0x10,%esp
+  high = vmtune(VM_HIGHWM, -1);
+    15e7:	89 c3                	mov    %eax,%ebx
+  if(low < 0 || high < low){
+    15e9:	85 f6                	test   %esi,%esi
+    15eb:	0f 88 33 01 00 00    	js     1724 <kswapdtest+0x174>
+    15f1:	39 c6                	cmp    %eax,%esi
+    15f3:	0f 8f 2b 01 00 00    	jg     1724 <kswapdtest+0x174>
+  if(vmtune(VM_HIGHWM, high + 16) != high || vmtune(VM_HIGHWM, -1) != high + 16){
+    15f9:	83 ec 08             	sub    $0x8,%esp
+    15fc:	8d 78 10             	lea    0x10(%eax),%edi
+    15ff:	57                   	push   %edi
+    1600:	6a 02                	push   $0x2
+    1602:	e8 04 4f 00 00       	call   650b <vmtune>
+    1607:	83 c4 10             	add    $0x10,%esp
+    160a:	89 c6                	mov    %eax,%esi
+    160c:	39 d8                	cmp    %ebx,%eax
+    160e:	0f 85 f9 00 00 00    	jne    170d <kswapdtest+0x15d>
+    1614:	83 ec 08             	sub    $0x8,%esp
+    1617:	6a ff                	push   $0xffffffff
+    1619:	6a 02                	push   $0x2
+    161b:	e8 eb 4e 00 00       	call   650b <vmtune>
+    1620:	83 c4 10             	add    $0x10,%esp
+    1623:	39 c7                	cmp    %eax,%edi
+    1625:	0f 85 e2 00 00 00    	jne    170d <kswapdtest+0x15d>
+  vmtune(VM_HIGHWM, high);
+    162b:	83 ec 08             	sub    $0x8,%esp
+    162e:	56                   	push   %esi
+    162f:	6a 02                	push   $0x2
+    1631:	e8 d5 4e 00 00       	call   650b <vmtune>
+  if(vmtune(12345, 1) != -1){
+    1636:	5f                   	pop    %edi
+    1637:	58                   	pop    %eax
+    1638:	6a 01                	push   $0x1
+    163a:	68 39 30 00 00       	push   $0x3039
+    163f:	e8 c7 4e 00 00       	call   650b <vmtune>
+    1644:	83 c4 10             	add    $0x10,%esp
+    1647:	83 f8 ff             	cmp    $0xffffffff,%eax
+    164a:	0f 85 19 01 00 00    	jne    1769 <kswapdtest+0x1b9>
+  getvmstat(&st0);
+    1650:	83 ec 0c             	sub    $0xc,%esp
+    1653:	8d 85 d8 fd ff ff    	lea    -0x228(%ebp),%eax
+    1659:	50                   	push   %eax
+    165a:	e8 a4 4e 00 00       	call   6503 <getvmstat>
+  n = st0.freepages + 64;
+    165f:	8b b5 d8 fd ff ff    	mov    -0x228(%ebp),%esi
+    1665:	8d 7e 40             	lea    0x40(%esi),%edi
+  a = sbrk(n*4096);
+    1668:	89 fb                	mov    %edi,%ebx
+    166a:	c1 e3 0c             	shl    $0xc,%ebx
+    166d:	89 1c 24             	mov    %ebx,(%esp)
+    1670:	e8 66 4e 00 00       	call   64db <sbrk>
+  if(a == (char*)0xffffffff){
+    1675:	83 c4 10             	add    $0x10,%esp
+    1678:	83 f8 ff             	cmp    $0xffffffff,%eax
+    167b:	0f 84 d1 00 00 00    	je     1752 <kswapdtest+0x1a2>
+  for(i = 0; i < n; i++)
+    1681:	c1 e6 0c             	shl    $0xc,%esi
+    1684:	8d 94 30 00 00 04 00 	lea    0x40000(%eax,%esi,1),%edx
+    168b:	85 ff                	test   %edi,%edi
+    168d:	7e 0d                	jle    169c <kswapdtest+0xec>
+    168f:	90                   	nop
+    a[i*4096] = 1;
+    1690:	c6 00 01             	movb   $0x1,(%eax)
+  for(i = 0; i < n; i++)
+    1693:	05 00 10 00 00       	add    $0x1000,%eax
+    1698:	39 d0                	cmp    %edx,%eax
+    169a:	75 f4                	jne    1690 <kswapdtest+0xe0>
+  getvmstat(&st1);
+    169c:	83 ec 0c             	sub    $0xc,%esp
+    169f:	8d 85 e0 fe ff ff    	lea    -0x120(%ebp),%eax
+  sbrk(-n*4096);
+    16a5:	f7 db                	neg    %ebx
+  getvmstat(&st1);
+    16a7:	50                   	push   %eax
+    16a8:	e8 56 4e 00 00       	call   6503 <getvmstat>
+  sbrk(-n*4096);
+    16ad:	89 1c 24             	mov    %ebx,(%esp)
+    16b0:	e8 26 4e 00 00       	call   64db <sbrk>
+  if(st1.kswapdwakeups == st0.kswapdwakeups){
+    16b5:	8b 85 1c fe ff ff    	mov    -0x1e4(%ebp),%eax
+    16bb:	83 c4 10             	add    $0x10,%esp
+    16be:	39 85 24 ff ff ff    	cmp    %eax,-0xdc(%ebp)
+    16c4:	74 75                	je     173b <kswapdtest+0x18b>
+  printf(stdout, "kswapd: %d pages by kswapd, %d direct\n",
+    16c6:	8b 85 2c ff ff ff    	mov    -0xd4(%ebp),%eax
+    16cc:	2b 85 24 fe ff ff    	sub    -0x1dc(%ebp),%eax
+    16d2:	50                   	push   %eax
+    16d3:	8b 85 28 ff ff ff    	mov    -0xd8(%ebp),%eax
+    16d9:	2b 85 20 fe ff ff    	sub    -0x1e0(%ebp),%eax
+    16df:	50                   	push   %eax
+    16e0:	68 4c 81 00 00       	push   $0x814c
+    16e5:	ff 35 d4 9e 00 00    	push   0x9ed4
+    16eb:	e8 d0 4e 00 00       	call   65c0 <printf>
+  printf(stdout, "kswapd test ok\n");
+    16f0:	58                   	pop    %eax
+    16f1:	5a                   	pop    %edx
+    16f2:	68 86 6e 00 00       	push   $0x6e86
+    16f7:	ff 35 d4 9e 00 00    	push   0x9ed4
+    16fd:	e8 be 4e 00 00       	call   65c0 <printf>
+}
+    1702:	83 c4 10             	add    $0x10,%esp
+    1705:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1708:	5b                   	pop    %ebx
+    1709:	5e                   	pop    %esi
+    170a:	5f                   	pop    %edi
+    170b:	5d                   	pop    %ebp
+    170c:	c3                   	ret
+    printf(stdout, "vmtune did not set high watermark\n");
+    170d:	50                   	push   %eax
+    170e:	50                   	push   %eax
+    170f:	68 08 81 00 00       	push   $0x8108
+    1714:	ff 35 d4 9e 00 00    	push   0x9ed4
+    171a:	e8 a1 4e 00 00       	call   65c0 <printf>
+    exit();
+    171f:	e8 2f 4d 00 00       	call   6453 <exit>
+    printf(stdout, "bad watermarks %d %d\n", low, high);
+    1724:	53                   	push   %ebx
+    1725:	56                   	push   %esi
+    1726:	68 44 6e 00 00       	push   $0x6e44
+    172b:	ff 35 d4 9e 00 00    	push   0x9ed4
+    1731:	e8 8a 4e 00 00       	call   65c0 <printf>
+    exit();
+    1736:	e8 18 4d 00 00       	call   6453 <exit>
+    printf(stdout, "kswapd never woke\n");
+    173b:	51                   	push   %ecx
+    173c:	51                   	push   %ecx
+    173d:	68 73 6e 00 00       	push   $0x6e73
+    1742:	ff 35 d4 9e 00 00    	push   0x9ed4
+    1748:	e8 73 4e 00 00       	call   65c0 <printf>
+    exit();
+    174d:	e8 01 4d 00 00       	call   6453 <exit>
+    printf(stdout, "kswapd test sbrk failed\n");
+    1752:	53                   	push   %ebx
+    1753:	53                   	push   %ebx
+    1754:	68 5a 6e 00 00       	push   $0x6e5a
+    1759:	ff 35 d4 9e 00 00    	push   0x9ed4
+    175f:	e8 5c 4e 00 00       	call   65c0 <printf>
+    exit();
+    1764:	e8 ea 4c 00 00       	call   6453 <exit>
+    printf(stdout, "vmtune accepted unknown param\n");
+    1769:	56                   	push   %esi
+    176a:	56                   	push   %esi
+    176b:	68 2c 81 00 00       	push   $0x812c
+    1770:	ff 35 d4 9e 00 00    	push   0x9ed4
+    1776:	e8 45 4e 00 00       	call   65c0 <printf>
+    exit();
+    177b:	e8 d3 4c 00 00       	call   6453 <exit>
+
+00001780 <wsbench>:
+{
+    1780:	55                   	push   %ebp
+    1781:	89 e5                	mov    %esp,%ebp
+    1783:	57                   	push   %edi
+    1784:	56                   	push   %esi
+    1785:	53                   	push   %ebx
+    1786:	81 ec 34 02 00 00    	sub    $0x234,%esp
+  printf(stdout, "wsbench test\n");
+    178c:	68 96 6e 00 00       	push   $0x6e96
+    1791:	ff 35 d4 9e 00 00    	push   0x9ed4
+    1797:	e8 24 4e 00 00       	call   65c0 <printf>
+  getvmstat(&st0);
+    179c:	8d 95 d8 fd ff ff    	lea    -0x228(%ebp),%edx
+    17a2:	89 14 24             	mov    %edx,(%esp)
+    17a5:	e8 59 4d 00 00       	call   6503 <getvmstat>
+  ncold = st0.freepages + OVERCOMMIT - WSHOT;
+    17aa:	8b 85 d8 fd ff ff    	mov    -0x228(%ebp),%eax
+  hot = sbrk(WSHOT*4096);
+    17b0:	c7 04 24 00 00 04 00 	movl   $0x40000,(%esp)
+  ncold = st0.freepages + OVERCOMMIT - WSHOT;
+    17b7:	8d 70 40             	lea    0x40(%eax),%esi
+  hot = sbrk(WSHOT*4096);
+    17ba:	e8 1c 4d 00 00       	call   64db <sbrk>
+    17bf:	89 c3                	mov    %eax,%ebx
+  cold = sbrk(ncold*4096);
+    17c1:	89 f0                	mov    %esi,%eax
+    17c3:	c1 e0 0c             	shl    $0xc,%eax
+    17c6:	89 04 24             	mov    %eax,(%esp)
+    17c9:	e8 0d 4d 00 00       	call   64db <sbrk>
+  if(hot == (char*)0xffffffff || cold == (char*)0xffffffff){
+    17ce:	83 c4 10             	add    $0x10,%esp
+    17d1:	83 fb ff             	cmp    $0xffffffff,%ebx
+    17d4:	0f 84 1a 01 00 00    	je     18f4 <wsbench+0x174>
+    17da:	89 c7                	mov    %eax,%edi
+    17dc:	83 f8 ff             	cmp    $0xffffffff,%eax
+    17df:	0f 84 0f 01 00 00    	je     18f4 <wsbench+0x174>
+  for(i = 0; i < ncold; i++)
+    17e5:	31 c0                	xor    %eax,%eax
+    17e7:	85 f6                	test   %esi,%esi
+    17e9:	8d 95 d8 fd ff ff    	lea    -0x228(%ebp),%edx
+    17ef:	7e 16                	jle    1807 <wsbench+0x87>
+    17f1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    cold[i*4096] = i;
+    17f8:	89 c1                	mov    %eax,%ecx
+    17fa:	c1 e1 0c             	shl    $0xc,%ecx
+    17fd:	88 04 0f             	mov    %al,(%edi,%ecx,1)
+  for(i = 0; i < ncold; i++)
+    1800:	83 c0 01             	add    $0x1,%eax
+    1803:	39 c6                	cmp    %eax,%esi
+    1805:	75 f1                	jne    17f8 <wsbench+0x78>
+  getvmstat(&st0);
+    1807:	83 ec 0c             	sub    $0xc,%esp
+    180a:	52                   	push   %edx
+    180b:	e8 f3 4c 00 00       	call   6503 <getvmstat>
+  t0 = uptime();
+    1810:	e8 d6 4c 00 00       	call   64eb <uptime>
+    for(i = 0; i < ncold; i++){
+    1815:	83 c4 10             	add    $0x10,%esp
+  t0 = uptime();
+    1818:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+    for(i = 0; i < ncold; i++){
+    181e:	85 f6                	test   %esi,%esi
+    1820:	7e 34                	jle    1856 <wsbench+0xd6>
+    1822:	b9 04 00 00 00       	mov    $0x4,%ecx
+    1827:	31 c0                	xor    %eax,%eax
+    1829:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      hot[(i % WSHOT)*4096] += 1;
+    1830:	89 c2                	mov    %eax,%edx
+    1832:	83 e2 3f             	and    $0x3f,%edx
+    1835:	c1 e2 0c             	shl    $0xc,%edx
+    1838:	80 04 13 01          	addb   $0x1,(%ebx,%edx,1)
+      if(cold[i*4096] != (char)i){
+    183c:	89 c2                	mov    %eax,%edx
+    183e:	c1 e2 0c             	shl    $0xc,%edx
+    1841:	38 04 17             	cmp    %al,(%edi,%edx,1)
+    1844:	0f 85 91 00 00 00    	jne    18db <wsbench+0x15b>
+    for(i = 0; i < ncold; i++){
+    184a:	83 c0 01             	add    $0x1,%eax
+    184d:	39 c6                	cmp    %eax,%esi
+    184f:	75 df                	jne    1830 <wsbench+0xb0>
+  for(k = 0; k < 4; k++){
+    1851:	83 e9 01             	sub    $0x1,%ecx
+    1854:	75 d1                	jne    1827 <wsbench+0xa7>
+  t = uptime() - t0;
+    1856:	e8 90 4c 00 00       	call   64eb <uptime>
+    185b:	8b 8d d4 fd ff ff    	mov    -0x22c(%ebp),%ecx
+  getvmstat(&st1);
+    1861:	83 ec 0c             	sub    $0xc,%esp
+  t = uptime() - t0;
+    1864:	29 c8                	sub    %ecx,%eax
+    1866:	89 c3                	mov    %eax,%ebx
+  getvmstat(&st1);
+    1868:	8d 85 e0 fe ff ff    	lea    -0x120(%ebp),%eax
+    186e:	50                   	push   %eax
+    186f:	e8 8f 4c 00 00       	call   6503 <getvmstat>
+  sbrk(-(WSHOT+ncold)*4096);
+    1874:	b8 c0 ff ff ff       	mov    $0xffffffc0,%eax
+    1879:	29 f0                	sub    %esi,%eax
+    187b:	c1 e0 0c             	shl    $0xc,%eax
+    187e:	89 04 24             	mov    %eax,(%esp)
+    1881:	e8 55 4c 00 00       	call   64db <sbrk>
+  if(st1.swapins == st0.swapins){
+    1886:	8b 85 18 ff ff ff    	mov    -0xe8(%ebp),%eax
+    188c:	8b 95 10 fe ff ff    	mov    -0x1f0(%ebp),%edx
+    1892:	83 c4 10             	add    $0x10,%esp
+    1895:	39 d0                	cmp    %edx,%eax
+    1897:	74 72                	je     190b <wsbench+0x18b>
+  printf(stdout, "wsbench: %d faults %d swap-ins in %d ticks\n",
+    1899:	83 ec 0c             	sub    $0xc,%esp
+    189c:	29 d0                	sub    %edx,%eax
+    189e:	53                   	push   %ebx
+    189f:	50                   	push   %eax
+    18a0:	8b 85 30 ff ff ff    	mov    -0xd0(%ebp),%eax
+    18a6:	2b 85 28 fe ff ff    	sub    -0x1d8(%ebp),%eax
+    18ac:	50                   	push   %eax
+    18ad:	68 a4 81 00 00       	push   $0x81a4
+    18b2:	ff 35 d4 9e 00 00    	push   0x9ed4
+    18b8:	e8 03 4d 00 00       	call   65c0 <printf>
+  printf(stdout, "wsbench ok\n");
+    18bd:	83 c4 18             	add    $0x18,%esp
+    18c0:	68 d2 6e 00 00       	push   $0x6ed2
+    18c5:	ff 35 d4 9e 00 00    	push   0x9ed4
+    18cb:	e8 f0 4c 00 00       	call   65c0 <printf>
+}
+    18d0:	83 c4 10             	add    $0x10,%esp
+    18d3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    18d6:	5b                   	pop    %ebx
+    18d7:	5e                   	pop    %esi
+    18d8:	5f                   	pop    %edi
+    18d9:	5d                   	pop    %ebp
+    18da:	c3                   	ret
+        printf(stdout, "wsbench page %d corrupt\n", i);
+    18db:	83 ec 04             	sub    $0x4,%esp
+    18de:	50                   	push   %eax
+    18df:	68 b9 6e 00 00       	push   $0x6eb9
+    18e4:	ff 35 d4 9e 00 00    	push   0x9ed4
+    18ea:	e8 d1 4c 00 00       	call   65c0 <printf>
+        exit();
+    18ef:	e8 5f 4b 00 00       	call   6453 <exit>
+    printf(stdout, "wsbench sbrk failed\n");
+    18f4:	52                   	push   %edx
+    18f5:	52                   	push   %edx
+    18f6:	68 a4 6e 00 00       	push   $0x6ea4
+    18fb:	ff 35 d4 9e 00 00    	push   0x9ed4
+    1901:	e8 ba 4c 00 00       	call   65c0 <printf>
+    exit();
+    1906:	e8 48 4b 00 00       	call   6453 <exit>
+    printf(stdout, "wsbench: the cold array was never swapped in\n");
+    190b:	50                   	push   %eax
+    190c:	50                   	push   %eax
+    190d:	68 74 81 00 00       	push   $0x8174
+    1912:	ff 35 d4 9e 00 00    	push   0x9ed4
+    1918:	e8 a3 4c 00 00       	call   65c0 <printf>
+    exit();
+    191d:	e8 31 4b 00 00       	call   6453 <exit>
+    1922:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1929:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001930 <swapfulltest>:
+{
+    1930:	55                   	push   %ebp
+    1931:	89 e5                	mov    %esp,%ebp
+    1933:	53                   	push   %ebx
+    1934:	81 ec 1c 02 00 00    	sub    $0x21c,%esp
+  printf(stdout, "swapfull test\n");
+    193a:	68 de 6e 00 00       	push   $0x6ede
+    193f:	ff 35 d4 9e 00 00    	push   0x9ed4
+    1945:	e8 76 4c 00 00       	call   65c0 <printf>
+  getvmstat(&st0);
+    194a:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+    1950:	89 04 24             	mov    %eax,(%esp)
+    1953:	e8 ab 4b 00 00       	call   6503 <getvmstat>
+  pid = fork();
+    1958:	e8 ee 4a 00 00       	call   644b <fork>
+  if(pid < 0){
+    195d:	83 c4 10             	add    $0x10,%esp
+    1960:	85 c0                	test   %eax,%eax
+    1962:	78 59                	js     19bd <swapfulltest+0x8d>
+  if(pid == 0){
+    1964:	0f 84 95 00 00 00    	je     19ff <swapfulltest+0xcf>
+  wait();
+    196a:	e8 ec 4a 00 00       	call   645b <wait>
+  getvmstat(&st1);
+    196f:	83 ec 0c             	sub    $0xc,%esp
+    1972:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+    1978:	50                   	push   %eax
+    1979:	e8 85 4b 00 00       	call   6503 <getvmstat>
+  if(st1.swapfree + 64 < st0.swapfree){
+    197e:	8b 95 50 ff ff ff    	mov    -0xb0(%ebp),%edx
+    1984:	8b 85 48 fe ff ff    	mov    -0x1b8(%ebp),%eax
+    198a:	83 c4 10             	add    $0x10,%esp
+    198d:	8d 4a 40             	lea    0x40(%edx),%ecx
+    1990:	39 c1                	cmp    %eax,%ecx
+    1992:	72 52                	jb     19e6 <swapfulltest+0xb6>
+    printf(stdout, "swapfull: %d swap slots leaked\n", st0.swapfree - st1.swapfree);
+    1994:	a1 d4 9e 00 00       	mov    0x9ed4,%eax
+  if(st1.oomfails == st0.oomfails){
+    1999:	8b 8d 4c fe ff ff    	mov    -0x1b4(%ebp),%ecx
+    199f:	39 8d 54 ff ff ff    	cmp    %ecx,-0xac(%ebp)
+    19a5:	74 2d                	je     19d4 <swapfulltest+0xa4>
+  printf(stdout, "swapfull test ok\n");
+    19a7:	83 ec 08             	sub    $0x8,%esp
+    19aa:	68 20 6f 00 00       	push   $0x6f20
+    19af:	50                   	push   %eax
+    19b0:	e8 0b 4c 00 00       	call   65c0 <printf>
+}
+    19b5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    19b8:	83 c4 10             	add    $0x10,%esp
+    19bb:	c9                   	leave
+    19bc:	c3                   	ret
+    printf(stdout, "swapfull fork failed\n");
+    19bd:	50                   	push   %eax
+    19be:	50                   	push   %eax
+    19bf:	68 ed 6e 00 00       	push   $0x6eed
+    19c4:	ff 35 d4 9e 00 00    	push   0x9ed4
+    19ca:	e8 f1 4b 00 00       	call   65c0 <printf>
+    exit();
+    19cf:	e8 7f 4a 00 00       	call   6453 <exit>
+    printf(stdout, "swapfull: swap never filled\n");
+    19d4:	52                   	push   %edx
+    19d5:	52                   	push   %edx
+    19d6:	68 03 6f 00 00       	push   $0x6f03
+    19db:	50                   	push   %eax
+    19dc:	e8 df 4b 00 00       	call   65c0 <printf>
+    exit();
+    19e1:	e8 6d 4a 00 00       	call   6453 <exit>
+    printf(stdout, "swapfull: %d swap slots leaked\n", st0.swapfree - st1.swapfree);
+    19e6:	29 d0                	sub    %edx,%eax
+    19e8:	51                   	push   %ecx
+    19e9:	50                   	push   %eax
+    19ea:	68 f8 81 00 00       	push   $0x81f8
+    19ef:	ff 35 d4 9e 00 00    	push   0x9ed4
+    19f5:	e8 c6 4b 00 00       	call   65c0 <printf>
+    exit();
+    19fa:	e8 54 4a 00 00       	call   6453 <exit>
+    19ff:	89 c3                	mov    %eax,%ebx
+    1a01:	eb 05                	jmp    1a08 <swapfulltest+0xd8>
+      *a = n;
+    1a03:	88 18                	mov    %bl,(%eax)
+      n++;
+    1a05:	83 c3 01             	add    $0x1,%ebx
+    while((a = sbrk(4096)) != (char*)0xffffffff){
+    1a08:	83 ec 0c             	sub    $0xc,%esp
+    1a0b:	68 00 10 00 00       	push   $0x1000
+    1a10:	e8 c6 4a 00 00       	call   64db <sbrk>
+    1a15:	83 c4 10             	add    $0x10,%esp
+    1a18:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1a1b:	75 e6                	jne    1a03 <swapfulltest+0xd3>
+    printf(stdout, "swapfull: sbrk failed after %d pages\n", n);
+    1a1d:	50                   	push   %eax
+    1a1e:	53                   	push   %ebx
+    1a1f:	68 d0 81 00 00       	push   $0x81d0
+    1a24:	ff 35 d4 9e 00 00    	push   0x9ed4
+    1a2a:	e8 91 4b 00 00       	call   65c0 <printf>
+    exit();
+    1a2f:	e8 1f 4a 00 00       	call   6453 <exit>
+    1a34:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1a3b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1a3f:	90                   	nop
+
+00001a40 <swapcachetest>:
+{
+    1a40:	55                   	push   %ebp
+    1a41:	89 e5                	mov    %esp,%ebp
+    1a43:	57                   	push   %edi
+    1a44:	56                   	push   %esi
+    1a45:	53                   	push   %ebx
+    1a46:	81 ec 34 02 00 00    	sub    $0x234,%esp
+  printf(stdout, "swapcache test\n");
+    1a4c:	68 32 6f 00 00       	push   $0x6f32
+    1a51:	ff 35 d4 9e 00 00    	push   0x9ed4
+    1a57:	e8 64 4b 00 00       	call   65c0 <printf>
+  zs = vmtune(VM_ZSWAP, 0);
+    1a5c:	5e                   	pop    %esi
+    1a5d:	5f                   	pop    %edi
+    1a5e:	6a 00                	push   $0x0
+    1a60:	6a 05                	push   $0x5
+    1a62:	e8 a4 4a 00 00       	call   650b <vmtune>
+  getvmstat(&st0);
+    1a67:	8d 8d d8 fd ff ff    	lea    -0x228(%ebp),%ecx
+  zs = vmtune(VM_ZSWAP, 0);
+    1a6d:	89 85 d0 fd ff ff    	mov    %eax,-0x230(%ebp)
+  getvmstat(&st0);
+    1a73:	89 0c 24             	mov    %ecx,(%esp)
+    1a76:	e8 88 4a 00 00       	call   6503 <getvmstat>
+  npages = st0.freepages + OVERCOMMIT;
+    1a7b:	8b 85 d8 fd ff ff    	mov    -0x228(%ebp),%eax
+    1a81:	8d 90 80 00 00 00    	lea    0x80(%eax),%edx
+  a = sbrk(npages*4096);
+    1a87:	89 d7                	mov    %edx,%edi
+    1a89:	89 95 d4 fd ff ff    	mov    %edx,-0x22c(%ebp)
+    1a8f:	c1 e7 0c             	shl    $0xc,%edi
+    1a92:	89 3c 24             	mov    %edi,(%esp)
+    1a95:	e8 41 4a 00 00       	call   64db <sbrk>
+  if(a == (char*)0xffffffff){
+    1a9a:	83 c4 10             	add    $0x10,%esp
+    1a9d:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1aa0:	0f 84 30 01 00 00    	je     1bd6 <swapcachetest+0x196>
+  for(i = 0; i < npages; i++)
+    1aa6:	8b 95 d4 fd ff ff    	mov    -0x22c(%ebp),%edx
+    1aac:	89 c6                	mov    %eax,%esi
+    1aae:	31 c0                	xor    %eax,%eax
+    1ab0:	8d 8d d8 fd ff ff    	lea    -0x228(%ebp),%ecx
+    1ab6:	85 d2                	test   %edx,%edx
+    1ab8:	0f 8e ee 00 00 00    	jle    1bac <swapcachetest+0x16c>
+    1abe:	66 90                	xchg   %ax,%ax
+    a[i*4096] = i;
+    1ac0:	89 c3                	mov    %eax,%ebx
+    1ac2:	c1 e3 0c             	shl    $0xc,%ebx
+    1ac5:	88 04 1e             	mov    %al,(%esi,%ebx,1)
+  for(i = 0; i < npages; i++)
+    1ac8:	89 c3                	mov    %eax,%ebx
+    1aca:	8d 40 01             	lea    0x1(%eax),%eax
+    1acd:	39 c2                	cmp    %eax,%edx
+    1acf:	75 ef                	jne    1ac0 <swapcachetest+0x80>
+  getvmstat(&st0);
+    1ad1:	83 ec 0c             	sub    $0xc,%esp
+    1ad4:	51                   	push   %ecx
+    1ad5:	e8 29 4a 00 00       	call   6503 <getvmstat>
+    1ada:	83 c4 10             	add    $0x10,%esp
+    for(i = 0; i < npages; i++){
+    1add:	31 c0                	xor    %eax,%eax
+    1adf:	eb 09                	jmp    1aea <swapcachetest+0xaa>
+    1ae1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1ae8:	89 d0                	mov    %edx,%eax
+      if(a[i*4096] != (char)i){
+    1aea:	89 c2                	mov    %eax,%edx
+    1aec:	c1 e2 0c             	shl    $0xc,%edx
+    1aef:	38 04 16             	cmp    %al,(%esi,%edx,1)
+    1af2:	0f 85 c5 00 00 00    	jne    1bbd <swapcachetest+0x17d>
+    for(i = 0; i < npages; i++){
+    1af8:	8d 50 01             	lea    0x1(%eax),%edx
+    1afb:	39 d8                	cmp    %ebx,%eax
+    1afd:	75 e9                	jne    1ae8 <swapcachetest+0xa8>
+    1aff:	31 c0                	xor    %eax,%eax
+    1b01:	eb 07                	jmp    1b0a <swapcachetest+0xca>
+    1b03:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1b07:	90                   	nop
+    1b08:	89 d0                	mov    %edx,%eax
+      if(a[i*4096] != (char)i){
+    1b0a:	89 c2                	mov    %eax,%edx
+    1b0c:	c1 e2 0c             	shl    $0xc,%edx
+    1b0f:	38 04 16             	cmp    %al,(%esi,%edx,1)
+    1b12:	0f 85 a5 00 00 00    	jne    1bbd <swapcachetest+0x17d>
+    for(i = 0; i < npages; i++){
+    1b18:	8d 50 01             	lea    0x1(%eax),%edx
+    1b1b:	39 d8                	cmp    %ebx,%eax
+    1b1d:	75 e9                	jne    1b08 <swapcachetest+0xc8>
+  getvmstat(&st1);
+    1b1f:	83 ec 0c             	sub    $0xc,%esp
+    1b22:	8d 85 e0 fe ff ff    	lea    -0x120(%ebp),%eax
+  sbrk(-npages*4096);
+    1b28:	f7 df                	neg    %edi
+  getvmstat(&st1);
+    1b2a:	50                   	push   %eax
+    1b2b:	e8 d3 49 00 00       	call   6503 <getvmstat>
+  sbrk(-npages*4096);
+    1b30:	89 3c 24             	mov    %edi,(%esp)
+    1b33:	e8 a3 49 00 00       	call   64db <sbrk>
+  vmtune(VM_ZSWAP, zs);
+    1b38:	5a                   	pop    %edx
+    1b39:	59                   	pop    %ecx
+    1b3a:	ff b5 d0 fd ff ff    	push   -0x230(%ebp)
+    1b40:	6a 05                	push   $0x5
+    1b42:	e8 c4 49 00 00       	call   650b <vmtune>
+  if(st1.swapcleandrops == st0.swapcleandrops){
+    1b47:	8b 85 4c ff ff ff    	mov    -0xb4(%ebp),%eax
+    1b4d:	8b 95 44 fe ff ff    	mov    -0x1bc(%ebp),%edx
+    1b53:	83 c4 10             	add    $0x10,%esp
+    1b56:	39 d0                	cmp    %edx,%eax
+    1b58:	0f 84 8f 00 00 00    	je     1bed <swapcachetest+0x1ad>
+  printf(stdout, "swapcache: %d swap-ins, %d swap-outs, %d without a write\n",
+    1b5e:	83 ec 0c             	sub    $0xc,%esp
+    1b61:	29 d0                	sub    %edx,%eax
+    1b63:	50                   	push   %eax
+    1b64:	8b 85 14 ff ff ff    	mov    -0xec(%ebp),%eax
+    1b6a:	2b 85 0c fe ff ff    	sub    -0x1f4(%ebp),%eax
+    1b70:	50                   	push   %eax
+    1b71:	8b 85 18 ff ff ff    	mov    -0xe8(%ebp),%eax
+    1b77:	2b 85 10 fe ff ff    	sub    -0x1f0(%ebp),%eax
+    1b7d:	50                   	push   %eax
+    1b7e:	68 44 82 00 00       	push   $0x8244
+    1b83:	ff 35 d4 9e 00 00    	push   0x9ed4
+    1b89:	e8 32 4a 00 00       	call   65c0 <printf>
+  printf(stdout, "swapcache test ok\n");
+    1b8e:	83 c4 18             	add    $0x18,%esp
+    1b91:	68 74 6f 00 00       	push   $0x6f74
+    1b96:	ff 35 d4 9e 00 00    	push   0x9ed4
+    1b9c:	e8 1f 4a 00 00       	call   65c0 <printf>
+}
+    1ba1:	83 c4 10             	add    $0x10,%esp
+    1ba4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1ba7:	5b                   	pop    %ebx
+    1ba8:	5e                   	pop    %esi
+    1ba9:	5f                   	pop    %edi
+    1baa:	5d                   	pop    %ebp
+    1bab:	c3                   	ret
+  getvmstat(&st0);
+    1bac:	83 ec 0c             	sub    $0xc,%esp
+    1baf:	51                   	push   %ecx
+    1bb0:	e8 4e 49 00 00       	call   6503 <getvmstat>
+    1bb5:	83 c4 10             	add    $0x10,%esp
+    1bb8:	e9 62 ff ff ff       	jmp    1b1f <swapcachetest+0xdf>
+        printf(stdout, "swapcache page %d corrupt\n", i);
+    1bbd:	83 ec 04             	sub    $0x4,%esp
+    1bc0:	50                   	push   %eax
+    1bc1:	68 59 6f 00 00       	push   $0x6f59
+    1bc6:	ff 35 d4 9e 00 00    	push   0x9ed4
+    1bcc:	e8 ef 49 00 00       	call   65c0 <printf>
+        exit();
+    1bd1:	e8 7d 48 00 00       	call   6453 <exit>
+    printf(stdout, "swapcache sbrk failed\n");
+    1bd6:	53                   	push   %ebx
+    1bd7:	53                   	push   %ebx
+    1bd8:	68 42 6f 00 00       	push   $0x6f42
+    1bdd:	ff 35 d4 9e 00 00    	push   0x9ed4
+    1be3:	e8 d8 49 00 00       	call   65c0 <printf>
+    exit();
+    1be8:	e8 66 48 00 00       	call   6453 <exit>
+    printf(stdout, "swapcache: clean pages were written again\n");
+    1bed:	50                   	push   %eax
+    1bee:	50                   	push   %eax
+    1bef:	68 18 82 00 00       	push   $0x8218
+    1bf4:	ff 35 d4 9e 00 00    	push   0x9ed4
+    1bfa:	e8 c1 49 00 00       	call   65c0 <printf>
+    exit();
+    1bff:	e8 4f 48 00 00       	call   6453 <exit>
+    1c04:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1c0b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1c0f:	90                   	nop
+
+00001c10 <readaheadbench>:
+{
+    1c10:	55                   	push   %ebp
+    1c11:	89 e5                	mov    %esp,%ebp
+    1c13:	57                   	push   %edi
+    1c14:	56                   	push   %esi
+    1c15:	53                   	push   %ebx
+    1c16:	81 ec 44 02 00 00    	sub    $0x244,%esp
+  printf(stdout, "readahead bench\n");
+    1c1c:	68 87 6f 00 00       	push   $0x6f87
+    1c21:	ff 35 d4 9e 00 00    	push   0x9ed4
+    1c27:	e8 94 49 00 00       	call   65c0 <printf>
+  zs = vmtune(VM_ZSWAP, 0);
+    1c2c:	58                   	pop    %eax
+    1c2d:	5a                   	pop    %edx
+    1c2e:	6a 00                	push   $0x0
+    1c30:	6a 05                	push   $0x5
+    1c32:	e8 d4 48 00 00       	call   650b <vmtune>
+    1c37:	89 85 bc fd ff ff    	mov    %eax,-0x244(%ebp)
+  getvmstat(&st0);
+    1c3d:	8d 85 d8 fd ff ff    	lea    -0x228(%ebp),%eax
+    1c43:	89 04 24             	mov    %eax,(%esp)
+    1c46:	e8 b8 48 00 00       	call   6503 <getvmstat>
+  npages = st0.freepages + OVERCOMMIT;
+    1c4b:	8b 85 d8 fd ff ff    	mov    -0x228(%ebp),%eax
+    1c51:	8d b0 80 00 00 00    	lea    0x80(%eax),%esi
+  a = sbrk(npages*4096);
+    1c57:	89 f7                	mov    %esi,%edi
+    1c59:	c1 e7 0c             	shl    $0xc,%edi
+    1c5c:	89 3c 24             	mov    %edi,(%esp)
+    1c5f:	e8 77 48 00 00       	call   64db <sbrk>
+  if(a == (char*)0xffffffff){
+    1c64:	83 c4 10             	add    $0x10,%esp
+    1c67:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1c6a:	0f 84 c5 01 00 00    	je     1e35 <readaheadbench+0x225>
+    1c70:	89 c3                	mov    %eax,%ebx
+  for(i = 0; i < npages; i++)
+    1c72:	31 c0                	xor    %eax,%eax
+    1c74:	85 f6                	test   %esi,%esi
+    1c76:	7e 17                	jle    1c8f <readaheadbench+0x7f>
+    1c78:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1c7f:	90                   	nop
+    a[i*4096] = i;
+    1c80:	89 c2                	mov    %eax,%edx
+    1c82:	c1 e2 0c             	shl    $0xc,%edx
+    1c85:	88 04 13             	mov    %al,(%ebx,%edx,1)
+  for(i = 0; i < npages; i++)
+    1c88:	83 c0 01             	add    $0x1,%eax
+    1c8b:	39 c6                	cmp    %eax,%esi
+    1c8d:	75 f1                	jne    1c80 <readaheadbench+0x70>
+  old = vmtune(VM_READAHEAD, -1);
+    1c8f:	83 ec 08             	sub    $0x8,%esp
+    1c92:	6a ff                	push   $0xffffffff
+    1c94:	6a 03                	push   $0x3
+    1c96:	e8 70 48 00 00       	call   650b <vmtune>
+    1c9b:	89 bd b8 fd ff ff    	mov    %edi,-0x248(%ebp)
+    1ca1:	83 c4 10             	add    $0x10,%esp
+    1ca4:	89 85 c0 fd ff ff    	mov    %eax,-0x240(%ebp)
+  for(k = 0; k < 2; k++){
+    1caa:	c7 85 d0 fd ff ff 00 	movl   $0x0,-0x230(%ebp)
+    1cb1:	00 00 00 
+    win = (k == 0) ? 1 : old;
+    1cb4:	c7 85 d4 fd ff ff 01 	movl   $0x1,-0x22c(%ebp)
+    1cbb:	00 00 00 
+    vmtune(VM_READAHEAD, win);
+    1cbe:	83 ec 08             	sub    $0x8,%esp
+    1cc1:	ff b5 d4 fd ff ff    	push   -0x22c(%ebp)
+    1cc7:	6a 03                	push   $0x3
+    1cc9:	e8 3d 48 00 00       	call   650b <vmtune>
+    getvmstat(&st0);
+    1cce:	8d 85 d8 fd ff ff    	lea    -0x228(%ebp),%eax
+    1cd4:	89 04 24             	mov    %eax,(%esp)
+    1cd7:	e8 27 48 00 00       	call   6503 <getvmstat>
+    t0 = uptime();
+    1cdc:	e8 0a 48 00 00       	call   64eb <uptime>
+    for(i = 0; i < npages; i++){
+    1ce1:	83 c4 10             	add    $0x10,%esp
+    t0 = uptime();
+    1ce4:	89 85 cc fd ff ff    	mov    %eax,-0x234(%ebp)
+    for(i = 0; i < npages; i++){
+    1cea:	85 f6                	test   %esi,%esi
+    1cec:	7e 17                	jle    1d05 <readaheadbench+0xf5>
+    1cee:	31 c0                	xor    %eax,%eax
+      if(a[i*4096] != (char)i){
+    1cf0:	89 c2                	mov    %eax,%edx
+    1cf2:	c1 e2 0c             	shl    $0xc,%edx
+    1cf5:	38 04 13             	cmp    %al,(%ebx,%edx,1)
+    1cf8:	0f 85 1e 01 00 00    	jne    1e1c <readaheadbench+0x20c>
+    for(i = 0; i < npages; i++){
+    1cfe:	83 c0 01             	add    $0x1,%eax
+    1d01:	39 c6                	cmp    %eax,%esi
+    1d03:	75 eb                	jne    1cf0 <readaheadbench+0xe0>
+    getvmstat(&st1);
+    1d05:	83 ec 0c             	sub    $0xc,%esp
+    1d08:	8d 85 e0 fe ff ff    	lea    -0x120(%ebp),%eax
+    1d0e:	50                   	push   %eax
+    1d0f:	e8 ef 47 00 00       	call   6503 <getvmstat>
+    if(st1.swapins == st0.swapins){
+    1d14:	8b 85 10 fe ff ff    	mov    -0x1f0(%ebp),%eax
+    1d1a:	83 c4 10             	add    $0x10,%esp
+    1d1d:	39 85 18 ff ff ff    	cmp    %eax,-0xe8(%ebp)
+    1d23:	0f 84 23 01 00 00    	je     1e4c <readaheadbench+0x23c>
+    printf(stdout, "readahead window %d: %d faults %d swap-ins in %d ticks, "
+    1d29:	8b 8d 60 ff ff ff    	mov    -0xa0(%ebp),%ecx
+    1d2f:	8b 95 5c ff ff ff    	mov    -0xa4(%ebp),%edx
+    1d35:	2b 8d 58 fe ff ff    	sub    -0x1a8(%ebp),%ecx
+    1d3b:	2b 95 54 fe ff ff    	sub    -0x1ac(%ebp),%edx
+    1d41:	89 8d c4 fd ff ff    	mov    %ecx,-0x23c(%ebp)
+    1d47:	8b bd 58 ff ff ff    	mov    -0xa8(%ebp),%edi
+    1d4d:	89 95 c8 fd ff ff    	mov    %edx,-0x238(%ebp)
+    1d53:	2b bd 50 fe ff ff    	sub    -0x1b0(%ebp),%edi
+           uptime() - t0, st1.rapages - st0.rapages,
+    1d59:	e8 8d 47 00 00       	call   64eb <uptime>
+    printf(stdout, "readahead window %d: %d faults %d swap-ins in %d ticks, "
+    1d5e:	8b 8d c4 fd ff ff    	mov    -0x23c(%ebp),%ecx
+    1d64:	83 ec 0c             	sub    $0xc,%esp
+    1d67:	51                   	push   %ecx
+    1d68:	8b 95 c8 fd ff ff    	mov    -0x238(%ebp),%edx
+    1d6e:	52                   	push   %edx
+    1d6f:	57                   	push   %edi
+    1d70:	8b 8d cc fd ff ff    	mov    -0x234(%ebp),%ecx
+    1d76:	29 c8                	sub    %ecx,%eax
+    1d78:	50                   	push   %eax
+    1d79:	8b 85 18 ff ff ff    	mov    -0xe8(%ebp),%eax
+    1d7f:	2b 85 10 fe ff ff    	sub    -0x1f0(%ebp),%eax
+    1d85:	50                   	push   %eax
+    1d86:	8b 85 30 ff ff ff    	mov    -0xd0(%ebp),%eax
+    1d8c:	2b 85 28 fe ff ff    	sub    -0x1d8(%ebp),%eax
+    1d92:	50                   	push   %eax
+    1d93:	ff b5 d4 fd ff ff    	push   -0x22c(%ebp)
+    1d99:	68 b0 82 00 00       	push   $0x82b0
+    1d9e:	ff 35 d4 9e 00 00    	push   0x9ed4
+    1da4:	e8 17 48 00 00       	call   65c0 <printf>
+  for(k = 0; k < 2; k++){
+    1da9:	83 c4 30             	add    $0x30,%esp
+    1dac:	83 bd d0 fd ff ff 01 	cmpl   $0x1,-0x230(%ebp)
+    1db3:	74 1b                	je     1dd0 <readaheadbench+0x1c0>
+    1db5:	c7 85 d0 fd ff ff 01 	movl   $0x1,-0x230(%ebp)
+    1dbc:	00 00 00 
+    win = (k == 0) ? 1 : old;
+    1dbf:	8b 85 c0 fd ff ff    	mov    -0x240(%ebp),%eax
+    1dc5:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+    1dcb:	e9 ee fe ff ff       	jmp    1cbe <readaheadbench+0xae>
+  vmtune(VM_READAHEAD, old);
+    1dd0:	83 ec 08             	sub    $0x8,%esp
+    1dd3:	8b bd b8 fd ff ff    	mov    -0x248(%ebp),%edi
+    1dd9:	ff b5 c0 fd ff ff    	push   -0x240(%ebp)
+    1ddf:	6a 03                	push   $0x3
+  sbrk(-npages*4096);
+    1de1:	f7 df                	neg    %edi
+  vmtune(VM_READAHEAD, old);
+    1de3:	e8 23 47 00 00       	call   650b <vmtune>
+  vmtune(VM_ZSWAP, zs);
+    1de8:	58                   	pop    %eax
+    1de9:	5a                   	pop    %edx
+    1dea:	ff b5 bc fd ff ff    	push   -0x244(%ebp)
+    1df0:	6a 05                	push   $0x5
+    1df2:	e8 14 47 00 00       	call   650b <vmtune>
+  sbrk(-npages*4096);
+    1df7:	89 3c 24             	mov    %edi,(%esp)
+    1dfa:	e8 dc 46 00 00       	call   64db <sbrk>
+  printf(stdout, "readahead bench ok\n");
+    1dff:	59                   	pop    %ecx
+    1e00:	5b                   	pop    %ebx
+    1e01:	68 ca 6f 00 00       	push   $0x6fca
+    1e06:	ff 35 d4 9e 00 00    	push   0x9ed4
+    1e0c:	e8 af 47 00 00       	call   65c0 <printf>
+}
+    1e11:	83 c4 10             	add    $0x10,%esp
+    1e14:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1e17:	5b                   	pop    %ebx
+    1e18:	5e                   	pop    %esi
+    1e19:	5f                   	pop    %edi
+    1e1a:	5d                   	pop    %ebp
+    1e1b:	c3                   	ret
+        printf(stdout, "readahead page %d corrupt\n", i);
+    1e1c:	83 ec 04             	sub    $0x4,%esp
+    1e1f:	50                   	push   %eax
+    1e20:	68 af 6f 00 00       	push   $0x6faf
+    1e25:	ff 35 d4 9e 00 00    	push   0x9ed4
+    1e2b:	e8 90 47 00 00       	call   65c0 <printf>
+        exit();
+    1e30:	e8 1e 46 00 00       	call   6453 <exit>
+    printf(stdout, "readahead sbrk failed\n");
+    1e35:	57                   	push   %edi
+    1e36:	57                   	push   %edi
+    1e37:	68 98 6f 00 00       	push   $0x6f98
+    1e3c:	ff 35 d4 9e 00 00    	push   0x9ed4
+    1e42:	e8 79 47 00 00       	call   65c0 <printf>
+    exit();
+    1e47:	e8 07 46 00 00       	call   6453 <exit>
+      printf(stdout, "readahead window %d: nothing was swapped in\n", win);
+    1e4c:	56                   	push   %esi
+    1e4d:	ff b5 d4 fd ff ff    	push   -0x22c(%ebp)
+    1e53:	68 80 82 00 00       	push   $0x8280
+    1e58:	ff 35 d4 9e 00 00    	push   0x9ed4
+    1e5e:	e8 5d 47 00 00       	call   65c0 <printf>
+      exit();
+    1e63:	e8 eb 45 00 00       	call   6453 <exit>
+    1e68:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1e6f:	90                   	nop
+
+00001e70 <clusterbench>:
+{
+    1e70:	55                   	push   %ebp
+    1e71:	89 e5                	mov    %esp,%ebp
+    1e73:	57                   	push   %edi
+    1e74:	56                   	push   %esi
+    1e75:	53                   	push   %ebx
+    1e76:	81 ec 54 03 00 00    	sub    $0x354,%esp
+  printf(stdout, "cluster bench\n");
+    1e7c:	68 de 6f 00 00       	push   $0x6fde
+    1e81:	ff 35 d4 9e 00 00    	push   0x9ed4
+    1e87:	e8 34 47 00 00       	call   65c0 <printf>
+  zs = vmtune(VM_ZSWAP, 0);
+    1e8c:	58                   	pop    %eax
+    1e8d:	5a                   	pop    %edx
+    1e8e:	6a 00                	push   $0x0
+    1e90:	6a 05                	push   $0x5
+    1e92:	e8 74 46 00 00       	call   650b <vmtune>
+  old = vmtune(VM_CLUSTER, -1);
+    1e97:	59                   	pop    %ecx
+    1e98:	5b                   	pop    %ebx
+    1e99:	6a ff                	push   $0xffffffff
+    1e9b:	6a 04                	push   $0x4
+  zs = vmtune(VM_ZSWAP, 0);
+    1e9d:	89 c7                	mov    %eax,%edi
+  old = vmtune(VM_CLUSTER, -1);
+    1e9f:	e8 67 46 00 00       	call   650b <vmtune>
+    1ea4:	89 bd b0 fc ff ff    	mov    %edi,-0x350(%ebp)
+    1eaa:	83 c4 10             	add    $0x10,%esp
+    1ead:	89 85 b4 fc ff ff    	mov    %eax,-0x34c(%ebp)
+  for(k = 0; k < 2; k++){
+    1eb3:	c7 85 c0 fc ff ff 00 	movl   $0x0,-0x340(%ebp)
+    1eba:	00 00 00 
+    size = (k == 0) ? 1 : old;
+    1ebd:	c7 85 c4 fc ff ff 01 	movl   $0x1,-0x33c(%ebp)
+    1ec4:	00 00 00 
+    vmtune(VM_CLUSTER, size);
+    1ec7:	83 ec 08             	sub    $0x8,%esp
+    1eca:	ff b5 c4 fc ff ff    	push   -0x33c(%ebp)
+    1ed0:	6a 04                	push   $0x4
+    1ed2:	e8 34 46 00 00       	call   650b <vmtune>
+    getvmstat(&st0);
+    1ed7:	8d 85 d0 fc ff ff    	lea    -0x330(%ebp),%eax
+    1edd:	89 04 24             	mov    %eax,(%esp)
+    1ee0:	e8 1e 46 00 00       	call   6503 <getvmstat>
+    npages = st0.freepages + OVERCOMMIT;
+    1ee5:	8b 85 d0 fc ff ff    	mov    -0x330(%ebp),%eax
+    1eeb:	8d 98 80 00 00 00    	lea    0x80(%eax),%ebx
+    t0 = uptime();
+    1ef1:	e8 f5 45 00 00       	call   64eb <uptime>
+    a = sbrk(npages*4096);
+    1ef6:	89 de                	mov    %ebx,%esi
+    1ef8:	c1 e6 0c             	shl    $0xc,%esi
+    t0 = uptime();
+    1efb:	89 85 bc fc ff ff    	mov    %eax,-0x344(%ebp)
+    a = sbrk(npages*4096);
+    1f01:	89 34 24             	mov    %esi,(%esp)
+    1f04:	e8 d2 45 00 00       	call   64db <sbrk>
+    if(a == (char*)0xffffffff){
+    1f09:	83 c4 10             	add    $0x10,%esp
+    a = sbrk(npages*4096);
+    1f0c:	89 c2                	mov    %eax,%edx
+    if(a == (char*)0xffffffff){
+    1f0e:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1f11:	0f 84 b9 01 00 00    	je     20d0 <clusterbench+0x260>
+    for(i = 0; i < npages; i++)
+    1f17:	31 c0                	xor    %eax,%eax
+    1f19:	85 db                	test   %ebx,%ebx
+    1f1b:	0f 8e 5c 01 00 00    	jle    207d <clusterbench+0x20d>
+    1f21:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      a[i*4096] = i;
+    1f28:	89 c1                	mov    %eax,%ecx
+    1f2a:	89 c7                	mov    %eax,%edi
+    1f2c:	c1 e1 0c             	shl    $0xc,%ecx
+    1f2f:	88 04 0a             	mov    %al,(%edx,%ecx,1)
+    for(i = 0; i < npages; i++)
+    1f32:	8d 40 01             	lea    0x1(%eax),%eax
+    1f35:	39 c3                	cmp    %eax,%ebx
+    1f37:	75 ef                	jne    1f28 <clusterbench+0xb8>
+    getvmstat(&st1);
+    1f39:	83 ec 0c             	sub    $0xc,%esp
+    1f3c:	8d 85 d8 fd ff ff    	lea    -0x228(%ebp),%eax
+    1f42:	89 95 b8 fc ff ff    	mov    %edx,-0x348(%ebp)
+    1f48:	50                   	push   %eax
+    1f49:	e8 b5 45 00 00       	call   6503 <getvmstat>
+    t1 = uptime();
+    1f4e:	e8 98 45 00 00       	call   64eb <uptime>
+    1f53:	8b 95 b8 fc ff ff    	mov    -0x348(%ebp),%edx
+    1f59:	83 c4 10             	add    $0x10,%esp
+    1f5c:	89 c3                	mov    %eax,%ebx
+    for(i = 0; i < npages; i++){
+    1f5e:	31 c0                	xor    %eax,%eax
+    1f60:	eb 08                	jmp    1f6a <clusterbench+0xfa>
+    1f62:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    1f68:	89 c8                	mov    %ecx,%eax
+      if(a[i*4096] != (char)i){
+    1f6a:	89 c1                	mov    %eax,%ecx
+    1f6c:	c1 e1 0c             	shl    $0xc,%ecx
+    1f6f:	38 04 0a             	cmp    %al,(%edx,%ecx,1)
+    1f72:	0f 85 23 01 00 00    	jne    209b <clusterbench+0x22b>
+    for(i = 0; i < npages; i++){
+    1f78:	8d 48 01             	lea    0x1(%eax),%ecx
+    1f7b:	39 c7                	cmp    %eax,%edi
+    1f7d:	75 e9                	jne    1f68 <clusterbench+0xf8>
+    getvmstat(&st2);
+    1f7f:	83 ec 0c             	sub    $0xc,%esp
+    1f82:	8d 85 e0 fe ff ff    	lea    -0x120(%ebp),%eax
+    sbrk(-npages*4096);
+    1f88:	f7 de                	neg    %esi
+    getvmstat(&st2);
+    1f8a:	50                   	push   %eax
+    1f8b:	e8 73 45 00 00       	call   6503 <getvmstat>
+    sbrk(-npages*4096);
+    1f90:	89 34 24             	mov    %esi,(%esp)
+    1f93:	e8 43 45 00 00       	call   64db <sbrk>
+    if(st1.swapouts == st0.swapouts){
+    1f98:	8b 85 04 fd ff ff    	mov    -0x2fc(%ebp),%eax
+    1f9e:	83 c4 10             	add    $0x10,%esp
+    1fa1:	39 85 0c fe ff ff    	cmp    %eax,-0x1f4(%ebp)
+    1fa7:	0f 84 07 01 00 00    	je     20b4 <clusterbench+0x244>
+    if(size > 1 && st1.clusters == st0.clusters){
+    1fad:	83 bd c4 fc ff ff 01 	cmpl   $0x1,-0x33c(%ebp)
+    1fb4:	7e 12                	jle    1fc8 <clusterbench+0x158>
+    1fb6:	8b 85 58 fd ff ff    	mov    -0x2a8(%ebp),%eax
+    1fbc:	39 85 60 fe ff ff    	cmp    %eax,-0x1a0(%ebp)
+    1fc2:	0f 84 1f 01 00 00    	je     20e7 <clusterbench+0x277>
+    printf(stdout, "cluster size %d: fill %d ticks, %d swap-outs in %d clusters; "
+    1fc8:	8b b5 30 ff ff ff    	mov    -0xd0(%ebp),%esi
+    1fce:	2b b5 28 fe ff ff    	sub    -0x1d8(%ebp),%esi
+           uptime() - t1, st2.pgfaults - st1.pgfaults);
+    1fd4:	e8 12 45 00 00       	call   64eb <uptime>
+    printf(stdout, "cluster size %d: fill %d ticks, %d swap-outs in %d clusters; "
+    1fd9:	56                   	push   %esi
+    1fda:	29 d8                	sub    %ebx,%eax
+    1fdc:	50                   	push   %eax
+    1fdd:	8b 85 60 fe ff ff    	mov    -0x1a0(%ebp),%eax
+    1fe3:	2b 85 58 fd ff ff    	sub    -0x2a8(%ebp),%eax
+    1fe9:	50                   	push   %eax
+    1fea:	8b 85 0c fe ff ff    	mov    -0x1f4(%ebp),%eax
+    1ff0:	2b 85 04 fd ff ff    	sub    -0x2fc(%ebp),%eax
+    1ff6:	50                   	push   %eax
+    1ff7:	8b 85 bc fc ff ff    	mov    -0x344(%ebp),%eax
+    1ffd:	29 c3                	sub    %eax,%ebx
+    1fff:	53                   	push   %ebx
+    2000:	ff b5 c4 fc ff ff    	push   -0x33c(%ebp)
+    2006:	68 64 83 00 00       	push   $0x8364
+    200b:	ff 35 d4 9e 00 00    	push   0x9ed4
+    2011:	e8 aa 45 00 00       	call   65c0 <printf>
+  for(k = 0; k < 2; k++){
+    2016:	83 c4 20             	add    $0x20,%esp
+    2019:	83 bd c0 fc ff ff 01 	cmpl   $0x1,-0x340(%ebp)
+    2020:	74 1e                	je     2040 <clusterbench+0x1d0>
+    2022:	c7 85 c0 fc ff ff 01 	movl   $0x1,-0x340(%ebp)
+    2029:	00 00 00 
+    size = (k == 0) ? 1 : old;
+    202c:	8b 85 b4 fc ff ff    	mov    -0x34c(%ebp),%eax
+    2032:	89 85 c4 fc ff ff    	mov    %eax,-0x33c(%ebp)
+    2038:	e9 8a fe ff ff       	jmp    1ec7 <clusterbench+0x57>
+    203d:	8d 76 00             	lea    0x0(%esi),%esi
+  vmtune(VM_CLUSTER, old);
+    2040:	83 ec 08             	sub    $0x8,%esp
+    2043:	8b bd b0 fc ff ff    	mov    -0x350(%ebp),%edi
+    2049:	ff b5 b4 fc ff ff    	push   -0x34c(%ebp)
+    204f:	6a 04                	push   $0x4
+    2051:	e8 b5 44 00 00       	call   650b <vmtune>
+  vmtune(VM_ZSWAP, zs);
+    2056:	58                   	pop    %eax
+    2057:	5a                   	pop    %edx
+    2058:	57                   	push   %edi
+    2059:	6a 05                	push   $0x5
+    205b:	e8 ab 44 00 00       	call   650b <vmtune>
+  printf(stdout, "cluster bench ok\n");
+    2060:	59                   	pop    %ecx
+    2061:	5b                   	pop    %ebx
+    2062:	68 1b 70 00 00       	push   $0x701b
+    2067:	ff 35 d4 9e 00 00    	push   0x9ed4
+    206d:	e8 4e 45 00 00       	call   65c0 <printf>
+}
+    2072:	83 c4 10             	add    $0x10,%esp
+    2075:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    2078:	5b                   	pop    %ebx
+    2079:	5e                   	pop    %esi
+    207a:	5f                   	pop    %edi
+    207b:	5d                   	pop    %ebp
+    207c:	c3                   	ret
+    getvmstat(&st1);
+    207d:	83 ec 0c             	sub    $0xc,%esp
+    2080:	8d 85 d8 fd ff ff    	lea    -0x228(%ebp),%eax
+    2086:	50                   	push   %eax
+    2087:	e8 77 44 00 00       	call   6503 <getvmstat>
+    t1 = uptime();
+    208c:	e8 5a 44 00 00       	call   64eb <uptime>
+    2091:	83 c4 10             	add    $0x10,%esp
+    2094:	89 c3                	mov    %eax,%ebx
+    for(i = 0; i < npages; i++){
+    2096:	e9 e4 fe ff ff       	jmp    1f7f <clusterbench+0x10f>
+        printf(stdout, "cluster page %d corrupt\n", i);
+    209b:	83 ec 04             	sub    $0x4,%esp
+    209e:	50                   	push   %eax
+    209f:	68 02 70 00 00       	push   $0x7002
+    20a4:	ff 35 d4 9e 00 00    	push   0x9ed4
+    20aa:	e8 11 45 00 00       	call   65c0 <printf>
+        exit();
+    20af:	e8 9f 43 00 00       	call   6453 <exit>
+      printf(stdout, "cluster size %d: nothing was swapped out\n", size);
+    20b4:	57                   	push   %edi
+    20b5:	ff b5 c4 fc ff ff    	push   -0x33c(%ebp)
+    20bb:	68 0c 83 00 00       	push   $0x830c
+    20c0:	ff 35 d4 9e 00 00    	push   0x9ed4
+    20c6:	e8 f5 44 00 00       	call   65c0 <printf>
+      exit();
+    20cb:	e8 83 43 00 00       	call   6453 <exit>
+      printf(stdout, "cluster sbrk failed\n");
+    20d0:	50                   	push   %eax
+    20d1:	50                   	push   %eax
+    20d2:	68 ed 6f 00 00       	push   $0x6fed
+    20d7:	ff 35 d4 9e 00 00    	push   0x9ed4
+    20dd:	e8 de 44 00 00       	call   65c0 <printf>
+      exit();
+    20e2:	e8 6c 43 00 00       	call   6453 <exit>
+      printf(stdout, "cluster size %d: no swap-out was clustered\n", size);
+    20e7:	56                   	push   %esi
+    20e8:	ff b5 c4 fc ff ff    	push   -0x33c(%ebp)
+    20ee:	68 38 83 00 00       	push   $0x8338
+    20f3:	ff 35 d4 9e 00 00    	push   0x9ed4
+    20f9:	e8 c2 44 00 00       	call   65c0 <printf>
+      exit();
+    20fe:	e8 50 43 00 00       	call   6453 <exit>
+    2103:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    210a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00002110 <zswapbench>:
+{
+    2110:	55                   	push   %ebp
+    2111:	89 e5                	mov    %esp,%ebp
+    2113:	57                   	push   %edi
+    2114:	56                   	push   %esi
+    2115:	53                   	push   %ebx
+    2116:	81 ec 44 02 00 00    	sub    $0x244,%esp
+  printf(stdout, "zswap bench\n");
+    211c:	68 34 70 00 00       	push   $0x7034
+    2121:	ff 35 d4 9e 00 00    	push   0x9ed4
+    2127:	e8 94 44 00 00       	call   65c0 <printf>
+  old = vmtune(VM_ZSWAP, -1);
+    212c:	58                   	pop    %eax
+    212d:	5a                   	pop    %edx
+    212e:	6a ff                	push   $0xffffffff
+    2130:	6a 05                	push   $0x5
+    2132:	e8 d4 43 00 00       	call   650b <vmtune>
+    2137:	83 c4 10             	add    $0x10,%esp
+  for(k = 0; k < 2; k++){
+    213a:	c7 85 d4 fd ff ff 00 	movl   $0x0,-0x22c(%ebp)
+    2141:	00 00 00 
+    getvmstat(&st1);
+    2144:	89 85 c4 fd ff ff    	mov    %eax,-0x23c(%ebp)
+    vmtune(VM_ZSWAP, k);
+    214a:	83 ec 08             	sub    $0x8,%esp
+    214d:	ff b5 d4 fd ff ff    	push   -0x22c(%ebp)
+    2153:	6a 05                	push   $0x5
+    2155:	e8 b1 43 00 00       	call   650b <vmtune>
+    getvmstat(&st0);
+    215a:	8d 85 d8 fd ff ff    	lea    -0x228(%ebp),%eax
+    2160:	89 04 24             	mov    %eax,(%esp)
+    2163:	e8 9b 43 00 00       	call   6503 <getvmstat>
+    npages = st0.freepages + OVERCOMMIT;
+    2168:	8b 85 d8 fd ff ff    	mov    -0x228(%ebp),%eax
+    216e:	8d b8 80 00 00 00    	lea    0x80(%eax),%edi
+    a = sbrk(npages*4096);
+    2174:	89 fb                	mov    %edi,%ebx
+    2176:	c1 e3 0c             	shl    $0xc,%ebx
+    2179:	89 1c 24             	mov    %ebx,(%esp)
+    217c:	e8 5a 43 00 00       	call   64db <sbrk>
+    if(a == (char*)0xffffffff){
+    2181:	83 c4 10             	add    $0x10,%esp
+    a = sbrk(npages*4096);
+    2184:	89 c6                	mov    %eax,%esi
+    if(a == (char*)0xffffffff){
+    2186:	83 f8 ff             	cmp    $0xffffffff,%eax
+    2189:	0f 84 aa 01 00 00    	je     2339 <zswapbench+0x229>
+    getvmstat(&st0);
+    218f:	83 ec 0c             	sub    $0xc,%esp
+    2192:	8d 85 d8 fd ff ff    	lea    -0x228(%ebp),%eax
+    2198:	50                   	push   %eax
+    2199:	e8 65 43 00 00       	call   6503 <getvmstat>
+    t0 = uptime();
+    219e:	e8 48 43 00 00       	call   64eb <uptime>
+    for(i = 0; i < npages; i++)
+    21a3:	83 c4 10             	add    $0x10,%esp
+    t0 = uptime();
+    21a6:	89 85 d0 fd ff ff    	mov    %eax,-0x230(%ebp)
+    for(i = 0; i < npages; i++)
+    21ac:	85 ff                	test   %edi,%edi
+    21ae:	7e 37                	jle    21e7 <zswapbench+0xd7>
+    21b0:	31 c0                	xor    %eax,%eax
+    21b2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      a[i*4096] = i;
+    21b8:	89 c2                	mov    %eax,%edx
+    21ba:	c1 e2 0c             	shl    $0xc,%edx
+    21bd:	88 04 16             	mov    %al,(%esi,%edx,1)
+    for(i = 0; i < npages; i++)
+    21c0:	89 c2                	mov    %eax,%edx
+    21c2:	8d 40 01             	lea    0x1(%eax),%eax
+    21c5:	39 c7                	cmp    %eax,%edi
+    21c7:	75 ef                	jne    21b8 <zswapbench+0xa8>
+    for(i = 0; i < npages; i++){
+    21c9:	31 c0                	xor    %eax,%eax
+    21cb:	eb 05                	jmp    21d2 <zswapbench+0xc2>
+    21cd:	8d 76 00             	lea    0x0(%esi),%esi
+    21d0:	89 c8                	mov    %ecx,%eax
+      if(a[i*4096] != (char)i){
+    21d2:	89 c1                	mov    %eax,%ecx
+    21d4:	c1 e1 0c             	shl    $0xc,%ecx
+    21d7:	38 04 0e             	cmp    %al,(%esi,%ecx,1)
+    21da:	0f 85 40 01 00 00    	jne    2320 <zswapbench+0x210>
+    for(i = 0; i < npages; i++){
+    21e0:	8d 48 01             	lea    0x1(%eax),%ecx
+    21e3:	39 d0                	cmp    %edx,%eax
+    21e5:	75 e9                	jne    21d0 <zswapbench+0xc0>
+    getvmstat(&st1);
+    21e7:	83 ec 0c             	sub    $0xc,%esp
+    21ea:	8d 85 e0 fe ff ff    	lea    -0x120(%ebp),%eax
+    sbrk(-npages*4096);
+    21f0:	f7 db                	neg    %ebx
+    getvmstat(&st1);
+    21f2:	50                   	push   %eax
+    21f3:	e8 0b 43 00 00       	call   6503 <getvmstat>
+    sbrk(-npages*4096);
+    21f8:	89 1c 24             	mov    %ebx,(%esp)
+    21fb:	e8 db 42 00 00       	call   64db <sbrk>
+    printf(stdout, "zswap %s: %d ticks, %d swap-ins, %d from the pool, "
+    2200:	8b bd 74 ff ff ff    	mov    -0x8c(%ebp),%edi
+    2206:	8b 85 78 ff ff ff    	mov    -0x88(%ebp),%eax
+    220c:	8b b5 7c ff ff ff    	mov    -0x84(%ebp),%esi
+    2212:	8b 9d 18 ff ff ff    	mov    -0xe8(%ebp),%ebx
+    2218:	89 bd c8 fd ff ff    	mov    %edi,-0x238(%ebp)
+    221e:	2b b5 74 fe ff ff    	sub    -0x18c(%ebp),%esi
+    2224:	89 85 cc fd ff ff    	mov    %eax,-0x234(%ebp)
+    222a:	2b 9d 10 fe ff ff    	sub    -0x1f0(%ebp),%ebx
+           "%d stored in %d bytes\n", k ? "on" : "off", uptime() - t0,
+    2230:	e8 b6 42 00 00       	call   64eb <uptime>
+    printf(stdout, "zswap %s: %d ticks, %d swap-ins, %d from the pool, "
+    2235:	8b 95 d0 fd ff ff    	mov    -0x230(%ebp),%edx
+    223b:	8b bd d4 fd ff ff    	mov    -0x22c(%ebp),%edi
+    2241:	83 c4 10             	add    $0x10,%esp
+    2244:	29 d0                	sub    %edx,%eax
+    2246:	85 ff                	test   %edi,%edi
+    2248:	74 76                	je     22c0 <zswapbench+0x1b0>
+    224a:	8b bd c4 fd ff ff    	mov    -0x23c(%ebp),%edi
+    2250:	ff b5 cc fd ff ff    	push   -0x234(%ebp)
+    2256:	ff b5 c8 fd ff ff    	push   -0x238(%ebp)
+    225c:	56                   	push   %esi
+    225d:	53                   	push   %ebx
+    225e:	50                   	push   %eax
+    225f:	68 2d 70 00 00       	push   $0x702d
+    2264:	68 bc 83 00 00       	push   $0x83bc
+    2269:	ff 35 d4 9e 00 00    	push   0x9ed4
+    226f:	e8 4c 43 00 00       	call   65c0 <printf>
+    if(st1.swapins == st0.swapins){
+    2274:	8b 85 10 fe ff ff    	mov    -0x1f0(%ebp),%eax
+    227a:	83 c4 20             	add    $0x20,%esp
+    227d:	39 85 18 ff ff ff    	cmp    %eax,-0xe8(%ebp)
+    2283:	0f 84 de 00 00 00    	je     2367 <zswapbench+0x257>
+    if(k == 1 && st1.zswaphits == st0.zswaphits){
+    2289:	8b 85 7c ff ff ff    	mov    -0x84(%ebp),%eax
+    228f:	39 85 74 fe ff ff    	cmp    %eax,-0x18c(%ebp)
+    2295:	0f 84 b5 00 00 00    	je     2350 <zswapbench+0x240>
+  vmtune(VM_ZSWAP, old);
+    229b:	83 ec 08             	sub    $0x8,%esp
+    229e:	57                   	push   %edi
+    229f:	6a 05                	push   $0x5
+    22a1:	e8 65 42 00 00       	call   650b <vmtune>
+  printf(stdout, "zswap bench ok\n");
+    22a6:	58                   	pop    %eax
+    22a7:	5a                   	pop    %edx
+    22a8:	68 6b 70 00 00       	push   $0x706b
+    22ad:	ff 35 d4 9e 00 00    	push   0x9ed4
+    22b3:	e8 08 43 00 00       	call   65c0 <printf>
+}
+    22b8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    22bb:	5b                   	pop    %ebx
+    22bc:	5e                   	pop    %esi
+    22bd:	5f                   	pop    %edi
+    22be:	5d                   	pop    %ebp
+    22bf:	c3                   	ret
+    printf(stdout, "zswap %s: %d ticks, %d swap-ins, %d from the pool, "
+    22c0:	ff b5 cc fd ff ff    	push   -0x234(%ebp)
+    22c6:	ff b5 c8 fd ff ff    	push   -0x238(%ebp)
+    22cc:	56                   	push   %esi
+    22cd:	53                   	push   %ebx
+    22ce:	50                   	push   %eax
+    22cf:	68 30 70 00 00       	push   $0x7030
+    22d4:	68 bc 83 00 00       	push   $0x83bc
+    22d9:	ff 35 d4 9e 00 00    	push   0x9ed4
+    22df:	e8 dc 42 00 00       	call   65c0 <printf>
+    if(st1.swapins == st0.swapins){
+    22e4:	8b 85 10 fe ff ff    	mov    -0x1f0(%ebp),%eax
+    22ea:	83 c4 20             	add    $0x20,%esp
+    22ed:	c7 85 d4 fd ff ff 01 	movl   $0x1,-0x22c(%ebp)
+    22f4:	00 00 00 
+    22f7:	39 85 18 ff ff ff    	cmp    %eax,-0xe8(%ebp)
+    22fd:	0f 85 47 fe ff ff    	jne    214a <zswapbench+0x3a>
+    printf(stdout, "zswap %s: %d ticks, %d swap-ins, %d from the pool, "
+    2303:	b8 30 70 00 00       	mov    $0x7030,%eax
+      printf(stdout, "zswap %s: nothing was swapped in\n", k ? "on" : "off");
+    2308:	53                   	push   %ebx
+    2309:	50                   	push   %eax
+    230a:	68 08 84 00 00       	push   $0x8408
+    230f:	ff 35 d4 9e 00 00    	push   0x9ed4
+    2315:	e8 a6 42 00 00       	call   65c0 <printf>
+      exit();
+    231a:	e8 34 41 00 00       	call   6453 <exit>
+    231f:	90                   	nop
+        printf(stdout, "zswap page %d corrupt\n", i);
+    2320:	83 ec 04             	sub    $0x4,%esp
+    2323:	50                   	push   %eax
+    2324:	68 54 70 00 00       	push   $0x7054
+    2329:	ff 35 d4 9e 00 00    	push   0x9ed4
+    232f:	e8 8c 42 00 00       	call   65c0 <printf>
+        exit();
+    2334:	e8 1a 41 00 00       	call   6453 <exit>
+      printf(stdout, "zswap sbrk failed\n");
+    2339:	50                   	push   %eax
+    233a:	50                   	push   %eax
+    233b:	68 41 70 00 00       	push   $0x7041
+    2340:	ff 35 d4 9e 00 00    	push   0x9ed4
+    2346:	e8 75 42 00 00       	call   65c0 <printf>
+      exit();
+    234b:	e8 03 41 00 00       	call   6453 <exit>
+      printf(stdout, "zswap: no swap-in came from the pool\n");
+    2350:	51                   	push   %ecx
+    2351:	51                   	push   %ecx
+    2352:	68 2c 84 00 00       	push   $0x842c
+    2357:	ff 35 d4 9e 00 00    	push   0x9ed4
+    235d:	e8 5e 42 00 00       	call   65c0 <printf>
+      exit();
+    2362:	e8 ec 40 00 00       	call   6453 <exit>
+    printf(stdout, "zswap %s: %d ticks, %d swap-ins, %d from the pool, "
+    2367:	b8 2d 70 00 00       	mov    $0x702d,%eax
+    236c:	eb 9a                	jmp    2308 <zswapbench+0x1f8>
+    236e:	66 90                	xchg   %ax,%ax
+
+00002370 <zeropagetest>:
+{
+    2370:	55                   	push   %ebp
+    2371:	89 e5                	mov    %esp,%ebp
+    2373:	57                   	push   %edi
+    2374:	56                   	push   %esi
+    2375:	53                   	push   %ebx
+  getvmstat(&st0);
+    2376:	8d 9d d8 fd ff ff    	lea    -0x228(%ebp),%ebx
+{
+    237c:	81 ec 34 02 00 00    	sub    $0x234,%esp
+  printf(stdout, "zero page test\n");
+    2382:	68 7b 70 00 00       	push   $0x707b
+    2387:	ff 35 d4 9e 00 00    	push   0x9ed4
+    238d:	e8 2e 42 00 00       	call   65c0 <printf>
+  getvmstat(&st0);
+    2392:	89 1c 24             	mov    %ebx,(%esp)
+    2395:	e8 69 41 00 00       	call   6503 <getvmstat>
+  a = sbrk(ZPPAGES*4096);
+    239a:	c7 04 24 00 00 10 00 	movl   $0x100000,(%esp)
+    23a1:	e8 35 41 00 00       	call   64db <sbrk>
+  if(a == (char*)0xffffffff){
+    23a6:	83 c4 10             	add    $0x10,%esp
+    23a9:	83 f8 ff             	cmp    $0xffffffff,%eax
+    23ac:	0f 84 24 02 00 00    	je     25d6 <zeropagetest+0x266>
+  getvmstat(&st1);
+    23b2:	83 ec 0c             	sub    $0xc,%esp
+    23b5:	89 c7                	mov    %eax,%edi
+    23b7:	8d 85 e0 fe ff ff    	lea    -0x120(%ebp),%eax
+    23bd:	50                   	push   %eax
+    23be:	e8 40 41 00 00       	call   6503 <getvmstat>
+  if(st1.freepages + 16 < st0.freepages){
+    23c3:	8b 85 e0 fe ff ff    	mov    -0x120(%ebp),%eax
+    23c9:	83 c4 10             	add    $0x10,%esp
+    23cc:	83 c0 10             	add    $0x10,%eax
+    23cf:	3b 85 d8 fd ff ff    	cmp    -0x228(%ebp),%eax
+    23d5:	0f 82 29 02 00 00    	jb     2604 <zeropagetest+0x294>
+    23db:	89 fe                	mov    %edi,%esi
+    23dd:	8d 97 00 10 00 00    	lea    0x1000(%edi),%edx
+    23e3:	8d 8f 00 10 10 00    	lea    0x101000(%edi),%ecx
+    23e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    for(j = 0; j < 4096; j += 512){
+    23f0:	8d 82 00 f0 ff ff    	lea    -0x1000(%edx),%eax
+    23f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    23fd:	8d 76 00             	lea    0x0(%esi),%esi
+      if(a[i*4096 + j] != 0){
+    2400:	80 38 00             	cmpb   $0x0,(%eax)
+    2403:	0f 85 aa 01 00 00    	jne    25b3 <zeropagetest+0x243>
+    for(j = 0; j < 4096; j += 512){
+    2409:	05 00 02 00 00       	add    $0x200,%eax
+    240e:	39 d0                	cmp    %edx,%eax
+    2410:	75 ee                	jne    2400 <zeropagetest+0x90>
+  for(i = 0; i < ZPPAGES; i++){
+    2412:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+    2418:	39 ca                	cmp    %ecx,%edx
+    241a:	75 d4                	jne    23f0 <zeropagetest+0x80>
+  getvmstat(&st1);
+    241c:	83 ec 0c             	sub    $0xc,%esp
+    241f:	8d 85 e0 fe ff ff    	lea    -0x120(%ebp),%eax
+    2425:	50                   	push   %eax
+    2426:	e8 d8 40 00 00       	call   6503 <getvmstat>
+  if(st1.zeromapped < st0.zeromapped + ZPPAGES){
+    242b:	8b 85 80 fe ff ff    	mov    -0x180(%ebp),%eax
+    2431:	83 c4 10             	add    $0x10,%esp
+    2434:	05 00 01 00 00       	add    $0x100,%eax
+    2439:	39 45 88             	cmp    %eax,-0x78(%ebp)
+    243c:	0f 82 0e 02 00 00    	jb     2650 <zeropagetest+0x2e0>
+    2442:	81 c7 00 00 10 00    	add    $0x100000,%edi
+    2448:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    244f:	90                   	nop
+    a[i*4096] = 1;
+    2450:	c6 06 01             	movb   $0x1,(%esi)
+  for(i = 0; i < ZPPAGES; i += 2)
+    2453:	81 c6 00 20 00 00    	add    $0x2000,%esi
+    2459:	39 fe                	cmp    %edi,%esi
+    245b:	75 f3                	jne    2450 <zeropagetest+0xe0>
+  getvmstat(&st1);
+    245d:	83 ec 0c             	sub    $0xc,%esp
+    2460:	8d 85 e0 fe ff ff    	lea    -0x120(%ebp),%eax
+    2466:	50                   	push   %eax
+    2467:	e8 97 40 00 00       	call   6503 <getvmstat>
+  if(st1.zerocows < st0.zerocows + ZPPAGES/2){
+    246c:	8b 85 84 fe ff ff    	mov    -0x17c(%ebp),%eax
+    2472:	83 c4 10             	add    $0x10,%esp
+    2475:	83 e8 80             	sub    $0xffffff80,%eax
+    2478:	39 45 8c             	cmp    %eax,-0x74(%ebp)
+    247b:	0f 82 b8 01 00 00    	jb     2639 <zeropagetest+0x2c9>
+  sbrk(-ZPPAGES*4096);
+    2481:	83 ec 0c             	sub    $0xc,%esp
+    2484:	68 00 00 f0 ff       	push   $0xfff00000
+    2489:	e8 4d 40 00 00       	call   64db <sbrk>
+  getvmstat(&st0);
+    248e:	89 1c 24             	mov    %ebx,(%esp)
+    2491:	e8 6d 40 00 00       	call   6503 <getvmstat>
+  n = st0.freepages + OVERCOMMIT;
+    2496:	8b 85 d8 fd ff ff    	mov    -0x228(%ebp),%eax
+    249c:	8d b0 80 00 00 00    	lea    0x80(%eax),%esi
+  a = sbrk(n*4096);
+    24a2:	89 f0                	mov    %esi,%eax
+    24a4:	c1 e0 0c             	shl    $0xc,%eax
+    24a7:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+    24ad:	89 04 24             	mov    %eax,(%esp)
+    24b0:	e8 26 40 00 00       	call   64db <sbrk>
+  if(a == (char*)0xffffffff){
+    24b5:	83 c4 10             	add    $0x10,%esp
+    24b8:	83 f8 ff             	cmp    $0xffffffff,%eax
+    24bb:	0f 84 15 01 00 00    	je     25d6 <zeropagetest+0x266>
+  getvmstat(&st0);
+    24c1:	83 ec 0c             	sub    $0xc,%esp
+    24c4:	89 85 d0 fd ff ff    	mov    %eax,-0x230(%ebp)
+  for(i = 0; i < n; i++)
+    24ca:	31 ff                	xor    %edi,%edi
+  getvmstat(&st0);
+    24cc:	53                   	push   %ebx
+    24cd:	e8 31 40 00 00       	call   6503 <getvmstat>
+  for(i = 0; i < n; i++)
+    24d2:	8b 95 d0 fd ff ff    	mov    -0x230(%ebp),%edx
+    24d8:	83 c4 10             	add    $0x10,%esp
+    24db:	89 d3                	mov    %edx,%ebx
+    24dd:	85 f6                	test   %esi,%esi
+    24df:	7e 52                	jle    2533 <zeropagetest+0x1c3>
+    24e1:	89 95 d0 fd ff ff    	mov    %edx,-0x230(%ebp)
+    memset(a + i*4096, i, 4096);
+    24e7:	83 ec 04             	sub    $0x4,%esp
+    24ea:	68 00 10 00 00       	push   $0x1000
+    24ef:	57                   	push   %edi
+    24f0:	53                   	push   %ebx
+  for(i = 0; i < n; i++)
+    24f1:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+    memset(a + i*4096, i, 4096);
+    24f7:	e8 d4 3d 00 00       	call   62d0 <memset>
+  for(i = 0; i < n; i++)
+    24fc:	89 f8                	mov    %edi,%eax
+    24fe:	8d 7f 01             	lea    0x1(%edi),%edi
+    2501:	83 c4 10             	add    $0x10,%esp
+    2504:	39 fe                	cmp    %edi,%esi
+    2506:	75 df                	jne    24e7 <zeropagetest+0x177>
+  for(i = 0; i < n; i++){
+    2508:	8b 95 d0 fd ff ff    	mov    -0x230(%ebp),%edx
+    250e:	31 c9                	xor    %ecx,%ecx
+    2510:	eb 08                	jmp    251a <zeropagetest+0x1aa>
+    2512:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    2518:	89 d9                	mov    %ebx,%ecx
+    if(a[i*4096 + 4095] != (char)i){
+    251a:	89 cb                	mov    %ecx,%ebx
+    251c:	c1 e3 0c             	shl    $0xc,%ebx
+    251f:	38 8c 1a ff 0f 00 00 	cmp    %cl,0xfff(%edx,%ebx,1)
+    2526:	0f 85 f4 00 00 00    	jne    2620 <zeropagetest+0x2b0>
+  for(i = 0; i < n; i++){
+    252c:	8d 59 01             	lea    0x1(%ecx),%ebx
+    252f:	39 c1                	cmp    %eax,%ecx
+    2531:	75 e5                	jne    2518 <zeropagetest+0x1a8>
+  getvmstat(&st1);
+    2533:	83 ec 0c             	sub    $0xc,%esp
+    2536:	8d 85 e0 fe ff ff    	lea    -0x120(%ebp),%eax
+    253c:	50                   	push   %eax
+    253d:	e8 c1 3f 00 00       	call   6503 <getvmstat>
+  sbrk(-n*4096);
+    2542:	8b 85 d4 fd ff ff    	mov    -0x22c(%ebp),%eax
+    2548:	f7 d8                	neg    %eax
+    254a:	89 04 24             	mov    %eax,(%esp)
+    254d:	e8 89 3f 00 00       	call   64db <sbrk>
+  if(st1.swapouts > st0.swapouts && st1.fillouts == st0.fillouts){
+    2552:	8b 95 14 ff ff ff    	mov    -0xec(%ebp),%edx
+    2558:	8b 9d 0c fe ff ff    	mov    -0x1f4(%ebp),%ebx
+    255e:	83 c4 10             	add    $0x10,%esp
+    2561:	39 d3                	cmp    %edx,%ebx
+    2563:	73 66                	jae    25cb <zeropagetest+0x25b>
+    2565:	8b 45 90             	mov    -0x70(%ebp),%eax
+    2568:	8b 8d 88 fe ff ff    	mov    -0x178(%ebp),%ecx
+    256e:	39 c8                	cmp    %ecx,%eax
+    2570:	74 7b                	je     25ed <zeropagetest+0x27d>
+  printf(stdout, "zero page: %d swap-outs, %d same-filled, %d filled back in\n",
+    2572:	8b 75 94             	mov    -0x6c(%ebp),%esi
+    2575:	83 ec 0c             	sub    $0xc,%esp
+    2578:	2b b5 8c fe ff ff    	sub    -0x174(%ebp),%esi
+    257e:	29 da                	sub    %ebx,%edx
+    2580:	29 c8                	sub    %ecx,%eax
+    2582:	56                   	push   %esi
+    2583:	50                   	push   %eax
+    2584:	52                   	push   %edx
+    2585:	68 04 85 00 00       	push   $0x8504
+    258a:	ff 35 d4 9e 00 00    	push   0x9ed4
+    2590:	e8 2b 40 00 00       	call   65c0 <printf>
+  printf(stdout, "zero page test ok\n");
+    2595:	83 c4 18             	add    $0x18,%esp
+    2598:	68 d3 70 00 00       	push   $0x70d3
+    259d:	ff 35 d4 9e 00 00    	push   0x9ed4
+    25a3:	e8 18 40 00 00       	call   65c0 <printf>
+}
+    25a8:	83 c4 10             	add    $0x10,%esp
+    25ab:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    25ae:	5b                   	pop    %ebx
+    25af:	5e                   	pop    %esi
+    25b0:	5f                   	pop    %edi
+    25b1:	5d                   	pop    %ebp
+    25b2:	c3                   	ret
+        printf(stdout, "zero page not zero\n");
+    25b3:	83 ec 08             	sub    $0x8,%esp
+    25b6:	68 a2 70 00 00       	push   $0x70a2
+    25bb:	ff 35 d4 9e 00 00    	push   0x9ed4
+    25c1:	e8 fa 3f 00 00       	call   65c0 <printf>
+        exit();
+    25c6:	e8 88 3e 00 00       	call   6453 <exit>
+  if(st1.swapouts > st0.swapouts && st1.fillouts == st0.fillouts){
+    25cb:	8b 45 90             	mov    -0x70(%ebp),%eax
+    25ce:	8b 8d 88 fe ff ff    	mov    -0x178(%ebp),%ecx
+    25d4:	eb 9c                	jmp    2572 <zeropagetest+0x202>
+    printf(stdout, "zero page sbrk failed\n");
+    25d6:	52                   	push   %edx
+    25d7:	52                   	push   %edx
+    25d8:	68 8b 70 00 00       	push   $0x708b
+    25dd:	ff 35 d4 9e 00 00    	push   0x9ed4
+    25e3:	e8 d8 3f 00 00       	call   65c0 <printf>
+    exit();
+    25e8:	e8 66 3e 00 00       	call   6453 <exit>
+    printf(stdout, "zero page: same-filled pages were written out\n");
+    25ed:	50                   	push   %eax
+    25ee:	50                   	push   %eax
+    25ef:	68 d4 84 00 00       	push   $0x84d4
+    25f4:	ff 35 d4 9e 00 00    	push   0x9ed4
+    25fa:	e8 c1 3f 00 00       	call   65c0 <printf>
+    exit();
+    25ff:	e8 4f 3e 00 00       	call   6453 <exit>
+    printf(stdout, "zero page: sbrk allocated memory\n");
+    2604:	56                   	push   %esi
+    2605:	56                   	push   %esi
+    2606:	68 54 84 00 00       	push   $0x8454
+    260b:	ff 35 d4 9e 00 00    	push   0x9ed4
+    2611:	e8 aa 3f 00 00       	call   65c0 <printf>
+    exit();
+    2616:	e8 38 3e 00 00       	call   6453 <exit>
+    261b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    261f:	90                   	nop
+      printf(stdout, "same-filled page %d corrupt\n", i);
+    2620:	83 ec 04             	sub    $0x4,%esp
+    2623:	51                   	push   %ecx
+    2624:	68 b6 70 00 00       	push   $0x70b6
+    2629:	ff 35 d4 9e 00 00    	push   0x9ed4
+    262f:	e8 8c 3f 00 00       	call   65c0 <printf>
+      exit();
+    2634:	e8 1a 3e 00 00       	call   6453 <exit>
+    printf(stdout, "zero page: writes did not get their own pages\n");
+    2639:	51                   	push   %ecx
+    263a:	51                   	push   %ecx
+    263b:	68 a4 84 00 00       	push   $0x84a4
+    2640:	ff 35 d4 9e 00 00    	push   0x9ed4
+    2646:	e8 75 3f 00 00       	call   65c0 <printf>
+    exit();
+    264b:	e8 03 3e 00 00       	call   6453 <exit>
+    printf(stdout, "zero page: reads did not map the zero page\n");
+    2650:	53                   	push   %ebx
+    2651:	53                   	push   %ebx
+    2652:	68 78 84 00 00       	push   $0x8478
+    2657:	ff 35 d4 9e 00 00    	push   0x9ed4
+    265d:	e8 5e 3f 00 00       	call   65c0 <printf>
+    exit();
+    2662:	e8 ec 3d 00 00       	call   6453 <exit>
+    2667:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    266e:	66 90                	xchg   %ax,%ax
+
+00002670 <sbrklatency>:
+{
+    2670:	55                   	push   %ebp
+    2671:	89 e5                	mov    %esp,%ebp
+    2673:	57                   	push   %edi
+    2674:	56                   	push   %esi
+  for(mb = 1; mb <= 64; mb *= 2){
+    2675:	be 01 00 00 00       	mov    $0x1,%esi
+{
+    267a:	53                   	push   %ebx
+    267b:	81 ec 34 02 00 00    	sub    $0x234,%esp
+  printf(stdout, "sbrk latency test\n");
+    2681:	68 e6 70 00 00       	push   $0x70e6
+    2686:	ff 35 d4 9e 00 00    	push   0x9ed4
+    268c:	e8 2f 3f 00 00       	call   65c0 <printf>
+    2691:	83 c4 10             	add    $0x10,%esp
+    2694:	c7 85 cc fd ff ff 07 	movl   $0x7,-0x234(%ebp)
+    269b:	00 00 00 
+    getvmstat(&st0);
+    269e:	83 ec 0c             	sub    $0xc,%esp
+    26a1:	8d 85 d8 fd ff ff    	lea    -0x228(%ebp),%eax
+      a = sbrk(mb*1024*1024);
+    26a7:	89 f7                	mov    %esi,%edi
+    for(r = 0; r < SLROUNDS; r++){
+    26a9:	31 db                	xor    %ebx,%ebx
+    getvmstat(&st0);
+    26ab:	50                   	push   %eax
+      a = sbrk(mb*1024*1024);
+    26ac:	c1 e7 14             	shl    $0x14,%edi
+    getvmstat(&st0);
+    26af:	e8 4f 3e 00 00       	call   6503 <getvmstat>
+    t0 = uptime();
+    26b4:	e8 32 3e 00 00       	call   64eb <uptime>
+    26b9:	83 c4 10             	add    $0x10,%esp
+    26bc:	89 85 d0 fd ff ff    	mov    %eax,-0x230(%ebp)
+    for(r = 0; r < SLROUNDS; r++){
+    26c2:	89 f8                	mov    %edi,%eax
+    26c4:	f7 d8                	neg    %eax
+    26c6:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+    26cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      a = sbrk(mb*1024*1024);
+    26d0:	83 ec 0c             	sub    $0xc,%esp
+    26d3:	57                   	push   %edi
+    26d4:	e8 02 3e 00 00       	call   64db <sbrk>
+      if(a == (char*)0xffffffff){
+    26d9:	83 c4 10             	add    $0x10,%esp
+      a = sbrk(mb*1024*1024);
+    26dc:	89 c2                	mov    %eax,%edx
+      if(a == (char*)0xffffffff){
+    26de:	83 f8 ff             	cmp    $0xffffffff,%eax
+    26e1:	0f 84 f2 00 00 00    	je     27d9 <sbrklatency+0x169>
+      if(r == 0){
+    26e7:	85 db                	test   %ebx,%ebx
+    26e9:	75 51                	jne    273c <sbrklatency+0xcc>
+        for(i = 0; i < mb; i++)
+    26eb:	31 c0                	xor    %eax,%eax
+    26ed:	8d 76 00             	lea    0x0(%esi),%esi
+          a[i*1024*1024] = i;
+    26f0:	89 c1                	mov    %eax,%ecx
+    26f2:	c1 e1 14             	shl    $0x14,%ecx
+    26f5:	88 04 0a             	mov    %al,(%edx,%ecx,1)
+        for(i = 0; i < mb; i++)
+    26f8:	83 c0 01             	add    $0x1,%eax
+    26fb:	39 f0                	cmp    %esi,%eax
+    26fd:	75 f1                	jne    26f0 <sbrklatency+0x80>
+    26ff:	90                   	nop
+          if(a[i*1024*1024] != (char)i){
+    2700:	89 d8                	mov    %ebx,%eax
+    2702:	c1 e0 14             	shl    $0x14,%eax
+    2705:	38 1c 02             	cmp    %bl,(%edx,%eax,1)
+    2708:	0f 85 b4 00 00 00    	jne    27c2 <sbrklatency+0x152>
+        for(i = 0; i < mb; i++){
+    270e:	83 c3 01             	add    $0x1,%ebx
+    2711:	39 f3                	cmp    %esi,%ebx
+    2713:	75 eb                	jne    2700 <sbrklatency+0x90>
+      sbrk(-mb*1024*1024);
+    2715:	83 ec 0c             	sub    $0xc,%esp
+    2718:	ff b5 d4 fd ff ff    	push   -0x22c(%ebp)
+    271e:	e8 b8 3d 00 00       	call   64db <sbrk>
+      a = sbrk(mb*1024*1024);
+    2723:	89 3c 24             	mov    %edi,(%esp)
+    2726:	e8 b0 3d 00 00       	call   64db <sbrk>
+      if(a == (char*)0xffffffff){
+    272b:	83 c4 10             	add    $0x10,%esp
+    272e:	83 f8 ff             	cmp    $0xffffffff,%eax
+    2731:	0f 84 a2 00 00 00    	je     27d9 <sbrklatency+0x169>
+    for(r = 0; r < SLROUNDS; r++){
+    2737:	bb 01 00 00 00       	mov    $0x1,%ebx
+      sbrk(-mb*1024*1024);
+    273c:	83 ec 0c             	sub    $0xc,%esp
+    273f:	ff b5 d4 fd ff ff    	push   -0x22c(%ebp)
+    for(r = 0; r < SLROUNDS; r++){
+    2745:	83 c3 01             	add    $0x1,%ebx
+      sbrk(-mb*1024*1024);
+    2748:	e8 8e 3d 00 00       	call   64db <sbrk>
+    for(r = 0; r < SLROUNDS; r++){
+    274d:	83 c4 10             	add    $0x10,%esp
+    2750:	83 fb 64             	cmp    $0x64,%ebx
+    2753:	0f 85 77 ff ff ff    	jne    26d0 <sbrklatency+0x60>
+    getvmstat(&st1);
+    2759:	83 ec 0c             	sub    $0xc,%esp
+    275c:	8d 85 e0 fe ff ff    	lea    -0x120(%ebp),%eax
+    2762:	50                   	push   %eax
+    2763:	e8 9b 3d 00 00       	call   6503 <getvmstat>
+    printf(stdout, "sbrk %d MB: %d ticks for %d rounds, %d pages faulted in\n",
+    2768:	8b 5d 9c             	mov    -0x64(%ebp),%ebx
+    276b:	2b 9d 94 fe ff ff    	sub    -0x16c(%ebp),%ebx
+           mb, uptime() - t0, SLROUNDS, st1.lazyalloc - st0.lazyalloc);
+    2771:	e8 75 3d 00 00       	call   64eb <uptime>
+    printf(stdout, "sbrk %d MB: %d ticks for %d rounds, %d pages faulted in\n",
+    2776:	5a                   	pop    %edx
+    2777:	59                   	pop    %ecx
+    2778:	53                   	push   %ebx
+    2779:	6a 64                	push   $0x64
+    277b:	8b bd d0 fd ff ff    	mov    -0x230(%ebp),%edi
+    2781:	29 f8                	sub    %edi,%eax
+    2783:	50                   	push   %eax
+    2784:	56                   	push   %esi
+  for(mb = 1; mb <= 64; mb *= 2){
+    2785:	01 f6                	add    %esi,%esi
+    printf(stdout, "sbrk %d MB: %d ticks for %d rounds, %d pages faulted in\n",
+    2787:	68 40 85 00 00       	push   $0x8540
+    278c:	ff 35 d4 9e 00 00    	push   0x9ed4
+    2792:	e8 29 3e 00 00       	call   65c0 <printf>
+  for(mb = 1; mb <= 64; mb *= 2){
+    2797:	83 c4 20             	add    $0x20,%esp
+    279a:	83 ad cc fd ff ff 01 	subl   $0x1,-0x234(%ebp)
+    27a1:	0f 85 f7 fe ff ff    	jne    269e <sbrklatency+0x2e>
+  printf(stdout, "sbrk latency test ok\n");
+    27a7:	83 ec 08             	sub    $0x8,%esp
+    27aa:	68 29 71 00 00       	push   $0x7129
+    27af:	ff 35 d4 9e 00 00    	push   0x9ed4
+    27b5:	e8 06 3e 00 00       	call   65c0 <printf>
+}
+    27ba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    27bd:	5b                   	pop    %ebx
+    27be:	5e                   	pop    %esi
+    27bf:	5f                   	pop    %edi
+    27c0:	5d                   	pop    %ebp
+    27c1:	c3                   	ret
+            printf(stdout, "sbrk %d MB: page %d corrupt\n", mb, i);
+    27c2:	53                   	push   %ebx
+    27c3:	56                   	push   %esi
+    27c4:	68 0c 71 00 00       	push   $0x710c
+    27c9:	ff 35 d4 9e 00 00    	push   0x9ed4
+    27cf:	e8 ec 3d 00 00       	call   65c0 <printf>
+            exit();
+    27d4:	e8 7a 3c 00 00       	call   6453 <exit>
+        printf(stdout, "sbrk %d MB failed\n", mb);
+    27d9:	83 ec 04             	sub    $0x4,%esp
+    27dc:	56                   	push   %esi
+    27dd:	68 f9 70 00 00       	push   $0x70f9
+    27e2:	ff 35 d4 9e 00 00    	push   0x9ed4
+    27e8:	e8 d3 3d 00 00       	call   65c0 <printf>
+        exit();
+    27ed:	e8 61 3c 00 00       	call   6453 <exit>
+    27f2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    27f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00002800 <runecho>:
+{
+    2800:	55                   	push   %ebp
+    2801:	89 e5                	mov    %esp,%ebp
+    2803:	53                   	push   %ebx
+  if(pipe(fds) != 0){
+    2804:	8d 45 dc             	lea    -0x24(%ebp),%eax
+{
+    2807:	83 ec 30             	sub    $0x30,%esp
+  char *args[] = { "echo", "ok", 0 };
+    280a:	c7 45 ec 55 72 00 00 	movl   $0x7255,-0x14(%ebp)
+    2811:	c7 45 f0 c8 7d 00 00 	movl   $0x7dc8,-0x10(%ebp)
+    2818:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  if(pipe(fds) != 0){
+    281f:	50                   	push   %eax
+    2820:	e8 3e 3c 00 00       	call   6463 <pipe>
+    2825:	83 c4 10             	add    $0x10,%esp
+    2828:	85 c0                	test   %eax,%eax
+    282a:	75 6b                	jne    2897 <runecho+0x97>
+  pid = fork();
+    282c:	e8 1a 3c 00 00       	call   644b <fork>
+  if(pid < 0){
+    2831:	85 c0                	test   %eax,%eax
+    2833:	0f 88 c3 00 00 00    	js     28fc <runecho+0xfc>
+  if(pid == 0){
+    2839:	74 73                	je     28ae <runecho+0xae>
+  close(fds[1]);
+    283b:	83 ec 0c             	sub    $0xc,%esp
+    283e:	ff 75 e0             	push   -0x20(%ebp)
+    2841:	e8 35 3c 00 00       	call   647b <close>
+  n = read(fds[0], buf, sizeof(buf));
+    2846:	83 c4 0c             	add    $0xc,%esp
+    2849:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+    284c:	6a 08                	push   $0x8
+    284e:	50                   	push   %eax
+    284f:	ff 75 dc             	push   -0x24(%ebp)
+    2852:	e8 14 3c 00 00       	call   646b <read>
+    2857:	89 c3                	mov    %eax,%ebx
+  close(fds[0]);
+    2859:	58                   	pop    %eax
+    285a:	ff 75 dc             	push   -0x24(%ebp)
+    285d:	e8 19 3c 00 00       	call   647b <close>
+  wait();
+    2862:	e8 f4 3b 00 00       	call   645b <wait>
+  if(n != 3 || buf[0] != 'o' || buf[1] != 'k' || buf[2] != '\n')
+    2867:	83 c4 10             	add    $0x10,%esp
+    286a:	83 fb 03             	cmp    $0x3,%ebx
+    286d:	75 21                	jne    2890 <runecho+0x90>
+    286f:	80 7d e4 6f          	cmpb   $0x6f,-0x1c(%ebp)
+    2873:	75 1b                	jne    2890 <runecho+0x90>
+    2875:	80 7d e5 6b          	cmpb   $0x6b,-0x1b(%ebp)
+    2879:	75 15                	jne    2890 <runecho+0x90>
+    287b:	31 c0                	xor    %eax,%eax
+    287d:	80 7d e6 0a          	cmpb   $0xa,-0x1a(%ebp)
+    2881:	0f 95 c0             	setne  %al
+    2884:	f7 d8                	neg    %eax
+}
+    2886:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2889:	c9                   	leave
+    288a:	c3                   	ret
+    288b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    288f:	90                   	nop
+    return -1;
+    2890:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    2895:	eb ef                	jmp    2886 <runecho+0x86>
+    printf(stdout, "pipe() failed\n");
+    2897:	53                   	push   %ebx
+    2898:	53                   	push   %ebx
+    2899:	68 1c 6c 00 00       	push   $0x6c1c
+    289e:	ff 35 d4 9e 00 00    	push   0x9ed4
+    28a4:	e8 17 3d 00 00       	call   65c0 <printf>
+    exit();
+    28a9:	e8 a5 3b 00 00       	call   6453 <exit>
+    close(1);
+    28ae:	83 ec 0c             	sub    $0xc,%esp
+    28b1:	6a 01                	push   $0x1
+    28b3:	e8 c3 3b 00 00       	call   647b <close>
+    dup(fds[1]);
+    28b8:	5a                   	pop    %edx
+    28b9:	ff 75 e0             	push   -0x20(%ebp)
+    28bc:	e8 0a 3c 00 00       	call   64cb <dup>
+    close(fds[0]);
+    28c1:	59                   	pop    %ecx
+    28c2:	ff 75 dc             	push   -0x24(%ebp)
+    28c5:	e8 b1 3b 00 00       	call   647b <close>
+    close(fds[1]);
+    28ca:	5b                   	pop    %ebx
+    28cb:	ff 75 e0             	push   -0x20(%ebp)
+    28ce:	e8 a8 3b 00 00       	call   647b <close>
+    exec(path, args);
+    28d3:	58                   	pop    %eax
+    28d4:	8d 45 ec             	lea    -0x14(%ebp),%eax
+    28d7:	5a                   	pop    %edx
+    28d8:	50                   	push   %eax
+    28d9:	ff 75 08             	push   0x8(%ebp)
+    28dc:	e8 aa 3b 00 00       	call   648b <exec>
+    printf(stdout, "exec %s failed\n", path);
+    28e1:	83 c4 0c             	add    $0xc,%esp
+    28e4:	ff 75 08             	push   0x8(%ebp)
+    28e7:	68 3f 71 00 00       	push   $0x713f
+    28ec:	ff 35 d4 9e 00 00    	push   0x9ed4
+    28f2:	e8 c9 3c 00 00       	call   65c0 <printf>
+    exit();
+    28f7:	e8 57 3b 00 00       	call   6453 <exit>
+    printf(stdout, "fork failed\n");
+    28fc:	51                   	push   %ecx
+    28fd:	51                   	push   %ecx
+    28fe:	68 f4 7d 00 00       	push   $0x7df4
+    2903:	ff 35 d4 9e 00 00    	push   0x9ed4
+    2909:	e8 b2 3c 00 00       	call   65c0 <printf>
+    exit();
+    290e:	e8 40 3b 00 00       	call   6453 <exit>
+    2913:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    291a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00002920 <execbench>:
+{
+    2920:	55                   	push   %ebp
+    2921:	89 e5                	mov    %esp,%ebp
+    2923:	57                   	push   %edi
+    2924:	56                   	push   %esi
+    2925:	53                   	push   %ebx
+  t0 = uptime();
+    2926:	bb 32 00 00 00       	mov    $0x32,%ebx
+{
+    292b:	81 ec 24 02 00 00    	sub    $0x224,%esp
+  printf(stdout, "exec bench\n");
+    2931:	68 54 71 00 00       	push   $0x7154
+    2936:	ff 35 d4 9e 00 00    	push   0x9ed4
+    293c:	e8 7f 3c 00 00       	call   65c0 <printf>
+  getvmstat(&st0);
+    2941:	8d 85 d8 fd ff ff    	lea    -0x228(%ebp),%eax
+    2947:	89 04 24             	mov    %eax,(%esp)
+    294a:	e8 b4 3b 00 00       	call   6503 <getvmstat>
+  t0 = uptime();
+    294f:	e8 97 3b 00 00       	call   64eb <uptime>
+    2954:	83 c4 10             	add    $0x10,%esp
+    2957:	89 c6                	mov    %eax,%esi
+  for(r = 0; r < EXROUNDS; r++){
+    2959:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(runecho("echo") != 0){
+    2960:	83 ec 0c             	sub    $0xc,%esp
+    2963:	68 55 72 00 00       	push   $0x7255
+    2968:	e8 93 fe ff ff       	call   2800 <runecho>
+    296d:	83 c4 10             	add    $0x10,%esp
+    2970:	85 c0                	test   %eax,%eax
+    2972:	75 62                	jne    29d6 <execbench+0xb6>
+  for(r = 0; r < EXROUNDS; r++){
+    2974:	83 eb 01             	sub    $0x1,%ebx
+    2977:	75 e7                	jne    2960 <execbench+0x40>
+  getvmstat(&st1);
+    2979:	83 ec 0c             	sub    $0xc,%esp
+    297c:	8d 85 e0 fe ff ff    	lea    -0x120(%ebp),%eax
+    2982:	50                   	push   %eax
+    2983:	e8 7b 3b 00 00       	call   6503 <getvmstat>
+  printf(stdout, "exec bench: %d ticks for %d execs, %d program pages read, %d shared\n",
+    2988:	8b 7d a8             	mov    -0x58(%ebp),%edi
+    298b:	8b 5d a0             	mov    -0x60(%ebp),%ebx
+    298e:	2b bd a0 fe ff ff    	sub    -0x160(%ebp),%edi
+    2994:	2b 9d 98 fe ff ff    	sub    -0x168(%ebp),%ebx
+         uptime() - t0, EXROUNDS, st1.filepages - st0.filepages,
+    299a:	e8 4c 3b 00 00       	call   64eb <uptime>
+  printf(stdout, "exec bench: %d ticks for %d execs, %d program pages read, %d shared\n",
+    299f:	5a                   	pop    %edx
+    29a0:	59                   	pop    %ecx
+    29a1:	57                   	push   %edi
+    29a2:	29 f0                	sub    %esi,%eax
+    29a4:	53                   	push   %ebx
+    29a5:	6a 32                	push   $0x32
+    29a7:	50                   	push   %eax
+    29a8:	68 a0 85 00 00       	push   $0x85a0
+    29ad:	ff 35 d4 9e 00 00    	push   0x9ed4
+    29b3:	e8 08 3c 00 00       	call   65c0 <printf>
+  printf(stdout, "exec bench ok\n");
+    29b8:	83 c4 18             	add    $0x18,%esp
+    29bb:	68 65 71 00 00       	push   $0x7165
+    29c0:	ff 35 d4 9e 00 00    	push   0x9ed4
+    29c6:	e8 f5 3b 00 00       	call   65c0 <printf>
+}
+    29cb:	83 c4 10             	add    $0x10,%esp
+    29ce:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    29d1:	5b                   	pop    %ebx
+    29d2:	5e                   	pop    %esi
+    29d3:	5f                   	pop    %edi
+    29d4:	5d                   	pop    %ebp
+    29d5:	c3                   	ret
+      printf(stdout, "exec bench: bad output from echo\n");
+    29d6:	83 ec 08             	sub    $0x8,%esp
+    29d9:	68 7c 85 00 00       	push   $0x857c
+    29de:	ff 35 d4 9e 00 00    	push   0x9ed4
+    29e4:	e8 d7 3b 00 00       	call   65c0 <printf>
+      exit();
+    29e9:	e8 65 3a 00 00       	call   6453 <exit>
+    29ee:	66 90                	xchg   %ax,%ax
+
+000029f0 <forkexecbench>:
+{
+    29f0:	55                   	push   %ebp
+    29f1:	89 e5                	mov    %esp,%ebp
+    29f3:	56                   	push   %esi
+    29f4:	53                   	push   %ebx
+  t0 = uptime();
+    29f5:	bb c8 00 00 00       	mov    $0xc8,%ebx
+  printf(stdout, "fork+exec bench\n");
+    29fa:	83 ec 08             	sub    $0x8,%esp
+    29fd:	68 4f 71 00 00       	push   $0x714f
+    2a02:	ff 35 d4 9e 00 00    	push   0x9ed4
+    2a08:	e8 b3 3b 00 00       	call   65c0 <printf>
+  t0 = uptime();
+    2a0d:	e8 d9 3a 00 00       	call   64eb <uptime>
+    2a12:	83 c4 10             	add    $0x10,%esp
+    2a15:	89 c6                	mov    %eax,%esi
+  for(r = 0; r < FEROUNDS; r++){
+    2a17:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2a1e:	66 90                	xchg   %ax,%ax
+    pid = fork();
+    2a20:	e8 26 3a 00 00       	call   644b <fork>
+    if(pid < 0){
+    2a25:	85 c0                	test   %eax,%eax
+    2a27:	0f 88 95 00 00 00    	js     2ac2 <forkexecbench+0xd2>
+    if(pid == 0)
+    2a2d:	0f 84 bf 00 00 00    	je     2af2 <forkexecbench+0x102>
+    wait();
+    2a33:	e8 23 3a 00 00       	call   645b <wait>
+  for(r = 0; r < FEROUNDS; r++){
+    2a38:	83 eb 01             	sub    $0x1,%ebx
+    2a3b:	75 e3                	jne    2a20 <forkexecbench+0x30>
+  printf(stdout, "fork+exec bench: %d ticks for %d forks\n", uptime() - t0, FEROUNDS);
+    2a3d:	e8 a9 3a 00 00       	call   64eb <uptime>
+    2a42:	68 c8 00 00 00       	push   $0xc8
+  t0 = uptime();
+    2a47:	bb c8 00 00 00       	mov    $0xc8,%ebx
+  printf(stdout, "fork+exec bench: %d ticks for %d forks\n", uptime() - t0, FEROUNDS);
+    2a4c:	29 f0                	sub    %esi,%eax
+    2a4e:	50                   	push   %eax
+    2a4f:	68 e8 85 00 00       	push   $0x85e8
+    2a54:	ff 35 d4 9e 00 00    	push   0x9ed4
+    2a5a:	e8 61 3b 00 00       	call   65c0 <printf>
+  t0 = uptime();
+    2a5f:	e8 87 3a 00 00       	call   64eb <uptime>
+    2a64:	83 c4 10             	add    $0x10,%esp
+    2a67:	89 c6                	mov    %eax,%esi
+  for(r = 0; r < FEROUNDS; r++){
+    2a69:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(runecho("echo") != 0){
+    2a70:	83 ec 0c             	sub    $0xc,%esp
+    2a73:	68 55 72 00 00       	push   $0x7255
+    2a78:	e8 83 fd ff ff       	call   2800 <runecho>
+    2a7d:	83 c4 10             	add    $0x10,%esp
+    2a80:	85 c0                	test   %eax,%eax
+    2a82:	75 56                	jne    2ada <forkexecbench+0xea>
+  for(r = 0; r < FEROUNDS; r++){
+    2a84:	83 eb 01             	sub    $0x1,%ebx
+    2a87:	75 e7                	jne    2a70 <forkexecbench+0x80>
+  printf(stdout, "fork+exec bench: %d ticks for %d fork+execs\n", uptime() - t0, FEROUNDS);
+    2a89:	e8 5d 3a 00 00       	call   64eb <uptime>
+    2a8e:	68 c8 00 00 00       	push   $0xc8
+    2a93:	29 f0                	sub    %esi,%eax
+    2a95:	50                   	push   %eax
+    2a96:	68 38 86 00 00       	push   $0x8638
+    2a9b:	ff 35 d4 9e 00 00    	push   0x9ed4
+    2aa1:	e8 1a 3b 00 00       	call   65c0 <printf>
+  printf(stdout, "fork+exec bench ok\n");
+    2aa6:	58                   	pop    %eax
+    2aa7:	5a                   	pop    %edx
+    2aa8:	68 60 71 00 00       	push   $0x7160
+    2aad:	ff 35 d4 9e 00 00    	push   0x9ed4
+    2ab3:	e8 08 3b 00 00       	call   65c0 <printf>
+}
+    2ab8:	83 c4 10             	add    $0x10,%esp
+    2abb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    2abe:	5b                   	pop    %ebx
+    2abf:	5e                   	pop    %esi
+    2ac0:	5d                   	pop    %ebp
+    2ac1:	c3                   	ret
+      printf(stdout, "fork failed\n");
+    2ac2:	83 ec 08             	sub    $0x8,%esp
+    2ac5:	68 f4 7d 00 00       	push   $0x7df4
+    2aca:	ff 35 d4 9e 00 00    	push   0x9ed4
+    2ad0:	e8 eb 3a 00 00       	call   65c0 <printf>
+      exit();
+    2ad5:	e8 79 39 00 00       	call   6453 <exit>
+      printf(stdout, "fork+exec bench: bad output from echo\n");
+    2ada:	83 ec 08             	sub    $0x8,%esp
+    2add:	68 10 86 00 00       	push   $0x8610
+    2ae2:	ff 35 d4 9e 00 00    	push   0x9ed4
+    2ae8:	e8 d3 3a 00 00       	call   65c0 <printf>
+      exit();
+    2aed:	e8 61 39 00 00       	call   6453 <exit>
+      exit();
+    2af2:	e8 5c 39 00 00       	call   6453 <exit>
+    2af7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2afe:	66 90                	xchg   %ax,%ax
+
+00002b00 <sparseforkbench>:
+{
+    2b00:	55                   	push   %ebp
+    2b01:	89 e5                	mov    %esp,%ebp
+    2b03:	56                   	push   %esi
+    2b04:	53                   	push   %ebx
+  printf(stdout, "sparse fork bench\n");
+    2b05:	83 ec 08             	sub    $0x8,%esp
+    2b08:	68 74 71 00 00       	push   $0x7174
+    2b0d:	ff 35 d4 9e 00 00    	push   0x9ed4
+    2b13:	e8 a8 3a 00 00       	call   65c0 <printf>
+  a = sbrk(SFMB*1024*1024);
+    2b18:	c7 04 24 00 00 00 04 	movl   $0x4000000,(%esp)
+    2b1f:	e8 b7 39 00 00       	call   64db <sbrk>
+  if(a == (char*)0xffffffff){
+    2b24:	83 c4 10             	add    $0x10,%esp
+    2b27:	83 f8 ff             	cmp    $0xffffffff,%eax
+    2b2a:	0f 84 9d 00 00 00    	je     2bcd <sparseforkbench+0xcd>
+  a[0] = 1;
+    2b30:	c6 00 01             	movb   $0x1,(%eax)
+  t0 = uptime();
+    2b33:	bb c8 00 00 00       	mov    $0xc8,%ebx
+  a[SFMB*1024*1024 - 1] = 1;
+    2b38:	c6 80 ff ff ff 03 01 	movb   $0x1,0x3ffffff(%eax)
+  t0 = uptime();
+    2b3f:	e8 a7 39 00 00       	call   64eb <uptime>
+    2b44:	89 c6                	mov    %eax,%esi
+  for(r = 0; r < FEROUNDS; r++){
+    2b46:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2b4d:	8d 76 00             	lea    0x0(%esi),%esi
+    pid = fork();
+    2b50:	e8 f6 38 00 00       	call   644b <fork>
+    if(pid < 0){
+    2b55:	85 c0                	test   %eax,%eax
+    2b57:	78 57                	js     2bb0 <sparseforkbench+0xb0>
+    if(pid == 0)
+    2b59:	74 6d                	je     2bc8 <sparseforkbench+0xc8>
+    wait();
+    2b5b:	e8 fb 38 00 00       	call   645b <wait>
+  for(r = 0; r < FEROUNDS; r++){
+    2b60:	83 eb 01             	sub    $0x1,%ebx
+    2b63:	75 eb                	jne    2b50 <sparseforkbench+0x50>
+         uptime() - t0, FEROUNDS, SFMB);
+    2b65:	e8 81 39 00 00       	call   64eb <uptime>
+  printf(stdout, "sparse fork bench: %d ticks for %d forks with a %d MB heap\n",
+    2b6a:	83 ec 0c             	sub    $0xc,%esp
+    2b6d:	29 f0                	sub    %esi,%eax
+    2b6f:	6a 40                	push   $0x40
+    2b71:	68 c8 00 00 00       	push   $0xc8
+    2b76:	50                   	push   %eax
+    2b77:	68 68 86 00 00       	push   $0x8668
+    2b7c:	ff 35 d4 9e 00 00    	push   0x9ed4
+    2b82:	e8 39 3a 00 00       	call   65c0 <printf>
+  sbrk(-SFMB*1024*1024);
+    2b87:	83 c4 14             	add    $0x14,%esp
+    2b8a:	68 00 00 00 fc       	push   $0xfc000000
+    2b8f:	e8 47 39 00 00       	call   64db <sbrk>
+  printf(stdout, "sparse fork bench ok\n");
+    2b94:	58                   	pop    %eax
+    2b95:	5a                   	pop    %edx
+    2b96:	68 87 71 00 00       	push   $0x7187
+    2b9b:	ff 35 d4 9e 00 00    	push   0x9ed4
+    2ba1:	e8 1a 3a 00 00       	call   65c0 <printf>
+}
+    2ba6:	83 c4 10             	add    $0x10,%esp
+    2ba9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    2bac:	5b                   	pop    %ebx
+    2bad:	5e                   	pop    %esi
+    2bae:	5d                   	pop    %ebp
+    2baf:	c3                   	ret
+      printf(stdout, "fork failed\n");
+    2bb0:	83 ec 08             	sub    $0x8,%esp
+    2bb3:	68 f4 7d 00 00       	push   $0x7df4
+    2bb8:	ff 35 d4 9e 00 00    	push   0x9ed4
+    2bbe:	e8 fd 39 00 00       	call   65c0 <printf>
+      exit();
+    2bc3:	e8 8b 38 00 00       	call   6453 <exit>
+      exit();
+    2bc8:	e8 86 38 00 00       	call   6453 <exit>
+    printf(stdout, "sbrk failed\n");
+    2bcd:	51                   	push   %ecx
+    2bce:	51                   	push   %ecx
+    2bcf:	68 a2 6f 00 00       	push   $0x6fa2
+    2bd4:	ff 35 d4 9e 00 00    	push   0x9ed4
+    2bda:	e8 e1 39 00 00       	call   65c0 <printf>
+    exit();
+    2bdf:	e8 6f 38 00 00       	call   6453 <exit>
+    2be4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2beb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    2bef:	90                   	nop
+
+00002bf0 <ptsharetest>:
+{
+    2bf0:	55                   	push   %ebp
+    2bf1:	89 e5                	mov    %esp,%ebp
+    2bf3:	57                   	push   %edi
+    2bf4:	56                   	push   %esi
+    2bf5:	53                   	push   %ebx
+    2bf6:	81 ec 34 02 00 00    	sub    $0x234,%esp
+  printf(stdout, "shared page table test\n");
+    2bfc:	68 9d 71 00 00       	push   $0x719d
+    2c01:	ff 35 d4 9e 00 00    	push   0x9ed4
+    2c07:	e8 b4 39 00 00       	call   65c0 <printf>
+  a = sbrk(0);
+    2c0c:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    2c13:	e8 c3 38 00 00       	call   64db <sbrk>
+  b = (char*)(((uint)a + 4*1024*1024) & ~(4*1024*1024 - 1));
+    2c18:	8d b0 00 00 40 00    	lea    0x400000(%eax),%esi
+  a = sbrk(0);
+    2c1e:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+    2c24:	89 c2                	mov    %eax,%edx
+  b = (char*)(((uint)a + 4*1024*1024) & ~(4*1024*1024 - 1));
+    2c26:	81 e6 00 00 c0 ff    	and    $0xffc00000,%esi
+  top = b + PTHALF*4096;
+    2c2c:	8d 9e 00 00 04 00    	lea    0x40000(%esi),%ebx
+  if(sbrk(top - a) == (char*)0xffffffff){
+    2c32:	89 d8                	mov    %ebx,%eax
+    2c34:	29 d0                	sub    %edx,%eax
+    2c36:	89 04 24             	mov    %eax,(%esp)
+    2c39:	e8 9d 38 00 00       	call   64db <sbrk>
+    2c3e:	83 c4 10             	add    $0x10,%esp
+    2c41:	83 f8 ff             	cmp    $0xffffffff,%eax
+    2c44:	0f 84 0f 02 00 00    	je     2e59 <ptsharetest+0x269>
+    2c4a:	8d be 00 00 fc ff    	lea    -0x40000(%esi),%edi
+    2c50:	89 f8                	mov    %edi,%eax
+    2c52:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    b[i*4096] = 'p';
+    2c58:	c6 00 70             	movb   $0x70,(%eax)
+  for(i = -PTHALF; i < PTHALF; i++)
+    2c5b:	05 00 10 00 00       	add    $0x1000,%eax
+    2c60:	39 d8                	cmp    %ebx,%eax
+    2c62:	75 f4                	jne    2c58 <ptsharetest+0x68>
+  getvmstat(&st0);
+    2c64:	83 ec 0c             	sub    $0xc,%esp
+    2c67:	8d 85 d8 fd ff ff    	lea    -0x228(%ebp),%eax
+    2c6d:	50                   	push   %eax
+    2c6e:	e8 90 38 00 00       	call   6503 <getvmstat>
+  pid = fork();
+    2c73:	e8 d3 37 00 00       	call   644b <fork>
+  if(pid < 0){
+    2c78:	83 c4 10             	add    $0x10,%esp
+    2c7b:	85 c0                	test   %eax,%eax
+    2c7d:	0f 88 5c 01 00 00    	js     2ddf <ptsharetest+0x1ef>
+  if(pid == 0){
+    2c83:	75 60                	jne    2ce5 <ptsharetest+0xf5>
+    sbrk(-(PTHALF/2)*4096);
+    2c85:	83 ec 0c             	sub    $0xc,%esp
+    2c88:	81 c6 00 00 02 00    	add    $0x20000,%esi
+    2c8e:	68 00 00 fe ff       	push   $0xfffe0000
+    2c93:	e8 43 38 00 00       	call   64db <sbrk>
+    for(i = -PTHALF; i < PTHALF/2; i++){
+    2c98:	83 c4 10             	add    $0x10,%esp
+    sbrk(-(PTHALF/2)*4096);
+    2c9b:	89 f8                	mov    %edi,%eax
+    2c9d:	8d 76 00             	lea    0x0(%esi),%esi
+      if(b[i*4096] != 'p'){
+    2ca0:	0f be 08             	movsbl (%eax),%ecx
+    2ca3:	80 f9 70             	cmp    $0x70,%cl
+    2ca6:	0f 85 1a 01 00 00    	jne    2dc6 <ptsharetest+0x1d6>
+      b[i*4096] = 'c';
+    2cac:	c6 00 63             	movb   $0x63,(%eax)
+    for(i = -PTHALF; i < PTHALF/2; i++){
+    2caf:	05 00 10 00 00       	add    $0x1000,%eax
+    2cb4:	39 f0                	cmp    %esi,%eax
+    2cb6:	75 e8                	jne    2ca0 <ptsharetest+0xb0>
+    pid = fork();
+    2cb8:	e8 8e 37 00 00       	call   644b <fork>
+    if(pid == 0){
+    2cbd:	85 c0                	test   %eax,%eax
+    2cbf:	0f 85 df 00 00 00    	jne    2da4 <ptsharetest+0x1b4>
+    2cc5:	8d 76 00             	lea    0x0(%esi),%esi
+        if(b[i*4096] != 'c'){
+    2cc8:	0f be 07             	movsbl (%edi),%eax
+    2ccb:	3c 63                	cmp    $0x63,%al
+    2ccd:	0f 85 56 01 00 00    	jne    2e29 <ptsharetest+0x239>
+        b[i*4096] = 'g';
+    2cd3:	c6 07 67             	movb   $0x67,(%edi)
+      for(i = -PTHALF; i < PTHALF/2; i++){
+    2cd6:	81 c7 00 10 00 00    	add    $0x1000,%edi
+    2cdc:	39 f7                	cmp    %esi,%edi
+    2cde:	75 e8                	jne    2cc8 <ptsharetest+0xd8>
+      exit();
+    2ce0:	e8 6e 37 00 00       	call   6453 <exit>
+  wait();
+    2ce5:	e8 71 37 00 00       	call   645b <wait>
+  for(i = -PTHALF; i < PTHALF; i++){
+    2cea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(b[i*4096] != 'p'){
+    2cf0:	0f be 07             	movsbl (%edi),%eax
+    2cf3:	3c 70                	cmp    $0x70,%al
+    2cf5:	0f 85 fc 00 00 00    	jne    2df7 <ptsharetest+0x207>
+  for(i = -PTHALF; i < PTHALF; i++){
+    2cfb:	81 c7 00 10 00 00    	add    $0x1000,%edi
+    2d01:	39 df                	cmp    %ebx,%edi
+    2d03:	75 eb                	jne    2cf0 <ptsharetest+0x100>
+  getvmstat(&st1);
+    2d05:	83 ec 0c             	sub    $0xc,%esp
+    2d08:	8d 85 e0 fe ff ff    	lea    -0x120(%ebp),%eax
+    2d0e:	50                   	push   %eax
+    2d0f:	e8 ef 37 00 00       	call   6503 <getvmstat>
+  if(st1.ptshares == st0.ptshares){
+    2d14:	8b 85 c4 fe ff ff    	mov    -0x13c(%ebp),%eax
+    2d1a:	83 c4 10             	add    $0x10,%esp
+    2d1d:	39 45 cc             	cmp    %eax,-0x34(%ebp)
+    2d20:	0f 84 1c 01 00 00    	je     2e42 <ptsharetest+0x252>
+  t0 = uptime();
+    2d26:	e8 c0 37 00 00       	call   64eb <uptime>
+    2d2b:	be c8 00 00 00       	mov    $0xc8,%esi
+    2d30:	89 c7                	mov    %eax,%edi
+  for(i = 0; i < FEROUNDS; i++){
+    2d32:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    pid = fork();
+    2d38:	e8 0e 37 00 00       	call   644b <fork>
+    if(pid < 0){
+    2d3d:	85 c0                	test   %eax,%eax
+    2d3f:	0f 88 9a 00 00 00    	js     2ddf <ptsharetest+0x1ef>
+    if(pid == 0)
+    2d45:	74 99                	je     2ce0 <ptsharetest+0xf0>
+    wait();
+    2d47:	e8 0f 37 00 00       	call   645b <wait>
+  for(i = 0; i < FEROUNDS; i++){
+    2d4c:	83 ee 01             	sub    $0x1,%esi
+    2d4f:	75 e7                	jne    2d38 <ptsharetest+0x148>
+         uptime() - t0, FEROUNDS, 2*PTHALF);
+    2d51:	e8 95 37 00 00       	call   64eb <uptime>
+  printf(stdout, "shared page table: %d ticks for %d forks of %d touched pages\n",
+    2d56:	83 ec 0c             	sub    $0xc,%esp
+    2d59:	29 f8                	sub    %edi,%eax
+    2d5b:	68 80 00 00 00       	push   $0x80
+    2d60:	68 c8 00 00 00       	push   $0xc8
+    2d65:	50                   	push   %eax
+    2d66:	68 78 87 00 00       	push   $0x8778
+    2d6b:	ff 35 d4 9e 00 00    	push   0x9ed4
+    2d71:	e8 4a 38 00 00       	call   65c0 <printf>
+  sbrk(-(top - a));
+    2d76:	8b bd d4 fd ff ff    	mov    -0x22c(%ebp),%edi
+    2d7c:	83 c4 14             	add    $0x14,%esp
+    2d7f:	29 df                	sub    %ebx,%edi
+    2d81:	57                   	push   %edi
+    2d82:	e8 54 37 00 00       	call   64db <sbrk>
+  printf(stdout, "shared page table test ok\n");
+    2d87:	58                   	pop    %eax
+    2d88:	5a                   	pop    %edx
+    2d89:	68 b5 71 00 00       	push   $0x71b5
+    2d8e:	ff 35 d4 9e 00 00    	push   0x9ed4
+    2d94:	e8 27 38 00 00       	call   65c0 <printf>
+}
+    2d99:	83 c4 10             	add    $0x10,%esp
+    2d9c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    2d9f:	5b                   	pop    %ebx
+    2da0:	5e                   	pop    %esi
+    2da1:	5f                   	pop    %edi
+    2da2:	5d                   	pop    %ebp
+    2da3:	c3                   	ret
+    wait();
+    2da4:	e8 b2 36 00 00       	call   645b <wait>
+    for(i = -PTHALF; i < PTHALF/2; i++){
+    2da9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      if(b[i*4096] != 'c'){
+    2db0:	0f be 07             	movsbl (%edi),%eax
+    2db3:	3c 63                	cmp    $0x63,%al
+    2db5:	75 59                	jne    2e10 <ptsharetest+0x220>
+    for(i = -PTHALF; i < PTHALF/2; i++){
+    2db7:	81 c7 00 10 00 00    	add    $0x1000,%edi
+    2dbd:	39 f7                	cmp    %esi,%edi
+    2dbf:	75 ef                	jne    2db0 <ptsharetest+0x1c0>
+      exit();
+    2dc1:	e8 8d 36 00 00       	call   6453 <exit>
+        printf(stdout, "shared page table: child sees %c\n", b[i*4096]);
+    2dc6:	83 ec 04             	sub    $0x4,%esp
+    2dc9:	51                   	push   %ecx
+    2dca:	68 a4 86 00 00       	push   $0x86a4
+    2dcf:	ff 35 d4 9e 00 00    	push   0x9ed4
+    2dd5:	e8 e6 37 00 00       	call   65c0 <printf>
+        exit();
+    2dda:	e8 74 36 00 00       	call   6453 <exit>
+      printf(stdout, "fork failed\n");
+    2ddf:	83 ec 08             	sub    $0x8,%esp
+    2de2:	68 f4 7d 00 00       	push   $0x7df4
+    2de7:	ff 35 d4 9e 00 00    	push   0x9ed4
+    2ded:	e8 ce 37 00 00       	call   65c0 <printf>
+      exit();
+    2df2:	e8 5c 36 00 00       	call   6453 <exit>
+      printf(stdout, "shared page table: parent sees %c\n", b[i*4096]);
+    2df7:	83 ec 04             	sub    $0x4,%esp
+    2dfa:	50                   	push   %eax
+    2dfb:	68 24 87 00 00       	push   $0x8724
+    2e00:	ff 35 d4 9e 00 00    	push   0x9ed4
+    2e06:	e8 b5 37 00 00       	call   65c0 <printf>
+      exit();
+    2e0b:	e8 43 36 00 00       	call   6453 <exit>
+        printf(stdout, "shared page table: child sees %c after grandchild\n", b[i*4096]);
+    2e10:	83 ec 04             	sub    $0x4,%esp
+    2e13:	50                   	push   %eax
+    2e14:	68 f0 86 00 00       	push   $0x86f0
+    2e19:	ff 35 d4 9e 00 00    	push   0x9ed4
+    2e1f:	e8 9c 37 00 00       	call   65c0 <printf>
+        exit();
+    2e24:	e8 2a 36 00 00       	call   6453 <exit>
+          printf(stdout, "shared page table: grandchild sees %c\n", b[i*4096]);
+    2e29:	83 ec 04             	sub    $0x4,%esp
+    2e2c:	50                   	push   %eax
+    2e2d:	68 c8 86 00 00       	push   $0x86c8
+    2e32:	ff 35 d4 9e 00 00    	push   0x9ed4
+    2e38:	e8 83 37 00 00       	call   65c0 <printf>
+          exit();
+    2e3d:	e8 11 36 00 00       	call   6453 <exit>
+    printf(stdout, "shared page table: fork shared no page tables\n");
+    2e42:	51                   	push   %ecx
+    2e43:	51                   	push   %ecx
+    2e44:	68 48 87 00 00       	push   $0x8748
+    2e49:	ff 35 d4 9e 00 00    	push   0x9ed4
+    2e4f:	e8 6c 37 00 00       	call   65c0 <printf>
+    exit();
+    2e54:	e8 fa 35 00 00       	call   6453 <exit>
+    printf(stdout, "sbrk failed\n");
+    2e59:	53                   	push   %ebx
+    2e5a:	53                   	push   %ebx
+    2e5b:	68 a2 6f 00 00       	push   $0x6fa2
+    2e60:	ff 35 d4 9e 00 00    	push   0x9ed4
+    2e66:	e8 55 37 00 00       	call   65c0 <printf>
+    exit();
+    2e6b:	e8 e3 35 00 00       	call   6453 <exit>
+
+00002e70 <spawnecho>:
+{
+    2e70:	55                   	push   %ebp
+    2e71:	89 e5                	mov    %esp,%ebp
+    2e73:	56                   	push   %esi
+    2e74:	53                   	push   %ebx
+  if(pipe(p) != 0){
+    2e75:	8d 45 d0             	lea    -0x30(%ebp),%eax
+{
+    2e78:	83 ec 3c             	sub    $0x3c,%esp
+  char *args[] = { "echo", "ok", 0 };
+    2e7b:	c7 45 e0 55 72 00 00 	movl   $0x7255,-0x20(%ebp)
+    2e82:	c7 45 e4 c8 7d 00 00 	movl   $0x7dc8,-0x1c(%ebp)
+    2e89:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+  if(pipe(p) != 0){
+    2e90:	50                   	push   %eax
+    2e91:	e8 cd 35 00 00       	call   6463 <pipe>
+    2e96:	83 c4 10             	add    $0x10,%esp
+    2e99:	85 c0                	test   %eax,%eax
+    2e9b:	0f 85 9e 00 00 00    	jne    2f3f <spawnecho+0xcf>
+  fds[1] = p[1];
+    2ea1:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  pid = spawn("echo", args, fds);
+    2ea4:	83 ec 04             	sub    $0x4,%esp
+  fds[0] = 0;
+    2ea7:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  fds[2] = 2;
+    2eae:	c7 45 f4 02 00 00 00 	movl   $0x2,-0xc(%ebp)
+  fds[1] = p[1];
+    2eb5:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  pid = spawn("echo", args, fds);
+    2eb8:	8d 45 ec             	lea    -0x14(%ebp),%eax
+    2ebb:	50                   	push   %eax
+    2ebc:	8d 45 e0             	lea    -0x20(%ebp),%eax
+    2ebf:	50                   	push   %eax
+    2ec0:	68 55 72 00 00       	push   $0x7255
+    2ec5:	e8 49 36 00 00       	call   6513 <spawn>
+  close(p[1]);
+    2eca:	5a                   	pop    %edx
+    2ecb:	ff 75 d4             	push   -0x2c(%ebp)
+  pid = spawn("echo", args, fds);
+    2ece:	89 c3                	mov    %eax,%ebx
+  close(p[1]);
+    2ed0:	e8 a6 35 00 00       	call   647b <close>
+  if(pid < 0){
+    2ed5:	83 c4 10             	add    $0x10,%esp
+    2ed8:	85 db                	test   %ebx,%ebx
+    2eda:	78 4b                	js     2f27 <spawnecho+0xb7>
+  n = read(p[0], buf, sizeof(buf));
+    2edc:	83 ec 04             	sub    $0x4,%esp
+    2edf:	8d 45 d8             	lea    -0x28(%ebp),%eax
+    2ee2:	6a 08                	push   $0x8
+    2ee4:	50                   	push   %eax
+    2ee5:	ff 75 d0             	push   -0x30(%ebp)
+    2ee8:	e8 7e 35 00 00       	call   646b <read>
+    2eed:	89 c6                	mov    %eax,%esi
+  close(p[0]);
+    2eef:	58                   	pop    %eax
+    2ef0:	ff 75 d0             	push   -0x30(%ebp)
+    2ef3:	e8 83 35 00 00       	call   647b <close>
+  if(wait() != pid)
+    2ef8:	e8 5e 35 00 00       	call   645b <wait>
+  if(n != 3 || buf[0] != 'o' || buf[1] != 'k' || buf[2] != '\n')
+    2efd:	83 c4 10             	add    $0x10,%esp
+    2f00:	83 fe 03             	cmp    $0x3,%esi
+    2f03:	75 33                	jne    2f38 <spawnecho+0xc8>
+    2f05:	39 d8                	cmp    %ebx,%eax
+    2f07:	75 2f                	jne    2f38 <spawnecho+0xc8>
+    2f09:	80 7d d8 6f          	cmpb   $0x6f,-0x28(%ebp)
+    2f0d:	75 29                	jne    2f38 <spawnecho+0xc8>
+    2f0f:	80 7d d9 6b          	cmpb   $0x6b,-0x27(%ebp)
+    2f13:	75 23                	jne    2f38 <spawnecho+0xc8>
+    2f15:	31 c0                	xor    %eax,%eax
+    2f17:	80 7d da 0a          	cmpb   $0xa,-0x26(%ebp)
+    2f1b:	0f 95 c0             	setne  %al
+    2f1e:	f7 d8                	neg    %eax
+}
+    2f20:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    2f23:	5b                   	pop    %ebx
+    2f24:	5e                   	pop    %esi
+    2f25:	5d                   	pop    %ebp
+    2f26:	c3                   	ret
+    close(p[0]);
+    2f27:	83 ec 0c             	sub    $0xc,%esp
+    2f2a:	ff 75 d0             	push   -0x30(%ebp)
+    2f2d:	e8 49 35 00 00       	call   647b <close>
+    return -1;
+    2f32:	83 c4 10             	add    $0x10,%esp
+    2f35:	8d 76 00             	lea    0x0(%esi),%esi
+    2f38:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    2f3d:	eb e1                	jmp    2f20 <spawnecho+0xb0>
+    printf(stdout, "pipe() failed\n");
+    2f3f:	51                   	push   %ecx
+    2f40:	51                   	push   %ecx
+    2f41:	68 1c 6c 00 00       	push   $0x6c1c
+    2f46:	ff 35 d4 9e 00 00    	push   0x9ed4
+    2f4c:	e8 6f 36 00 00       	call   65c0 <printf>
+    exit();
+    2f51:	e8 fd 34 00 00       	call   6453 <exit>
+    2f56:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2f5d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00002f60 <spawnbench>:
+{
+    2f60:	55                   	push   %ebp
+    2f61:	89 e5                	mov    %esp,%ebp
+    2f63:	57                   	push   %edi
+    2f64:	56                   	push   %esi
+  if(spawn("nosuchfile", args, fds) >= 0){
+    2f65:	8d 75 dc             	lea    -0x24(%ebp),%esi
+{
+    2f68:	53                   	push   %ebx
+  if(spawn("nosuchfile", args, fds) >= 0){
+    2f69:	8d 5d d0             	lea    -0x30(%ebp),%ebx
+{
+    2f6c:	83 ec 44             	sub    $0x44,%esp
+  char *args[] = { "echo", "ok", 0 };
+    2f6f:	c7 45 d0 55 72 00 00 	movl   $0x7255,-0x30(%ebp)
+    2f76:	c7 45 d4 c8 7d 00 00 	movl   $0x7dc8,-0x2c(%ebp)
+    2f7d:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+  printf(stdout, "spawn bench\n");
+    2f84:	68 d0 71 00 00       	push   $0x71d0
+    2f89:	ff 35 d4 9e 00 00    	push   0x9ed4
+    2f8f:	e8 2c 36 00 00       	call   65c0 <printf>
+  if(spawn("nosuchfile", args, fds) >= 0){
+    2f94:	83 c4 0c             	add    $0xc,%esp
+  fds[0] = 0;
+    2f97:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%ebp)
+  fds[1] = 1;
+    2f9e:	c7 45 e0 01 00 00 00 	movl   $0x1,-0x20(%ebp)
+  fds[2] = 2;
+    2fa5:	c7 45 e4 02 00 00 00 	movl   $0x2,-0x1c(%ebp)
+  if(spawn("nosuchfile", args, fds) >= 0){
+    2fac:	56                   	push   %esi
+    2fad:	53                   	push   %ebx
+    2fae:	68 dd 71 00 00       	push   $0x71dd
+    2fb3:	e8 5b 35 00 00       	call   6513 <spawn>
+    2fb8:	83 c4 10             	add    $0x10,%esp
+    2fbb:	85 c0                	test   %eax,%eax
+    2fbd:	0f 89 54 01 00 00    	jns    3117 <spawnbench+0x1b7>
+  if(spawn("echo", args, fds) >= 0){
+    2fc3:	83 ec 04             	sub    $0x4,%esp
+  fds[1] = NOFILE;
+    2fc6:	c7 45 e0 10 00 00 00 	movl   $0x10,-0x20(%ebp)
+  if(spawn("echo", args, fds) >= 0){
+    2fcd:	56                   	push   %esi
+    2fce:	53                   	push   %ebx
+    2fcf:	68 55 72 00 00       	push   $0x7255
+    2fd4:	e8 3a 35 00 00       	call   6513 <spawn>
+    2fd9:	83 c4 10             	add    $0x10,%esp
+    2fdc:	85 c0                	test   %eax,%eax
+    2fde:	0f 89 4a 01 00 00    	jns    312e <spawnbench+0x1ce>
+    a = sbrk(big*4096);
+    2fe4:	83 ec 0c             	sub    $0xc,%esp
+  for(big = 0; big <= SPBIG; big += SPBIG){
+    2fe7:	31 f6                	xor    %esi,%esi
+    a = sbrk(big*4096);
+    2fe9:	31 ff                	xor    %edi,%edi
+    2feb:	6a 00                	push   $0x0
+    2fed:	e8 e9 34 00 00       	call   64db <sbrk>
+    2ff2:	83 c4 10             	add    $0x10,%esp
+    t0 = uptime();
+    2ff5:	e8 f1 34 00 00       	call   64eb <uptime>
+    2ffa:	bb c8 00 00 00       	mov    $0xc8,%ebx
+    2fff:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+    for(r = 0; r < FEROUNDS; r++){
+    3002:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(spawnecho() != 0){
+    3008:	e8 63 fe ff ff       	call   2e70 <spawnecho>
+    300d:	85 c0                	test   %eax,%eax
+    300f:	0f 85 ea 00 00 00    	jne    30ff <spawnbench+0x19f>
+    for(r = 0; r < FEROUNDS; r++){
+    3015:	83 eb 01             	sub    $0x1,%ebx
+    3018:	75 ee                	jne    3008 <spawnbench+0xa8>
+           uptime() - t0, FEROUNDS, big);
+    301a:	e8 cc 34 00 00       	call   64eb <uptime>
+    printf(stdout, "spawn bench: %d ticks for %d spawns, %d extra pages\n",
+    301f:	83 ec 0c             	sub    $0xc,%esp
+    t0 = uptime();
+    3022:	bb c8 00 00 00       	mov    $0xc8,%ebx
+    printf(stdout, "spawn bench: %d ticks for %d spawns, %d extra pages\n",
+    3027:	56                   	push   %esi
+    3028:	68 c8 00 00 00       	push   $0xc8
+    302d:	8b 4d c4             	mov    -0x3c(%ebp),%ecx
+    3030:	29 c8                	sub    %ecx,%eax
+    3032:	50                   	push   %eax
+    3033:	68 20 88 00 00       	push   $0x8820
+    3038:	ff 35 d4 9e 00 00    	push   0x9ed4
+    303e:	e8 7d 35 00 00       	call   65c0 <printf>
+    t0 = uptime();
+    3043:	83 c4 20             	add    $0x20,%esp
+    3046:	e8 a0 34 00 00       	call   64eb <uptime>
+    304b:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+    for(r = 0; r < FEROUNDS; r++){
+    304e:	66 90                	xchg   %ax,%ax
+      if(runecho("echo") != 0){
+    3050:	83 ec 0c             	sub    $0xc,%esp
+    3053:	68 55 72 00 00       	push   $0x7255
+    3058:	e8 a3 f7 ff ff       	call   2800 <runecho>
+    305d:	83 c4 10             	add    $0x10,%esp
+    3060:	85 c0                	test   %eax,%eax
+    3062:	0f 85 97 00 00 00    	jne    30ff <spawnbench+0x19f>
+    for(r = 0; r < FEROUNDS; r++){
+    3068:	83 eb 01             	sub    $0x1,%ebx
+    306b:	75 e3                	jne    3050 <spawnbench+0xf0>
+           uptime() - t0, FEROUNDS, big);
+    306d:	e8 79 34 00 00       	call   64eb <uptime>
+    printf(stdout, "spawn bench: %d ticks for %d fork+execs, %d extra pages\n",
+    3072:	83 ec 0c             	sub    $0xc,%esp
+    sbrk(-big*4096);
+    3075:	f7 df                	neg    %edi
+    printf(stdout, "spawn bench: %d ticks for %d fork+execs, %d extra pages\n",
+    3077:	56                   	push   %esi
+    3078:	68 c8 00 00 00       	push   $0xc8
+    307d:	8b 4d c4             	mov    -0x3c(%ebp),%ecx
+    3080:	29 c8                	sub    %ecx,%eax
+    3082:	50                   	push   %eax
+    3083:	68 58 88 00 00       	push   $0x8858
+    3088:	ff 35 d4 9e 00 00    	push   0x9ed4
+    308e:	e8 2d 35 00 00       	call   65c0 <printf>
+    sbrk(-big*4096);
+    3093:	83 c4 14             	add    $0x14,%esp
+    3096:	57                   	push   %edi
+    3097:	e8 3f 34 00 00       	call   64db <sbrk>
+  for(big = 0; big <= SPBIG; big += SPBIG){
+    309c:	83 c4 10             	add    $0x10,%esp
+    309f:	81 fe 00 01 00 00    	cmp    $0x100,%esi
+    30a5:	74 3a                	je     30e1 <spawnbench+0x181>
+    a = sbrk(big*4096);
+    30a7:	83 ec 0c             	sub    $0xc,%esp
+    30aa:	bf 00 00 10 00       	mov    $0x100000,%edi
+    30af:	be 00 01 00 00       	mov    $0x100,%esi
+    30b4:	68 00 00 10 00       	push   $0x100000
+    30b9:	e8 1d 34 00 00       	call   64db <sbrk>
+    for(i = 0; i < big; i++)
+    30be:	83 c4 10             	add    $0x10,%esp
+    30c1:	8d 90 00 00 10 00    	lea    0x100000(%eax),%edx
+    30c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    30ce:	66 90                	xchg   %ax,%ax
+      a[i*4096] = 1;
+    30d0:	c6 00 01             	movb   $0x1,(%eax)
+    for(i = 0; i < big; i++)
+    30d3:	05 00 10 00 00       	add    $0x1000,%eax
+    30d8:	39 c2                	cmp    %eax,%edx
+    30da:	75 f4                	jne    30d0 <spawnbench+0x170>
+    30dc:	e9 14 ff ff ff       	jmp    2ff5 <spawnbench+0x95>
+  printf(stdout, "spawn bench ok\n");
+    30e1:	83 ec 08             	sub    $0x8,%esp
+    30e4:	68 e8 71 00 00       	push   $0x71e8
+    30e9:	ff 35 d4 9e 00 00    	push   0x9ed4
+    30ef:	e8 cc 34 00 00       	call   65c0 <printf>
+}
+    30f4:	83 c4 10             	add    $0x10,%esp
+    30f7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    30fa:	5b                   	pop    %ebx
+    30fb:	5e                   	pop    %esi
+    30fc:	5f                   	pop    %edi
+    30fd:	5d                   	pop    %ebp
+    30fe:	c3                   	ret
+        printf(stdout, "spawn bench: bad output from echo\n");
+    30ff:	83 ec 08             	sub    $0x8,%esp
+    3102:	68 fc 87 00 00       	push   $0x87fc
+    3107:	ff 35 d4 9e 00 00    	push   0x9ed4
+    310d:	e8 ae 34 00 00       	call   65c0 <printf>
+        exit();
+    3112:	e8 3c 33 00 00       	call   6453 <exit>
+    printf(stdout, "spawn of a missing file succeeded\n");
+    3117:	52                   	push   %edx
+    3118:	52                   	push   %edx
+    3119:	68 b8 87 00 00       	push   $0x87b8
+    311e:	ff 35 d4 9e 00 00    	push   0x9ed4
+    3124:	e8 97 34 00 00       	call   65c0 <printf>
+    exit();
+    3129:	e8 25 33 00 00       	call   6453 <exit>
+    printf(stdout, "spawn with a bad fd succeeded\n");
+    312e:	50                   	push   %eax
+    312f:	50                   	push   %eax
+    3130:	68 dc 87 00 00       	push   $0x87dc
+    3135:	ff 35 d4 9e 00 00    	push   0x9ed4
+    313b:	e8 80 34 00 00       	call   65c0 <printf>
+    exit();
+    3140:	e8 0e 33 00 00       	call   6453 <exit>
+    3145:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    314c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00003150 <tlbtest>:
+{
+    3150:	55                   	push   %ebp
+    3151:	89 e5                	mov    %esp,%ebp
+    3153:	57                   	push   %edi
+    3154:	56                   	push   %esi
+    3155:	53                   	push   %ebx
+    3156:	81 ec 24 02 00 00    	sub    $0x224,%esp
+  printf(stdout, "tlb test\n");
+    315c:	68 f8 71 00 00       	push   $0x71f8
+    3161:	ff 35 d4 9e 00 00    	push   0x9ed4
+    3167:	e8 54 34 00 00       	call   65c0 <printf>
+  a = sbrk(TLBPAGES*4096);
+    316c:	c7 04 24 00 00 02 00 	movl   $0x20000,(%esp)
+    3173:	e8 63 33 00 00       	call   64db <sbrk>
+  if(a == (char*)0xffffffff){
+    3178:	83 c4 10             	add    $0x10,%esp
+    317b:	83 f8 ff             	cmp    $0xffffffff,%eax
+    317e:	0f 84 38 01 00 00    	je     32bc <tlbtest+0x16c>
+    3184:	89 c6                	mov    %eax,%esi
+    3186:	89 c3                	mov    %eax,%ebx
+    3188:	8d b8 00 00 02 00    	lea    0x20000(%eax),%edi
+    318e:	66 90                	xchg   %ax,%ax
+    a[i*4096] = 'p';
+    3190:	c6 00 70             	movb   $0x70,(%eax)
+  for(i = 0; i < TLBPAGES; i++)
+    3193:	05 00 10 00 00       	add    $0x1000,%eax
+    3198:	39 f8                	cmp    %edi,%eax
+    319a:	75 f4                	jne    3190 <tlbtest+0x40>
+  pid = fork();
+    319c:	e8 aa 32 00 00       	call   644b <fork>
+  if(pid < 0){
+    31a1:	85 c0                	test   %eax,%eax
+    31a3:	0f 88 fc 00 00 00    	js     32a5 <tlbtest+0x155>
+  if(pid == 0){
+    31a9:	0f 85 7e 00 00 00    	jne    322d <tlbtest+0xdd>
+    31af:	89 f0                	mov    %esi,%eax
+    31b1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      if(a[i*4096] != 'p'){
+    31b8:	0f be 10             	movsbl (%eax),%edx
+    31bb:	80 fa 70             	cmp    $0x70,%dl
+    31be:	0f 85 af 00 00 00    	jne    3273 <tlbtest+0x123>
+    for(i = 0; i < TLBPAGES; i++)
+    31c4:	05 00 10 00 00       	add    $0x1000,%eax
+    31c9:	39 f8                	cmp    %edi,%eax
+    31cb:	75 eb                	jne    31b8 <tlbtest+0x68>
+    getvmstat(&st0);
+    31cd:	83 ec 0c             	sub    $0xc,%esp
+    31d0:	8d 85 d8 fd ff ff    	lea    -0x228(%ebp),%eax
+    31d6:	50                   	push   %eax
+    31d7:	e8 27 33 00 00       	call   6503 <getvmstat>
+    31dc:	83 c4 10             	add    $0x10,%esp
+    31df:	90                   	nop
+      a[i*4096] = 'c';
+    31e0:	c6 03 63             	movb   $0x63,(%ebx)
+    for(i = 0; i < TLBPAGES; i++){
+    31e3:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+    31e9:	39 fb                	cmp    %edi,%ebx
+    31eb:	75 f3                	jne    31e0 <tlbtest+0x90>
+    getvmstat(&st1);
+    31ed:	83 ec 0c             	sub    $0xc,%esp
+    31f0:	8d 85 e0 fe ff ff    	lea    -0x120(%ebp),%eax
+    31f6:	50                   	push   %eax
+    31f7:	e8 07 33 00 00       	call   6503 <getvmstat>
+    if(st1.tlbinvlpgs - st0.tlbinvlpgs < TLBPAGES){
+    31fc:	8b 45 d8             	mov    -0x28(%ebp),%eax
+    31ff:	2b 85 d0 fe ff ff    	sub    -0x130(%ebp),%eax
+    3205:	83 c4 10             	add    $0x10,%esp
+    3208:	83 f8 1f             	cmp    $0x1f,%eax
+    320b:	77 1b                	ja     3228 <tlbtest+0xd8>
+      printf(stdout, "tlb test: %d invlpgs for %d copies\n",
+    320d:	6a 20                	push   $0x20
+    320f:	50                   	push   %eax
+    3210:	68 94 88 00 00       	push   $0x8894
+    3215:	ff 35 d4 9e 00 00    	push   0x9ed4
+    321b:	e8 a0 33 00 00       	call   65c0 <printf>
+      exit();
+    3220:	e8 2e 32 00 00       	call   6453 <exit>
+    3225:	8d 76 00             	lea    0x0(%esi),%esi
+    exit();
+    3228:	e8 26 32 00 00       	call   6453 <exit>
+  wait();
+    322d:	e8 29 32 00 00       	call   645b <wait>
+  for(i = 0; i < TLBPAGES; i++)
+    3232:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(a[i*4096] != 'p'){
+    3238:	0f be 03             	movsbl (%ebx),%eax
+    323b:	3c 70                	cmp    $0x70,%al
+    323d:	75 4d                	jne    328c <tlbtest+0x13c>
+  for(i = 0; i < TLBPAGES; i++)
+    323f:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+    3245:	39 fb                	cmp    %edi,%ebx
+    3247:	75 ef                	jne    3238 <tlbtest+0xe8>
+  sbrk(-TLBPAGES*4096);
+    3249:	83 ec 0c             	sub    $0xc,%esp
+    324c:	68 00 00 fe ff       	push   $0xfffe0000
+    3251:	e8 85 32 00 00       	call   64db <sbrk>
+  printf(stdout, "tlb test ok\n");
+    3256:	58                   	pop    %eax
+    3257:	5a                   	pop    %edx
+    3258:	68 35 72 00 00       	push   $0x7235
+    325d:	ff 35 d4 9e 00 00    	push   0x9ed4
+    3263:	e8 58 33 00 00       	call   65c0 <printf>
+}
+    3268:	83 c4 10             	add    $0x10,%esp
+    326b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    326e:	5b                   	pop    %ebx
+    326f:	5e                   	pop    %esi
+    3270:	5f                   	pop    %edi
+    3271:	5d                   	pop    %ebp
+    3272:	c3                   	ret
+        printf(stdout, "tlb test: child sees %c\n", a[i*4096]);
+    3273:	83 ec 04             	sub    $0x4,%esp
+    3276:	52                   	push   %edx
+    3277:	68 02 72 00 00       	push   $0x7202
+    327c:	ff 35 d4 9e 00 00    	push   0x9ed4
+    3282:	e8 39 33 00 00       	call   65c0 <printf>
+        exit();
+    3287:	e8 c7 31 00 00       	call   6453 <exit>
+      printf(stdout, "tlb test: parent sees %c\n", a[i*4096]);
+    328c:	83 ec 04             	sub    $0x4,%esp
+    328f:	50                   	push   %eax
+    3290:	68 1b 72 00 00       	push   $0x721b
+    3295:	ff 35 d4 9e 00 00    	push   0x9ed4
+    329b:	e8 20 33 00 00       	call   65c0 <printf>
+      exit();
+    32a0:	e8 ae 31 00 00       	call   6453 <exit>
+    printf(stdout, "fork failed\n");
+    32a5:	51                   	push   %ecx
+    32a6:	51                   	push   %ecx
+    32a7:	68 f4 7d 00 00       	push   $0x7df4
+    32ac:	ff 35 d4 9e 00 00    	push   0x9ed4
+    32b2:	e8 09 33 00 00       	call   65c0 <printf>
+    exit();
+    32b7:	e8 97 31 00 00       	call   6453 <exit>
+    printf(stdout, "sbrk failed\n");
+    32bc:	53                   	push   %ebx
+    32bd:	53                   	push   %ebx
+    32be:	68 a2 6f 00 00       	push   $0x6fa2
+    32c3:	ff 35 d4 9e 00 00    	push   0x9ed4
+    32c9:	e8 f2 32 00 00       	call   65c0 <printf>
+    exit();
+    32ce:	e8 80 31 00 00       	call   6453 <exit>
+    32d3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    32da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000032e0 <pcachetest>:
+{
+    32e0:	55                   	push   %ebp
+    32e1:	89 e5                	mov    %esp,%ebp
+    32e3:	57                   	push   %edi
+    32e4:	56                   	push   %esi
+    32e5:	53                   	push   %ebx
+    32e6:	81 ec 34 04 00 00    	sub    $0x434,%esp
+  printf(stdout, "page cache test\n");
+    32ec:	68 42 72 00 00       	push   $0x7242
+    32f1:	ff 35 d4 9e 00 00    	push   0x9ed4
+    32f7:	e8 c4 32 00 00       	call   65c0 <printf>
+  unlink("pcecho");
+    32fc:	c7 04 24 53 72 00 00 	movl   $0x7253,(%esp)
+    3303:	e8 9b 31 00 00       	call   64a3 <unlink>
+  in = open("echo", 0);
+    3308:	58                   	pop    %eax
+    3309:	5a                   	pop    %edx
+    330a:	6a 00                	push   $0x0
+    330c:	68 55 72 00 00       	push   $0x7255
+    3311:	e8 7d 31 00 00       	call   6493 <open>
+  out = open("pcecho", O_CREATE|O_RDWR);
+    3316:	59                   	pop    %ecx
+    3317:	5b                   	pop    %ebx
+    3318:	68 02 02 00 00       	push   $0x202
+    331d:	68 53 72 00 00       	push   $0x7253
+  in = open("echo", 0);
+    3322:	89 c6                	mov    %eax,%esi
+  out = open("pcecho", O_CREATE|O_RDWR);
+    3324:	e8 6a 31 00 00       	call   6493 <open>
+  if(in < 0 || out < 0){
+    3329:	83 c4 10             	add    $0x10,%esp
+  out = open("pcecho", O_CREATE|O_RDWR);
+    332c:	89 85 d4 fb ff ff    	mov    %eax,-0x42c(%ebp)
+  if(in < 0 || out < 0){
+    3332:	09 f0                	or     %esi,%eax
+    3334:	0f 88 9b 02 00 00    	js     35d5 <pcachetest+0x2f5>
+    333a:	8d 9d e8 fd ff ff    	lea    -0x218(%ebp),%ebx
+    3340:	eb 21                	jmp    3363 <pcachetest+0x83>
+    3342:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(write(out, buf, n) != n){
+    3348:	83 ec 04             	sub    $0x4,%esp
+    334b:	57                   	push   %edi
+    334c:	53                   	push   %ebx
+    334d:	ff b5 d4 fb ff ff    	push   -0x42c(%ebp)
+    3353:	e8 1b 31 00 00       	call   6473 <write>
+    3358:	83 c4 10             	add    $0x10,%esp
+    335b:	39 f8                	cmp    %edi,%eax
+    335d:	0f 85 fd 01 00 00    	jne    3560 <pcachetest+0x280>
+  while((n = read(in, buf, sizeof(buf))) > 0){
+    3363:	83 ec 04             	sub    $0x4,%esp
+    3366:	68 00 02 00 00       	push   $0x200
+    336b:	53                   	push   %ebx
+    336c:	56                   	push   %esi
+    336d:	e8 f9 30 00 00       	call   646b <read>
+    3372:	83 c4 10             	add    $0x10,%esp
+    3375:	89 c7                	mov    %eax,%edi
+    3377:	85 c0                	test   %eax,%eax
+    3379:	7f cd                	jg     3348 <pcachetest+0x68>
+  close(in);
+    337b:	83 ec 0c             	sub    $0xc,%esp
+    337e:	56                   	push   %esi
+    337f:	e8 f7 30 00 00       	call   647b <close>
+  if(runecho("pcecho") != 0){
+    3384:	c7 04 24 53 72 00 00 	movl   $0x7253,(%esp)
+    338b:	e8 70 f4 ff ff       	call   2800 <runecho>
+    3390:	83 c4 10             	add    $0x10,%esp
+    3393:	85 c0                	test   %eax,%eax
+    3395:	0f 85 dd 01 00 00    	jne    3578 <pcachetest+0x298>
+  getvmstat(&st0);
+    339b:	83 ec 0c             	sub    $0xc,%esp
+    339e:	8d 85 d8 fb ff ff    	lea    -0x428(%ebp),%eax
+    33a4:	be 0a 00 00 00       	mov    $0xa,%esi
+    33a9:	50                   	push   %eax
+    33aa:	e8 54 31 00 00       	call   6503 <getvmstat>
+    33af:	83 c4 10             	add    $0x10,%esp
+    33b2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(runecho("pcecho") != 0){
+    33b8:	83 ec 0c             	sub    $0xc,%esp
+    33bb:	68 53 72 00 00       	push   $0x7253
+    33c0:	e8 3b f4 ff ff       	call   2800 <runecho>
+    33c5:	83 c4 10             	add    $0x10,%esp
+    33c8:	85 c0                	test   %eax,%eax
+    33ca:	0f 85 a8 01 00 00    	jne    3578 <pcachetest+0x298>
+  for(r = 0; r < 10; r++){
+    33d0:	83 ee 01             	sub    $0x1,%esi
+    33d3:	75 e3                	jne    33b8 <pcachetest+0xd8>
+  getvmstat(&st1);
+    33d5:	83 ec 0c             	sub    $0xc,%esp
+    33d8:	8d 85 e0 fc ff ff    	lea    -0x320(%ebp),%eax
+    33de:	50                   	push   %eax
+    33df:	e8 1f 31 00 00       	call   6503 <getvmstat>
+  if(st1.filepages != st0.filepages || st1.fileshared == st0.fileshared){
+    33e4:	8b 95 a0 fd ff ff    	mov    -0x260(%ebp),%edx
+    33ea:	8b 8d 98 fc ff ff    	mov    -0x368(%ebp),%ecx
+    33f0:	83 c4 10             	add    $0x10,%esp
+    33f3:	8b 85 a8 fd ff ff    	mov    -0x258(%ebp),%eax
+    33f9:	39 ca                	cmp    %ecx,%edx
+    33fb:	0f 85 30 02 00 00    	jne    3631 <pcachetest+0x351>
+    3401:	3b 85 a0 fc ff ff    	cmp    -0x360(%ebp),%eax
+    3407:	0f 84 24 02 00 00    	je     3631 <pcachetest+0x351>
+  close(out);
+    340d:	83 ec 0c             	sub    $0xc,%esp
+    3410:	ff b5 d4 fb ff ff    	push   -0x42c(%ebp)
+    3416:	e8 60 30 00 00       	call   647b <close>
+  out = open("pcecho", O_RDWR);
+    341b:	5e                   	pop    %esi
+    341c:	5f                   	pop    %edi
+    341d:	6a 02                	push   $0x2
+    341f:	68 53 72 00 00       	push   $0x7253
+    3424:	e8 6a 30 00 00       	call   6493 <open>
+  if(out < 0 || (n = read(out, buf, sizeof(buf))) != sizeof(buf)){
+    3429:	83 c4 10             	add    $0x10,%esp
+  out = open("pcecho", O_RDWR);
+    342c:	89 c6                	mov    %eax,%esi
+  if(out < 0 || (n = read(out, buf, sizeof(buf))) != sizeof(buf)){
+    342e:	85 c0                	test   %eax,%eax
+    3430:	0f 88 5a 01 00 00    	js     3590 <pcachetest+0x2b0>
+    3436:	83 ec 04             	sub    $0x4,%esp
+    3439:	68 00 02 00 00       	push   $0x200
+    343e:	53                   	push   %ebx
+    343f:	50                   	push   %eax
+    3440:	e8 26 30 00 00       	call   646b <read>
+    3445:	83 c4 10             	add    $0x10,%esp
+    3448:	3d 00 02 00 00       	cmp    $0x200,%eax
+    344d:	0f 85 3d 01 00 00    	jne    3590 <pcachetest+0x2b0>
+  close(out);
+    3453:	83 ec 0c             	sub    $0xc,%esp
+    3456:	56                   	push   %esi
+    3457:	e8 1f 30 00 00       	call   647b <close>
+  out = open("pcecho", O_RDWR);
+    345c:	58                   	pop    %eax
+    345d:	5a                   	pop    %edx
+    345e:	6a 02                	push   $0x2
+    3460:	68 53 72 00 00       	push   $0x7253
+    3465:	e8 29 30 00 00       	call   6493 <open>
+    346a:	89 c6                	mov    %eax,%esi
+  getvmstat(&st0);
+    346c:	8d 85 d8 fb ff ff    	lea    -0x428(%ebp),%eax
+    3472:	89 04 24             	mov    %eax,(%esp)
+    3475:	e8 89 30 00 00       	call   6503 <getvmstat>
+  if(write(out, buf, n) != n){
+    347a:	83 c4 0c             	add    $0xc,%esp
+    347d:	68 00 02 00 00       	push   $0x200
+    3482:	53                   	push   %ebx
+    3483:	56                   	push   %esi
+    3484:	e8 ea 2f 00 00       	call   6473 <write>
+    3489:	83 c4 10             	add    $0x10,%esp
+    348c:	3d 00 02 00 00       	cmp    $0x200,%eax
+    3491:	0f 85 27 01 00 00    	jne    35be <pcachetest+0x2de>
+  close(out);
+    3497:	83 ec 0c             	sub    $0xc,%esp
+    349a:	56                   	push   %esi
+    349b:	e8 db 2f 00 00       	call   647b <close>
+  getvmstat(&st1);
+    34a0:	8d 85 e0 fc ff ff    	lea    -0x320(%ebp),%eax
+    34a6:	89 04 24             	mov    %eax,(%esp)
+    34a9:	e8 55 30 00 00       	call   6503 <getvmstat>
+  if(st1.pcacheinvalidates == st0.pcacheinvalidates){
+    34ae:	8b 85 b8 fc ff ff    	mov    -0x348(%ebp),%eax
+    34b4:	83 c4 10             	add    $0x10,%esp
+    34b7:	39 85 c0 fd ff ff    	cmp    %eax,-0x240(%ebp)
+    34bd:	0f 84 e4 00 00 00    	je     35a7 <pcachetest+0x2c7>
+  if(runecho("pcecho") != 0){
+    34c3:	83 ec 0c             	sub    $0xc,%esp
+    34c6:	68 53 72 00 00       	push   $0x7253
+    34cb:	e8 30 f3 ff ff       	call   2800 <runecho>
+    34d0:	83 c4 10             	add    $0x10,%esp
+    34d3:	85 c0                	test   %eax,%eax
+    34d5:	0f 85 3f 01 00 00    	jne    361a <pcachetest+0x33a>
+  unlink("pcecho");
+    34db:	83 ec 0c             	sub    $0xc,%esp
+    34de:	68 53 72 00 00       	push   $0x7253
+    34e3:	e8 bb 2f 00 00       	call   64a3 <unlink>
+  out = open("/usertests", O_RDWR);
+    34e8:	5e                   	pop    %esi
+    34e9:	5f                   	pop    %edi
+    34ea:	6a 02                	push   $0x2
+    34ec:	68 5a 72 00 00       	push   $0x725a
+    34f1:	e8 9d 2f 00 00       	call   6493 <open>
+  if(out < 0 || read(out, buf, sizeof(buf)) != sizeof(buf)){
+    34f6:	83 c4 10             	add    $0x10,%esp
+  out = open("/usertests", O_RDWR);
+    34f9:	89 c6                	mov    %eax,%esi
+  if(out < 0 || read(out, buf, sizeof(buf)) != sizeof(buf)){
+    34fb:	85 c0                	test   %eax,%eax
+    34fd:	0f 88 00 01 00 00    	js     3603 <pcachetest+0x323>
+    3503:	83 ec 04             	sub    $0x4,%esp
+    3506:	68 00 02 00 00       	push   $0x200
+    350b:	53                   	push   %ebx
+    350c:	50                   	push   %eax
+    350d:	e8 59 2f 00 00       	call   646b <read>
+    3512:	83 c4 10             	add    $0x10,%esp
+    3515:	3d 00 02 00 00       	cmp    $0x200,%eax
+    351a:	0f 85 e3 00 00 00    	jne    3603 <pcachetest+0x323>
+  if(write(out, buf, sizeof(buf)) >= 0){
+    3520:	83 ec 04             	sub    $0x4,%esp
+    3523:	68 00 02 00 00       	push   $0x200
+    3528:	53                   	push   %ebx
+    3529:	56                   	push   %esi
+    352a:	e8 44 2f 00 00       	call   6473 <write>
+    352f:	83 c4 10             	add    $0x10,%esp
+    3532:	85 c0                	test   %eax,%eax
+    3534:	0f 89 b2 00 00 00    	jns    35ec <pcachetest+0x30c>
+  close(out);
+    353a:	83 ec 0c             	sub    $0xc,%esp
+    353d:	56                   	push   %esi
+    353e:	e8 38 2f 00 00       	call   647b <close>
+  printf(stdout, "page cache test ok\n");
+    3543:	58                   	pop    %eax
+    3544:	5a                   	pop    %edx
+    3545:	68 65 72 00 00       	push   $0x7265
+    354a:	ff 35 d4 9e 00 00    	push   0x9ed4
+    3550:	e8 6b 30 00 00       	call   65c0 <printf>
+}
+    3555:	83 c4 10             	add    $0x10,%esp
+    3558:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    355b:	5b                   	pop    %ebx
+    355c:	5e                   	pop    %esi
+    355d:	5f                   	pop    %edi
+    355e:	5d                   	pop    %ebp
+    355f:	c3                   	ret
+      printf(stdout, "page cache test: write failed\n");
+    3560:	83 ec 08             	sub    $0x8,%esp
+    3563:	68 dc 88 00 00       	push   $0x88dc
+    3568:	ff 35 d4 9e 00 00    	push   0x9ed4
+    356e:	e8 4d 30 00 00       	call   65c0 <printf>
+      exit();
+    3573:	e8 db 2e 00 00       	call   6453 <exit>
+      printf(stdout, "page cache test: pcecho failed\n");
+    3578:	83 ec 08             	sub    $0x8,%esp
+    357b:	68 fc 88 00 00       	push   $0x88fc
+    3580:	ff 35 d4 9e 00 00    	push   0x9ed4
+    3586:	e8 35 30 00 00       	call   65c0 <printf>
+      exit();
+    358b:	e8 c3 2e 00 00       	call   6453 <exit>
+    printf(stdout, "page cache test: reread failed\n");
+    3590:	51                   	push   %ecx
+    3591:	51                   	push   %ecx
+    3592:	68 58 89 00 00       	push   $0x8958
+    3597:	ff 35 d4 9e 00 00    	push   0x9ed4
+    359d:	e8 1e 30 00 00       	call   65c0 <printf>
+    exit();
+    35a2:	e8 ac 2e 00 00       	call   6453 <exit>
+    printf(stdout, "page cache test: rewrite kept cached pages\n");
+    35a7:	50                   	push   %eax
+    35a8:	50                   	push   %eax
+    35a9:	68 9c 89 00 00       	push   $0x899c
+    35ae:	ff 35 d4 9e 00 00    	push   0x9ed4
+    35b4:	e8 07 30 00 00       	call   65c0 <printf>
+    exit();
+    35b9:	e8 95 2e 00 00       	call   6453 <exit>
+    printf(stdout, "page cache test: rewrite failed\n");
+    35be:	50                   	push   %eax
+    35bf:	50                   	push   %eax
+    35c0:	68 78 89 00 00       	push   $0x8978
+    35c5:	ff 35 d4 9e 00 00    	push   0x9ed4
+    35cb:	e8 f0 2f 00 00       	call   65c0 <printf>
+    exit();
+    35d0:	e8 7e 2e 00 00       	call   6453 <exit>
+    printf(stdout, "page cache test: cannot copy echo\n");
+    35d5:	50                   	push   %eax
+    35d6:	50                   	push   %eax
+    35d7:	68 b8 88 00 00       	push   $0x88b8
+    35dc:	ff 35 d4 9e 00 00    	push   0x9ed4
+    35e2:	e8 d9 2f 00 00       	call   65c0 <printf>
+    exit();
+    35e7:	e8 67 2e 00 00       	call   6453 <exit>
+    printf(stdout, "page cache test: wrote to a running binary\n");
+    35ec:	51                   	push   %ecx
+    35ed:	51                   	push   %ecx
+    35ee:	68 20 8a 00 00       	push   $0x8a20
+    35f3:	ff 35 d4 9e 00 00    	push   0x9ed4
+    35f9:	e8 c2 2f 00 00       	call   65c0 <printf>
+    exit();
+    35fe:	e8 50 2e 00 00       	call   6453 <exit>
+    printf(stdout, "page cache test: cannot read usertests\n");
+    3603:	53                   	push   %ebx
+    3604:	53                   	push   %ebx
+    3605:	68 f8 89 00 00       	push   $0x89f8
+    360a:	ff 35 d4 9e 00 00    	push   0x9ed4
+    3610:	e8 ab 2f 00 00       	call   65c0 <printf>
+    exit();
+    3615:	e8 39 2e 00 00       	call   6453 <exit>
+    printf(stdout, "page cache test: pcecho failed after rewrite\n");
+    361a:	50                   	push   %eax
+    361b:	50                   	push   %eax
+    361c:	68 c8 89 00 00       	push   $0x89c8
+    3621:	ff 35 d4 9e 00 00    	push   0x9ed4
+    3627:	e8 94 2f 00 00       	call   65c0 <printf>
+    exit();
+    362c:	e8 22 2e 00 00       	call   6453 <exit>
+    printf(stdout, "page cache test: %d pages read, %d shared on repeat runs\n",
+    3631:	2b 85 a0 fc ff ff    	sub    -0x360(%ebp),%eax
+    3637:	29 ca                	sub    %ecx,%edx
+    3639:	50                   	push   %eax
+    363a:	52                   	push   %edx
+    363b:	68 1c 89 00 00       	push   $0x891c
+    3640:	ff 35 d4 9e 00 00    	push   0x9ed4
+    3646:	e8 75 2f 00 00       	call   65c0 <printf>
+    exit();
+    364b:	e8 03 2e 00 00       	call   6453 <exit>
+
+00003650 <rmapstress>:
+{
+    3650:	55                   	push   %ebp
+    3651:	89 e5                	mov    %esp,%ebp
+    3653:	57                   	push   %edi
+    3654:	56                   	push   %esi
+    3655:	53                   	push   %ebx
+    3656:	83 ec 34             	sub    $0x34,%esp
+  printf(stdout, "rmap stress test\n");
+    3659:	68 79 72 00 00       	push   $0x7279
+    365e:	ff 35 d4 9e 00 00    	push   0x9ed4
+    3664:	e8 57 2f 00 00       	call   65c0 <printf>
+  a = sbrk(RSPAGES*4096);
+    3669:	c7 04 24 00 00 04 00 	movl   $0x40000,(%esp)
+    3670:	e8 66 2e 00 00       	call   64db <sbrk>
+  if(a == (char*)0xffffffff){
+    3675:	83 c4 10             	add    $0x10,%esp
+  a = sbrk(RSPAGES*4096);
+    3678:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(a == (char*)0xffffffff){
+    367b:	83 f8 ff             	cmp    $0xffffffff,%eax
+    367e:	0f 84 8e 01 00 00    	je     3812 <rmapstress+0x1c2>
+    3684:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    3687:	89 c1                	mov    %eax,%ecx
+    3689:	8d 98 00 00 04 00    	lea    0x40000(%eax),%ebx
+    368f:	90                   	nop
+    a[i*4096] = 'p';
+    3690:	c6 00 70             	movb   $0x70,(%eax)
+  for(i = 0; i < RSPAGES; i++)
+    3693:	05 00 10 00 00       	add    $0x1000,%eax
+    3698:	39 d8                	cmp    %ebx,%eax
+    369a:	75 f4                	jne    3690 <rmapstress+0x40>
+  for(j = 0; j < RSPROCS; j++){
+    369c:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+    36a3:	89 de                	mov    %ebx,%esi
+    36a5:	89 cb                	mov    %ecx,%ebx
+    pid = fork();
+    36a7:	e8 9f 2d 00 00       	call   644b <fork>
+    36ac:	89 c7                	mov    %eax,%edi
+    if(pid < 0){
+    36ae:	85 c0                	test   %eax,%eax
+    36b0:	0f 88 44 01 00 00    	js     37fa <rmapstress+0x1aa>
+    if(pid > 0)
+    36b6:	0f 85 90 00 00 00    	jne    374c <rmapstress+0xfc>
+        if(a[i*4096] != (r == 0 ? 'p' : 'a' + j)){
+    36bc:	8b 45 d8             	mov    -0x28(%ebp),%eax
+    36bf:	89 d9                	mov    %ebx,%ecx
+    36c1:	89 f3                	mov    %esi,%ebx
+    36c3:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+    36c6:	8d 70 61             	lea    0x61(%eax),%esi
+    36c9:	89 75 dc             	mov    %esi,-0x24(%ebp)
+        a[i*4096] = 'a' + j;
+    36cc:	8d 70 61             	lea    0x61(%eax),%esi
+    36cf:	89 f1                	mov    %esi,%ecx
+    36d1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      for(i = 0; i < RSPAGES; i++){
+    36d8:	85 ff                	test   %edi,%edi
+    36da:	be 70 00 00 00       	mov    $0x70,%esi
+  for(j = 0; j < RSPROCS; j++){
+    36df:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    36e2:	0f 45 75 dc          	cmovne -0x24(%ebp),%esi
+    36e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    36ed:	8d 76 00             	lea    0x0(%esi),%esi
+        if(a[i*4096] != (r == 0 ? 'p' : 'a' + j)){
+    36f0:	0f be 10             	movsbl (%eax),%edx
+    36f3:	39 f2                	cmp    %esi,%edx
+    36f5:	0f 85 b8 00 00 00    	jne    37b3 <rmapstress+0x163>
+      for(i = 0; i < RSPAGES; i++){
+    36fb:	05 00 10 00 00       	add    $0x1000,%eax
+    3700:	39 d8                	cmp    %ebx,%eax
+    3702:	75 ec                	jne    36f0 <rmapstress+0xa0>
+      gpid = fork();
+    3704:	88 4d e3             	mov    %cl,-0x1d(%ebp)
+    3707:	e8 3f 2d 00 00       	call   644b <fork>
+      if(gpid < 0){
+    370c:	0f b6 4d e3          	movzbl -0x1d(%ebp),%ecx
+    3710:	85 c0                	test   %eax,%eax
+    3712:	0f 88 e2 00 00 00    	js     37fa <rmapstress+0x1aa>
+      if(gpid == 0){
+    3718:	0f 84 c7 00 00 00    	je     37e5 <rmapstress+0x195>
+        a[i*4096] = 'a' + j;
+    371e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    3721:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3728:	88 08                	mov    %cl,(%eax)
+      for(i = 0; i < RSPAGES; i++)
+    372a:	05 00 10 00 00       	add    $0x1000,%eax
+    372f:	39 d8                	cmp    %ebx,%eax
+    3731:	75 f5                	jne    3728 <rmapstress+0xd8>
+    for(r = 0; r < RSROUNDS; r++){
+    3733:	83 c7 01             	add    $0x1,%edi
+      wait();
+    3736:	88 4d e3             	mov    %cl,-0x1d(%ebp)
+    3739:	e8 1d 2d 00 00       	call   645b <wait>
+    for(r = 0; r < RSROUNDS; r++){
+    373e:	83 ff 14             	cmp    $0x14,%edi
+    3741:	0f b6 4d e3          	movzbl -0x1d(%ebp),%ecx
+    3745:	75 91                	jne    36d8 <rmapstress+0x88>
+        exit();
+    3747:	e8 07 2d 00 00       	call   6453 <exit>
+  for(j = 0; j < RSPROCS; j++){
+    374c:	83 45 d8 01          	addl   $0x1,-0x28(%ebp)
+    3750:	8b 45 d8             	mov    -0x28(%ebp),%eax
+    3753:	83 f8 08             	cmp    $0x8,%eax
+    3756:	0f 85 4b ff ff ff    	jne    36a7 <rmapstress+0x57>
+    375c:	89 d9                	mov    %ebx,%ecx
+    375e:	89 f3                	mov    %esi,%ebx
+    3760:	be 08 00 00 00       	mov    $0x8,%esi
+    3765:	89 cf                	mov    %ecx,%edi
+    wait();
+    3767:	e8 ef 2c 00 00       	call   645b <wait>
+  for(j = 0; j < RSPROCS; j++)
+    376c:	83 ee 01             	sub    $0x1,%esi
+    376f:	75 f6                	jne    3767 <rmapstress+0x117>
+    3771:	89 f9                	mov    %edi,%ecx
+    3773:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    3777:	90                   	nop
+    if(a[i*4096] != 'p'){
+    3778:	0f be 01             	movsbl (%ecx),%eax
+    377b:	3c 70                	cmp    $0x70,%al
+    377d:	75 4d                	jne    37cc <rmapstress+0x17c>
+  for(i = 0; i < RSPAGES; i++){
+    377f:	81 c1 00 10 00 00    	add    $0x1000,%ecx
+    3785:	39 d9                	cmp    %ebx,%ecx
+    3787:	75 ef                	jne    3778 <rmapstress+0x128>
+  sbrk(-RSPAGES*4096);
+    3789:	83 ec 0c             	sub    $0xc,%esp
+    378c:	68 00 00 fc ff       	push   $0xfffc0000
+    3791:	e8 45 2d 00 00       	call   64db <sbrk>
+  printf(stdout, "rmap stress test ok\n");
+    3796:	58                   	pop    %eax
+    3797:	5a                   	pop    %edx
+    3798:	68 a8 72 00 00       	push   $0x72a8
+    379d:	ff 35 d4 9e 00 00    	push   0x9ed4
+    37a3:	e8 18 2e 00 00       	call   65c0 <printf>
+}
+    37a8:	83 c4 10             	add    $0x10,%esp
+    37ab:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    37ae:	5b                   	pop    %ebx
+    37af:	5e                   	pop    %esi
+    37b0:	5f                   	pop    %edi
+    37b1:	5d                   	pop    %ebp
+    37b2:	c3                   	ret
+          printf(stdout, "rmap stress: child %d sees %c\n", j, a[i*4096]);
+    37b3:	52                   	push   %edx
+    37b4:	ff 75 d8             	push   -0x28(%ebp)
+    37b7:	68 4c 8a 00 00       	push   $0x8a4c
+    37bc:	ff 35 d4 9e 00 00    	push   0x9ed4
+    37c2:	e8 f9 2d 00 00       	call   65c0 <printf>
+          exit();
+    37c7:	e8 87 2c 00 00       	call   6453 <exit>
+      printf(stdout, "rmap stress: parent sees %c\n", a[i*4096]);
+    37cc:	83 ec 04             	sub    $0x4,%esp
+    37cf:	50                   	push   %eax
+    37d0:	68 8b 72 00 00       	push   $0x728b
+    37d5:	ff 35 d4 9e 00 00    	push   0x9ed4
+    37db:	e8 e0 2d 00 00       	call   65c0 <printf>
+      exit();
+    37e0:	e8 6e 2c 00 00       	call   6453 <exit>
+    37e5:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+          a[i*4096] = 'z';
+    37e8:	c6 01 7a             	movb   $0x7a,(%ecx)
+        for(i = 0; i < RSPAGES; i += 2)
+    37eb:	81 c1 00 20 00 00    	add    $0x2000,%ecx
+    37f1:	39 d9                	cmp    %ebx,%ecx
+    37f3:	75 f3                	jne    37e8 <rmapstress+0x198>
+    37f5:	e9 4d ff ff ff       	jmp    3747 <rmapstress+0xf7>
+        printf(stdout, "fork failed\n");
+    37fa:	83 ec 08             	sub    $0x8,%esp
+    37fd:	68 f4 7d 00 00       	push   $0x7df4
+    3802:	ff 35 d4 9e 00 00    	push   0x9ed4
+    3808:	e8 b3 2d 00 00       	call   65c0 <printf>
+        exit();
+    380d:	e8 41 2c 00 00       	call   6453 <exit>
+    printf(stdout, "sbrk failed\n");
+    3812:	51                   	push   %ecx
+    3813:	51                   	push   %ecx
+    3814:	68 a2 6f 00 00       	push   $0x6fa2
+    3819:	ff 35 d4 9e 00 00    	push   0x9ed4
+    381f:	e8 9c 2d 00 00       	call   65c0 <printf>
+    exit();
+    3824:	e8 2a 2c 00 00       	call   6453 <exit>
+    3829:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00003830 <cowbench>:
+{
+    3830:	55                   	push   %ebp
+    3831:	89 e5                	mov    %esp,%ebp
+    3833:	57                   	push   %edi
+    3834:	56                   	push   %esi
+    3835:	53                   	push   %ebx
+    3836:	83 ec 44             	sub    $0x44,%esp
+  printf(stdout, "cow break benchmark\n");
+    3839:	68 bd 72 00 00       	push   $0x72bd
+    383e:	ff 35 d4 9e 00 00    	push   0x9ed4
+    3844:	e8 77 2d 00 00       	call   65c0 <printf>
+  a = sbrk(CBPAGES*4096);
+    3849:	c7 04 24 00 00 20 00 	movl   $0x200000,(%esp)
+    3850:	e8 86 2c 00 00       	call   64db <sbrk>
+  if(a == (char*)0xffffffff){
+    3855:	83 c4 10             	add    $0x10,%esp
+  a = sbrk(CBPAGES*4096);
+    3858:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  if(a == (char*)0xffffffff){
+    385b:	83 f8 ff             	cmp    $0xffffffff,%eax
+    385e:	0f 84 95 01 00 00    	je     39f9 <cowbench+0x1c9>
+    3864:	8b 45 cc             	mov    -0x34(%ebp),%eax
+    3867:	8d 98 00 00 20 00    	lea    0x200000(%eax),%ebx
+    386d:	8d 76 00             	lea    0x0(%esi),%esi
+    a[i*4096] = 'c';
+    3870:	c6 00 63             	movb   $0x63,(%eax)
+  for(i = 0; i < CBPAGES; i++)
+    3873:	05 00 10 00 00       	add    $0x1000,%eax
+    3878:	39 c3                	cmp    %eax,%ebx
+    387a:	75 f4                	jne    3870 <cowbench+0x40>
+  for(n = 2; n <= 32; n *= 2){
+    387c:	be 02 00 00 00       	mov    $0x2,%esi
+    3881:	c7 45 c0 05 00 00 00 	movl   $0x5,-0x40(%ebp)
+    3888:	89 5d c4             	mov    %ebx,-0x3c(%ebp)
+    388b:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+    ticks = 0;
+    388e:	31 c9                	xor    %ecx,%ecx
+  if(a == (char*)0xffffffff){
+    3890:	bb 61 00 00 00       	mov    $0x61,%ebx
+    3895:	89 4d c8             	mov    %ecx,-0x38(%ebp)
+    3898:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    389f:	90                   	nop
+      if(pipe(fds) != 0){
+    38a0:	83 ec 0c             	sub    $0xc,%esp
+    38a3:	8d 45 e0             	lea    -0x20(%ebp),%eax
+    38a6:	50                   	push   %eax
+    38a7:	e8 b7 2b 00 00       	call   6463 <pipe>
+    38ac:	83 c4 10             	add    $0x10,%esp
+    38af:	85 c0                	test   %eax,%eax
+    38b1:	0f 85 2a 01 00 00    	jne    39e1 <cowbench+0x1b1>
+      for(j = 1; j < n; j++){
+    38b7:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+    38ba:	bf 01 00 00 00       	mov    $0x1,%edi
+    38bf:	90                   	nop
+        pid = fork();
+    38c0:	e8 86 2b 00 00       	call   644b <fork>
+        if(pid < 0){
+    38c5:	85 c0                	test   %eax,%eax
+    38c7:	0f 88 db 00 00 00    	js     39a8 <cowbench+0x178>
+        if(pid == 0){
+    38cd:	0f 84 ed 00 00 00    	je     39c0 <cowbench+0x190>
+      for(j = 1; j < n; j++){
+    38d3:	83 c7 01             	add    $0x1,%edi
+    38d6:	39 f7                	cmp    %esi,%edi
+    38d8:	75 e6                	jne    38c0 <cowbench+0x90>
+      close(fds[0]);
+    38da:	83 ec 0c             	sub    $0xc,%esp
+    38dd:	ff 75 e0             	push   -0x20(%ebp)
+    38e0:	e8 96 2b 00 00       	call   647b <close>
+      t = uptime();
+    38e5:	e8 01 2c 00 00       	call   64eb <uptime>
+        a[i*4096] = 'a' + r;
+    38ea:	8b 7d c4             	mov    -0x3c(%ebp),%edi
+    38ed:	83 c4 10             	add    $0x10,%esp
+      t = uptime();
+    38f0:	89 c2                	mov    %eax,%edx
+        a[i*4096] = 'a' + r;
+    38f2:	8b 45 cc             	mov    -0x34(%ebp),%eax
+    38f5:	8d 76 00             	lea    0x0(%esi),%esi
+    38f8:	88 18                	mov    %bl,(%eax)
+      for(i = 0; i < CBPAGES; i++)
+    38fa:	05 00 10 00 00       	add    $0x1000,%eax
+    38ff:	39 c7                	cmp    %eax,%edi
+    3901:	75 f5                	jne    38f8 <cowbench+0xc8>
+      ticks += uptime() - t;
+    3903:	89 55 d0             	mov    %edx,-0x30(%ebp)
+    3906:	e8 e0 2b 00 00       	call   64eb <uptime>
+    390b:	8b 55 d0             	mov    -0x30(%ebp),%edx
+      close(fds[1]);
+    390e:	83 ec 0c             	sub    $0xc,%esp
+      ticks += uptime() - t;
+    3911:	29 d0                	sub    %edx,%eax
+    3913:	01 45 c8             	add    %eax,-0x38(%ebp)
+      close(fds[1]);
+    3916:	ff 75 e4             	push   -0x1c(%ebp)
+    3919:	e8 5d 2b 00 00       	call   647b <close>
+      for(j = 1; j < n; j++)
+    391e:	ba 01 00 00 00       	mov    $0x1,%edx
+    3923:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+      close(fds[1]);
+    3926:	83 c4 10             	add    $0x10,%esp
+      for(j = 1; j < n; j++)
+    3929:	89 d7                	mov    %edx,%edi
+    392b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    392f:	90                   	nop
+        wait();
+    3930:	e8 26 2b 00 00       	call   645b <wait>
+      for(j = 1; j < n; j++)
+    3935:	83 c7 01             	add    $0x1,%edi
+    3938:	39 f7                	cmp    %esi,%edi
+    393a:	75 f4                	jne    3930 <cowbench+0x100>
+    for(r = 0; r < CBROUNDS; r++){
+    393c:	83 c3 01             	add    $0x1,%ebx
+    393f:	80 fb 6b             	cmp    $0x6b,%bl
+    3942:	0f 85 58 ff ff ff    	jne    38a0 <cowbench+0x70>
+    printf(stdout, "%d sharers: %d ticks for %d cow breaks\n", n, ticks, CBPAGES*CBROUNDS);
+    3948:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+    394b:	83 ec 0c             	sub    $0xc,%esp
+    394e:	68 00 14 00 00       	push   $0x1400
+    3953:	51                   	push   %ecx
+    3954:	57                   	push   %edi
+    3955:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+    3958:	68 6c 8a 00 00       	push   $0x8a6c
+    395d:	ff 35 d4 9e 00 00    	push   0x9ed4
+    3963:	e8 58 2c 00 00       	call   65c0 <printf>
+  for(n = 2; n <= 32; n *= 2){
+    3968:	83 c4 20             	add    $0x20,%esp
+    396b:	83 6d c0 01          	subl   $0x1,-0x40(%ebp)
+    396f:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    3972:	8d 04 12             	lea    (%edx,%edx,1),%eax
+    3975:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+    3978:	0f 85 10 ff ff ff    	jne    388e <cowbench+0x5e>
+  sbrk(-CBPAGES*4096);
+    397e:	83 ec 0c             	sub    $0xc,%esp
+    3981:	68 00 00 e0 ff       	push   $0xffe00000
+    3986:	e8 50 2b 00 00       	call   64db <sbrk>
+  printf(stdout, "cow break benchmark ok\n");
+    398b:	58                   	pop    %eax
+    398c:	5a                   	pop    %edx
+    398d:	68 d2 72 00 00       	push   $0x72d2
+    3992:	ff 35 d4 9e 00 00    	push   0x9ed4
+    3998:	e8 23 2c 00 00       	call   65c0 <printf>
+}
+    399d:	83 c4 10             	add    $0x10,%esp
+    39a0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    39a3:	5b                   	pop    %ebx
+    39a4:	5e                   	pop    %esi
+    39a5:	5f                   	pop    %edi
+    39a6:	5d                   	pop    %ebp
+    39a7:	c3                   	ret
+          printf(stdout, "fork failed\n");
+    39a8:	83 ec 08             	sub    $0x8,%esp
+    39ab:	68 f4 7d 00 00       	push   $0x7df4
+    39b0:	ff 35 d4 9e 00 00    	push   0x9ed4
+    39b6:	e8 05 2c 00 00       	call   65c0 <printf>
+          exit();
+    39bb:	e8 93 2a 00 00       	call   6453 <exit>
+          close(fds[1]);
+    39c0:	83 ec 0c             	sub    $0xc,%esp
+    39c3:	ff 75 e4             	push   -0x1c(%ebp)
+    39c6:	e8 b0 2a 00 00       	call   647b <close>
+          read(fds[0], &c, 1);
+    39cb:	83 c4 0c             	add    $0xc,%esp
+    39ce:	8d 45 df             	lea    -0x21(%ebp),%eax
+    39d1:	6a 01                	push   $0x1
+    39d3:	50                   	push   %eax
+    39d4:	ff 75 e0             	push   -0x20(%ebp)
+    39d7:	e8 8f 2a 00 00       	call   646b <read>
+          exit();
+    39dc:	e8 72 2a 00 00       	call   6453 <exit>
+        printf(stdout, "pipe() failed\n");
+    39e1:	83 ec 08             	sub    $0x8,%esp
+    39e4:	68 1c 6c 00 00       	push   $0x6c1c
+    39e9:	ff 35 d4 9e 00 00    	push   0x9ed4
+    39ef:	e8 cc 2b 00 00       	call   65c0 <printf>
+        exit();
+    39f4:	e8 5a 2a 00 00       	call   6453 <exit>
+    printf(stdout, "sbrk failed\n");
+    39f9:	51                   	push   %ecx
+    39fa:	51                   	push   %ecx
+    39fb:	68 a2 6f 00 00       	push   $0x6fa2
+    3a00:	ff 35 d4 9e 00 00    	push   0x9ed4
+    3a06:	e8 b5 2b 00 00       	call   65c0 <printf>
+    exit();
+    3a0b:	e8 43 2a 00 00       	call   6453 <exit>
+
+00003a10 <sharedfd>:
+{
+    3a10:	55                   	push   %ebp
+    3a11:	89 e5                	mov    %esp,%ebp
+    3a13:	57                   	push   %edi
+    3a14:	56                   	push   %esi
+    3a15:	53                   	push   %ebx
+    3a16:	83 ec 34             	sub    $0x34,%esp
+  printf(1, "sharedfd test\n");
+    3a19:	68 ea 72 00 00       	push   $0x72ea
+    3a1e:	6a 01                	push   $0x1
+    3a20:	e8 9b 2b 00 00       	call   65c0 <printf>
+  unlink("sharedfd");
+    3a25:	c7 04 24 f9 72 00 00 	movl   $0x72f9,(%esp)
+    3a2c:	e8 72 2a 00 00       	call   64a3 <unlink>
+  fd = open("sharedfd", O_CREATE|O_RDWR);
+    3a31:	5b                   	pop    %ebx
+    3a32:	5e                   	pop    %esi
+    3a33:	68 02 02 00 00       	push   $0x202
+    3a38:	68 f9 72 00 00       	push   $0x72f9
+    3a3d:	e8 51 2a 00 00       	call   6493 <open>
+  if(fd < 0){
+    3a42:	83 c4 10             	add    $0x10,%esp
+    3a45:	85 c0                	test   %eax,%eax
+    3a47:	0f 88 2a 01 00 00    	js     3b77 <sharedfd+0x167>
+    3a4d:	89 c7                	mov    %eax,%edi
+  memset(buf, pid==0?'c':'p', sizeof(buf));
+    3a4f:	8d 75 de             	lea    -0x22(%ebp),%esi
+    3a52:	bb e8 03 00 00       	mov    $0x3e8,%ebx
+  pid = fork();
+    3a57:	e8 ef 29 00 00       	call   644b <fork>
+  memset(buf, pid==0?'c':'p', sizeof(buf));
+    3a5c:	83 f8 01             	cmp    $0x1,%eax
+  pid = fork();
+    3a5f:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  memset(buf, pid==0?'c':'p', sizeof(buf));
+    3a62:	19 c0                	sbb    %eax,%eax
+    3a64:	83 ec 04             	sub    $0x4,%esp
+    3a67:	83 e0 f3             	and    $0xfffffff3,%eax
+    3a6a:	6a 0a                	push   $0xa
+    3a6c:	83 c0 70             	add    $0x70,%eax
+    3a6f:	50                   	push   %eax
+    3a70:	56                   	push   %esi
+    3a71:	e8 5a 28 00 00       	call   62d0 <memset>
+    3a76:	83 c4 10             	add    $0x10,%esp
+    3a79:	eb 0a                	jmp    3a85 <sharedfd+0x75>
+    3a7b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    3a7f:	90                   	nop
+  for(i = 0; i < 1000; i++){
+    3a80:	83 eb 01             	sub    $0x1,%ebx
+    3a83:	74 26                	je     3aab <sharedfd+0x9b>
+    if(write(fd, buf, sizeof(buf)) != sizeof(buf)){
+    3a85:	83 ec 04             	sub    $0x4,%esp
+    3a88:	6a 0a                	push   $0xa
+    3a8a:	56                   	push   %esi
+    3a8b:	57                   	push   %edi
+    3a8c:	e8 e2 29 00 00       	call   6473 <write>
+    3a91:	83 c4 10             	add    $0x10,%esp
+    3a94:	83 f8 0a             	cmp    $0xa,%eax
+    3a97:	74 e7                	je     3a80 <sharedfd+0x70>
+      printf(1, "fstests: write sharedfd failed\n");
+    3a99:	83 ec 08             	sub    $0x8,%esp
+    3a9c:	68 c0 8a 00 00       	push   $0x8ac0
+    3aa1:	6a 01                	push   $0x1
+    3aa3:	e8 18 2b 00 00       	call   65c0 <printf>
+      break;
+    3aa8:	83 c4 10             	add    $0x10,%esp
+  if(pid == 0)
+    3aab:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+    3aae:	85 c9                	test   %ecx,%ecx
+    3ab0:	0f 84 f5 00 00 00    	je     3bab <sharedfd+0x19b>
+    wait();
+    3ab6:	e8 a0 29 00 00       	call   645b <wait>
+  close(fd);
+    3abb:	83 ec 0c             	sub    $0xc,%esp
+  nc = np = 0;
+    3abe:	31 db                	xor    %ebx,%ebx
+  close(fd);
+    3ac0:	57                   	push   %edi
+    3ac1:	8d 7d e8             	lea    -0x18(%ebp),%edi
+    3ac4:	e8 b2 29 00 00       	call   647b <close>
+  fd = open("sharedfd", 0);
+    3ac9:	58                   	pop    %eax
+    3aca:	5a                   	pop    %edx
+    3acb:	6a 00                	push   $0x0
+    3acd:	68 f9 72 00 00       	push   $0x72f9
+    3ad2:	e8 bc 29 00 00       	call   6493 <open>
+  if(fd < 0){
+    3ad7:	83 c4 10             	add    $0x10,%esp
+  nc = np = 0;
+    3ada:	31 d2                	xor    %edx,%edx
+  fd = open("sharedfd", 0);
+    3adc:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  if(fd < 0){
+    3adf:	85 c0                	test   %eax,%eax
+    3ae1:	0f 88 aa 00 00 00    	js     3b91 <sharedfd+0x181>
+    3ae7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3aee:	66 90                	xchg   %ax,%ax
+  while((n = read(fd, buf, sizeof(buf))) > 0){
+    3af0:	83 ec 04             	sub    $0x4,%esp
+    3af3:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    3af6:	6a 0a                	push   $0xa
+    3af8:	56                   	push   %esi
+    3af9:	ff 75 d0             	push   -0x30(%ebp)
+    3afc:	e8 6a 29 00 00       	call   646b <read>
+    3b01:	83 c4 10             	add    $0x10,%esp
+    3b04:	85 c0                	test   %eax,%eax
+    3b06:	7e 28                	jle    3b30 <sharedfd+0x120>
+    3b08:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    3b0b:	89 f0                	mov    %esi,%eax
+    3b0d:	eb 13                	jmp    3b22 <sharedfd+0x112>
+    3b0f:	90                   	nop
+        np++;
+    3b10:	80 f9 70             	cmp    $0x70,%cl
+    3b13:	0f 94 c1             	sete   %cl
+    3b16:	0f b6 c9             	movzbl %cl,%ecx
+    3b19:	01 cb                	add    %ecx,%ebx
+    for(i = 0; i < sizeof(buf); i++){
+    3b1b:	83 c0 01             	add    $0x1,%eax
+    3b1e:	39 f8                	cmp    %edi,%eax
+    3b20:	74 ce                	je     3af0 <sharedfd+0xe0>
+      if(buf[i] == 'c')
+    3b22:	0f b6 08             	movzbl (%eax),%ecx
+    3b25:	80 f9 63             	cmp    $0x63,%cl
+    3b28:	75 e6                	jne    3b10 <sharedfd+0x100>
+        nc++;
+    3b2a:	83 c2 01             	add    $0x1,%edx
+      if(buf[i] == 'p')
+    3b2d:	eb ec                	jmp    3b1b <sharedfd+0x10b>
+    3b2f:	90                   	nop
+  close(fd);
+    3b30:	83 ec 0c             	sub    $0xc,%esp
+    3b33:	ff 75 d0             	push   -0x30(%ebp)
+    3b36:	e8 40 29 00 00       	call   647b <close>
+  unlink("sharedfd");
+    3b3b:	c7 04 24 f9 72 00 00 	movl   $0x72f9,(%esp)
+    3b42:	e8 5c 29 00 00       	call   64a3 <unlink>
+  if(nc == 10000 && np == 10000){
+    3b47:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    3b4a:	83 c4 10             	add    $0x10,%esp
+    3b4d:	81 fa 10 27 00 00    	cmp    $0x2710,%edx
+    3b53:	75 5b                	jne    3bb0 <sharedfd+0x1a0>
+    3b55:	81 fb 10 27 00 00    	cmp    $0x2710,%ebx
+    3b5b:	75 53                	jne    3bb0 <sharedfd+0x1a0>
+    printf(1, "sharedfd ok\n");
+    3b5d:	83 ec 08             	sub    $0x8,%esp
+    3b60:	68 02 73 00 00       	push   $0x7302
+    3b65:	6a 01                	push   $0x1
+    3b67:	e8 54 2a 00 00       	call   65c0 <printf>
+    3b6c:	83 c4 10             	add    $0x10,%esp
+}
+    3b6f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    3b72:	5b                   	pop    %ebx
+    3b73:	5e                   	pop    %esi
+    3b74:	5f                   	pop    %edi
+    3b75:	5d                   	pop    %ebp
+    3b76:	c3                   	ret
+    printf(1, "fstests: cannot open sharedfd for writing");
+    3b77:	83 ec 08             	sub    $0x8,%esp
+    3b7a:	68 94 8a 00 00       	push   $0x8a94
+    3b7f:	6a 01                	push   $0x1
+    3b81:	e8 3a 2a 00 00       	call   65c0 <printf>
+    return;
+    3b86:	83 c4 10             	add    $0x10,%esp
+}
+    3b89:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    3b8c:	5b                   	pop    %ebx
+    3b8d:	5e                   	pop    %esi
+    3b8e:	5f                   	pop    %edi
+    3b8f:	5d                   	pop    %ebp
+    3b90:	c3                   	ret
+    printf(1, "fstests: cannot open sharedfd for reading\n");
+    3b91:	83 ec 08             	sub    $0x8,%esp
+    3b94:	68 e0 8a 00 00       	push   $0x8ae0
+    3b99:	6a 01                	push   $0x1
+    3b9b:	e8 20 2a 00 00       	call   65c0 <printf>
+    return;
+    3ba0:	83 c4 10             	add    $0x10,%esp
+}
+    3ba3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    3ba6:	5b                   	pop    %ebx
+    3ba7:	5e                   	pop    %esi
+    3ba8:	5f                   	pop    %edi
+    3ba9:	5d                   	pop    %ebp
+    3baa:	c3                   	ret
+    exit();
+    3bab:	e8 a3 28 00 00       	call   6453 <exit>
+    printf(1, "sharedfd oops %d %d\n", nc, np);
+    3bb0:	53                   	push   %ebx
+    3bb1:	52                   	push   %edx
+    3bb2:	68 0f 73 00 00       	push   $0x730f
+    3bb7:	6a 01                	push   $0x1
+    3bb9:	e8 02 2a 00 00       	call   65c0 <printf>
+    exit();
+    3bbe:	e8 90 28 00 00       	call   6453 <exit>
+    3bc3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3bca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00003bd0 <fourfiles>:
+{
+    3bd0:	55                   	push   %ebp
+    3bd1:	89 e5                	mov    %esp,%ebp
+    3bd3:	57                   	push   %edi
+    3bd4:	56                   	push   %esi
+    3bd5:	53                   	push   %ebx
+  for(pi = 0; pi < 4; pi++){
+    3bd6:	31 db                	xor    %ebx,%ebx
+{
+    3bd8:	83 ec 34             	sub    $0x34,%esp
+  char *names[] = { "f0", "f1", "f2", "f3" };
+    3bdb:	c7 45 d8 24 73 00 00 	movl   $0x7324,-0x28(%ebp)
+    3be2:	c7 45 dc 6d 74 00 00 	movl   $0x746d,-0x24(%ebp)
+    3be9:	c7 45 e0 71 74 00 00 	movl   $0x7471,-0x20(%ebp)
+    3bf0:	c7 45 e4 27 73 00 00 	movl   $0x7327,-0x1c(%ebp)
+  printf(1, "fourfiles test\n");
+    3bf7:	68 2a 73 00 00       	push   $0x732a
+    3bfc:	6a 01                	push   $0x1
+    3bfe:	e8 bd 29 00 00       	call   65c0 <printf>
+    3c03:	83 c4 10             	add    $0x10,%esp
+    fname = names[pi];
+    3c06:	8b 74 9d d8          	mov    -0x28(%ebp,%ebx,4),%esi
+    unlink(fname);
+    3c0a:	83 ec 0c             	sub    $0xc,%esp
+    3c0d:	56                   	push   %esi
+    3c0e:	e8 90 28 00 00       	call   64a3 <unlink>
+    pid = fork();
+    3c13:	e8 33 28 00 00       	call   644b <fork>
+    if(pid < 0){
+    3c18:	83 c4 10             	add    $0x10,%esp
+    3c1b:	85 c0                	test   %eax,%eax
+    3c1d:	0f 88 65 01 00 00    	js     3d88 <fourfiles+0x1b8>
+    if(pid == 0){
+    3c23:	0f 84 eb 00 00 00    	je     3d14 <fourfiles+0x144>
+  for(pi = 0; pi < 4; pi++){
+    3c29:	83 c3 01             	add    $0x1,%ebx
+    3c2c:	83 fb 04             	cmp    $0x4,%ebx
+    3c2f:	75 d5                	jne    3c06 <fourfiles+0x36>
+    wait();
+    3c31:	e8 25 28 00 00       	call   645b <wait>
+  for(i = 0; i < 2; i++){
+    3c36:	31 f6                	xor    %esi,%esi
+    wait();
+    3c38:	e8 1e 28 00 00       	call   645b <wait>
+    3c3d:	e8 19 28 00 00       	call   645b <wait>
+    3c42:	e8 14 28 00 00       	call   645b <wait>
+    fname = names[i];
+    3c47:	8b 5c b5 d8          	mov    -0x28(%ebp,%esi,4),%ebx
+    fd = open(fname, 0);
+    3c4b:	83 ec 08             	sub    $0x8,%esp
+    total = 0;
+    3c4e:	31 ff                	xor    %edi,%edi
+    fd = open(fname, 0);
+    3c50:	6a 00                	push   $0x0
+    3c52:	53                   	push   %ebx
+    3c53:	e8 3b 28 00 00       	call   6493 <open>
+    while((n = read(fd, buf, sizeof(buf))) > 0){
+    3c58:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    3c5b:	83 c4 10             	add    $0x10,%esp
+    3c5e:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+    3c61:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3c68:	83 ec 04             	sub    $0x4,%esp
+    3c6b:	68 00 20 00 00       	push   $0x2000
+    3c70:	68 20 c6 00 00       	push   $0xc620
+    3c75:	ff 75 d4             	push   -0x2c(%ebp)
+    3c78:	e8 ee 27 00 00       	call   646b <read>
+    3c7d:	83 c4 10             	add    $0x10,%esp
+    3c80:	89 c3                	mov    %eax,%ebx
+    3c82:	85 c0                	test   %eax,%eax
+    3c84:	7e 28                	jle    3cae <fourfiles+0xde>
+      for(j = 0; j < n; j++){
+    3c86:	31 c0                	xor    %eax,%eax
+    3c88:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3c8f:	90                   	nop
+        if(buf[j] != '0'+i){
+    3c90:	83 fe 01             	cmp    $0x1,%esi
+    3c93:	0f be 88 20 c6 00 00 	movsbl 0xc620(%eax),%ecx
+    3c9a:	19 d2                	sbb    %edx,%edx
+    3c9c:	83 c2 31             	add    $0x31,%edx
+    3c9f:	39 d1                	cmp    %edx,%ecx
+    3ca1:	75 5d                	jne    3d00 <fourfiles+0x130>
+      for(j = 0; j < n; j++){
+    3ca3:	83 c0 01             	add    $0x1,%eax
+    3ca6:	39 c3                	cmp    %eax,%ebx
+    3ca8:	75 e6                	jne    3c90 <fourfiles+0xc0>
+      total += n;
+    3caa:	01 df                	add    %ebx,%edi
+    3cac:	eb ba                	jmp    3c68 <fourfiles+0x98>
+    close(fd);
+    3cae:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+    3cb1:	83 ec 0c             	sub    $0xc,%esp
+    3cb4:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    3cb7:	51                   	push   %ecx
+    3cb8:	e8 be 27 00 00       	call   647b <close>
+    if(total != 12*500){
+    3cbd:	83 c4 10             	add    $0x10,%esp
+    3cc0:	81 ff 70 17 00 00    	cmp    $0x1770,%edi
+    3cc6:	0f 85 d0 00 00 00    	jne    3d9c <fourfiles+0x1cc>
+    unlink(fname);
+    3ccc:	83 ec 0c             	sub    $0xc,%esp
+    3ccf:	53                   	push   %ebx
+    3cd0:	e8 ce 27 00 00       	call   64a3 <unlink>
+  for(i = 0; i < 2; i++){
+    3cd5:	83 c4 10             	add    $0x10,%esp
+    3cd8:	85 f6                	test   %esi,%esi
+    3cda:	75 0a                	jne    3ce6 <fourfiles+0x116>
+    3cdc:	be 01 00 00 00       	mov    $0x1,%esi
+    3ce1:	e9 61 ff ff ff       	jmp    3c47 <fourfiles+0x77>
+  printf(1, "fourfiles ok\n");
+    3ce6:	83 ec 08             	sub    $0x8,%esp
+    3ce9:	68 68 73 00 00       	push   $0x7368
+    3cee:	6a 01                	push   $0x1
+    3cf0:	e8 cb 28 00 00       	call   65c0 <printf>
+}
+    3cf5:	83 c4 10             	add    $0x10,%esp
+    3cf8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    3cfb:	5b                   	pop    %ebx
+    3cfc:	5e                   	pop    %esi
+    3cfd:	5f                   	pop    %edi
+    3cfe:	5d                   	pop    %ebp
+    3cff:	c3                   	ret
+          printf(1, "wrong char\n");
+    3d00:	83 ec 08             	sub    $0x8,%esp
+    3d03:	68 4b 73 00 00       	push   $0x734b
+    3d08:	6a 01                	push   $0x1
+    3d0a:	e8 b1 28 00 00       	call   65c0 <printf>
+          exit();
+    3d0f:	e8 3f 27 00 00       	call   6453 <exit>
+      fd = open(fname, O_CREATE | O_RDWR);
+    3d14:	83 ec 08             	sub    $0x8,%esp
+    3d17:	68 02 02 00 00       	push   $0x202
+    3d1c:	56                   	push   %esi
+    3d1d:	e8 71 27 00 00       	call   6493 <open>
+      if(fd < 0){
+    3d22:	83 c4 10             	add    $0x10,%esp
+      fd = open(fname, O_CREATE | O_RDWR);
+    3d25:	89 c6                	mov    %eax,%esi
+      if(fd < 0){
+    3d27:	85 c0                	test   %eax,%eax
+    3d29:	78 45                	js     3d70 <fourfiles+0x1a0>
+      memset(buf, '0'+pi, 512);
+    3d2b:	83 ec 04             	sub    $0x4,%esp
+    3d2e:	83 c3 30             	add    $0x30,%ebx
+    3d31:	68 00 02 00 00       	push   $0x200
+    3d36:	53                   	push   %ebx
+    3d37:	bb 0c 00 00 00       	mov    $0xc,%ebx
+    3d3c:	68 20 c6 00 00       	push   $0xc620
+    3d41:	e8 8a 25 00 00       	call   62d0 <memset>
+    3d46:	83 c4 10             	add    $0x10,%esp
+        if((n = write(fd, buf, 500)) != 500){
+    3d49:	83 ec 04             	sub    $0x4,%esp
+    3d4c:	68 f4 01 00 00       	push   $0x1f4
+    3d51:	68 20 c6 00 00       	push   $0xc620
+    3d56:	56                   	push   %esi
+    3d57:	e8 17 27 00 00       	call   6473 <write>
+    3d5c:	83 c4 10             	add    $0x10,%esp
+    3d5f:	3d f4 01 00 00       	cmp    $0x1f4,%eax
+    3d64:	75 49                	jne    3daf <fourfiles+0x1df>
+      for(i = 0; i < 12; i++){
+    3d66:	83 eb 01             	sub    $0x1,%ebx
+    3d69:	75 de                	jne    3d49 <fourfiles+0x179>
+      exit();
+    3d6b:	e8 e3 26 00 00       	call   6453 <exit>
+        printf(1, "create failed\n");
+    3d70:	51                   	push   %ecx
+    3d71:	51                   	push   %ecx
+    3d72:	68 c5 75 00 00       	push   $0x75c5
+    3d77:	6a 01                	push   $0x1
+    3d79:	e8 42 28 00 00       	call   65c0 <printf>
+        exit();
+    3d7e:	e8 d0 26 00 00       	call   6453 <exit>
+    3d83:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    3d87:	90                   	nop
+      printf(1, "fork failed\n");
+    3d88:	83 ec 08             	sub    $0x8,%esp
+    3d8b:	68 f4 7d 00 00       	push   $0x7df4
+    3d90:	6a 01                	push   $0x1
+    3d92:	e8 29 28 00 00       	call   65c0 <printf>
+      exit();
+    3d97:	e8 b7 26 00 00       	call   6453 <exit>
+      printf(1, "wrong length %d\n", total);
+    3d9c:	50                   	push   %eax
+    3d9d:	57                   	push   %edi
+    3d9e:	68 57 73 00 00       	push   $0x7357
+    3da3:	6a 01                	push   $0x1
+    3da5:	e8 16 28 00 00       	call   65c0 <printf>
+      exit();
+    3daa:	e8 a4 26 00 00       	call   6453 <exit>
+          printf(1, "write failed %d\n", n);
+    3daf:	52                   	push   %edx
+    3db0:	50                   	push   %eax
+    3db1:	68 3a 73 00 00       	push   $0x733a
+    3db6:	6a 01                	push   $0x1
+    3db8:	e8 03 28 00 00       	call   65c0 <printf>
+          exit();
+    3dbd:	e8 91 26 00 00       	call   6453 <exit>
+    3dc2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3dc9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00003dd0 <createdelete>:
+{
+    3dd0:	55                   	push   %ebp
+    3dd1:	89 e5                	mov    %esp,%ebp
+    3dd3:	57                   	push   %edi
+    3dd4:	56                   	push   %esi
+  for(pi = 0; pi < 4; pi++){
+    3dd5:	31 f6                	xor    %esi,%esi
+{
+    3dd7:	53                   	push   %ebx
+    3dd8:	83 ec 44             	sub    $0x44,%esp
+  printf(1, "createdelete test\n");
+    3ddb:	68 76 73 00 00       	push   $0x7376
+    3de0:	6a 01                	push   $0x1
+    3de2:	e8 d9 27 00 00       	call   65c0 <printf>
+    3de7:	83 c4 10             	add    $0x10,%esp
+    pid = fork();
+    3dea:	e8 5c 26 00 00       	call   644b <fork>
+    3def:	89 c3                	mov    %eax,%ebx
+    if(pid < 0){
+    3df1:	85 c0                	test   %eax,%eax
+    3df3:	0f 88 ac 01 00 00    	js     3fa5 <createdelete+0x1d5>
+    if(pid == 0){
+    3df9:	0f 84 01 01 00 00    	je     3f00 <createdelete+0x130>
+  for(pi = 0; pi < 4; pi++){
+    3dff:	83 c6 01             	add    $0x1,%esi
+    3e02:	83 fe 04             	cmp    $0x4,%esi
+    3e05:	75 e3                	jne    3dea <createdelete+0x1a>
+    wait();
+    3e07:	e8 4f 26 00 00       	call   645b <wait>
+  for(i = 0; i < N; i++){
+    3e0c:	31 ff                	xor    %edi,%edi
+    3e0e:	8d 75 c8             	lea    -0x38(%ebp),%esi
+    wait();
+    3e11:	e8 45 26 00 00       	call   645b <wait>
+    3e16:	e8 40 26 00 00       	call   645b <wait>
+    3e1b:	e8 3b 26 00 00       	call   645b <wait>
+  name[0] = name[1] = name[2] = 0;
+    3e20:	c6 45 ca 00          	movb   $0x0,-0x36(%ebp)
+  for(i = 0; i < N; i++){
+    3e24:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      if((i == 0 || i >= N/2) && fd < 0){
+    3e28:	85 ff                	test   %edi,%edi
+      name[1] = '0' + i;
+    3e2a:	8d 47 30             	lea    0x30(%edi),%eax
+      if((i == 0 || i >= N/2) && fd < 0){
+    3e2d:	bb 70 00 00 00       	mov    $0x70,%ebx
+    3e32:	0f 94 c2             	sete   %dl
+    3e35:	83 ff 09             	cmp    $0x9,%edi
+      name[1] = '0' + i;
+    3e38:	88 45 c6             	mov    %al,-0x3a(%ebp)
+      if((i == 0 || i >= N/2) && fd < 0){
+    3e3b:	0f 9f c0             	setg   %al
+    3e3e:	09 c2                	or     %eax,%edx
+    3e40:	88 55 c7             	mov    %dl,-0x39(%ebp)
+      name[1] = '0' + i;
+    3e43:	0f b6 45 c6          	movzbl -0x3a(%ebp),%eax
+      fd = open(name, 0);
+    3e47:	83 ec 08             	sub    $0x8,%esp
+      name[0] = 'p' + pi;
+    3e4a:	88 5d c8             	mov    %bl,-0x38(%ebp)
+      name[1] = '0' + i;
+    3e4d:	88 45 c9             	mov    %al,-0x37(%ebp)
+      fd = open(name, 0);
+    3e50:	6a 00                	push   $0x0
+    3e52:	56                   	push   %esi
+    3e53:	e8 3b 26 00 00       	call   6493 <open>
+      if((i == 0 || i >= N/2) && fd < 0){
+    3e58:	83 c4 10             	add    $0x10,%esp
+    3e5b:	80 7d c7 00          	cmpb   $0x0,-0x39(%ebp)
+    3e5f:	74 7f                	je     3ee0 <createdelete+0x110>
+    3e61:	85 c0                	test   %eax,%eax
+    3e63:	0f 88 27 01 00 00    	js     3f90 <createdelete+0x1c0>
+        close(fd);
+    3e69:	83 ec 0c             	sub    $0xc,%esp
+    3e6c:	50                   	push   %eax
+    3e6d:	e8 09 26 00 00       	call   647b <close>
+    3e72:	83 c4 10             	add    $0x10,%esp
+    for(pi = 0; pi < 4; pi++){
+    3e75:	83 c3 01             	add    $0x1,%ebx
+    3e78:	80 fb 74             	cmp    $0x74,%bl
+    3e7b:	75 c6                	jne    3e43 <createdelete+0x73>
+  for(i = 0; i < N; i++){
+    3e7d:	83 c7 01             	add    $0x1,%edi
+    3e80:	83 ff 14             	cmp    $0x14,%edi
+    3e83:	75 a3                	jne    3e28 <createdelete+0x58>
+    3e85:	bf 70 00 00 00       	mov    $0x70,%edi
+    3e8a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      name[1] = '0' + i;
+    3e90:	8d 47 c0             	lea    -0x40(%edi),%eax
+    3e93:	bb 04 00 00 00       	mov    $0x4,%ebx
+    3e98:	88 45 c7             	mov    %al,-0x39(%ebp)
+      name[0] = 'p' + i;
+    3e9b:	89 f8                	mov    %edi,%eax
+      unlink(name);
+    3e9d:	83 ec 0c             	sub    $0xc,%esp
+      name[0] = 'p' + i;
+    3ea0:	88 45 c8             	mov    %al,-0x38(%ebp)
+      name[1] = '0' + i;
+    3ea3:	0f b6 45 c7          	movzbl -0x39(%ebp),%eax
+    3ea7:	88 45 c9             	mov    %al,-0x37(%ebp)
+      unlink(name);
+    3eaa:	56                   	push   %esi
+    3eab:	e8 f3 25 00 00       	call   64a3 <unlink>
+    for(pi = 0; pi < 4; pi++){
+    3eb0:	83 c4 10             	add    $0x10,%esp
+    3eb3:	83 eb 01             	sub    $0x1,%ebx
+    3eb6:	75 e3                	jne    3e9b <createdelete+0xcb>
+  for(i = 0; i < N; i++){
+    3eb8:	83 c7 01             	add    $0x1,%edi
+    3ebb:	89 f8                	mov    %edi,%eax
+    3ebd:	3c 84                	cmp    $0x84,%al
+    3ebf:	75 cf                	jne    3e90 <createdelete+0xc0>
+  printf(1, "createdelete ok\n");
+    3ec1:	83 ec 08             	sub    $0x8,%esp
+    3ec4:	68 89 73 00 00       	push   $0x7389
+    3ec9:	6a 01                	push   $0x1
+    3ecb:	e8 f0 26 00 00       	call   65c0 <printf>
+}
+    3ed0:	83 c4 10             	add    $0x10,%esp
+    3ed3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    3ed6:	5b                   	pop    %ebx
+    3ed7:	5e                   	pop    %esi
+    3ed8:	5f                   	pop    %edi
+    3ed9:	5d                   	pop    %ebp
+    3eda:	c3                   	ret
+    3edb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    3edf:	90                   	nop
+      } else if((i >= 1 && i < N/2) && fd >= 0){
+    3ee0:	85 c0                	test   %eax,%eax
+    3ee2:	78 91                	js     3e75 <createdelete+0xa5>
+        printf(1, "oops createdelete %s did exist\n", name);
+    3ee4:	50                   	push   %eax
+    3ee5:	56                   	push   %esi
+    3ee6:	68 30 8b 00 00       	push   $0x8b30
+    3eeb:	6a 01                	push   $0x1
+    3eed:	e8 ce 26 00 00       	call   65c0 <printf>
+        exit();
+    3ef2:	e8 5c 25 00 00       	call   6453 <exit>
+    3ef7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3efe:	66 90                	xchg   %ax,%ax
+      name[0] = 'p' + pi;
+    3f00:	8d 46 70             	lea    0x70(%esi),%eax
+      name[2] = '\0';
+    3f03:	c6 45 ca 00          	movb   $0x0,-0x36(%ebp)
+    3f07:	8d 75 c8             	lea    -0x38(%ebp),%esi
+      name[0] = 'p' + pi;
+    3f0a:	88 45 c8             	mov    %al,-0x38(%ebp)
+      for(i = 0; i < N; i++){
+    3f0d:	8d 76 00             	lea    0x0(%esi),%esi
+        fd = open(name, O_CREATE | O_RDWR);
+    3f10:	83 ec 08             	sub    $0x8,%esp
+        name[1] = '0' + i;
+    3f13:	8d 43 30             	lea    0x30(%ebx),%eax
+    3f16:	88 45 c9             	mov    %al,-0x37(%ebp)
+        fd = open(name, O_CREATE | O_RDWR);
+    3f19:	68 02 02 00 00       	push   $0x202
+    3f1e:	56                   	push   %esi
+    3f1f:	e8 6f 25 00 00       	call   6493 <open>
+        if(fd < 0){
+    3f24:	83 c4 10             	add    $0x10,%esp
+    3f27:	85 c0                	test   %eax,%eax
+    3f29:	0f 88 8a 00 00 00    	js     3fb9 <createdelete+0x1e9>
+        close(fd);
+    3f2f:	83 ec 0c             	sub    $0xc,%esp
+    3f32:	50                   	push   %eax
+    3f33:	e8 43 25 00 00       	call   647b <close>
+        if(i > 0 && (i % 2 ) == 0){
+    3f38:	83 c4 10             	add    $0x10,%esp
+    3f3b:	85 db                	test   %ebx,%ebx
+    3f3d:	74 19                	je     3f58 <createdelete+0x188>
+    3f3f:	f6 c3 01             	test   $0x1,%bl
+    3f42:	74 1b                	je     3f5f <createdelete+0x18f>
+      for(i = 0; i < N; i++){
+    3f44:	83 c3 01             	add    $0x1,%ebx
+    3f47:	83 fb 14             	cmp    $0x14,%ebx
+    3f4a:	75 c4                	jne    3f10 <createdelete+0x140>
+      exit();
+    3f4c:	e8 02 25 00 00       	call   6453 <exit>
+    3f51:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      for(i = 0; i < N; i++){
+    3f58:	bb 01 00 00 00       	mov    $0x1,%ebx
+    3f5d:	eb b1                	jmp    3f10 <createdelete+0x140>
+          name[1] = '0' + (i / 2);
+    3f5f:	89 d8                	mov    %ebx,%eax
+          if(unlink(name) < 0){
+    3f61:	83 ec 0c             	sub    $0xc,%esp
+          name[1] = '0' + (i / 2);
+    3f64:	d1 f8                	sar    %eax
+    3f66:	83 c0 30             	add    $0x30,%eax
+    3f69:	88 45 c9             	mov    %al,-0x37(%ebp)
+          if(unlink(name) < 0){
+    3f6c:	56                   	push   %esi
+    3f6d:	e8 31 25 00 00       	call   64a3 <unlink>
+    3f72:	83 c4 10             	add    $0x10,%esp
+    3f75:	85 c0                	test   %eax,%eax
+    3f77:	79 cb                	jns    3f44 <createdelete+0x174>
+            printf(1, "unlink failed\n");
+    3f79:	52                   	push   %edx
+    3f7a:	52                   	push   %edx
+    3f7b:	68 a1 69 00 00       	push   $0x69a1
+    3f80:	6a 01                	push   $0x1
+    3f82:	e8 39 26 00 00       	call   65c0 <printf>
+            exit();
+    3f87:	e8 c7 24 00 00       	call   6453 <exit>
+    3f8c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printf(1, "oops createdelete %s didn't exist\n", name);
+    3f90:	83 ec 04             	sub    $0x4,%esp
+    3f93:	56                   	push   %esi
+    3f94:	68 0c 8b 00 00       	push   $0x8b0c
+    3f99:	6a 01                	push   $0x1
+    3f9b:	e8 20 26 00 00       	call   65c0 <printf>
+        exit();
+    3fa0:	e8 ae 24 00 00       	call   6453 <exit>
+      printf(1, "fork failed\n");
+    3fa5:	83 ec 08             	sub    $0x8,%esp
+    3fa8:	68 f4 7d 00 00       	push   $0x7df4
+    3fad:	6a 01                	push   $0x1
+    3faf:	e8 0c 26 00 00       	call   65c0 <printf>
+      exit();
+    3fb4:	e8 9a 24 00 00       	call   6453 <exit>
+          printf(1, "create failed\n");
+    3fb9:	83 ec 08             	sub    $0x8,%esp
+    3fbc:	68 c5 75 00 00       	push   $0x75c5
+    3fc1:	6a 01                	push   $0x1
+    3fc3:	e8 f8 25 00 00       	call   65c0 <printf>
+          exit();
+    3fc8:	e8 86 24 00 00       	call   6453 <exit>
+    3fcd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00003fd0 <unlinkread>:
+{
+    3fd0:	55                   	push   %ebp
+    3fd1:	89 e5                	mov    %esp,%ebp
+    3fd3:	56                   	push   %esi
+    3fd4:	53                   	push   %ebx
+  printf(1, "unlinkread test\n");
+    3fd5:	83 ec 08             	sub    $0x8,%esp
+    3fd8:	68 9a 73 00 00       	push   $0x739a
+    3fdd:	6a 01                	push   $0x1
+    3fdf:	e8 dc 25 00 00       	call   65c0 <printf>
+  fd = open("unlinkread", O_CREATE | O_RDWR);
+    3fe4:	5b                   	pop    %ebx
+    3fe5:	5e                   	pop    %esi
+    3fe6:	68 02 02 00 00       	push   $0x202
+    3feb:	68 ab 73 00 00       	push   $0x73ab
+    3ff0:	e8 9e 24 00 00       	call   6493 <open>
+  if(fd < 0){
+    3ff5:	83 c4 10             	add    $0x10,%esp
+    3ff8:	85 c0                	test   %eax,%eax
+    3ffa:	0f 88 e6 00 00 00    	js     40e6 <unlinkread+0x116>
+  write(fd, "hello", 5);
+    4000:	83 ec 04             	sub    $0x4,%esp
+    4003:	89 c3                	mov    %eax,%ebx
+    4005:	6a 05                	push   $0x5
+    4007:	68 d0 73 00 00       	push   $0x73d0
+    400c:	50                   	push   %eax
+    400d:	e8 61 24 00 00       	call   6473 <write>
+  close(fd);
+    4012:	89 1c 24             	mov    %ebx,(%esp)
+    4015:	e8 61 24 00 00       	call   647b <close>
+  fd = open("unlinkread", O_RDWR);
+    401a:	58                   	pop    %eax
+    401b:	5a                   	pop    %edx
+    401c:	6a 02                	push   $0x2
+    401e:	68 ab 73 00 00       	push   $0x73ab
+    4023:	e8 6b 24 00 00       	call   6493 <open>
+  if(fd < 0){
+    4028:	83 c4 10             	add    $0x10,%esp
+  fd = open("unlinkread", O_RDWR);
+    402b:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    402d:	85 c0                	test   %eax,%eax
+    402f:	0f 88 10 01 00 00    	js     4145 <unlinkread+0x175>
+  if(unlink("unlinkread") != 0){
+    4035:	83 ec 0c             	sub    $0xc,%esp
+    4038:	68 ab 73 00 00       	push   $0x73ab
+    403d:	e8 61 24 00 00       	call   64a3 <unlink>
+    4042:	83 c4 10             	add    $0x10,%esp
+    4045:	85 c0                	test   %eax,%eax
+    4047:	0f 85 e5 00 00 00    	jne    4132 <unlinkread+0x162>
+  fd1 = open("unlinkread", O_CREATE | O_RDWR);
+    404d:	83 ec 08             	sub    $0x8,%esp
+    4050:	68 02 02 00 00       	push   $0x202
+    4055:	68 ab 73 00 00       	push   $0x73ab
+    405a:	e8 34 24 00 00       	call   6493 <open>
+  write(fd1, "yyy", 3);
+    405f:	83 c4 0c             	add    $0xc,%esp
+    4062:	6a 03                	push   $0x3
+  fd1 = open("unlinkread", O_CREATE | O_RDWR);
+    4064:	89 c6                	mov    %eax,%esi
+  write(fd1, "yyy", 3);
+    4066:	68 08 74 00 00       	push   $0x7408
+    406b:	50                   	push   %eax
+    406c:	e8 02 24 00 00       	call   6473 <write>
+  close(fd1);
+    4071:	89 34 24             	mov    %esi,(%esp)
+    4074:	e8 02 24 00 00       	call   647b <close>
+  if(read(fd, buf, sizeof(buf)) != 5){
+    4079:	83 c4 0c             	add    $0xc,%esp
+    407c:	68 00 20 00 00       	push   $0x2000
+    4081:	68 20 c6 00 00       	push   $0xc620
+    4086:	53                   	push   %ebx
+    4087:	e8 df 23 00 00       	call   646b <read>
+    408c:	83 c4 10             	add    $0x10,%esp
+    408f:	83 f8 05             	cmp    $0x5,%eax
+    4092:	0f 85 87 00 00 00    	jne    411f <unlinkread+0x14f>
+  if(buf[0] != 'h'){
+    4098:	80 3d 20 c6 00 00 68 	cmpb   $0x68,0xc620
+    409f:	75 6b                	jne    410c <unlinkread+0x13c>
+  if(write(fd, buf, 10) != 10){
+    40a1:	83 ec 04             	sub    $0x4,%esp
+    40a4:	6a 0a                	push   $0xa
+    40a6:	68 20 c6 00 00       	push   $0xc620
+    40ab:	53                   	push   %ebx
+    40ac:	e8 c2 23 00 00       	call   6473 <write>
+    40b1:	83 c4 10             	add    $0x10,%esp
+    40b4:	83 f8 0a             	cmp    $0xa,%eax
+    40b7:	75 40                	jne    40f9 <unlinkread+0x129>
+  close(fd);
+    40b9:	83 ec 0c             	sub    $0xc,%esp
+    40bc:	53                   	push   %ebx
+    40bd:	e8 b9 23 00 00       	call   647b <close>
+  unlink("unlinkread");
+    40c2:	c7 04 24 ab 73 00 00 	movl   $0x73ab,(%esp)
+    40c9:	e8 d5 23 00 00       	call   64a3 <unlink>
+  printf(1, "unlinkread ok\n");
+    40ce:	58                   	pop    %eax
+    40cf:	5a                   	pop    %edx
+    40d0:	68 53 74 00 00       	push   $0x7453
+    40d5:	6a 01                	push   $0x1
+    40d7:	e8 e4 24 00 00       	call   65c0 <printf>
+}
+    40dc:	83 c4 10             	add    $0x10,%esp
+    40df:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    40e2:	5b                   	pop    %ebx
+    40e3:	5e                   	pop    %esi
+    40e4:	5d                   	pop    %ebp
+    40e5:	c3                   	ret
+    printf(1, "create unlinkread failed\n");
+    40e6:	51                   	push   %ecx
+    40e7:	51                   	push   %ecx
+    40e8:	68 b6 73 00 00       	push   $0x73b6
+    40ed:	6a 01                	push   $0x1
+    40ef:	e8 cc 24 00 00       	call   65c0 <printf>
+    exit();
+    40f4:	e8 5a 23 00 00       	call   6453 <exit>
+    printf(1, "unlinkread write failed\n");
+    40f9:	51                   	push   %ecx
+    40fa:	51                   	push   %ecx
+    40fb:	68 3a 74 00 00       	push   $0x743a
+    4100:	6a 01                	push   $0x1
+    4102:	e8 b9 24 00 00       	call   65c0 <printf>
+    exit();
+    4107:	e8 47 23 00 00       	call   6453 <exit>
+    printf(1, "unlinkread wrong data\n");
+    410c:	53                   	push   %ebx
+    410d:	53                   	push   %ebx
+    410e:	68 23 74 00 00       	push   $0x7423
+    4113:	6a 01                	push   $0x1
+    4115:	e8 a6 24 00 00       	call   65c0 <printf>
+    exit();
+    411a:	e8 34 23 00 00       	call   6453 <exit>
+    printf(1, "unlinkread read failed");
+    411f:	56                   	push   %esi
+    4120:	56                   	push   %esi
+    4121:	68 0c 74 00 00       	push   $0x740c
+    4126:	6a 01                	push   $0x1
+    4128:	e8 93 24 00 00       	call   65c0 <printf>
+    exit();
+    412d:	e8 21 23 00 00       	call   6453 <exit>
+    printf(1, "unlink unlinkread failed\n");
+    4132:	50                   	push   %eax
+    4133:	50                   	push   %eax
+    4134:	68 ee 73 00 00       	push   $0x73ee
+    4139:	6a 01                	push   $0x1
+    413b:	e8 80 24 00 00       	call   65c0 <printf>
+    exit();
+    4140:	e8 0e 23 00 00       	call   6453 <exit>
+    printf(1, "open unlinkread failed\n");
+    4145:	50                   	push   %eax
+    4146:	50                   	push   %eax
+    4147:	68 d6 73 00 00       	push   $0x73d6
+    414c:	6a 01                	push   $0x1
+    414e:	e8 6d 24 00 00       	call   65c0 <printf>
+    exit();
+    4153:	e8 fb 22 00 00       	call   6453 <exit>
+    4158:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    415f:	90                   	nop
+
+00004160 <linktest>:
+{
+    4160:	55                   	push   %ebp
+    4161:	89 e5                	mov    %esp,%ebp
+    4163:	53                   	push   %ebx
+    4164:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "linktest\n");
+    4167:	68 62 74 00 00       	push   $0x7462
+    416c:	6a 01                	push   $0x1
+    416e:	e8 4d 24 00 00       	call   65c0 <printf>
+  unlink("lf1");
+    4173:	c7 04 24 6c 74 00 00 	movl   $0x746c,(%esp)
+    417a:	e8 24 23 00 00       	call   64a3 <unlink>
+  unlink("lf2");
+    417f:	c7 04 24 70 74 00 00 	movl   $0x7470,(%esp)
+    4186:	e8 18 23 00 00       	call   64a3 <unlink>
+  fd = open("lf1", O_CREATE|O_RDWR);
+    418b:	58                   	pop    %eax
+    418c:	5a                   	pop    %edx
+    418d:	68 02 02 00 00       	push   $0x202
+    4192:	68 6c 74 00 00       	push   $0x746c
+    4197:	e8 f7 22 00 00       	call   6493 <open>
+  if(fd < 0){
+    419c:	83 c4 10             	add    $0x10,%esp
+    419f:	85 c0                	test   %eax,%eax
+    41a1:	0f 88 1e 01 00 00    	js     42c5 <linktest+0x165>
+  if(write(fd, "hello", 5) != 5){
+    41a7:	83 ec 04             	sub    $0x4,%esp
+    41aa:	89 c3                	mov    %eax,%ebx
+    41ac:	6a 05                	push   $0x5
+    41ae:	68 d0 73 00 00       	push   $0x73d0
+    41b3:	50                   	push   %eax
+    41b4:	e8 ba 22 00 00       	call   6473 <write>
+    41b9:	83 c4 10             	add    $0x10,%esp
+    41bc:	83 f8 05             	cmp    $0x5,%eax
+    41bf:	0f 85 98 01 00 00    	jne    435d <linktest+0x1fd>
+  close(fd);
+    41c5:	83 ec 0c             	sub    $0xc,%esp
+    41c8:	53                   	push   %ebx
+    41c9:	e8 ad 22 00 00       	call   647b <close>
+  if(link("lf1", "lf2") < 0){
+    41ce:	5b                   	pop    %ebx
+    41cf:	58                   	pop    %eax
+    41d0:	68 70 74 00 00       	push   $0x7470
+    41d5:	68 6c 74 00 00       	push   $0x746c
+    41da:	e8 d4 22 00 00       	call   64b3 <link>
+    41df:	83 c4 10             	add    $0x10,%esp
+    41e2:	85 c0                	test   %eax,%eax
+    41e4:	0f 88 60 01 00 00    	js     434a <linktest+0x1ea>
+  unlink("lf1");
+    41ea:	83 ec 0c             	sub    $0xc,%esp
+    41ed:	68 6c 74 00 00       	push   $0x746c
+    41f2:	e8 ac 22 00 00       	call   64a3 <unlink>
+  if(open("lf1", 0) >= 0){
+    41f7:	58                   	pop    %eax
+    41f8:	5a                   	pop    %edx
+    41f9:	6a 00                	push   $0x0
+    41fb:	68 6c 74 00 00       	push   $0x746c
+    4200:	e8 8e 22 00 00       	call   6493 <open>
+    4205:	83 c4 10             	add    $0x10,%esp
+    4208:	85 c0                	test   %eax,%eax
+    420a:	0f 89 27 01 00 00    	jns    4337 <linktest+0x1d7>
+  fd = open("lf2", 0);
+    4210:	83 ec 08             	sub    $0x8,%esp
+    4213:	6a 00                	push   $0x0
+    4215:	68 70 74 00 00       	push   $0x7470
+    421a:	e8 74 22 00 00       	call   6493 <open>
+  if(fd < 0){
+    421f:	83 c4 10             	add    $0x10,%esp
+  fd = open("lf2", 0);
+    4222:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    4224:	85 c0                	test   %eax,%eax
+    4226:	0f 88 f8 00 00 00    	js     4324 <linktest+0x1c4>
+  if(read(fd, buf, sizeof(buf)) != 5){
+    422c:	83 ec 04             	sub    $0x4,%esp
+    422f:	68 00 20 00 00       	push   $0x2000
+    4234:	68 20 c6 00 00       	push   $0xc620
+    4239:	50                   	push   %eax
+    423a:	e8 2c 22 00 00       	call   646b <read>
+    423f:	83 c4 10             	add    $0x10,%esp
+    4242:	83 f8 05             	cmp    $0x5,%eax
+    4245:	0f 85 c6 00 00 00    	jne    4311 <linktest+0x1b1>
+  close(fd);
+    424b:	83 ec 0c             	sub    $0xc,%esp
+    424e:	53                   	push   %ebx
+    424f:	e8 27 22 00 00       	call   647b <close>
+  if(link("lf2", "lf2") >= 0){
+    4254:	58                   	pop    %eax
+    4255:	5a                   	pop    %edx
+    4256:	68 70 74 00 00       	push   $0x7470
+    425b:	68 70 74 00 00       	push   $0x7470
+    4260:	e8 4e 22 00 00       	call   64b3 <link>
+    4265:	83 c4 10             	add    $0x10,%esp
+    4268:	85 c0                	test   %eax,%eax
+    426a:	0f 89 8e 00 00 00    	jns    42fe <linktest+0x19e>
+  unlink("lf2");
+    4270:	83 ec 0c             	sub    $0xc,%esp
+    4273:	68 70 74 00 00       	push   $0x7470
+    4278:	e8 26 22 00 00       	call   64a3 <unlink>
+  if(link("lf2", "lf1") >= 0){
+    427d:	59                   	pop    %ecx
+    427e:	5b                   	pop    %ebx
+    427f:	68 6c 74 00 00       	push   $0x746c
+    4284:	68 70 74 00 00       	push   $0x7470
+    4289:	e8 25 22 00 00       	call   64b3 <link>
+    428e:	83 c4 10             	add    $0x10,%esp
+    4291:	85 c0                	test   %eax,%eax
+    4293:	79 56                	jns    42eb <linktest+0x18b>
+  if(link(".", "lf1") >= 0){
+    4295:	83 ec 08             	sub    $0x8,%esp
+    4298:	68 6c 74 00 00       	push   $0x746c
+    429d:	68 34 77 00 00       	push   $0x7734
+    42a2:	e8 0c 22 00 00       	call   64b3 <link>
+    42a7:	83 c4 10             	add    $0x10,%esp
+    42aa:	85 c0                	test   %eax,%eax
+    42ac:	79 2a                	jns    42d8 <linktest+0x178>
+  printf(1, "linktest ok\n");
+    42ae:	83 ec 08             	sub    $0x8,%esp
+    42b1:	68 0a 75 00 00       	push   $0x750a
+    42b6:	6a 01                	push   $0x1
+    42b8:	e8 03 23 00 00       	call   65c0 <printf>
+}
+    42bd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    42c0:	83 c4 10             	add    $0x10,%esp
+    42c3:	c9                   	leave
+    42c4:	c3                   	ret
+    printf(1, "create lf1 failed\n");
+    42c5:	50                   	push   %eax
+    42c6:	50                   	push   %eax
+    42c7:	68 74 74 00 00       	push   $0x7474
+    42cc:	6a 01                	push   $0x1
+    42ce:	e8 ed 22 00 00       	call   65c0 <printf>
+    exit();
+    42d3:	e8 7b 21 00 00       	call   6453 <exit>
+    printf(1, "link . lf1 succeeded! oops\n");
+    42d8:	50                   	push   %eax
+    42d9:	50                   	push   %eax
+    42da:	68 ee 74 00 00       	push   $0x74ee
+    42df:	6a 01                	push   $0x1
+    42e1:	e8 da 22 00 00       	call   65c0 <printf>
+    exit();
+    42e6:	e8 68 21 00 00       	call   6453 <exit>
+    printf(1, "link non-existant succeeded! oops\n");
+    42eb:	52                   	push   %edx
+    42ec:	52                   	push   %edx
+    42ed:	68 78 8b 00 00       	push   $0x8b78
+    42f2:	6a 01                	push   $0x1
+    42f4:	e8 c7 22 00 00       	call   65c0 <printf>
+    exit();
+    42f9:	e8 55 21 00 00       	call   6453 <exit>
+    printf(1, "link lf2 lf2 succeeded! oops\n");
+    42fe:	50                   	push   %eax
+    42ff:	50                   	push   %eax
+    4300:	68 d0 74 00 00       	push   $0x74d0
+    4305:	6a 01                	push   $0x1
+    4307:	e8 b4 22 00 00       	call   65c0 <printf>
+    exit();
+    430c:	e8 42 21 00 00       	call   6453 <exit>
+    printf(1, "read lf2 failed\n");
+    4311:	51                   	push   %ecx
+    4312:	51                   	push   %ecx
+    4313:	68 bf 74 00 00       	push   $0x74bf
+    4318:	6a 01                	push   $0x1
+    431a:	e8 a1 22 00 00       	call   65c0 <printf>
+    exit();
+    431f:	e8 2f 21 00 00       	call   6453 <exit>
+    printf(1, "open lf2 failed\n");
+    4324:	53                   	push   %ebx
+    4325:	53                   	push   %ebx
+    4326:	68 ae 74 00 00       	push   $0x74ae
+    432b:	6a 01                	push   $0x1
+    432d:	e8 8e 22 00 00       	call   65c0 <printf>
+    exit();
+    4332:	e8 1c 21 00 00       	call   6453 <exit>
+    printf(1, "unlinked lf1 but it is still there!\n");
+    4337:	50                   	push   %eax
+    4338:	50                   	push   %eax
+    4339:	68 50 8b 00 00       	push   $0x8b50
+    433e:	6a 01                	push   $0x1
+    4340:	e8 7b 22 00 00       	call   65c0 <printf>
+    exit();
+    4345:	e8 09 21 00 00       	call   6453 <exit>
+    printf(1, "link lf1 lf2 failed\n");
+    434a:	51                   	push   %ecx
+    434b:	51                   	push   %ecx
+    434c:	68 99 74 00 00       	push   $0x7499
+    4351:	6a 01                	push   $0x1
+    4353:	e8 68 22 00 00       	call   65c0 <printf>
+    exit();
+    4358:	e8 f6 20 00 00       	call   6453 <exit>
+    printf(1, "write lf1 failed\n");
+    435d:	50                   	push   %eax
+    435e:	50                   	push   %eax
+    435f:	68 87 74 00 00       	push   $0x7487
+    4364:	6a 01                	push   $0x1
+    4366:	e8 55 22 00 00       	call   65c0 <printf>
+    exit();
+    436b:	e8 e3 20 00 00       	call   6453 <exit>
+
+00004370 <concreate>:
+{
+    4370:	55                   	push   %ebp
+    4371:	89 e5                	mov    %esp,%ebp
+    4373:	57                   	push   %edi
+    4374:	56                   	push   %esi
+  for(i = 0; i < 40; i++){
+    4375:	31 f6                	xor    %esi,%esi
+{
+    4377:	53                   	push   %ebx
+    4378:	8d 5d ad             	lea    -0x53(%ebp),%ebx
+    437b:	83 ec 64             	sub    $0x64,%esp
+  printf(1, "concreate test\n");
+    437e:	68 17 75 00 00       	push   $0x7517
+    4383:	6a 01                	push   $0x1
+    4385:	e8 36 22 00 00       	call   65c0 <printf>
+  file[0] = 'C';
+    438a:	c6 45 ad 43          	movb   $0x43,-0x53(%ebp)
+  file[2] = '\0';
+    438e:	83 c4 10             	add    $0x10,%esp
+    4391:	c6 45 af 00          	movb   $0x0,-0x51(%ebp)
+  for(i = 0; i < 40; i++){
+    4395:	eb 4c                	jmp    43e3 <concreate+0x73>
+    4397:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    439e:	66 90                	xchg   %ax,%ax
+    43a0:	69 c6 ab aa aa aa    	imul   $0xaaaaaaab,%esi,%eax
+    if(pid && (i % 3) == 1){
+    43a6:	3d ab aa aa aa       	cmp    $0xaaaaaaab,%eax
+    43ab:	0f 83 8f 00 00 00    	jae    4440 <concreate+0xd0>
+      fd = open(file, O_CREATE | O_RDWR);
+    43b1:	83 ec 08             	sub    $0x8,%esp
+    43b4:	68 02 02 00 00       	push   $0x202
+    43b9:	53                   	push   %ebx
+    43ba:	e8 d4 20 00 00       	call   6493 <open>
+      if(fd < 0){
+    43bf:	83 c4 10             	add    $0x10,%esp
+    43c2:	85 c0                	test   %eax,%eax
+    43c4:	78 63                	js     4429 <concreate+0xb9>
+      close(fd);
+    43c6:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 0; i < 40; i++){
+    43c9:	83 c6 01             	add    $0x1,%esi
+      close(fd);
+    43cc:	50                   	push   %eax
+    43cd:	e8 a9 20 00 00       	call   647b <close>
+    43d2:	83 c4 10             	add    $0x10,%esp
+      wait();
+    43d5:	e8 81 20 00 00       	call   645b <wait>
+  for(i = 0; i < 40; i++){
+    43da:	83 fe 28             	cmp    $0x28,%esi
+    43dd:	0f 84 7f 00 00 00    	je     4462 <concreate+0xf2>
+    unlink(file);
+    43e3:	83 ec 0c             	sub    $0xc,%esp
+    file[1] = '0' + i;
+    43e6:	8d 46 30             	lea    0x30(%esi),%eax
+    43e9:	88 45 ae             	mov    %al,-0x52(%ebp)
+    unlink(file);
+    43ec:	53                   	push   %ebx
+    43ed:	e8 b1 20 00 00       	call   64a3 <unlink>
+    pid = fork();
+    43f2:	e8 54 20 00 00       	call   644b <fork>
+    if(pid && (i % 3) == 1){
+    43f7:	83 c4 10             	add    $0x10,%esp
+    43fa:	85 c0                	test   %eax,%eax
+    43fc:	75 a2                	jne    43a0 <concreate+0x30>
+      link("C0", file);
+    43fe:	69 f6 cd cc cc cc    	imul   $0xcccccccd,%esi,%esi
+    } else if(pid == 0 && (i % 5) == 1){
+    4404:	81 fe cd cc cc cc    	cmp    $0xcccccccd,%esi
+    440a:	0f 83 d0 00 00 00    	jae    44e0 <concreate+0x170>
+      fd = open(file, O_CREATE | O_RDWR);
+    4410:	83 ec 08             	sub    $0x8,%esp
+    4413:	68 02 02 00 00       	push   $0x202
+    4418:	53                   	push   %ebx
+    4419:	e8 75 20 00 00       	call   6493 <open>
+      if(fd < 0){
+    441e:	83 c4 10             	add    $0x10,%esp
+    4421:	85 c0                	test   %eax,%eax
+    4423:	0f 89 ea 01 00 00    	jns    4613 <concreate+0x2a3>
+        printf(1, "concreate create %s failed\n", file);
+    4429:	83 ec 04             	sub    $0x4,%esp
+    442c:	53                   	push   %ebx
+    442d:	68 2a 75 00 00       	push   $0x752a
+    4432:	6a 01                	push   $0x1
+    4434:	e8 87 21 00 00       	call   65c0 <printf>
+        exit();
+    4439:	e8 15 20 00 00       	call   6453 <exit>
+    443e:	66 90                	xchg   %ax,%ax
+      link("C0", file);
+    4440:	83 ec 08             	sub    $0x8,%esp
+  for(i = 0; i < 40; i++){
+    4443:	83 c6 01             	add    $0x1,%esi
+      link("C0", file);
+    4446:	53                   	push   %ebx
+    4447:	68 27 75 00 00       	push   $0x7527
+    444c:	e8 62 20 00 00       	call   64b3 <link>
+    4451:	83 c4 10             	add    $0x10,%esp
+      wait();
+    4454:	e8 02 20 00 00       	call   645b <wait>
+  for(i = 0; i < 40; i++){
+    4459:	83 fe 28             	cmp    $0x28,%esi
+    445c:	0f 85 81 ff ff ff    	jne    43e3 <concreate+0x73>
+  memset(fa, 0, sizeof(fa));
+    4462:	83 ec 04             	sub    $0x4,%esp
+    4465:	8d 45 c0             	lea    -0x40(%ebp),%eax
+    4468:	6a 28                	push   $0x28
+    446a:	6a 00                	push   $0x0
+    446c:	50                   	push   %eax
+    446d:	e8 5e 1e 00 00       	call   62d0 <memset>
+  fd = open(".", 0);
+    4472:	5e                   	pop    %esi
+    4473:	5f                   	pop    %edi
+    4474:	6a 00                	push   $0x0
+    4476:	68 34 77 00 00       	push   $0x7734
+    447b:	8d 7d b0             	lea    -0x50(%ebp),%edi
+    447e:	e8 10 20 00 00       	call   6493 <open>
+  n = 0;
+    4483:	c7 45 a4 00 00 00 00 	movl   $0x0,-0x5c(%ebp)
+  while(read(fd, &de, sizeof(de)) > 0){
+    448a:	83 c4 10             	add    $0x10,%esp
+  fd = open(".", 0);
+    448d:	89 c6                	mov    %eax,%esi
+  while(read(fd, &de, sizeof(de)) > 0){
+    448f:	90                   	nop
+    4490:	83 ec 04             	sub    $0x4,%esp
+    4493:	6a 10                	push   $0x10
+    4495:	57                   	push   %edi
+    4496:	56                   	push   %esi
+    4497:	e8 cf 1f 00 00       	call   646b <read>
+    449c:	83 c4 10             	add    $0x10,%esp
+    449f:	85 c0                	test   %eax,%eax
+    44a1:	7e 5d                	jle    4500 <concreate+0x190>
+    if(de.inum == 0)
+    44a3:	66 83 7d b0 00       	cmpw   $0x0,-0x50(%ebp)
+    44a8:	74 e6                	je     4490 <concreate+0x120>
+    if(de.name[0] == 'C' && de.name[2] == '\0'){
+    44aa:	80 7d b2 43          	cmpb   $0x43,-0x4e(%ebp)
+    44ae:	75 e0                	jne    4490 <concreate+0x120>
+    44b0:	80 7d b4 00          	cmpb   $0x0,-0x4c(%ebp)
+    44b4:	75 da                	jne    4490 <concreate+0x120>
+      i = de.name[1] - '0';
+    44b6:	0f be 45 b3          	movsbl -0x4d(%ebp),%eax
+    44ba:	83 e8 30             	sub    $0x30,%eax
+      if(i < 0 || i >= sizeof(fa)){
+    44bd:	83 f8 27             	cmp    $0x27,%eax
+    44c0:	0f 87 5e 01 00 00    	ja     4624 <concreate+0x2b4>
+      if(fa[i]){
+    44c6:	80 7c 05 c0 00       	cmpb   $0x0,-0x40(%ebp,%eax,1)
+    44cb:	0f 85 7e 01 00 00    	jne    464f <concreate+0x2df>
+      n++;
+    44d1:	83 45 a4 01          	addl   $0x1,-0x5c(%ebp)
+      fa[i] = 1;
+    44d5:	c6 44 05 c0 01       	movb   $0x1,-0x40(%ebp,%eax,1)
+      n++;
+    44da:	eb b4                	jmp    4490 <concreate+0x120>
+    44dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      link("C0", file);
+    44e0:	83 ec 08             	sub    $0x8,%esp
+    44e3:	53                   	push   %ebx
+    44e4:	68 27 75 00 00       	push   $0x7527
+    44e9:	e8 c5 1f 00 00       	call   64b3 <link>
+    44ee:	83 c4 10             	add    $0x10,%esp
+      exit();
+    44f1:	e8 5d 1f 00 00       	call   6453 <exit>
+    44f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    44fd:	8d 76 00             	lea    0x0(%esi),%esi
+  close(fd);
+    4500:	83 ec 0c             	sub    $0xc,%esp
+    4503:	56                   	push   %esi
+    4504:	e8 72 1f 00 00       	call   647b <close>
+  if(n != 40){
+    4509:	83 c4 10             	add    $0x10,%esp
+    450c:	83 7d a4 28          	cmpl   $0x28,-0x5c(%ebp)
+    4510:	0f 85 26 01 00 00    	jne    463c <concreate+0x2cc>
+  for(i = 0; i < 40; i++){
+    4516:	31 f6                	xor    %esi,%esi
+    4518:	eb 48                	jmp    4562 <concreate+0x1f2>
+    451a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+       ((i % 3) == 1 && pid != 0)){
+    4520:	85 ff                	test   %edi,%edi
+    4522:	74 05                	je     4529 <concreate+0x1b9>
+    4524:	83 f8 01             	cmp    $0x1,%eax
+    4527:	74 68                	je     4591 <concreate+0x221>
+      unlink(file);
+    4529:	83 ec 0c             	sub    $0xc,%esp
+    452c:	53                   	push   %ebx
+    452d:	e8 71 1f 00 00       	call   64a3 <unlink>
+      unlink(file);
+    4532:	89 1c 24             	mov    %ebx,(%esp)
+    4535:	e8 69 1f 00 00       	call   64a3 <unlink>
+      unlink(file);
+    453a:	89 1c 24             	mov    %ebx,(%esp)
+    453d:	e8 61 1f 00 00       	call   64a3 <unlink>
+      unlink(file);
+    4542:	89 1c 24             	mov    %ebx,(%esp)
+    4545:	e8 59 1f 00 00       	call   64a3 <unlink>
+    454a:	83 c4 10             	add    $0x10,%esp
+    if(pid == 0)
+    454d:	85 ff                	test   %edi,%edi
+    454f:	74 a0                	je     44f1 <concreate+0x181>
+      wait();
+    4551:	e8 05 1f 00 00       	call   645b <wait>
+  for(i = 0; i < 40; i++){
+    4556:	83 c6 01             	add    $0x1,%esi
+    4559:	83 fe 28             	cmp    $0x28,%esi
+    455c:	0f 84 86 00 00 00    	je     45e8 <concreate+0x278>
+    file[1] = '0' + i;
+    4562:	8d 46 30             	lea    0x30(%esi),%eax
+    4565:	88 45 ae             	mov    %al,-0x52(%ebp)
+    pid = fork();
+    4568:	e8 de 1e 00 00       	call   644b <fork>
+    456d:	89 c7                	mov    %eax,%edi
+    if(pid < 0){
+    456f:	85 c0                	test   %eax,%eax
+    4571:	0f 88 88 00 00 00    	js     45ff <concreate+0x28f>
+    if(((i % 3) == 0 && pid == 0) ||
+    4577:	b8 ab aa aa aa       	mov    $0xaaaaaaab,%eax
+    457c:	f7 e6                	mul    %esi
+    457e:	89 d0                	mov    %edx,%eax
+    4580:	83 e2 fe             	and    $0xfffffffe,%edx
+    4583:	d1 e8                	shr    %eax
+    4585:	01 c2                	add    %eax,%edx
+    4587:	89 f0                	mov    %esi,%eax
+    4589:	29 d0                	sub    %edx,%eax
+    458b:	89 c1                	mov    %eax,%ecx
+    458d:	09 f9                	or     %edi,%ecx
+    458f:	75 8f                	jne    4520 <concreate+0x1b0>
+      close(open(file, 0));
+    4591:	83 ec 08             	sub    $0x8,%esp
+    4594:	6a 00                	push   $0x0
+    4596:	53                   	push   %ebx
+    4597:	e8 f7 1e 00 00       	call   6493 <open>
+    459c:	89 04 24             	mov    %eax,(%esp)
+    459f:	e8 d7 1e 00 00       	call   647b <close>
+      close(open(file, 0));
+    45a4:	58                   	pop    %eax
+    45a5:	5a                   	pop    %edx
+    45a6:	6a 00                	push   $0x0
+    45a8:	53                   	push   %ebx
+    45a9:	e8 e5 1e 00 00       	call   6493 <open>
+    45ae:	89 04 24             	mov    %eax,(%esp)
+    45b1:	e8 c5 1e 00 00       	call   647b <close>
+      close(open(file, 0));
+    45b6:	59                   	pop    %ecx
+    45b7:	58                   	pop    %eax
+    45b8:	6a 00                	push   $0x0
+    45ba:	53                   	push   %ebx
+    45bb:	e8 d3 1e 00 00       	call   6493 <open>
+    45c0:	89 04 24             	mov    %eax,(%esp)
+    45c3:	e8 b3 1e 00 00       	call   647b <close>
+      close(open(file, 0));
+    45c8:	58                   	pop    %eax
+    45c9:	5a                   	pop    %edx
+    45ca:	6a 00                	push   $0x0
+    45cc:	53                   	push   %ebx
+    45cd:	e8 c1 1e 00 00       	call   6493 <open>
+    45d2:	89 04 24             	mov    %eax,(%esp)
+    45d5:	e8 a1 1e 00 00       	call   647b <close>
+    45da:	83 c4 10             	add    $0x10,%esp
+    45dd:	e9 6b ff ff ff       	jmp    454d <concreate+0x1dd>
+    45e2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  printf(1, "concreate ok\n");
+    45e8:	83 ec 08             	sub    $0x8,%esp
+    45eb:	68 7c 75 00 00       	push   $0x757c
+    45f0:	6a 01                	push   $0x1
+    45f2:	e8 c9 1f 00 00       	call   65c0 <printf>
+}
+    45f7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    45fa:	5b                   	pop    %ebx
+    45fb:	5e                   	pop    %esi
+    45fc:	5f                   	pop    %edi
+    45fd:	5d                   	pop    %ebp
+    45fe:	c3                   	ret
+      printf(1, "fork failed\n");
+    45ff:	83 ec 08             	sub    $0x8,%esp
+    4602:	68 f4 7d 00 00       	push   $0x7df4
+    4607:	6a 01                	push   $0x1
+    4609:	e8 b2 1f 00 00       	call   65c0 <printf>
+      exit();
+    460e:	e8 40 1e 00 00       	call   6453 <exit>
+      close(fd);
+    4613:	83 ec 0c             	sub    $0xc,%esp
+    4616:	50                   	push   %eax
+    4617:	e8 5f 1e 00 00       	call   647b <close>
+    461c:	83 c4 10             	add    $0x10,%esp
+    461f:	e9 cd fe ff ff       	jmp    44f1 <concreate+0x181>
+        printf(1, "concreate weird file %s\n", de.name);
+    4624:	83 ec 04             	sub    $0x4,%esp
+    4627:	8d 45 b2             	lea    -0x4e(%ebp),%eax
+    462a:	50                   	push   %eax
+    462b:	68 46 75 00 00       	push   $0x7546
+    4630:	6a 01                	push   $0x1
+    4632:	e8 89 1f 00 00       	call   65c0 <printf>
+        exit();
+    4637:	e8 17 1e 00 00       	call   6453 <exit>
+    printf(1, "concreate not enough files in directory listing\n");
+    463c:	51                   	push   %ecx
+    463d:	51                   	push   %ecx
+    463e:	68 9c 8b 00 00       	push   $0x8b9c
+    4643:	6a 01                	push   $0x1
+    4645:	e8 76 1f 00 00       	call   65c0 <printf>
+    exit();
+    464a:	e8 04 1e 00 00       	call   6453 <exit>
+        printf(1, "concreate duplicate file %s\n", de.name);
+    464f:	83 ec 04             	sub    $0x4,%esp
+    4652:	8d 45 b2             	lea    -0x4e(%ebp),%eax
+    4655:	50                   	push   %eax
+    4656:	68 5f 75 00 00       	push   $0x755f
+    465b:	6a 01                	push   $0x1
+    465d:	e8 5e 1f 00 00       	call   65c0 <printf>
+        exit();
+    4662:	e8 ec 1d 00 00       	call   6453 <exit>
+    4667:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    466e:	66 90                	xchg   %ax,%ax
+
+00004670 <linkunlink>:
+{
+    4670:	55                   	push   %ebp
+    4671:	89 e5                	mov    %esp,%ebp
+    4673:	57                   	push   %edi
+    4674:	56                   	push   %esi
+    4675:	53                   	push   %ebx
+    4676:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "linkunlink test\n");
+    4679:	68 8a 75 00 00       	push   $0x758a
+    467e:	6a 01                	push   $0x1
+    4680:	e8 3b 1f 00 00       	call   65c0 <printf>
+  unlink("x");
+    4685:	c7 04 24 17 78 00 00 	movl   $0x7817,(%esp)
+    468c:	e8 12 1e 00 00       	call   64a3 <unlink>
+  pid = fork();
+    4691:	e8 b5 1d 00 00       	call   644b <fork>
+  if(pid < 0){
+    4696:	83 c4 10             	add    $0x10,%esp
+  pid = fork();
+    4699:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(pid < 0){
+    469c:	85 c0                	test   %eax,%eax
+    469e:	0f 88 b6 00 00 00    	js     475a <linkunlink+0xea>
+  unsigned int x = (pid ? 1 : 97);
+    46a4:	83 7d e4 01          	cmpl   $0x1,-0x1c(%ebp)
+    46a8:	bb 64 00 00 00       	mov    $0x64,%ebx
+    if((x % 3) == 0){
+    46ad:	be ab aa aa aa       	mov    $0xaaaaaaab,%esi
+  unsigned int x = (pid ? 1 : 97);
+    46b2:	19 ff                	sbb    %edi,%edi
+    46b4:	83 e7 60             	and    $0x60,%edi
+    46b7:	83 c7 01             	add    $0x1,%edi
+    46ba:	eb 1e                	jmp    46da <linkunlink+0x6a>
+    46bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    } else if((x % 3) == 1){
+    46c0:	83 f8 01             	cmp    $0x1,%eax
+    46c3:	74 7b                	je     4740 <linkunlink+0xd0>
+      unlink("x");
+    46c5:	83 ec 0c             	sub    $0xc,%esp
+    46c8:	68 17 78 00 00       	push   $0x7817
+    46cd:	e8 d1 1d 00 00       	call   64a3 <unlink>
+    46d2:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 100; i++){
+    46d5:	83 eb 01             	sub    $0x1,%ebx
+    46d8:	74 41                	je     471b <linkunlink+0xab>
+    x = x * 1103515245 + 12345;
+    46da:	69 cf 6d 4e c6 41    	imul   $0x41c64e6d,%edi,%ecx
+    46e0:	8d b9 39 30 00 00    	lea    0x3039(%ecx),%edi
+    if((x % 3) == 0){
+    46e6:	89 f8                	mov    %edi,%eax
+    46e8:	f7 e6                	mul    %esi
+    46ea:	89 d0                	mov    %edx,%eax
+    46ec:	83 e2 fe             	and    $0xfffffffe,%edx
+    46ef:	d1 e8                	shr    %eax
+    46f1:	01 c2                	add    %eax,%edx
+    46f3:	89 f8                	mov    %edi,%eax
+    46f5:	29 d0                	sub    %edx,%eax
+    46f7:	75 c7                	jne    46c0 <linkunlink+0x50>
+      close(open("x", O_RDWR | O_CREATE));
+    46f9:	83 ec 08             	sub    $0x8,%esp
+    46fc:	68 02 02 00 00       	push   $0x202
+    4701:	68 17 78 00 00       	push   $0x7817
+    4706:	e8 88 1d 00 00       	call   6493 <open>
+    470b:	89 04 24             	mov    %eax,(%esp)
+    470e:	e8 68 1d 00 00       	call   647b <close>
+    4713:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 100; i++){
+    4716:	83 eb 01             	sub    $0x1,%ebx
+    4719:	75 bf                	jne    46da <linkunlink+0x6a>
+  if(pid)
+    471b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    471e:	85 c0                	test   %eax,%eax
+    4720:	74 4b                	je     476d <linkunlink+0xfd>
+    wait();
+    4722:	e8 34 1d 00 00       	call   645b <wait>
+  printf(1, "linkunlink ok\n");
+    4727:	83 ec 08             	sub    $0x8,%esp
+    472a:	68 9f 75 00 00       	push   $0x759f
+    472f:	6a 01                	push   $0x1
+    4731:	e8 8a 1e 00 00       	call   65c0 <printf>
+}
+    4736:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    4739:	5b                   	pop    %ebx
+    473a:	5e                   	pop    %esi
+    473b:	5f                   	pop    %edi
+    473c:	5d                   	pop    %ebp
+    473d:	c3                   	ret
+    473e:	66 90                	xchg   %ax,%ax
+      link("cat", "x");
+    4740:	83 ec 08             	sub    $0x8,%esp
+    4743:	68 17 78 00 00       	push   $0x7817
+    4748:	68 9b 75 00 00       	push   $0x759b
+    474d:	e8 61 1d 00 00       	call   64b3 <link>
+    4752:	83 c4 10             	add    $0x10,%esp
+    4755:	e9 7b ff ff ff       	jmp    46d5 <linkunlink+0x65>
+    printf(1, "fork failed\n");
+    475a:	52                   	push   %edx
+    475b:	52                   	push   %edx
+    475c:	68 f4 7d 00 00       	push   $0x7df4
+    4761:	6a 01                	push   $0x1
+    4763:	e8 58 1e 00 00       	call   65c0 <printf>
+    exit();
+    4768:	e8 e6 1c 00 00       	call   6453 <exit>
+    exit();
+    476d:	e8 e1 1c 00 00       	call   6453 <exit>
+    4772:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    4779:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00004780 <bigdir>:
+{
+    4780:	55                   	push   %ebp
+    4781:	89 e5                	mov    %esp,%ebp
+    4783:	57                   	push   %edi
+    4784:	56                   	push   %esi
+    4785:	53                   	push   %ebx
+    4786:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "bigdir test\n");
+    4789:	68 ae 75 00 00       	push   $0x75ae
+    478e:	6a 01                	push   $0x1
+    4790:	e8 2b 1e 00 00       	call   65c0 <printf>
+  unlink("bd");
+    4795:	c7 04 24 bb 75 00 00 	movl   $0x75bb,(%esp)
+    479c:	e8 02 1d 00 00       	call   64a3 <unlink>
+  fd = open("bd", O_CREATE);
+    47a1:	5a                   	pop    %edx
+    47a2:	59                   	pop    %ecx
+    47a3:	68 00 02 00 00       	push   $0x200
+    47a8:	68 bb 75 00 00       	push   $0x75bb
+    47ad:	e8 e1 1c 00 00       	call   6493 <open>
+  if(fd < 0){
+    47b2:	83 c4 10             	add    $0x10,%esp
+    47b5:	85 c0                	test   %eax,%eax
+    47b7:	0f 88 de 00 00 00    	js     489b <bigdir+0x11b>
+  close(fd);
+    47bd:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 0; i < 500; i++){
+    47c0:	31 f6                	xor    %esi,%esi
+    47c2:	8d 7d de             	lea    -0x22(%ebp),%edi
+  close(fd);
+    47c5:	50                   	push   %eax
+    47c6:	e8 b0 1c 00 00       	call   647b <close>
+    47cb:	83 c4 10             	add    $0x10,%esp
+    47ce:	66 90                	xchg   %ax,%ax
+    name[1] = '0' + (i / 64);
+    47d0:	89 f0                	mov    %esi,%eax
+    if(link("bd", name) != 0){
+    47d2:	83 ec 08             	sub    $0x8,%esp
+    name[0] = 'x';
+    47d5:	c6 45 de 78          	movb   $0x78,-0x22(%ebp)
+    name[1] = '0' + (i / 64);
+    47d9:	c1 f8 06             	sar    $0x6,%eax
+    name[3] = '\0';
+    47dc:	c6 45 e1 00          	movb   $0x0,-0x1f(%ebp)
+    name[1] = '0' + (i / 64);
+    47e0:	83 c0 30             	add    $0x30,%eax
+    47e3:	88 45 df             	mov    %al,-0x21(%ebp)
+    name[2] = '0' + (i % 64);
+    47e6:	89 f0                	mov    %esi,%eax
+    47e8:	83 e0 3f             	and    $0x3f,%eax
+    47eb:	83 c0 30             	add    $0x30,%eax
+    47ee:	88 45 e0             	mov    %al,-0x20(%ebp)
+    if(link("bd", name) != 0){
+    47f1:	57                   	push   %edi
+    47f2:	68 bb 75 00 00       	push   $0x75bb
+    47f7:	e8 b7 1c 00 00       	call   64b3 <link>
+    47fc:	83 c4 10             	add    $0x10,%esp
+    47ff:	89 c3                	mov    %eax,%ebx
+    4801:	85 c0                	test   %eax,%eax
+    4803:	75 6e                	jne    4873 <bigdir+0xf3>
+  for(i = 0; i < 500; i++){
+    4805:	83 c6 01             	add    $0x1,%esi
+    4808:	81 fe f4 01 00 00    	cmp    $0x1f4,%esi
+    480e:	75 c0                	jne    47d0 <bigdir+0x50>
+  unlink("bd");
+    4810:	83 ec 0c             	sub    $0xc,%esp
+    4813:	68 bb 75 00 00       	push   $0x75bb
+    4818:	e8 86 1c 00 00       	call   64a3 <unlink>
+    481d:	83 c4 10             	add    $0x10,%esp
+    name[1] = '0' + (i / 64);
+    4820:	89 d8                	mov    %ebx,%eax
+    if(unlink(name) != 0){
+    4822:	83 ec 0c             	sub    $0xc,%esp
+    name[0] = 'x';
+    4825:	c6 45 de 78          	movb   $0x78,-0x22(%ebp)
+    name[1] = '0' + (i / 64);
+    4829:	c1 f8 06             	sar    $0x6,%eax
+    name[3] = '\0';
+    482c:	c6 45 e1 00          	movb   $0x0,-0x1f(%ebp)
+    name[1] = '0' + (i / 64);
+    4830:	83 c0 30             	add    $0x30,%eax
+    4833:	88 45 df             	mov    %al,-0x21(%ebp)
+    name[2] = '0' + (i % 64);
+    4836:	89 d8                	mov    %ebx,%eax
+    4838:	83 e0 3f             	and    $0x3f,%eax
+    483b:	83 c0 30             	add    $0x30,%eax
+    483e:	88 45 e0             	mov    %al,-0x20(%ebp)
+    if(unlink(name) != 0){
+    4841:	57                   	push   %edi
+    4842:	e8 5c 1c 00 00       	call   64a3 <unlink>
+    4847:	83 c4 10             	add    $0x10,%esp
+    484a:	85 c0                	test   %eax,%eax
+    484c:	75 39                	jne    4887 <bigdir+0x107>
+  for(i = 0; i < 500; i++){
+    484e:	83 c3 01             	add    $0x1,%ebx
+    4851:	81 fb f4 01 00 00    	cmp    $0x1f4,%ebx
+    4857:	75 c7                	jne    4820 <bigdir+0xa0>
+  printf(1, "bigdir ok\n");
+    4859:	83 ec 08             	sub    $0x8,%esp
+    485c:	68 fd 75 00 00       	push   $0x75fd
+    4861:	6a 01                	push   $0x1
+    4863:	e8 58 1d 00 00       	call   65c0 <printf>
+    4868:	83 c4 10             	add    $0x10,%esp
+}
+    486b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    486e:	5b                   	pop    %ebx
+    486f:	5e                   	pop    %esi
+    4870:	5f                   	pop    %edi
+    4871:	5d                   	pop    %ebp
+    4872:	c3                   	ret
+      printf(1, "bigdir link failed\n");
+    4873:	83 ec 08             	sub    $0x8,%esp
+    4876:	68 d4 75 00 00       	push   $0x75d4
+    487b:	6a 01                	push   $0x1
+    487d:	e8 3e 1d 00 00       	call   65c0 <printf>
+      exit();
+    4882:	e8 cc 1b 00 00       	call   6453 <exit>
+      printf(1, "bigdir unlink failed");
+    4887:	83 ec 08             	sub    $0x8,%esp
+    488a:	68 e8 75 00 00       	push   $0x75e8
+    488f:	6a 01                	push   $0x1
+    4891:	e8 2a 1d 00 00       	call   65c0 <printf>
+      exit();
+    4896:	e8 b8 1b 00 00       	call   6453 <exit>
+    printf(1, "bigdir create failed\n");
+    489b:	50                   	push   %eax
+    489c:	50                   	push   %eax
+    489d:	68 be 75 00 00       	push   $0x75be
+    48a2:	6a 01                	push   $0x1
+    48a4:	e8 17 1d 00 00       	call   65c0 <printf>
+    exit();
+    48a9:	e8 a5 1b 00 00       	call   6453 <exit>
+    48ae:	66 90                	xchg   %ax,%ax
+
+000048b0 <subdir>:
+{
+    48b0:	55                   	push   %ebp
+    48b1:	89 e5                	mov    %esp,%ebp
+    48b3:	53                   	push   %ebx
+    48b4:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "subdir test\n");
+    48b7:	68 08 76 00 00       	push   $0x7608
+    48bc:	6a 01                	push   $0x1
+    48be:	e8 fd 1c 00 00       	call   65c0 <printf>
+  unlink("ff");
+    48c3:	c7 04 24 91 76 00 00 	movl   $0x7691,(%esp)
+    48ca:	e8 d4 1b 00 00       	call   64a3 <unlink>
+  if(mkdir("dd") != 0){
+    48cf:	c7 04 24 2e 77 00 00 	movl   $0x772e,(%esp)
+    48d6:	e8 e0 1b 00 00       	call   64bb <mkdir>
+    48db:	83 c4 10             	add    $0x10,%esp
+    48de:	85 c0                	test   %eax,%eax
+    48e0:	0f 85 b3 05 00 00    	jne    4e99 <subdir+0x5e9>
+  fd = open("dd/ff", O_CREATE | O_RDWR);
+    48e6:	83 ec 08             	sub    $0x8,%esp
+    48e9:	68 02 02 00 00       	push   $0x202
+    48ee:	68 67 76 00 00       	push   $0x7667
+    48f3:	e8 9b 1b 00 00       	call   6493 <open>
+  if(fd < 0){
+    48f8:	83 c4 10             	add    $0x10,%esp
+  fd = open("dd/ff", O_CREATE | O_RDWR);
+    48fb:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    48fd:	85 c0                	test   %eax,%eax
+    48ff:	0f 88 81 05 00 00    	js     4e86 <subdir+0x5d6>
+  write(fd, "ff", 2);
+    4905:	83 ec 04             	sub    $0x4,%esp
+    4908:	6a 02                	push   $0x2
+    490a:	68 91 76 00 00       	push   $0x7691
+    490f:	50                   	push   %eax
+    4910:	e8 5e 1b 00 00       	call   6473 <write>
+  close(fd);
+    4915:	89 1c 24             	mov    %ebx,(%esp)
+    4918:	e8 5e 1b 00 00       	call   647b <close>
+  if(unlink("dd") >= 0){
+    491d:	c7 04 24 2e 77 00 00 	movl   $0x772e,(%esp)
+    4924:	e8 7a 1b 00 00       	call   64a3 <unlink>
+    4929:	83 c4 10             	add    $0x10,%esp
+    492c:	85 c0                	test   %eax,%eax
+    492e:	0f 89 3f 05 00 00    	jns    4e73 <subdir+0x5c3>
+  if(mkdir("/dd/dd") != 0){
+    4934:	83 ec 0c             	sub    $0xc,%esp
+    4937:	68 42 76 00 00       	push   $0x7642
+    493c:	e8 7a 1b 00 00       	call   64bb <mkdir>
+    4941:	83 c4 10             	add    $0x10,%esp
+    4944:	85 c0                	test   %eax,%eax
+    4946:	0f 85 14 05 00 00    	jne    4e60 <subdir+0x5b0>
+  fd = open("dd/dd/ff", O_CREATE | O_RDWR);
+    494c:	83 ec 08             	sub    $0x8,%esp
+    494f:	68 02 02 00 00       	push   $0x202
+    4954:	68 64 76 00 00       	push   $0x7664
+    4959:	e8 35 1b 00 00       	call   6493 <open>
+  if(fd < 0){
+    495e:	83 c4 10             	add    $0x10,%esp
+  fd = open("dd/dd/ff", O_CREATE | O_RDWR);
+    4961:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    4963:	85 c0                	test   %eax,%eax
+    4965:	0f 88 24 04 00 00    	js     4d8f <subdir+0x4df>
+  write(fd, "FF", 2);
+    496b:	83 ec 04             	sub    $0x4,%esp
+    496e:	6a 02                	push   $0x2
+    4970:	68 85 76 00 00       	push   $0x7685
+    4975:	50                   	push   %eax
+    4976:	e8 f8 1a 00 00       	call   6473 <write>
+  close(fd);
+    497b:	89 1c 24             	mov    %ebx,(%esp)
+    497e:	e8 f8 1a 00 00       	call   647b <close>
+  fd = open("dd/dd/../ff", 0);
+    4983:	58                   	pop    %eax
+    4984:	5a                   	pop    %edx
+    4985:	6a 00                	push   $0x0
+    4987:	68 88 76 00 00       	push   $0x7688
+    498c:	e8 02 1b 00 00       	call   6493 <open>
+  if(fd < 0){
+    4991:	83 c4 10             	add    $0x10,%esp
+  fd = open("dd/dd/../ff", 0);
+    4994:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    4996:	85 c0                	test   %eax,%eax
+    4998:	0f 88 de 03 00 00    	js     4d7c <subdir+0x4cc>
+  cc = read(fd, buf, sizeof(buf));
+    499e:	83 ec 04             	sub    $0x4,%esp
+    49a1:	68 00 20 00 00       	push   $0x2000
+    49a6:	68 20 c6 00 00       	push   $0xc620
+    49ab:	50                   	push   %eax
+    49ac:	e8 ba 1a 00 00       	call   646b <read>
+  if(cc != 2 || buf[0] != 'f'){
+    49b1:	83 c4 10             	add    $0x10,%esp
+    49b4:	83 f8 02             	cmp    $0x2,%eax
+    49b7:	0f 85 3a 03 00 00    	jne    4cf7 <subdir+0x447>
+    49bd:	80 3d 20 c6 00 00 66 	cmpb   $0x66,0xc620
+    49c4:	0f 85 2d 03 00 00    	jne    4cf7 <subdir+0x447>
+  close(fd);
+    49ca:	83 ec 0c             	sub    $0xc,%esp
+    49cd:	53                   	push   %ebx
+    49ce:	e8 a8 1a 00 00       	call   647b <close>
+  if(link("dd/dd/ff", "dd/dd/ffff") != 0){
+    49d3:	59                   	pop    %ecx
+    49d4:	5b                   	pop    %ebx
+    49d5:	68 c8 76 00 00       	push   $0x76c8
+    49da:	68 64 76 00 00       	push   $0x7664
+    49df:	e8 cf 1a 00 00       	call   64b3 <link>
+    49e4:	83 c4 10             	add    $0x10,%esp
+    49e7:	85 c0                	test   %eax,%eax
+    49e9:	0f 85 c6 03 00 00    	jne    4db5 <subdir+0x505>
+  if(unlink("dd/dd/ff") != 0){
+    49ef:	83 ec 0c             	sub    $0xc,%esp
+    49f2:	68 64 76 00 00       	push   $0x7664
+    49f7:	e8 a7 1a 00 00       	call   64a3 <unlink>
+    49fc:	83 c4 10             	add    $0x10,%esp
+    49ff:	85 c0                	test   %eax,%eax
+    4a01:	0f 85 16 03 00 00    	jne    4d1d <subdir+0x46d>
+  if(open("dd/dd/ff", O_RDONLY) >= 0){
+    4a07:	83 ec 08             	sub    $0x8,%esp
+    4a0a:	6a 00                	push   $0x0
+    4a0c:	68 64 76 00 00       	push   $0x7664
+    4a11:	e8 7d 1a 00 00       	call   6493 <open>
+    4a16:	83 c4 10             	add    $0x10,%esp
+    4a19:	85 c0                	test   %eax,%eax
+    4a1b:	0f 89 2c 04 00 00    	jns    4e4d <subdir+0x59d>
+  if(chdir("dd") != 0){
+    4a21:	83 ec 0c             	sub    $0xc,%esp
+    4a24:	68 2e 77 00 00       	push   $0x772e
+    4a29:	e8 95 1a 00 00       	call   64c3 <chdir>
+    4a2e:	83 c4 10             	add    $0x10,%esp
+    4a31:	85 c0                	test   %eax,%eax
+    4a33:	0f 85 01 04 00 00    	jne    4e3a <subdir+0x58a>
+  if(chdir("dd/../../dd") != 0){
+    4a39:	83 ec 0c             	sub    $0xc,%esp
+    4a3c:	68 fc 76 00 00       	push   $0x76fc
+    4a41:	e8 7d 1a 00 00       	call   64c3 <chdir>
+    4a46:	83 c4 10             	add    $0x10,%esp
+    4a49:	85 c0                	test   %eax,%eax
+    4a4b:	0f 85 b9 02 00 00    	jne    4d0a <subdir+0x45a>
+  if(chdir("dd/../../../dd") != 0){
+    4a51:	83 ec 0c             	sub    $0xc,%esp
+    4a54:	68 22 77 00 00       	push   $0x7722
+    4a59:	e8 65 1a 00 00       	call   64c3 <chdir>
+    4a5e:	83 c4 10             	add    $0x10,%esp
+    4a61:	85 c0                	test   %eax,%eax
+    4a63:	0f 85 a1 02 00 00    	jne    4d0a <subdir+0x45a>
+  if(chdir("./..") != 0){
+    4a69:	83 ec 0c             	sub    $0xc,%esp
+    4a6c:	68 31 77 00 00       	push   $0x7731
+    4a71:	e8 4d 1a 00 00       	call   64c3 <chdir>
+    4a76:	83 c4 10             	add    $0x10,%esp
+    4a79:	85 c0                	test   %eax,%eax
+    4a7b:	0f 85 21 03 00 00    	jne    4da2 <subdir+0x4f2>
+  fd = open("dd/dd/ffff", 0);
+    4a81:	83 ec 08             	sub    $0x8,%esp
+    4a84:	6a 00                	push   $0x0
+    4a86:	68 c8 76 00 00       	push   $0x76c8
+    4a8b:	e8 03 1a 00 00       	call   6493 <open>
+  if(fd < 0){
+    4a90:	83 c4 10             	add    $0x10,%esp
+  fd = open("dd/dd/ffff", 0);
+    4a93:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    4a95:	85 c0                	test   %eax,%eax
+    4a97:	0f 88 e0 04 00 00    	js     4f7d <subdir+0x6cd>
+  if(read(fd, buf, sizeof(buf)) != 2){
+    4a9d:	83 ec 04             	sub    $0x4,%esp
+    4aa0:	68 00 20 00 00       	push   $0x2000
+    4aa5:	68 20 c6 00 00       	push   $0xc620
+    4aaa:	50                   	push   %eax
+    4aab:	e8 bb 19 00 00       	call   646b <read>
+    4ab0:	83 c4 10             	add    $0x10,%esp
+    4ab3:	83 f8 02             	cmp    $0x2,%eax
+    4ab6:	0f 85 ae 04 00 00    	jne    4f6a <subdir+0x6ba>
+  close(fd);
+    4abc:	83 ec 0c             	sub    $0xc,%esp
+    4abf:	53                   	push   %ebx
+    4ac0:	e8 b6 19 00 00       	call   647b <close>
+  if(open("dd/dd/ff", O_RDONLY) >= 0){
+    4ac5:	58                   	pop    %eax
+    4ac6:	5a                   	pop    %edx
+    4ac7:	6a 00                	push   $0x0
+    4ac9:	68 64 76 00 00       	push   $0x7664
+    4ace:	e8 c0 19 00 00       	call   6493 <open>
+    4ad3:	83 c4 10             	add    $0x10,%esp
+    4ad6:	85 c0                	test   %eax,%eax
+    4ad8:	0f 89 65 02 00 00    	jns    4d43 <subdir+0x493>
+  if(open("dd/ff/ff", O_CREATE|O_RDWR) >= 0){
+    4ade:	83 ec 08             	sub    $0x8,%esp
+    4ae1:	68 02 02 00 00       	push   $0x202
+    4ae6:	68 7c 77 00 00       	push   $0x777c
+    4aeb:	e8 a3 19 00 00       	call   6493 <open>
+    4af0:	83 c4 10             	add    $0x10,%esp
+    4af3:	85 c0                	test   %eax,%eax
+    4af5:	0f 89 35 02 00 00    	jns    4d30 <subdir+0x480>
+  if(open("dd/xx/ff", O_CREATE|O_RDWR) >= 0){
+    4afb:	83 ec 08             	sub    $0x8,%esp
+    4afe:	68 02 02 00 00       	push   $0x202
+    4b03:	68 a1 77 00 00       	push   $0x77a1
+    4b08:	e8 86 19 00 00       	call   6493 <open>
+    4b0d:	83 c4 10             	add    $0x10,%esp
+    4b10:	85 c0                	test   %eax,%eax
+    4b12:	0f 89 0f 03 00 00    	jns    4e27 <subdir+0x577>
+  if(open("dd", O_CREATE) >= 0){
+    4b18:	83 ec 08             	sub    $0x8,%esp
+    4b1b:	68 00 02 00 00       	push   $0x200
+    4b20:	68 2e 77 00 00       	push   $0x772e
+    4b25:	e8 69 19 00 00       	call   6493 <open>
+    4b2a:	83 c4 10             	add    $0x10,%esp
+    4b2d:	85 c0                	test   %eax,%eax
+    4b2f:	0f 89 df 02 00 00    	jns    4e14 <subdir+0x564>
+  if(open("dd", O_RDWR) >= 0){
+    4b35:	83 ec 08             	sub    $0x8,%esp
+    4b38:	6a 02                	push   $0x2
+    4b3a:	68 2e 77 00 00       	push   $0x772e
+    4b3f:	e8 4f 19 00 00       	call   6493 <open>
+    4b44:	83 c4 10             	add    $0x10,%esp
+    4b47:	85 c0                	test   %eax,%eax
+    4b49:	0f 89 b2 02 00 00    	jns    4e01 <subdir+0x551>
+  if(open("dd", O_WRONLY) >= 0){
+    4b4f:	83 ec 08             	sub    $0x8,%esp
+    4b52:	6a 01                	push   $0x1
+    4b54:	68 2e 77 00 00       	push   $0x772e
+    4b59:	e8 35 19 00 00       	call   6493 <open>
+    4b5e:	83 c4 10             	add    $0x10,%esp
+    4b61:	85 c0                	test   %eax,%eax
+    4b63:	0f 89 85 02 00 00    	jns    4dee <subdir+0x53e>
+  if(link("dd/ff/ff", "dd/dd/xx") == 0){
+    4b69:	83 ec 08             	sub    $0x8,%esp
+    4b6c:	68 10 78 00 00       	push   $0x7810
+    4b71:	68 7c 77 00 00       	push   $0x777c
+    4b76:	e8 38 19 00 00       	call   64b3 <link>
+    4b7b:	83 c4 10             	add    $0x10,%esp
+    4b7e:	85 c0                	test   %eax,%eax
+    4b80:	0f 84 55 02 00 00    	je     4ddb <subdir+0x52b>
+  if(link("dd/xx/ff", "dd/dd/xx") == 0){
+    4b86:	83 ec 08             	sub    $0x8,%esp
+    4b89:	68 10 78 00 00       	push   $0x7810
+    4b8e:	68 a1 77 00 00       	push   $0x77a1
+    4b93:	e8 1b 19 00 00       	call   64b3 <link>
+    4b98:	83 c4 10             	add    $0x10,%esp
+    4b9b:	85 c0                	test   %eax,%eax
+    4b9d:	0f 84 25 02 00 00    	je     4dc8 <subdir+0x518>
+  if(link("dd/ff", "dd/dd/ffff") == 0){
+    4ba3:	83 ec 08             	sub    $0x8,%esp
+    4ba6:	68 c8 76 00 00       	push   $0x76c8
+    4bab:	68 67 76 00 00       	push   $0x7667
+    4bb0:	e8 fe 18 00 00       	call   64b3 <link>
+    4bb5:	83 c4 10             	add    $0x10,%esp
+    4bb8:	85 c0                	test   %eax,%eax
+    4bba:	0f 84 a9 01 00 00    	je     4d69 <subdir+0x4b9>
+  if(mkdir("dd/ff/ff") == 0){
+    4bc0:	83 ec 0c             	sub    $0xc,%esp
+    4bc3:	68 7c 77 00 00       	push   $0x777c
+    4bc8:	e8 ee 18 00 00       	call   64bb <mkdir>
+    4bcd:	83 c4 10             	add    $0x10,%esp
+    4bd0:	85 c0                	test   %eax,%eax
+    4bd2:	0f 84 7e 01 00 00    	je     4d56 <subdir+0x4a6>
+  if(mkdir("dd/xx/ff") == 0){
+    4bd8:	83 ec 0c             	sub    $0xc,%esp
+    4bdb:	68 a1 77 00 00       	push   $0x77a1
+    4be0:	e8 d6 18 00 00       	call   64bb <mkdir>
+    4be5:	83 c4 10             	add    $0x10,%esp
+    4be8:	85 c0                	test   %eax,%eax
+    4bea:	0f 84 67 03 00 00    	je     4f57 <subdir+0x6a7>
+  if(mkdir("dd/dd/ffff") == 0){
+    4bf0:	83 ec 0c             	sub    $0xc,%esp
+    4bf3:	68 c8 76 00 00       	push   $0x76c8
+    4bf8:	e8 be 18 00 00       	call   64bb <mkdir>
+    4bfd:	83 c4 10             	add    $0x10,%esp
+    4c00:	85 c0                	test   %eax,%eax
+    4c02:	0f 84 3c 03 00 00    	je     4f44 <subdir+0x694>
+  if(unlink("dd/xx/ff") == 0){
+    4c08:	83 ec 0c             	sub    $0xc,%esp
+    4c0b:	68 a1 77 00 00       	push   $0x77a1
+    4c10:	e8 8e 18 00 00       	call   64a3 <unlink>
+    4c15:	83 c4 10             	add    $0x10,%esp
+    4c18:	85 c0                	test   %eax,%eax
+    4c1a:	0f 84 11 03 00 00    	je     4f31 <subdir+0x681>
+  if(unlink("dd/ff/ff") == 0){
+    4c20:	83 ec 0c             	sub    $0xc,%esp
+    4c23:	68 7c 77 00 00       	push   $0x777c
+    4c28:	e8 76 18 00 00       	call   64a3 <unlink>
+    4c2d:	83 c4 10             	add    $0x10,%esp
+    4c30:	85 c0                	test   %eax,%eax
+    4c32:	0f 84 e6 02 00 00    	je     4f1e <subdir+0x66e>
+  if(chdir("dd/ff") == 0){
+    4c38:	83 ec 0c             	sub    $0xc,%esp
+    4c3b:	68 67 76 00 00       	push   $0x7667
+    4c40:	e8 7e 18 00 00       	call   64c3 <chdir>
+    4c45:	83 c4 10             	add    $0x10,%esp
+    4c48:	85 c0                	test   %eax,%eax
+    4c4a:	0f 84 bb 02 00 00    	je     4f0b <subdir+0x65b>
+  if(chdir("dd/xx") == 0){
+    4c50:	83 ec 0c             	sub    $0xc,%esp
+    4c53:	68 13 78 00 00       	push   $0x7813
+    4c58:	e8 66 18 00 00       	call   64c3 <chdir>
+    4c5d:	83 c4 10             	add    $0x10,%esp
+    4c60:	85 c0                	test   %eax,%eax
+    4c62:	0f 84 90 02 00 00    	je     4ef8 <subdir+0x648>
+  if(unlink("dd/dd/ffff") != 0){
+    4c68:	83 ec 0c             	sub    $0xc,%esp
+    4c6b:	68 c8 76 00 00       	push   $0x76c8
+    4c70:	e8 2e 18 00 00       	call   64a3 <unlink>
+    4c75:	83 c4 10             	add    $0x10,%esp
+    4c78:	85 c0                	test   %eax,%eax
+    4c7a:	0f 85 9d 00 00 00    	jne    4d1d <subdir+0x46d>
+  if(unlink("dd/ff") != 0){
+    4c80:	83 ec 0c             	sub    $0xc,%esp
+    4c83:	68 67 76 00 00       	push   $0x7667
+    4c88:	e8 16 18 00 00       	call   64a3 <unlink>
+    4c8d:	83 c4 10             	add    $0x10,%esp
+    4c90:	85 c0                	test   %eax,%eax
+    4c92:	0f 85 4d 02 00 00    	jne    4ee5 <subdir+0x635>
+  if(unlink("dd") == 0){
+    4c98:	83 ec 0c             	sub    $0xc,%esp
+    4c9b:	68 2e 77 00 00       	push   $0x772e
+    4ca0:	e8 fe 17 00 00       	call   64a3 <unlink>
+    4ca5:	83 c4 10             	add    $0x10,%esp
+    4ca8:	85 c0                	test   %eax,%eax
+    4caa:	0f 84 22 02 00 00    	je     4ed2 <subdir+0x622>
+  if(unlink("dd/dd") < 0){
+    4cb0:	83 ec 0c             	sub    $0xc,%esp
+    4cb3:	68 43 76 00 00       	push   $0x7643
+    4cb8:	e8 e6 17 00 00       	call   64a3 <unlink>
+    4cbd:	83 c4 10             	add    $0x10,%esp
+    4cc0:	85 c0                	test   %eax,%eax
+    4cc2:	0f 88 f7 01 00 00    	js     4ebf <subdir+0x60f>
+  if(unlink("dd") < 0){
+    4cc8:	83 ec 0c             	sub    $0xc,%esp
+    4ccb:	68 2e 77 00 00       	push   $0x772e
+    4cd0:	e8 ce 17 00 00       	call   64a3 <unlink>
+    4cd5:	83 c4 10             	add    $0x10,%esp
+    4cd8:	85 c0                	test   %eax,%eax
+    4cda:	0f 88 cc 01 00 00    	js     4eac <subdir+0x5fc>
+  printf(1, "subdir ok\n");
+    4ce0:	83 ec 08             	sub    $0x8,%esp
+    4ce3:	68 10 79 00 00       	push   $0x7910
+    4ce8:	6a 01                	push   $0x1
+    4cea:	e8 d1 18 00 00       	call   65c0 <printf>
+}
+    4cef:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    4cf2:	83 c4 10             	add    $0x10,%esp
+    4cf5:	c9                   	leave
+    4cf6:	c3                   	ret
+    printf(1, "dd/dd/../ff wrong content\n");
+    4cf7:	50                   	push   %eax
+    4cf8:	50                   	push   %eax
+    4cf9:	68 ad 76 00 00       	push   $0x76ad
+    4cfe:	6a 01                	push   $0x1
+    4d00:	e8 bb 18 00 00       	call   65c0 <printf>
+    exit();
+    4d05:	e8 49 17 00 00       	call   6453 <exit>
+    printf(1, "chdir dd/../../dd failed\n");
+    4d0a:	50                   	push   %eax
+    4d0b:	50                   	push   %eax
+    4d0c:	68 08 77 00 00       	push   $0x7708
+    4d11:	6a 01                	push   $0x1
+    4d13:	e8 a8 18 00 00       	call   65c0 <printf>
+    exit();
+    4d18:	e8 36 17 00 00       	call   6453 <exit>
+    printf(1, "unlink dd/dd/ff failed\n");
+    4d1d:	50                   	push   %eax
+    4d1e:	50                   	push   %eax
+    4d1f:	68 d3 76 00 00       	push   $0x76d3
+    4d24:	6a 01                	push   $0x1
+    4d26:	e8 95 18 00 00       	call   65c0 <printf>
+    exit();
+    4d2b:	e8 23 17 00 00       	call   6453 <exit>
+    printf(1, "create dd/ff/ff succeeded!\n");
+    4d30:	51                   	push   %ecx
+    4d31:	51                   	push   %ecx
+    4d32:	68 85 77 00 00       	push   $0x7785
+    4d37:	6a 01                	push   $0x1
+    4d39:	e8 82 18 00 00       	call   65c0 <printf>
+    exit();
+    4d3e:	e8 10 17 00 00       	call   6453 <exit>
+    printf(1, "open (unlinked) dd/dd/ff succeeded!\n");
+    4d43:	53                   	push   %ebx
+    4d44:	53                   	push   %ebx
+    4d45:	68 40 8c 00 00       	push   $0x8c40
+    4d4a:	6a 01                	push   $0x1
+    4d4c:	e8 6f 18 00 00       	call   65c0 <printf>
+    exit();
+    4d51:	e8 fd 16 00 00       	call   6453 <exit>
+    printf(1, "mkdir dd/ff/ff succeeded!\n");
+    4d56:	51                   	push   %ecx
+    4d57:	51                   	push   %ecx
+    4d58:	68 19 78 00 00       	push   $0x7819
+    4d5d:	6a 01                	push   $0x1
+    4d5f:	e8 5c 18 00 00       	call   65c0 <printf>
+    exit();
+    4d64:	e8 ea 16 00 00       	call   6453 <exit>
+    printf(1, "link dd/ff dd/dd/ffff succeeded!\n");
+    4d69:	53                   	push   %ebx
+    4d6a:	53                   	push   %ebx
+    4d6b:	68 b0 8c 00 00       	push   $0x8cb0
+    4d70:	6a 01                	push   $0x1
+    4d72:	e8 49 18 00 00       	call   65c0 <printf>
+    exit();
+    4d77:	e8 d7 16 00 00       	call   6453 <exit>
+    printf(1, "open dd/dd/../ff failed\n");
+    4d7c:	50                   	push   %eax
+    4d7d:	50                   	push   %eax
+    4d7e:	68 94 76 00 00       	push   $0x7694
+    4d83:	6a 01                	push   $0x1
+    4d85:	e8 36 18 00 00       	call   65c0 <printf>
+    exit();
+    4d8a:	e8 c4 16 00 00       	call   6453 <exit>
+    printf(1, "create dd/dd/ff failed\n");
+    4d8f:	51                   	push   %ecx
+    4d90:	51                   	push   %ecx
+    4d91:	68 6d 76 00 00       	push   $0x766d
+    4d96:	6a 01                	push   $0x1
+    4d98:	e8 23 18 00 00       	call   65c0 <printf>
+    exit();
+    4d9d:	e8 b1 16 00 00       	call   6453 <exit>
+    printf(1, "chdir ./.. failed\n");
+    4da2:	50                   	push   %eax
+    4da3:	50                   	push   %eax
+    4da4:	68 36 77 00 00       	push   $0x7736
+    4da9:	6a 01                	push   $0x1
+    4dab:	e8 10 18 00 00       	call   65c0 <printf>
+    exit();
+    4db0:	e8 9e 16 00 00       	call   6453 <exit>
+    printf(1, "link dd/dd/ff dd/dd/ffff failed\n");
+    4db5:	52                   	push   %edx
+    4db6:	52                   	push   %edx
+    4db7:	68 f8 8b 00 00       	push   $0x8bf8
+    4dbc:	6a 01                	push   $0x1
+    4dbe:	e8 fd 17 00 00       	call   65c0 <printf>
+    exit();
+    4dc3:	e8 8b 16 00 00       	call   6453 <exit>
+    printf(1, "link dd/xx/ff dd/dd/xx succeeded!\n");
+    4dc8:	50                   	push   %eax
+    4dc9:	50                   	push   %eax
+    4dca:	68 8c 8c 00 00       	push   $0x8c8c
+    4dcf:	6a 01                	push   $0x1
+    4dd1:	e8 ea 17 00 00       	call   65c0 <printf>
+    exit();
+    4dd6:	e8 78 16 00 00       	call   6453 <exit>
+    printf(1, "link dd/ff/ff dd/dd/xx succeeded!\n");
+    4ddb:	50                   	push   %eax
+    4ddc:	50                   	push   %eax
+    4ddd:	68 68 8c 00 00       	push   $0x8c68
+    4de2:	6a 01                	push   $0x1
+    4de4:	e8 d7 17 00 00       	call   65c0 <printf>
+    exit();
+    4de9:	e8 65 16 00 00       	call   6453 <exit>
+    printf(1, "open dd wronly succeeded!\n");
+    4dee:	50                   	push   %eax
+    4def:	50                   	push   %eax
+    4df0:	68 f5 77 00 00       	push   $0x77f5
+    4df5:	6a 01                	push   $0x1
+    4df7:	e8 c4 17 00 00       	call   65c0 <printf>
+    exit();
+    4dfc:	e8 52 16 00 00       	call   6453 <exit>
+    printf(1, "open dd rdwr succeeded!\n");
+    4e01:	50                   	push   %eax
+    4e02:	50                   	push   %eax
+    4e03:	68 dc 77 00 00       	push   $0x77dc
+    4e08:	6a 01                	push   $0x1
+    4e0a:	e8 b1 17 00 00       	call   65c0 <printf>
+    exit();
+    4e0f:	e8 3f 16 00 00       	call   6453 <exit>
+    printf(1, "create dd succeeded!\n");
+    4e14:	50                   	push   %eax
+    4e15:	50                   	push   %eax
+    4e16:	68 c6 77 00 00       	push   $0x77c6
+    4e1b:	6a 01                	push   $0x1
+    4e1d:	e8 9e 17 00 00       	call   65c0 <printf>
+    exit();
+    4e22:	e8 2c 16 00 00       	call   6453 <exit>
+    printf(1, "create dd/xx/ff succeeded!\n");
+    4e27:	52                   	push   %edx
+    4e28:	52                   	push   %edx
+    4e29:	68 aa 77 00 00       	push   $0x77aa
+    4e2e:	6a 01                	push   $0x1
+    4e30:	e8 8b 17 00 00       	call   65c0 <printf>
+    exit();
+    4e35:	e8 19 16 00 00       	call   6453 <exit>
+    printf(1, "chdir dd failed\n");
+    4e3a:	50                   	push   %eax
+    4e3b:	50                   	push   %eax
+    4e3c:	68 eb 76 00 00       	push   $0x76eb
+    4e41:	6a 01                	push   $0x1
+    4e43:	e8 78 17 00 00       	call   65c0 <printf>
+    exit();
+    4e48:	e8 06 16 00 00       	call   6453 <exit>
+    printf(1, "open (unlinked) dd/dd/ff succeeded\n");
+    4e4d:	50                   	push   %eax
+    4e4e:	50                   	push   %eax
+    4e4f:	68 1c 8c 00 00       	push   $0x8c1c
+    4e54:	6a 01                	push   $0x1
+    4e56:	e8 65 17 00 00       	call   65c0 <printf>
+    exit();
+    4e5b:	e8 f3 15 00 00       	call   6453 <exit>
+    printf(1, "subdir mkdir dd/dd failed\n");
+    4e60:	53                   	push   %ebx
+    4e61:	53                   	push   %ebx
+    4e62:	68 49 76 00 00       	push   $0x7649
+    4e67:	6a 01                	push   $0x1
+    4e69:	e8 52 17 00 00       	call   65c0 <printf>
+    exit();
+    4e6e:	e8 e0 15 00 00       	call   6453 <exit>
+    printf(1, "unlink dd (non-empty dir) succeeded!\n");
+    4e73:	50                   	push   %eax
+    4e74:	50                   	push   %eax
+    4e75:	68 d0 8b 00 00       	push   $0x8bd0
+    4e7a:	6a 01                	push   $0x1
+    4e7c:	e8 3f 17 00 00       	call   65c0 <printf>
+    exit();
+    4e81:	e8 cd 15 00 00       	call   6453 <exit>
+    printf(1, "create dd/ff failed\n");
+    4e86:	50                   	push   %eax
+    4e87:	50                   	push   %eax
+    4e88:	68 2d 76 00 00       	push   $0x762d
+    4e8d:	6a 01                	push   $0x1
+    4e8f:	e8 2c 17 00 00       	call   65c0 <printf>
+    exit();
+    4e94:	e8 ba 15 00 00       	call   6453 <exit>
+    printf(1, "subdir mkdir dd failed\n");
+    4e99:	50                   	push   %eax
+    4e9a:	50                   	push   %eax
+    4e9b:	68 15 76 00 00       	push   $0x7615
+    4ea0:	6a 01                	push   $0x1
+    4ea2:	e8 19 17 00 00       	call   65c0 <printf>
+    exit();
+    4ea7:	e8 a7 15 00 00       	call   6453 <exit>
+    printf(1, "unlink dd failed\n");
+    4eac:	50                   	push   %eax
+    4ead:	50                   	push   %eax
+    4eae:	68 fe 78 00 00       	push   $0x78fe
+    4eb3:	6a 01                	push   $0x1
+    4eb5:	e8 06 17 00 00       	call   65c0 <printf>
+    exit();
+    4eba:	e8 94 15 00 00       	call   6453 <exit>
+    printf(1, "unlink dd/dd failed\n");
+    4ebf:	52                   	push   %edx
+    4ec0:	52                   	push   %edx
+    4ec1:	68 e9 78 00 00       	push   $0x78e9
+    4ec6:	6a 01                	push   $0x1
+    4ec8:	e8 f3 16 00 00       	call   65c0 <printf>
+    exit();
+    4ecd:	e8 81 15 00 00       	call   6453 <exit>
+    printf(1, "unlink non-empty dd succeeded!\n");
+    4ed2:	51                   	push   %ecx
+    4ed3:	51                   	push   %ecx
+    4ed4:	68 d4 8c 00 00       	push   $0x8cd4
+    4ed9:	6a 01                	push   $0x1
+    4edb:	e8 e0 16 00 00       	call   65c0 <printf>
+    exit();
+    4ee0:	e8 6e 15 00 00       	call   6453 <exit>
+    printf(1, "unlink dd/ff failed\n");
+    4ee5:	53                   	push   %ebx
+    4ee6:	53                   	push   %ebx
+    4ee7:	68 d4 78 00 00       	push   $0x78d4
+    4eec:	6a 01                	push   $0x1
+    4eee:	e8 cd 16 00 00       	call   65c0 <printf>
+    exit();
+    4ef3:	e8 5b 15 00 00       	call   6453 <exit>
+    printf(1, "chdir dd/xx succeeded!\n");
+    4ef8:	50                   	push   %eax
+    4ef9:	50                   	push   %eax
+    4efa:	68 bc 78 00 00       	push   $0x78bc
+    4eff:	6a 01                	push   $0x1
+    4f01:	e8 ba 16 00 00       	call   65c0 <printf>
+    exit();
+    4f06:	e8 48 15 00 00       	call   6453 <exit>
+    printf(1, "chdir dd/ff succeeded!\n");
+    4f0b:	50                   	push   %eax
+    4f0c:	50                   	push   %eax
+    4f0d:	68 a4 78 00 00       	push   $0x78a4
+    4f12:	6a 01                	push   $0x1
+    4f14:	e8 a7 16 00 00       	call   65c0 <printf>
+    exit();
+    4f19:	e8 35 15 00 00       	call   6453 <exit>
+    printf(1, "unlink dd/ff/ff succeeded!\n");
+    4f1e:	50                   	push   %eax
+    4f1f:	50                   	push   %eax
+    4f20:	68 88 78 00 00       	push   $0x7888
+    4f25:	6a 01                	push   $0x1
+    4f27:	e8 94 16 00 00       	call   65c0 <printf>
+    exit();
+    4f2c:	e8 22 15 00 00       	call   6453 <exit>
+    printf(1, "unlink dd/xx/ff succeeded!\n");
+    4f31:	50                   	push   %eax
+    4f32:	50                   	push   %eax
+    4f33:	68 6c 78 00 00       	push   $0x786c
+    4f38:	6a 01                	push   $0x1
+    4f3a:	e8 81 16 00 00       	call   65c0 <printf>
+    exit();
+    4f3f:	e8 0f 15 00 00       	call   6453 <exit>
+    printf(1, "mkdir dd/dd/ffff succeeded!\n");
+    4f44:	50                   	push   %eax
+    4f45:	50                   	push   %eax
+    4f46:	68 4f 78 00 00       	push   $0x784f
+    4f4b:	6a 01                	push   $0x1
+    4f4d:	e8 6e 16 00 00       	call   65c0 <printf>
+    exit();
+    4f52:	e8 fc 14 00 00       	call   6453 <exit>
+    printf(1, "mkdir dd/xx/ff succeeded!\n");
+    4f57:	52                   	push   %edx
+    4f58:	52                   	push   %edx
+    4f59:	68 34 78 00 00       	push   $0x7834
+    4f5e:	6a 01                	push   $0x1
+    4f60:	e8 5b 16 00 00       	call   65c0 <printf>
+    exit();
+    4f65:	e8 e9 14 00 00       	call   6453 <exit>
+    printf(1, "read dd/dd/ffff wrong len\n");
+    4f6a:	51                   	push   %ecx
+    4f6b:	51                   	push   %ecx
+    4f6c:	68 61 77 00 00       	push   $0x7761
+    4f71:	6a 01                	push   $0x1
+    4f73:	e8 48 16 00 00       	call   65c0 <printf>
+    exit();
+    4f78:	e8 d6 14 00 00       	call   6453 <exit>
+    printf(1, "open dd/dd/ffff failed\n");
+    4f7d:	53                   	push   %ebx
+    4f7e:	53                   	push   %ebx
+    4f7f:	68 49 77 00 00       	push   $0x7749
+    4f84:	6a 01                	push   $0x1
+    4f86:	e8 35 16 00 00       	call   65c0 <printf>
+    exit();
+    4f8b:	e8 c3 14 00 00       	call   6453 <exit>
+
+00004f90 <bigwrite>:
+{
+    4f90:	55                   	push   %ebp
+    4f91:	89 e5                	mov    %esp,%ebp
+    4f93:	56                   	push   %esi
+    4f94:	53                   	push   %ebx
+  for(sz = 499; sz < 12*512; sz += 471){
+    4f95:	bb f3 01 00 00       	mov    $0x1f3,%ebx
+  printf(1, "bigwrite test\n");
+    4f9a:	83 ec 08             	sub    $0x8,%esp
+    4f9d:	68 1b 79 00 00       	push   $0x791b
+    4fa2:	6a 01                	push   $0x1
+    4fa4:	e8 17 16 00 00       	call   65c0 <printf>
+  unlink("bigwrite");
+    4fa9:	c7 04 24 2a 79 00 00 	movl   $0x792a,(%esp)
+    4fb0:	e8 ee 14 00 00       	call   64a3 <unlink>
+    4fb5:	83 c4 10             	add    $0x10,%esp
+    4fb8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    4fbf:	90                   	nop
+    fd = open("bigwrite", O_CREATE | O_RDWR);
+    4fc0:	83 ec 08             	sub    $0x8,%esp
+    4fc3:	68 02 02 00 00       	push   $0x202
+    4fc8:	68 2a 79 00 00       	push   $0x792a
+    4fcd:	e8 c1 14 00 00       	call   6493 <open>
+    if(fd < 0){
+    4fd2:	83 c4 10             	add    $0x10,%esp
+    fd = open("bigwrite", O_CREATE | O_RDWR);
+    4fd5:	89 c6                	mov    %eax,%esi
+    if(fd < 0){
+    4fd7:	85 c0                	test   %eax,%eax
+    4fd9:	78 7e                	js     5059 <bigwrite+0xc9>
+      int cc = write(fd, buf, sz);
+    4fdb:	83 ec 04             	sub    $0x4,%esp
+    4fde:	53                   	push   %ebx
+    4fdf:	68 20 c6 00 00       	push   $0xc620
+    4fe4:	50                   	push   %eax
+    4fe5:	e8 89 14 00 00       	call   6473 <write>
+      if(cc != sz){
+    4fea:	83 c4 10             	add    $0x10,%esp
+    4fed:	39 d8                	cmp    %ebx,%eax
+    4fef:	75 55                	jne    5046 <bigwrite+0xb6>
+      int cc = write(fd, buf, sz);
+    4ff1:	83 ec 04             	sub    $0x4,%esp
+    4ff4:	53                   	push   %ebx
+    4ff5:	68 20 c6 00 00       	push   $0xc620
+    4ffa:	56                   	push   %esi
+    4ffb:	e8 73 14 00 00       	call   6473 <write>
+      if(cc != sz){
+    5000:	83 c4 10             	add    $0x10,%esp
+    5003:	39 c3                	cmp    %eax,%ebx
+    5005:	75 3f                	jne    5046 <bigwrite+0xb6>
+    close(fd);
+    5007:	83 ec 0c             	sub    $0xc,%esp
+  for(sz = 499; sz < 12*512; sz += 471){
+    500a:	81 c3 d7 01 00 00    	add    $0x1d7,%ebx
+    close(fd);
+    5010:	56                   	push   %esi
+    5011:	e8 65 14 00 00       	call   647b <close>
+    unlink("bigwrite");
+    5016:	c7 04 24 2a 79 00 00 	movl   $0x792a,(%esp)
+    501d:	e8 81 14 00 00       	call   64a3 <unlink>
+  for(sz = 499; sz < 12*512; sz += 471){
+    5022:	83 c4 10             	add    $0x10,%esp
+    5025:	81 fb 07 18 00 00    	cmp    $0x1807,%ebx
+    502b:	75 93                	jne    4fc0 <bigwrite+0x30>
+  printf(1, "bigwrite ok\n");
+    502d:	83 ec 08             	sub    $0x8,%esp
+    5030:	68 5d 79 00 00       	push   $0x795d
+    5035:	6a 01                	push   $0x1
+    5037:	e8 84 15 00 00       	call   65c0 <printf>
+}
+    503c:	83 c4 10             	add    $0x10,%esp
+    503f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    5042:	5b                   	pop    %ebx
+    5043:	5e                   	pop    %esi
+    5044:	5d                   	pop    %ebp
+    5045:	c3                   	ret
+        printf(1, "write(%d) ret %d\n", sz, cc);
+    5046:	50                   	push   %eax
+    5047:	53                   	push   %ebx
+    5048:	68 4b 79 00 00       	push   $0x794b
+    504d:	6a 01                	push   $0x1
+    504f:	e8 6c 15 00 00       	call   65c0 <printf>
+        exit();
+    5054:	e8 fa 13 00 00       	call   6453 <exit>
+      printf(1, "cannot create bigwrite\n");
+    5059:	83 ec 08             	sub    $0x8,%esp
+    505c:	68 33 79 00 00       	push   $0x7933
+    5061:	6a 01                	push   $0x1
+    5063:	e8 58 15 00 00       	call   65c0 <printf>
+      exit();
+    5068:	e8 e6 13 00 00       	call   6453 <exit>
+    506d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00005070 <bigfile>:
+{
+    5070:	55                   	push   %ebp
+    5071:	89 e5                	mov    %esp,%ebp
+    5073:	57                   	push   %edi
+    5074:	56                   	push   %esi
+    5075:	53                   	push   %ebx
+    5076:	83 ec 14             	sub    $0x14,%esp
+  printf(1, "bigfile test\n");
+    5079:	68 6a 79 00 00       	push   $0x796a
+    507e:	6a 01                	push   $0x1
+    5080:	e8 3b 15 00 00       	call   65c0 <printf>
+  unlink("bigfile");
+    5085:	c7 04 24 86 79 00 00 	movl   $0x7986,(%esp)
+    508c:	e8 12 14 00 00       	call   64a3 <unlink>
+  fd = open("bigfile", O_CREATE | O_RDWR);
+    5091:	58                   	pop    %eax
+    5092:	5a                   	pop    %edx
+    5093:	68 02 02 00 00       	push   $0x202
+    5098:	68 86 79 00 00       	push   $0x7986
+    509d:	e8 f1 13 00 00       	call   6493 <open>
+  if(fd < 0){
+    50a2:	83 c4 10             	add    $0x10,%esp
+    50a5:	85 c0                	test   %eax,%eax
+    50a7:	0f 88 5e 01 00 00    	js     520b <bigfile+0x19b>
+    50ad:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < 20; i++){
+    50af:	31 db                	xor    %ebx,%ebx
+    50b1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    memset(buf, i, 600);
+    50b8:	83 ec 04             	sub    $0x4,%esp
+    50bb:	68 58 02 00 00       	push   $0x258
+    50c0:	53                   	push   %ebx
+    50c1:	68 20 c6 00 00       	push   $0xc620
+    50c6:	e8 05 12 00 00       	call   62d0 <memset>
+    if(write(fd, buf, 600) != 600){
+    50cb:	83 c4 0c             	add    $0xc,%esp
+    50ce:	68 58 02 00 00       	push   $0x258
+    50d3:	68 20 c6 00 00       	push   $0xc620
+    50d8:	56                   	push   %esi
+    50d9:	e8 95 13 00 00       	call   6473 <write>
+    50de:	83 c4 10             	add    $0x10,%esp
+    50e1:	3d 58 02 00 00       	cmp    $0x258,%eax
+    50e6:	0f 85 f8 00 00 00    	jne    51e4 <bigfile+0x174>
+  for(i = 0; i < 20; i++){
+    50ec:	83 c3 01             	add    $0x1,%ebx
+    50ef:	83 fb 14             	cmp    $0x14,%ebx
+    50f2:	75 c4                	jne    50b8 <bigfile+0x48>
+  close(fd);
+    50f4:	83 ec 0c             	sub    $0xc,%esp
+    50f7:	56                   	push   %esi
+    50f8:	e8 7e 13 00 00       	call   647b <close>
+  fd = open("bigfile", 0);
+    50fd:	5e                   	pop    %esi
+    50fe:	5f                   	pop    %edi
+    50ff:	6a 00                	push   $0x0
+    5101:	68 86 79 00 00       	push   $0x7986
+    5106:	e8 88 13 00 00       	call   6493 <open>
+  if(fd < 0){
+    510b:	83 c4 10             	add    $0x10,%esp
+  fd = open("bigfile", 0);
+    510e:	89 c6                	mov    %eax,%esi
+  if(fd < 0){
+    5110:	85 c0                	test   %eax,%eax
+    5112:	0f 88 e0 00 00 00    	js     51f8 <bigfile+0x188>
+  total = 0;
+    5118:	31 db                	xor    %ebx,%ebx
+  for(i = 0; ; i++){
+    511a:	31 ff                	xor    %edi,%edi
+    511c:	eb 30                	jmp    514e <bigfile+0xde>
+    511e:	66 90                	xchg   %ax,%ax
+    if(cc != 300){
+    5120:	3d 2c 01 00 00       	cmp    $0x12c,%eax
+    5125:	0f 85 91 00 00 00    	jne    51bc <bigfile+0x14c>
+    if(buf[0] != i/2 || buf[299] != i/2){
+    512b:	89 fa                	mov    %edi,%edx
+    512d:	0f be 05 20 c6 00 00 	movsbl 0xc620,%eax
+    5134:	d1 fa                	sar    %edx
+    5136:	39 d0                	cmp    %edx,%eax
+    5138:	75 6e                	jne    51a8 <bigfile+0x138>
+    513a:	0f be 15 4b c7 00 00 	movsbl 0xc74b,%edx
+    5141:	39 d0                	cmp    %edx,%eax
+    5143:	75 63                	jne    51a8 <bigfile+0x138>
+    total += cc;
+    5145:	81 c3 2c 01 00 00    	add    $0x12c,%ebx
+  for(i = 0; ; i++){
+    514b:	83 c7 01             	add    $0x1,%edi
+    cc = read(fd, buf, 300);
+    514e:	83 ec 04             	sub    $0x4,%esp
+    5151:	68 2c 01 00 00       	push   $0x12c
+    5156:	68 20 c6 00 00       	push   $0xc620
+    515b:	56                   	push   %esi
+    515c:	e8 0a 13 00 00       	call   646b <read>
+    if(cc < 0){
+    5161:	83 c4 10             	add    $0x10,%esp
+    5164:	85 c0                	test   %eax,%eax
+    5166:	78 68                	js     51d0 <bigfile+0x160>
+    if(cc == 0)
+    5168:	75 b6                	jne    5120 <bigfile+0xb0>
+  close(fd);
+    516a:	83 ec 0c             	sub    $0xc,%esp
+    516d:	56                   	push   %esi
+    516e:	e8 08 13 00 00       	call   647b <close>
+  if(total != 20*600){
+    5173:	83 c4 10             	add    $0x10,%esp
+    5176:	81 fb e0 2e 00 00    	cmp    $0x2ee0,%ebx
+    517c:	0f 85 9c 00 00 00    	jne    521e <bigfile+0x1ae>
+  unlink("bigfile");
+    5182:	83 ec 0c             	sub    $0xc,%esp
+    5185:	68 86 79 00 00       	push   $0x7986
+    518a:	e8 14 13 00 00       	call   64a3 <unlink>
+  printf(1, "bigfile test ok\n");
+    518f:	58                   	pop    %eax
+    5190:	5a                   	pop    %edx
+    5191:	68 15 7a 00 00       	push   $0x7a15
+    5196:	6a 01                	push   $0x1
+    5198:	e8 23 14 00 00       	call   65c0 <printf>
+}
+    519d:	83 c4 10             	add    $0x10,%esp
+    51a0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    51a3:	5b                   	pop    %ebx
+    51a4:	5e                   	pop    %esi
+    51a5:	5f                   	pop    %edi
+    51a6:	5d                   	pop    %ebp
+    51a7:	c3                   	ret
+      printf(1, "read bigfile wrong data\n");
+    51a8:	83 ec 08             	sub    $0x8,%esp
+    51ab:	68 e2 79 00 00       	push   $0x79e2
+    51b0:	6a 01                	push   $0x1
+    51b2:	e8 09 14 00 00       	call   65c0 <printf>
+      exit();
+    51b7:	e8 97 12 00 00       	call   6453 <exit>
+      printf(1, "short read bigfile\n");
+    51bc:	83 ec 08             	sub    $0x8,%esp
+    51bf:	68 ce 79 00 00       	push   $0x79ce
+    51c4:	6a 01                	push   $0x1
+    51c6:	e8 f5 13 00 00       	call   65c0 <printf>
+      exit();
+    51cb:	e8 83 12 00 00       	call   6453 <exit>
+      printf(1, "read bigfile failed\n");
+    51d0:	83 ec 08             	sub    $0x8,%esp
+    51d3:	68 b9 79 00 00       	push   $0x79b9
+    51d8:	6a 01                	push   $0x1
+    51da:	e8 e1 13 00 00       	call   65c0 <printf>
+      exit();
+    51df:	e8 6f 12 00 00       	call   6453 <exit>
+      printf(1, "write bigfile failed\n");
+    51e4:	83 ec 08             	sub    $0x8,%esp
+    51e7:	68 8e 79 00 00       	push   $0x798e
+    51ec:	6a 01                	push   $0x1
+    51ee:	e8 cd 13 00 00       	call   65c0 <printf>
+      exit();
+    51f3:	e8 5b 12 00 00       	call   6453 <exit>
+    printf(1, "cannot open bigfile\n");
+    51f8:	53                   	push   %ebx
+    51f9:	53                   	push   %ebx
+    51fa:	68 a4 79 00 00       	push   $0x79a4
+    51ff:	6a 01                	push   $0x1
+    5201:	e8 ba 13 00 00       	call   65c0 <printf>
+    exit();
+    5206:	e8 48 12 00 00       	call   6453 <exit>
+    printf(1, "cannot create bigfile");
+    520b:	50                   	push   %eax
+    520c:	50                   	push   %eax
+    520d:	68 78 79 00 00       	push   $0x7978
+    5212:	6a 01                	push   $0x1
+    5214:	e8 a7 13 00 00       	call   65c0 <printf>
+    exit();
+    5219:	e8 35 12 00 00       	call   6453 <exit>
+    printf(1, "read bigfile wrong total\n");
+    521e:	51                   	push   %ecx
+    521f:	51                   	push   %ecx
+    5220:	68 fb 79 00 00       	push   $0x79fb
+    5225:	6a 01                	push   $0x1
+    5227:	e8 94 13 00 00       	call   65c0 <printf>
+    exit();
+    522c:	e8 22 12 00 00       	call   6453 <exit>
+    5231:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    5238:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    523f:	90                   	nop
+
+00005240 <fourteen>:
+{
+    5240:	55                   	push   %ebp
+    5241:	89 e5                	mov    %esp,%ebp
+    5243:	83 ec 10             	sub    $0x10,%esp
+  printf(1, "fourteen test\n");
+    5246:	68 26 7a 00 00       	push   $0x7a26
+    524b:	6a 01                	push   $0x1
+    524d:	e8 6e 13 00 00       	call   65c0 <printf>
+  if(mkdir("12345678901234") != 0){
+    5252:	c7 04 24 61 7a 00 00 	movl   $0x7a61,(%esp)
+    5259:	e8 5d 12 00 00       	call   64bb <mkdir>
+    525e:	83 c4 10             	add    $0x10,%esp
+    5261:	85 c0                	test   %eax,%eax
+    5263:	0f 85 97 00 00 00    	jne    5300 <fourteen+0xc0>
+  if(mkdir("12345678901234/123456789012345") != 0){
+    5269:	83 ec 0c             	sub    $0xc,%esp
+    526c:	68 f4 8c 00 00       	push   $0x8cf4
+    5271:	e8 45 12 00 00       	call   64bb <mkdir>
+    5276:	83 c4 10             	add    $0x10,%esp
+    5279:	85 c0                	test   %eax,%eax
+    527b:	0f 85 de 00 00 00    	jne    535f <fourteen+0x11f>
+  fd = open("123456789012345/123456789012345/123456789012345", O_CREATE);
+    5281:	83 ec 08             	sub    $0x8,%esp
+    5284:	68 00 02 00 00       	push   $0x200
+    5289:	68 44 8d 00 00       	push   $0x8d44
+    528e:	e8 00 12 00 00       	call   6493 <open>
+  if(fd < 0){
+    5293:	83 c4 10             	add    $0x10,%esp
+    5296:	85 c0                	test   %eax,%eax
+    5298:	0f 88 ae 00 00 00    	js     534c <fourteen+0x10c>
+  close(fd);
+    529e:	83 ec 0c             	sub    $0xc,%esp
+    52a1:	50                   	push   %eax
+    52a2:	e8 d4 11 00 00       	call   647b <close>
+  fd = open("12345678901234/12345678901234/12345678901234", 0);
+    52a7:	58                   	pop    %eax
+    52a8:	5a                   	pop    %edx
+    52a9:	6a 00                	push   $0x0
+    52ab:	68 b4 8d 00 00       	push   $0x8db4
+    52b0:	e8 de 11 00 00       	call   6493 <open>
+  if(fd < 0){
+    52b5:	83 c4 10             	add    $0x10,%esp
+    52b8:	85 c0                	test   %eax,%eax
+    52ba:	78 7d                	js     5339 <fourteen+0xf9>
+  close(fd);
+    52bc:	83 ec 0c             	sub    $0xc,%esp
+    52bf:	50                   	push   %eax
+    52c0:	e8 b6 11 00 00       	call   647b <close>
+  if(mkdir("12345678901234/12345678901234") == 0){
+    52c5:	c7 04 24 52 7a 00 00 	movl   $0x7a52,(%esp)
+    52cc:	e8 ea 11 00 00       	call   64bb <mkdir>
+    52d1:	83 c4 10             	add    $0x10,%esp
+    52d4:	85 c0                	test   %eax,%eax
+    52d6:	74 4e                	je     5326 <fourteen+0xe6>
+  if(mkdir("123456789012345/12345678901234") == 0){
+    52d8:	83 ec 0c             	sub    $0xc,%esp
+    52db:	68 50 8e 00 00       	push   $0x8e50
+    52e0:	e8 d6 11 00 00       	call   64bb <mkdir>
+    52e5:	83 c4 10             	add    $0x10,%esp
+    52e8:	85 c0                	test   %eax,%eax
+    52ea:	74 27                	je     5313 <fourteen+0xd3>
+  printf(1, "fourteen ok\n");
+    52ec:	83 ec 08             	sub    $0x8,%esp
+    52ef:	68 70 7a 00 00       	push   $0x7a70
+    52f4:	6a 01                	push   $0x1
+    52f6:	e8 c5 12 00 00       	call   65c0 <printf>
+}
+    52fb:	83 c4 10             	add    $0x10,%esp
+    52fe:	c9                   	leave
+    52ff:	c3                   	ret
+    printf(1, "mkdir 12345678901234 failed\n");
+    5300:	50                   	push   %eax
+    5301:	50                   	push   %eax
+    5302:	68 35 7a 00 00       	push   $0x7a35
+    5307:	6a 01                	push   $0x1
+    5309:	e8 b2 12 00 00       	call   65c0 <printf>
+    exit();
+    530e:	e8 40 11 00 00       	call   6453 <exit>
+    printf(1, "mkdir 12345678901234/123456789012345 succeeded!\n");
+    5313:	50                   	push   %eax
+    5314:	50                   	push   %eax
+    5315:	68 70 8e 00 00       	push   $0x8e70
+    531a:	6a 01                	push   $0x1
+    531c:	e8 9f 12 00 00       	call   65c0 <printf>
+    exit();
+    5321:	e8 2d 11 00 00       	call   6453 <exit>
+    printf(1, "mkdir 12345678901234/12345678901234 succeeded!\n");
+    5326:	52                   	push   %edx
+    5327:	52                   	push   %edx
+    5328:	68 20 8e 00 00       	push   $0x8e20
+    532d:	6a 01                	push   $0x1
+    532f:	e8 8c 12 00 00       	call   65c0 <printf>
+    exit();
+    5334:	e8 1a 11 00 00       	call   6453 <exit>
+    printf(1, "open 12345678901234/12345678901234/12345678901234 failed\n");
+    5339:	51                   	push   %ecx
+    533a:	51                   	push   %ecx
+    533b:	68 e4 8d 00 00       	push   $0x8de4
+    5340:	6a 01                	push   $0x1
+    5342:	e8 79 12 00 00       	call   65c0 <printf>
+    exit();
+    5347:	e8 07 11 00 00       	call   6453 <exit>
+    printf(1, "create 123456789012345/123456789012345/123456789012345 failed\n");
+    534c:	51                   	push   %ecx
+    534d:	51                   	push   %ecx
+    534e:	68 74 8d 00 00       	push   $0x8d74
+    5353:	6a 01                	push   $0x1
+    5355:	e8 66 12 00 00       	call   65c0 <printf>
+    exit();
+    535a:	e8 f4 10 00 00       	call   6453 <exit>
+    printf(1, "mkdir 12345678901234/123456789012345 failed\n");
+    535f:	50                   	push   %eax
+    5360:	50                   	push   %eax
+    5361:	68 14 8d 00 00       	push   $0x8d14
+    5366:	6a 01                	push   $0x1
+    5368:	e8 53 12 00 00       	call   65c0 <printf>
+    exit();
+    536d:	e8 e1 10 00 00       	call   6453 <exit>
+    5372:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    5379:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00005380 <rmdot>:
+{
+    5380:	55                   	push   %ebp
+    5381:	89 e5                	mov    %esp,%ebp
+    5383:	83 ec 10             	sub    $0x10,%esp
+  printf(1, "rmdot test\n");
+    5386:	68 7d 7a 00 00       	push   $0x7a7d
+    538b:	6a 01                	push   $0x1
+    538d:	e8 2e 12 00 00       	call   65c0 <printf>
+  if(mkdir("dots") != 0){
+    5392:	c7 04 24 89 7a 00 00 	movl   $0x7a89,(%esp)
+    5399:	e8 1d 11 00 00       	call   64bb <mkdir>
+    539e:	83 c4 10             	add    $0x10,%esp
+    53a1:	85 c0                	test   %eax,%eax
+    53a3:	0f 85 b0 00 00 00    	jne    5459 <rmdot+0xd9>
+  if(chdir("dots") != 0){
+    53a9:	83 ec 0c             	sub    $0xc,%esp
+    53ac:	68 89 7a 00 00       	push   $0x7a89
+    53b1:	e8 0d 11 00 00       	call   64c3 <chdir>
+    53b6:	83 c4 10             	add    $0x10,%esp
+    53b9:	85 c0                	test   %eax,%eax
+    53bb:	0f 85 1d 01 00 00    	jne    54de <rmdot+0x15e>
+  if(unlink(".") == 0){
+    53c1:	83 ec 0c             	sub    $0xc,%esp
+    53c4:	68 34 77 00 00       	push   $0x7734
+    53c9:	e8 d5 10 00 00       	call   64a3 <unlink>
+    53ce:	83 c4 10             	add    $0x10,%esp
+    53d1:	85 c0                	test   %eax,%eax
+    53d3:	0f 84 f2 00 00 00    	je     54cb <rmdot+0x14b>
+  if(unlink("..") == 0){
+    53d9:	83 ec 0c             	sub    $0xc,%esp
+    53dc:	68 33 77 00 00       	push   $0x7733
+    53e1:	e8 bd 10 00 00       	call   64a3 <unlink>
+    53e6:	83 c4 10             	add    $0x10,%esp
+    53e9:	85 c0                	test   %eax,%eax
+    53eb:	0f 84 c7 00 00 00    	je     54b8 <rmdot+0x138>
+  if(chdir("/") != 0){
+    53f1:	83 ec 0c             	sub    $0xc,%esp
+    53f4:	68 31 69 00 00       	push   $0x6931
+    53f9:	e8 c5 10 00 00       	call   64c3 <chdir>
+    53fe:	83 c4 10             	add    $0x10,%esp
+    5401:	85 c0                	test   %eax,%eax
+    5403:	0f 85 9c 00 00 00    	jne    54a5 <rmdot+0x125>
+  if(unlink("dots/.") == 0){
+    5409:	83 ec 0c             	sub    $0xc,%esp
+    540c:	68 d1 7a 00 00       	push   $0x7ad1
+    5411:	e8 8d 10 00 00       	call   64a3 <unlink>
+    5416:	83 c4 10             	add    $0x10,%esp
+    5419:	85 c0                	test   %eax,%eax
+    541b:	74 75                	je     5492 <rmdot+0x112>
+  if(unlink("dots/..") == 0){
+    541d:	83 ec 0c             	sub    $0xc,%esp
+    5420:	68 ef 7a 00 00       	push   $0x7aef
+    5425:	e8 79 10 00 00       	call   64a3 <unlink>
+    542a:	83 c4 10             	add    $0x10,%esp
+    542d:	85 c0                	test   %eax,%eax
+    542f:	74 4e                	je     547f <rmdot+0xff>
+  if(unlink("dots") != 0){
+    5431:	83 ec 0c             	sub    $0xc,%esp
+    5434:	68 89 7a 00 00       	push   $0x7a89
+    5439:	e8 65 10 00 00       	call   64a3 <unlink>
+    543e:	83 c4 10             	add    $0x10,%esp
+    5441:	85 c0                	test   %eax,%eax
+    5443:	75 27                	jne    546c <rmdot+0xec>
+  printf(1, "rmdot ok\n");
+    5445:	83 ec 08             	sub    $0x8,%esp
+    5448:	68 24 7b 00 00       	push   $0x7b24
+    544d:	6a 01                	push   $0x1
+    544f:	e8 6c 11 00 00       	call   65c0 <printf>
+}
+    5454:	83 c4 10             	add    $0x10,%esp
+    5457:	c9                   	leave
+    5458:	c3                   	ret
+    printf(1, "mkdir dots failed\n");
+    5459:	50                   	push   %eax
+    545a:	50                   	push   %eax
+    545b:	68 8e 7a 00 00       	push   $0x7a8e
+    5460:	6a 01                	push   $0x1
+    5462:	e8 59 11 00 00       	call   65c0 <printf>
+    exit();
+    5467:	e8 e7 0f 00 00       	call   6453 <exit>
+    printf(1, "unlink dots failed!\n");
+    546c:	50                   	push   %eax
+    546d:	50                   	push   %eax
+    546e:	68 0f 7b 00 00       	push   $0x7b0f
+    5473:	6a 01                	push   $0x1
+    5475:	e8 46 11 00 00       	call   65c0 <printf>
+    exit();
+    547a:	e8 d4 0f 00 00       	call   6453 <exit>
+    printf(1, "unlink dots/.. worked!\n");
+    547f:	52                   	push   %edx
+    5480:	52                   	push   %edx
+    5481:	68 f7 7a 00 00       	push   $0x7af7
+    5486:	6a 01                	push   $0x1
+    5488:	e8 33 11 00 00       	call   65c0 <printf>
+    exit();
+    548d:	e8 c1 0f 00 00       	call   6453 <exit>
+    printf(1, "unlink dots/. worked!\n");
+    5492:	51                   	push   %ecx
+    5493:	51                   	push   %ecx
+    5494:	68 d8 7a 00 00       	push   $0x7ad8
+    5499:	6a 01                	push   $0x1
+    549b:	e8 20 11 00 00       	call   65c0 <printf>
+    exit();
+    54a0:	e8 ae 0f 00 00       	call   6453 <exit>
+    printf(1, "chdir / failed\n");
+    54a5:	50                   	push   %eax
+    54a6:	50                   	push   %eax
+    54a7:	68 33 69 00 00       	push   $0x6933
+    54ac:	6a 01                	push   $0x1
+    54ae:	e8 0d 11 00 00       	call   65c0 <printf>
+    exit();
+    54b3:	e8 9b 0f 00 00       	call   6453 <exit>
+    printf(1, "rm .. worked!\n");
+    54b8:	50                   	push   %eax
+    54b9:	50                   	push   %eax
+    54ba:	68 c2 7a 00 00       	push   $0x7ac2
+    54bf:	6a 01                	push   $0x1
+    54c1:	e8 fa 10 00 00       	call   65c0 <printf>
+    exit();
+    54c6:	e8 88 0f 00 00       	call   6453 <exit>
+    printf(1, "rm . worked!\n");
+    54cb:	50                   	push   %eax
+    54cc:	50                   	push   %eax
+    54cd:	68 b4 7a 00 00       	push   $0x7ab4
+    54d2:	6a 01                	push   $0x1
+    54d4:	e8 e7 10 00 00       	call   65c0 <printf>
+    exit();
+    54d9:	e8 75 0f 00 00       	call   6453 <exit>
+    printf(1, "chdir dots failed\n");
+    54de:	50                   	push   %eax
+    54df:	50                   	push   %eax
+    54e0:	68 a1 7a 00 00       	push   $0x7aa1
+    54e5:	6a 01                	push   $0x1
+    54e7:	e8 d4 10 00 00       	call   65c0 <printf>
+    exit();
+    54ec:	e8 62 0f 00 00       	call   6453 <exit>
+    54f1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    54f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    54ff:	90                   	nop
+
+00005500 <dirfile>:
+{
+    5500:	55                   	push   %ebp
+    5501:	89 e5                	mov    %esp,%ebp
+    5503:	53                   	push   %ebx
+    5504:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "dir vs file\n");
+    5507:	68 2e 7b 00 00       	push   $0x7b2e
+    550c:	6a 01                	push   $0x1
+    550e:	e8 ad 10 00 00       	call   65c0 <printf>
+  fd = open("dirfile", O_CREATE);
+    5513:	5b                   	pop    %ebx
+    5514:	58                   	pop    %eax
+    5515:	68 00 02 00 00       	push   $0x200
+    551a:	68 3b 7b 00 00       	push   $0x7b3b
+    551f:	e8 6f 0f 00 00       	call   6493 <open>
+  if(fd < 0){
+    5524:	83 c4 10             	add    $0x10,%esp
+    5527:	85 c0                	test   %eax,%eax
+    5529:	0f 88 43 01 00 00    	js     5672 <dirfile+0x172>
+  close(fd);
+    552f:	83 ec 0c             	sub    $0xc,%esp
+    5532:	50                   	push   %eax
+    5533:	e8 43 0f 00 00       	call   647b <close>
+  if(chdir("dirfile") == 0){
+    5538:	c7 04 24 3b 7b 00 00 	movl   $0x7b3b,(%esp)
+    553f:	e8 7f 0f 00 00       	call   64c3 <chdir>
+    5544:	83 c4 10             	add    $0x10,%esp
+    5547:	85 c0                	test   %eax,%eax
+    5549:	0f 84 10 01 00 00    	je     565f <dirfile+0x15f>
+  fd = open("dirfile/xx", 0);
+    554f:	83 ec 08             	sub    $0x8,%esp
+    5552:	6a 00                	push   $0x0
+    5554:	68 74 7b 00 00       	push   $0x7b74
+    5559:	e8 35 0f 00 00       	call   6493 <open>
+  if(fd >= 0){
+    555e:	83 c4 10             	add    $0x10,%esp
+    5561:	85 c0                	test   %eax,%eax
+    5563:	0f 89 e3 00 00 00    	jns    564c <dirfile+0x14c>
+  fd = open("dirfile/xx", O_CREATE);
+    5569:	83 ec 08             	sub    $0x8,%esp
+    556c:	68 00 02 00 00       	push   $0x200
+    5571:	68 74 7b 00 00       	push   $0x7b74
+    5576:	e8 18 0f 00 00       	call   6493 <open>
+  if(fd >= 0){
+    557b:	83 c4 10             	add    $0x10,%esp
+    557e:	85 c0                	test   %eax,%eax
+    5580:	0f 89 c6 00 00 00    	jns    564c <dirfile+0x14c>
+  if(mkdir("dirfile/xx") == 0){
+    5586:	83 ec 0c             	sub    $0xc,%esp
+    5589:	68 74 7b 00 00       	push   $0x7b74
+    558e:	e8 28 0f 00 00       	call   64bb <mkdir>
+    5593:	83 c4 10             	add    $0x10,%esp
+    5596:	85 c0                	test   %eax,%eax
+    5598:	0f 84 46 01 00 00    	je     56e4 <dirfile+0x1e4>
+  if(unlink("dirfile/xx") == 0){
+    559e:	83 ec 0c             	sub    $0xc,%esp
+    55a1:	68 74 7b 00 00       	push   $0x7b74
+    55a6:	e8 f8 0e 00 00       	call   64a3 <unlink>
+    55ab:	83 c4 10             	add    $0x10,%esp
+    55ae:	85 c0                	test   %eax,%eax
+    55b0:	0f 84 1b 01 00 00    	je     56d1 <dirfile+0x1d1>
+  if(link("README", "dirfile/xx") == 0){
+    55b6:	83 ec 08             	sub    $0x8,%esp
+    55b9:	68 74 7b 00 00       	push   $0x7b74
+    55be:	68 d8 7b 00 00       	push   $0x7bd8
+    55c3:	e8 eb 0e 00 00       	call   64b3 <link>
+    55c8:	83 c4 10             	add    $0x10,%esp
+    55cb:	85 c0                	test   %eax,%eax
+    55cd:	0f 84 eb 00 00 00    	je     56be <dirfile+0x1be>
+  if(unlink("dirfile") != 0){
+    55d3:	83 ec 0c             	sub    $0xc,%esp
+    55d6:	68 3b 7b 00 00       	push   $0x7b3b
+    55db:	e8 c3 0e 00 00       	call   64a3 <unlink>
+    55e0:	83 c4 10             	add    $0x10,%esp
+    55e3:	85 c0                	test   %eax,%eax
+    55e5:	0f 85 c0 00 00 00    	jne    56ab <dirfile+0x1ab>
+  fd = open(".", O_RDWR);
+    55eb:	83 ec 08             	sub    $0x8,%esp
+    55ee:	6a 02                	push   $0x2
+    55f0:	68 34 77 00 00       	push   $0x7734
+    55f5:	e8 99 0e 00 00       	call   6493 <open>
+  if(fd >= 0){
+    55fa:	83 c4 10             	add    $0x10,%esp
+    55fd:	85 c0                	test   %eax,%eax
+    55ff:	0f 89 93 00 00 00    	jns    5698 <dirfile+0x198>
+  fd = open(".", 0);
+    5605:	83 ec 08             	sub    $0x8,%esp
+    5608:	6a 00                	push   $0x0
+    560a:	68 34 77 00 00       	push   $0x7734
+    560f:	e8 7f 0e 00 00       	call   6493 <open>
+  if(write(fd, "x", 1) > 0){
+    5614:	83 c4 0c             	add    $0xc,%esp
+    5617:	6a 01                	push   $0x1
+  fd = open(".", 0);
+    5619:	89 c3                	mov    %eax,%ebx
+  if(write(fd, "x", 1) > 0){
+    561b:	68 17 78 00 00       	push   $0x7817
+    5620:	50                   	push   %eax
+    5621:	e8 4d 0e 00 00       	call   6473 <write>
+    5626:	83 c4 10             	add    $0x10,%esp
+    5629:	85 c0                	test   %eax,%eax
+    562b:	7f 58                	jg     5685 <dirfile+0x185>
+  close(fd);
+    562d:	83 ec 0c             	sub    $0xc,%esp
+    5630:	53                   	push   %ebx
+    5631:	e8 45 0e 00 00       	call   647b <close>
+  printf(1, "dir vs file OK\n");
+    5636:	58                   	pop    %eax
+    5637:	5a                   	pop    %edx
+    5638:	68 0b 7c 00 00       	push   $0x7c0b
+    563d:	6a 01                	push   $0x1
+    563f:	e8 7c 0f 00 00       	call   65c0 <printf>
+}
+    5644:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    5647:	83 c4 10             	add    $0x10,%esp
+    564a:	c9                   	leave
+    564b:	c3                   	ret
+    printf(1, "create dirfile/xx succeeded!\n");
+    564c:	50                   	push   %eax
+    564d:	50                   	push   %eax
+    564e:	68 7f 7b 00 00       	push   $0x7b7f
+    5653:	6a 01                	push   $0x1
+    5655:	e8 66 0f 00 00       	call   65c0 <printf>
+    exit();
+    565a:	e8 f4 0d 00 00       	call   6453 <exit>
+    printf(1, "chdir dirfile succeeded!\n");
+    565f:	52                   	push   %edx
+    5660:	52                   	push   %edx
+    5661:	68 5a 7b 00 00       	push   $0x7b5a
+    5666:	6a 01                	push   $0x1
+    5668:	e8 53 0f 00 00       	call   65c0 <printf>
+    exit();
+    566d:	e8 e1 0d 00 00       	call   6453 <exit>
+    printf(1, "create dirfile failed\n");
+    5672:	51                   	push   %ecx
+    5673:	51                   	push   %ecx
+    5674:	68 43 7b 00 00       	push   $0x7b43
+    5679:	6a 01                	push   $0x1
+    567b:	e8 40 0f 00 00       	call   65c0 <printf>
+    exit();
+    5680:	e8 ce 0d 00 00       	call   6453 <exit>
+    printf(1, "write . succeeded!\n");
+    5685:	51                   	push   %ecx
+    5686:	51                   	push   %ecx
+    5687:	68 f7 7b 00 00       	push   $0x7bf7
+    568c:	6a 01                	push   $0x1
+    568e:	e8 2d 0f 00 00       	call   65c0 <printf>
+    exit();
+    5693:	e8 bb 0d 00 00       	call   6453 <exit>
+    printf(1, "open . for writing succeeded!\n");
+    5698:	53                   	push   %ebx
+    5699:	53                   	push   %ebx
+    569a:	68 c4 8e 00 00       	push   $0x8ec4
+    569f:	6a 01                	push   $0x1
+    56a1:	e8 1a 0f 00 00       	call   65c0 <printf>
+    exit();
+    56a6:	e8 a8 0d 00 00       	call   6453 <exit>
+    printf(1, "unlink dirfile failed!\n");
+    56ab:	50                   	push   %eax
+    56ac:	50                   	push   %eax
+    56ad:	68 df 7b 00 00       	push   $0x7bdf
+    56b2:	6a 01                	push   $0x1
+    56b4:	e8 07 0f 00 00       	call   65c0 <printf>
+    exit();
+    56b9:	e8 95 0d 00 00       	call   6453 <exit>
+    printf(1, "link to dirfile/xx succeeded!\n");
+    56be:	50                   	push   %eax
+    56bf:	50                   	push   %eax
+    56c0:	68 a4 8e 00 00       	push   $0x8ea4
+    56c5:	6a 01                	push   $0x1
+    56c7:	e8 f4 0e 00 00       	call   65c0 <printf>
+    exit();
+    56cc:	e8 82 0d 00 00       	call   6453 <exit>
+    printf(1, "unlink dirfile/xx succeeded!\n");
+    56d1:	50                   	push   %eax
+    56d2:	50                   	push   %eax
+    56d3:	68 ba 7b 00 00       	push   $0x7bba
+    56d8:	6a 01                	push   $0x1
+    56da:	e8 e1 0e 00 00       	call   65c0 <printf>
+    exit();
+    56df:	e8 6f 0d 00 00       	call   6453 <exit>
+    printf(1, "mkdir dirfile/xx succeeded!\n");
+    56e4:	50                   	push   %eax
+    56e5:	50                   	push   %eax
+    56e6:	68 9d 7b 00 00       	push   $0x7b9d
+    56eb:	6a 01                	push   $0x1
+    56ed:	e8 ce 0e 00 00       	call   65c0 <printf>
+    exit();
+    56f2:	e8 5c 0d 00 00       	call   6453 <exit>
+    56f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    56fe:	66 90                	xchg   %ax,%ax
+
+00005700 <iref>:
+{
+    5700:	55                   	push   %ebp
+    5701:	89 e5                	mov    %esp,%ebp
+    5703:	53                   	push   %ebx
+  printf(1, "empty file name\n");
+    5704:	bb 33 00 00 00       	mov    $0x33,%ebx
+{
+    5709:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "empty file name\n");
+    570c:	68 1b 7c 00 00       	push   $0x7c1b
+    5711:	6a 01                	push   $0x1
+    5713:	e8 a8 0e 00 00       	call   65c0 <printf>
+    5718:	83 c4 10             	add    $0x10,%esp
+    571b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    571f:	90                   	nop
+    if(mkdir("irefd") != 0){
+    5720:	83 ec 0c             	sub    $0xc,%esp
+    5723:	68 2c 7c 00 00       	push   $0x7c2c
+    5728:	e8 8e 0d 00 00       	call   64bb <mkdir>
+    572d:	83 c4 10             	add    $0x10,%esp
+    5730:	85 c0                	test   %eax,%eax
+    5732:	0f 85 bb 00 00 00    	jne    57f3 <iref+0xf3>
+    if(chdir("irefd") != 0){
+    5738:	83 ec 0c             	sub    $0xc,%esp
+    573b:	68 2c 7c 00 00       	push   $0x7c2c
+    5740:	e8 7e 0d 00 00       	call   64c3 <chdir>
+    5745:	83 c4 10             	add    $0x10,%esp
+    5748:	85 c0                	test   %eax,%eax
+    574a:	0f 85 b7 00 00 00    	jne    5807 <iref+0x107>
+    mkdir("");
+    5750:	83 ec 0c             	sub    $0xc,%esp
+    5753:	68 06 6d 00 00       	push   $0x6d06
+    5758:	e8 5e 0d 00 00       	call   64bb <mkdir>
+    link("README", "");
+    575d:	59                   	pop    %ecx
+    575e:	58                   	pop    %eax
+    575f:	68 06 6d 00 00       	push   $0x6d06
+    5764:	68 d8 7b 00 00       	push   $0x7bd8
+    5769:	e8 45 0d 00 00       	call   64b3 <link>
+    fd = open("", O_CREATE);
+    576e:	58                   	pop    %eax
+    576f:	5a                   	pop    %edx
+    5770:	68 00 02 00 00       	push   $0x200
+    5775:	68 06 6d 00 00       	push   $0x6d06
+    577a:	e8 14 0d 00 00       	call   6493 <open>
+    if(fd >= 0)
+    577f:	83 c4 10             	add    $0x10,%esp
+    5782:	85 c0                	test   %eax,%eax
+    5784:	78 0c                	js     5792 <iref+0x92>
+      close(fd);
+    5786:	83 ec 0c             	sub    $0xc,%esp
+    5789:	50                   	push   %eax
+    578a:	e8 ec 0c 00 00       	call   647b <close>
+    578f:	83 c4 10             	add    $0x10,%esp
+    fd = open("xx", O_CREATE);
+    5792:	83 ec 08             	sub    $0x8,%esp
+    5795:	68 00 02 00 00       	push   $0x200
+    579a:	68 16 78 00 00       	push   $0x7816
+    579f:	e8 ef 0c 00 00       	call   6493 <open>
+    if(fd >= 0)
+    57a4:	83 c4 10             	add    $0x10,%esp
+    57a7:	85 c0                	test   %eax,%eax
+    57a9:	78 0c                	js     57b7 <iref+0xb7>
+      close(fd);
+    57ab:	83 ec 0c             	sub    $0xc,%esp
+    57ae:	50                   	push   %eax
+    57af:	e8 c7 0c 00 00       	call   647b <close>
+    57b4:	83 c4 10             	add    $0x10,%esp
+    unlink("xx");
+    57b7:	83 ec 0c             	sub    $0xc,%esp
+    57ba:	68 16 78 00 00       	push   $0x7816
+    57bf:	e8 df 0c 00 00       	call   64a3 <unlink>
+  for(i = 0; i < 50 + 1; i++){
+    57c4:	83 c4 10             	add    $0x10,%esp
+    57c7:	83 eb 01             	sub    $0x1,%ebx
+    57ca:	0f 85 50 ff ff ff    	jne    5720 <iref+0x20>
+  chdir("/");
+    57d0:	83 ec 0c             	sub    $0xc,%esp
+    57d3:	68 31 69 00 00       	push   $0x6931
+    57d8:	e8 e6 0c 00 00       	call   64c3 <chdir>
+  printf(1, "empty file name OK\n");
+    57dd:	58                   	pop    %eax
+    57de:	5a                   	pop    %edx
+    57df:	68 5a 7c 00 00       	push   $0x7c5a
+    57e4:	6a 01                	push   $0x1
+    57e6:	e8 d5 0d 00 00       	call   65c0 <printf>
+}
+    57eb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    57ee:	83 c4 10             	add    $0x10,%esp
+    57f1:	c9                   	leave
+    57f2:	c3                   	ret
+      printf(1, "mkdir irefd failed\n");
+    57f3:	83 ec 08             	sub    $0x8,%esp
+    57f6:	68 32 7c 00 00       	push   $0x7c32
+    57fb:	6a 01                	push   $0x1
+    57fd:	e8 be 0d 00 00       	call   65c0 <printf>
+      exit();
+    5802:	e8 4c 0c 00 00       	call   6453 <exit>
+      printf(1, "chdir irefd failed\n");
+    5807:	83 ec 08             	sub    $0x8,%esp
+    580a:	68 46 7c 00 00       	push   $0x7c46
+    580f:	6a 01                	push   $0x1
+    5811:	e8 aa 0d 00 00       	call   65c0 <printf>
+      exit();
+    5816:	e8 38 0c 00 00       	call   6453 <exit>
+    581b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    581f:	90                   	nop
+
+00005820 <forktest>:
+{
+    5820:	55                   	push   %ebp
+    5821:	89 e5                	mov    %esp,%ebp
+    5823:	53                   	push   %ebx
+  for(n=0; n<1000; n++){
+    5824:	31 db                	xor    %ebx,%ebx
+{
+    5826:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "fork test\n");
+    5829:	68 6e 7c 00 00       	push   $0x7c6e
+    582e:	6a 01                	push   $0x1
+    5830:	e8 8b 0d 00 00       	call   65c0 <printf>
+    5835:	83 c4 10             	add    $0x10,%esp
+    5838:	eb 13                	jmp    584d <forktest+0x2d>
+    583a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(pid == 0)
+    5840:	74 4d                	je     588f <forktest+0x6f>
+  for(n=0; n<1000; n++){
+    5842:	83 c3 01             	add    $0x1,%ebx
+    5845:	81 fb e8 03 00 00    	cmp    $0x3e8,%ebx
+    584b:	74 6e                	je     58bb <forktest+0x9b>
+    pid = fork();
+    584d:	e8 f9 0b 00 00       	call   644b <fork>
+    if(pid < 0)
+    5852:	85 c0                	test   %eax,%eax
+    5854:	79 ea                	jns    5840 <forktest+0x20>
+  for(; n > 0; n--){
+    5856:	85 db                	test   %ebx,%ebx
+    5858:	74 14                	je     586e <forktest+0x4e>
+    585a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(wait() < 0){
+    5860:	e8 f6 0b 00 00       	call   645b <wait>
+    5865:	85 c0                	test   %eax,%eax
+    5867:	78 2b                	js     5894 <forktest+0x74>
+  for(; n > 0; n--){
+    5869:	83 eb 01             	sub    $0x1,%ebx
+    586c:	75 f2                	jne    5860 <forktest+0x40>
+  if(wait() != -1){
+    586e:	e8 e8 0b 00 00       	call   645b <wait>
+    5873:	83 f8 ff             	cmp    $0xffffffff,%eax
+    5876:	75 30                	jne    58a8 <forktest+0x88>
+  printf(1, "fork test OK\n");
+    5878:	83 ec 08             	sub    $0x8,%esp
+    587b:	68 a0 7c 00 00       	push   $0x7ca0
+    5880:	6a 01                	push   $0x1
+    5882:	e8 39 0d 00 00       	call   65c0 <printf>
+}
+    5887:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    588a:	83 c4 10             	add    $0x10,%esp
+    588d:	c9                   	leave
+    588e:	c3                   	ret
+      exit();
+    588f:	e8 bf 0b 00 00       	call   6453 <exit>
+      printf(1, "wait stopped early\n");
+    5894:	83 ec 08             	sub    $0x8,%esp
+    5897:	68 79 7c 00 00       	push   $0x7c79
+    589c:	6a 01                	push   $0x1
+    589e:	e8 1d 0d 00 00       	call   65c0 <printf>
+      exit();
+    58a3:	e8 ab 0b 00 00       	call   6453 <exit>
+    printf(1, "wait got too many\n");
+    58a8:	50                   	push   %eax
+    58a9:	50                   	push   %eax
+    58aa:	68 8d 7c 00 00       	push   $0x7c8d
+    58af:	6a 01                	push   $0x1
+    58b1:	e8 0a 0d 00 00       	call   65c0 <printf>
+    exit();
+    58b6:	e8 98 0b 00 00       	call   6453 <exit>
+    printf(1, "fork claimed to work 1000 times!\n");
+    58bb:	52                   	push   %edx
+    58bc:	52                   	push   %edx
+    58bd:	68 e4 8e 00 00       	push   $0x8ee4
+    58c2:	6a 01                	push   $0x1
+    58c4:	e8 f7 0c 00 00       	call   65c0 <printf>
+    exit();
+    58c9:	e8 85 0b 00 00       	call   6453 <exit>
+    58ce:	66 90                	xchg   %ax,%ax
+
+000058d0 <sbrktest>:
+{
+    58d0:	55                   	push   %ebp
+    58d1:	89 e5                	mov    %esp,%ebp
+    58d3:	57                   	push   %edi
+    58d4:	56                   	push   %esi
+  for(i = 0; i < 5000; i++){
+    58d5:	31 f6                	xor    %esi,%esi
+{
+    58d7:	53                   	push   %ebx
+    58d8:	83 ec 64             	sub    $0x64,%esp
+  printf(stdout, "sbrk test\n");
+    58db:	68 ae 7c 00 00       	push   $0x7cae
+    58e0:	ff 35 d4 9e 00 00    	push   0x9ed4
+    58e6:	e8 d5 0c 00 00       	call   65c0 <printf>
+  oldbrk = sbrk(0);
+    58eb:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    58f2:	e8 e4 0b 00 00       	call   64db <sbrk>
+    58f7:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+  a = sbrk(0);
+    58fa:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    5901:	e8 d5 0b 00 00       	call   64db <sbrk>
+    5906:	83 c4 10             	add    $0x10,%esp
+    5909:	89 c3                	mov    %eax,%ebx
+  for(i = 0; i < 5000; i++){
+    590b:	eb 05                	jmp    5912 <sbrktest+0x42>
+    590d:	8d 76 00             	lea    0x0(%esi),%esi
+    a = b + 1;
+    5910:	89 c3                	mov    %eax,%ebx
+    b = sbrk(1);
+    5912:	83 ec 0c             	sub    $0xc,%esp
+    5915:	6a 01                	push   $0x1
+    5917:	e8 bf 0b 00 00       	call   64db <sbrk>
+    if(b != a){
+    591c:	83 c4 10             	add    $0x10,%esp
+    591f:	39 d8                	cmp    %ebx,%eax
+    5921:	0f 85 9c 02 00 00    	jne    5bc3 <sbrktest+0x2f3>
+  for(i = 0; i < 5000; i++){
+    5927:	83 c6 01             	add    $0x1,%esi
+    *b = 1;
+    592a:	c6 03 01             	movb   $0x1,(%ebx)
+    a = b + 1;
+    592d:	8d 43 01             	lea    0x1(%ebx),%eax
+  for(i = 0; i < 5000; i++){
+    5930:	81 fe 88 13 00 00    	cmp    $0x1388,%esi
+    5936:	75 d8                	jne    5910 <sbrktest+0x40>
+  pid = fork();
+    5938:	e8 0e 0b 00 00       	call   644b <fork>
+    593d:	89 c6                	mov    %eax,%esi
+  if(pid < 0){
+    593f:	85 c0                	test   %eax,%eax
+    5941:	0f 88 02 03 00 00    	js     5c49 <sbrktest+0x379>
+  c = sbrk(1);
+    5947:	83 ec 0c             	sub    $0xc,%esp
+  if(c != a + 1){
+    594a:	83 c3 02             	add    $0x2,%ebx
+  c = sbrk(1);
+    594d:	6a 01                	push   $0x1
+    594f:	e8 87 0b 00 00       	call   64db <sbrk>
+  c = sbrk(1);
+    5954:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    595b:	e8 7b 0b 00 00       	call   64db <sbrk>
+  if(c != a + 1){
+    5960:	83 c4 10             	add    $0x10,%esp
+    5963:	39 c3                	cmp    %eax,%ebx
+    5965:	0f 85 3b 03 00 00    	jne    5ca6 <sbrktest+0x3d6>
+  if(pid == 0)
+    596b:	85 f6                	test   %esi,%esi
+    596d:	0f 84 2e 03 00 00    	je     5ca1 <sbrktest+0x3d1>
+  wait();
+    5973:	e8 e3 0a 00 00       	call   645b <wait>
+  a = sbrk(0);
+    5978:	83 ec 0c             	sub    $0xc,%esp
+    597b:	6a 00                	push   $0x0
+    597d:	e8 59 0b 00 00       	call   64db <sbrk>
+    5982:	89 c3                	mov    %eax,%ebx
+  amt = (BIG) - (uint)a;
+    5984:	b8 00 00 40 06       	mov    $0x6400000,%eax
+    5989:	29 d8                	sub    %ebx,%eax
+  p = sbrk(amt);
+    598b:	89 04 24             	mov    %eax,(%esp)
+    598e:	e8 48 0b 00 00       	call   64db <sbrk>
+  if (p != a) {
+    5993:	83 c4 10             	add    $0x10,%esp
+    5996:	39 c3                	cmp    %eax,%ebx
+    5998:	0f 85 94 02 00 00    	jne    5c32 <sbrktest+0x362>
+  a = sbrk(0);
+    599e:	83 ec 0c             	sub    $0xc,%esp
+  *lastaddr = 99;
+    59a1:	c6 05 ff ff 3f 06 63 	movb   $0x63,0x63fffff
+  a = sbrk(0);
+    59a8:	6a 00                	push   $0x0
+    59aa:	e8 2c 0b 00 00       	call   64db <sbrk>
+  c = sbrk(-4096);
+    59af:	c7 04 24 00 f0 ff ff 	movl   $0xfffff000,(%esp)
+  a = sbrk(0);
+    59b6:	89 c3                	mov    %eax,%ebx
+  c = sbrk(-4096);
+    59b8:	e8 1e 0b 00 00       	call   64db <sbrk>
+  if(c == (char*)0xffffffff){
+    59bd:	83 c4 10             	add    $0x10,%esp
+    59c0:	83 f8 ff             	cmp    $0xffffffff,%eax
+    59c3:	0f 84 22 03 00 00    	je     5ceb <sbrktest+0x41b>
+  c = sbrk(0);
+    59c9:	83 ec 0c             	sub    $0xc,%esp
+    59cc:	6a 00                	push   $0x0
+    59ce:	e8 08 0b 00 00       	call   64db <sbrk>
+  if(c != a - 4096){
+    59d3:	8d 93 00 f0 ff ff    	lea    -0x1000(%ebx),%edx
+    59d9:	83 c4 10             	add    $0x10,%esp
+    59dc:	39 d0                	cmp    %edx,%eax
+    59de:	0f 85 f0 02 00 00    	jne    5cd4 <sbrktest+0x404>
+  a = sbrk(0);
+    59e4:	83 ec 0c             	sub    $0xc,%esp
+    59e7:	6a 00                	push   $0x0
+    59e9:	e8 ed 0a 00 00       	call   64db <sbrk>
+  c = sbrk(4096);
+    59ee:	c7 04 24 00 10 00 00 	movl   $0x1000,(%esp)
+  a = sbrk(0);
+    59f5:	89 c3                	mov    %eax,%ebx
+  c = sbrk(4096);
+    59f7:	e8 df 0a 00 00       	call   64db <sbrk>
+  if(c != a || sbrk(0) != a + 4096){
+    59fc:	83 c4 10             	add    $0x10,%esp
+  c = sbrk(4096);
+    59ff:	89 c6                	mov    %eax,%esi
+  if(c != a || sbrk(0) != a + 4096){
+    5a01:	39 c3                	cmp    %eax,%ebx
+    5a03:	0f 85 b4 02 00 00    	jne    5cbd <sbrktest+0x3ed>
+    5a09:	83 ec 0c             	sub    $0xc,%esp
+    5a0c:	6a 00                	push   $0x0
+    5a0e:	e8 c8 0a 00 00       	call   64db <sbrk>
+    5a13:	8d 93 00 10 00 00    	lea    0x1000(%ebx),%edx
+    5a19:	83 c4 10             	add    $0x10,%esp
+    5a1c:	39 c2                	cmp    %eax,%edx
+    5a1e:	0f 85 99 02 00 00    	jne    5cbd <sbrktest+0x3ed>
+  if(*lastaddr == 99){
+    5a24:	80 3d ff ff 3f 06 63 	cmpb   $0x63,0x63fffff
+    5a2b:	0f 84 2f 02 00 00    	je     5c60 <sbrktest+0x390>
+  a = sbrk(0);
+    5a31:	83 ec 0c             	sub    $0xc,%esp
+    5a34:	6a 00                	push   $0x0
+    5a36:	e8 a0 0a 00 00       	call   64db <sbrk>
+  c = sbrk(-(sbrk(0) - oldbrk));
+    5a3b:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  a = sbrk(0);
+    5a42:	89 c3                	mov    %eax,%ebx
+  c = sbrk(-(sbrk(0) - oldbrk));
+    5a44:	e8 92 0a 00 00       	call   64db <sbrk>
+    5a49:	89 c2                	mov    %eax,%edx
+    5a4b:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+    5a4e:	29 d0                	sub    %edx,%eax
+    5a50:	89 04 24             	mov    %eax,(%esp)
+    5a53:	e8 83 0a 00 00       	call   64db <sbrk>
+  if(c != a){
+    5a58:	83 c4 10             	add    $0x10,%esp
+    5a5b:	39 c3                	cmp    %eax,%ebx
+    5a5d:	0f 85 b8 01 00 00    	jne    5c1b <sbrktest+0x34b>
+  for(a = (char*)(KERNBASE); a < (char*) (KERNBASE+2000000); a += 50000){
+    5a63:	bb 00 00 00 80       	mov    $0x80000000,%ebx
+    5a68:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    5a6f:	90                   	nop
+    ppid = getpid();
+    5a70:	e8 5e 0a 00 00       	call   64d3 <getpid>
+    5a75:	89 c6                	mov    %eax,%esi
+    pid = fork();
+    5a77:	e8 cf 09 00 00       	call   644b <fork>
+    if(pid < 0){
+    5a7c:	85 c0                	test   %eax,%eax
+    5a7e:	0f 88 5d 01 00 00    	js     5be1 <sbrktest+0x311>
+    if(pid == 0){
+    5a84:	0f 84 6f 01 00 00    	je     5bf9 <sbrktest+0x329>
+    wait();
+    5a8a:	e8 cc 09 00 00       	call   645b <wait>
+  for(a = (char*)(KERNBASE); a < (char*) (KERNBASE+2000000); a += 50000){
+    5a8f:	81 c3 50 c3 00 00    	add    $0xc350,%ebx
+    5a95:	81 fb 80 84 1e 80    	cmp    $0x801e8480,%ebx
+    5a9b:	75 d3                	jne    5a70 <sbrktest+0x1a0>
+  if(pipe(fds) != 0){
+    5a9d:	83 ec 0c             	sub    $0xc,%esp
+    5aa0:	8d 45 b8             	lea    -0x48(%ebp),%eax
+    5aa3:	50                   	push   %eax
+    5aa4:	e8 ba 09 00 00       	call   6463 <pipe>
+    5aa9:	83 c4 10             	add    $0x10,%esp
+    5aac:	85 c0                	test   %eax,%eax
+    5aae:	0f 85 da 01 00 00    	jne    5c8e <sbrktest+0x3be>
+    5ab4:	8d 5d c0             	lea    -0x40(%ebp),%ebx
+    5ab7:	8d 75 e8             	lea    -0x18(%ebp),%esi
+    5aba:	89 df                	mov    %ebx,%edi
+    5abc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if((pids[i] = fork()) == 0){
+    5ac0:	e8 86 09 00 00       	call   644b <fork>
+    5ac5:	89 07                	mov    %eax,(%edi)
+    5ac7:	85 c0                	test   %eax,%eax
+    5ac9:	0f 84 91 00 00 00    	je     5b60 <sbrktest+0x290>
+    if(pids[i] != -1)
+    5acf:	83 f8 ff             	cmp    $0xffffffff,%eax
+    5ad2:	74 14                	je     5ae8 <sbrktest+0x218>
+      read(fds[0], &scratch, 1);
+    5ad4:	83 ec 04             	sub    $0x4,%esp
+    5ad7:	8d 45 b7             	lea    -0x49(%ebp),%eax
+    5ada:	6a 01                	push   $0x1
+    5adc:	50                   	push   %eax
+    5add:	ff 75 b8             	push   -0x48(%ebp)
+    5ae0:	e8 86 09 00 00       	call   646b <read>
+    5ae5:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    5ae8:	83 c7 04             	add    $0x4,%edi
+    5aeb:	39 f7                	cmp    %esi,%edi
+    5aed:	75 d1                	jne    5ac0 <sbrktest+0x1f0>
+  c = sbrk(4096);
+    5aef:	83 ec 0c             	sub    $0xc,%esp
+    5af2:	68 00 10 00 00       	push   $0x1000
+    5af7:	e8 df 09 00 00       	call   64db <sbrk>
+    5afc:	83 c4 10             	add    $0x10,%esp
+    5aff:	89 c7                	mov    %eax,%edi
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    5b01:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(pids[i] == -1)
+    5b08:	8b 03                	mov    (%ebx),%eax
+    5b0a:	83 f8 ff             	cmp    $0xffffffff,%eax
+    5b0d:	74 11                	je     5b20 <sbrktest+0x250>
+    kill(pids[i]);
+    5b0f:	83 ec 0c             	sub    $0xc,%esp
+    5b12:	50                   	push   %eax
+    5b13:	e8 6b 09 00 00       	call   6483 <kill>
+    wait();
+    5b18:	e8 3e 09 00 00       	call   645b <wait>
+    5b1d:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    5b20:	83 c3 04             	add    $0x4,%ebx
+    5b23:	39 f3                	cmp    %esi,%ebx
+    5b25:	75 e1                	jne    5b08 <sbrktest+0x238>
+  if(c == (char*)0xffffffff){
+    5b27:	83 ff ff             	cmp    $0xffffffff,%edi
+    5b2a:	0f 84 47 01 00 00    	je     5c77 <sbrktest+0x3a7>
+  if(sbrk(0) > oldbrk)
+    5b30:	83 ec 0c             	sub    $0xc,%esp
+    5b33:	6a 00                	push   $0x0
+    5b35:	e8 a1 09 00 00       	call   64db <sbrk>
+    5b3a:	83 c4 10             	add    $0x10,%esp
+    5b3d:	39 45 a4             	cmp    %eax,-0x5c(%ebp)
+    5b40:	72 60                	jb     5ba2 <sbrktest+0x2d2>
+  printf(stdout, "sbrk test OK\n");
+    5b42:	83 ec 08             	sub    $0x8,%esp
+    5b45:	68 56 7d 00 00       	push   $0x7d56
+    5b4a:	ff 35 d4 9e 00 00    	push   0x9ed4
+    5b50:	e8 6b 0a 00 00       	call   65c0 <printf>
+}
+    5b55:	83 c4 10             	add    $0x10,%esp
+    5b58:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    5b5b:	5b                   	pop    %ebx
+    5b5c:	5e                   	pop    %esi
+    5b5d:	5f                   	pop    %edi
+    5b5e:	5d                   	pop    %ebp
+    5b5f:	c3                   	ret
+      sbrk(BIG - (uint)sbrk(0));
+    5b60:	83 ec 0c             	sub    $0xc,%esp
+    5b63:	6a 00                	push   $0x0
+    5b65:	e8 71 09 00 00       	call   64db <sbrk>
+    5b6a:	89 c2                	mov    %eax,%edx
+    5b6c:	b8 00 00 40 06       	mov    $0x6400000,%eax
+    5b71:	29 d0                	sub    %edx,%eax
+    5b73:	89 04 24             	mov    %eax,(%esp)
+    5b76:	e8 60 09 00 00       	call   64db <sbrk>
+      write(fds[1], "x", 1);
+    5b7b:	83 c4 0c             	add    $0xc,%esp
+    5b7e:	6a 01                	push   $0x1
+    5b80:	68 17 78 00 00       	push   $0x7817
+    5b85:	ff 75 bc             	push   -0x44(%ebp)
+    5b88:	e8 e6 08 00 00       	call   6473 <write>
+    5b8d:	83 c4 10             	add    $0x10,%esp
+      for(;;) sleep(1000);
+    5b90:	83 ec 0c             	sub    $0xc,%esp
+    5b93:	68 e8 03 00 00       	push   $0x3e8
+    5b98:	e8 46 09 00 00       	call   64e3 <sleep>
+    5b9d:	83 c4 10             	add    $0x10,%esp
+    5ba0:	eb ee                	jmp    5b90 <sbrktest+0x2c0>
+    sbrk(-(sbrk(0) - oldbrk));
+    5ba2:	83 ec 0c             	sub    $0xc,%esp
+    5ba5:	6a 00                	push   $0x0
+    5ba7:	e8 2f 09 00 00       	call   64db <sbrk>
+    5bac:	89 c2                	mov    %eax,%edx
+    5bae:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+    5bb1:	29 d0                	sub    %edx,%eax
+    5bb3:	89 04 24             	mov    %eax,(%esp)
+    5bb6:	e8 20 09 00 00       	call   64db <sbrk>
+    5bbb:	83 c4 10             	add    $0x10,%esp
+    5bbe:	e9 7f ff ff ff       	jmp    5b42 <sbrktest+0x272>
+      printf(stdout, "sbrk test failed %d %x %x\n", i, a, b);
+    5bc3:	83 ec 0c             	sub    $0xc,%esp
+    5bc6:	50                   	push   %eax
+    5bc7:	53                   	push   %ebx
+    5bc8:	56                   	push   %esi
+    5bc9:	68 b9 7c 00 00       	push   $0x7cb9
+    5bce:	ff 35 d4 9e 00 00    	push   0x9ed4
+    5bd4:	e8 e7 09 00 00       	call   65c0 <printf>
+      exit();
+    5bd9:	83 c4 20             	add    $0x20,%esp
+    5bdc:	e8 72 08 00 00       	call   6453 <exit>
+      printf(stdout, "fork failed\n");
+    5be1:	83 ec 08             	sub    $0x8,%esp
+    5be4:	68 f4 7d 00 00       	push   $0x7df4
+    5be9:	ff 35 d4 9e 00 00    	push   0x9ed4
+    5bef:	e8 cc 09 00 00       	call   65c0 <printf>
+      exit();
+    5bf4:	e8 5a 08 00 00       	call   6453 <exit>
+      printf(stdout, "oops could read %x = %x\n", a, *a);
+    5bf9:	0f be 03             	movsbl (%ebx),%eax
+    5bfc:	50                   	push   %eax
+    5bfd:	53                   	push   %ebx
+    5bfe:	68 22 7d 00 00       	push   $0x7d22
+    5c03:	ff 35 d4 9e 00 00    	push   0x9ed4
+    5c09:	e8 b2 09 00 00       	call   65c0 <printf>
+      kill(ppid);
+    5c0e:	89 34 24             	mov    %esi,(%esp)
+    5c11:	e8 6d 08 00 00       	call   6483 <kill>
+      exit();
+    5c16:	e8 38 08 00 00       	call   6453 <exit>
+    printf(stdout, "sbrk downsize failed, a %x c %x\n", a, c);
+    5c1b:	50                   	push   %eax
+    5c1c:	53                   	push   %ebx
+    5c1d:	68 d8 8f 00 00       	push   $0x8fd8
+    5c22:	ff 35 d4 9e 00 00    	push   0x9ed4
+    5c28:	e8 93 09 00 00       	call   65c0 <printf>
+    exit();
+    5c2d:	e8 21 08 00 00       	call   6453 <exit>
+    printf(stdout, "sbrk test failed to grow big address space; enough phys mem?\n");
+    5c32:	56                   	push   %esi
+    5c33:	56                   	push   %esi
+    5c34:	68 08 8f 00 00       	push   $0x8f08
+    5c39:	ff 35 d4 9e 00 00    	push   0x9ed4
+    5c3f:	e8 7c 09 00 00       	call   65c0 <printf>
+    exit();
+    5c44:	e8 0a 08 00 00       	call   6453 <exit>
+    printf(stdout, "sbrk test fork failed\n");
+    5c49:	50                   	push   %eax
+    5c4a:	50                   	push   %eax
+    5c4b:	68 d4 7c 00 00       	push   $0x7cd4
+    5c50:	ff 35 d4 9e 00 00    	push   0x9ed4
+    5c56:	e8 65 09 00 00       	call   65c0 <printf>
+    exit();
+    5c5b:	e8 f3 07 00 00       	call   6453 <exit>
+    printf(stdout, "sbrk de-allocation didn't really deallocate\n");
+    5c60:	51                   	push   %ecx
+    5c61:	51                   	push   %ecx
+    5c62:	68 a8 8f 00 00       	push   $0x8fa8
+    5c67:	ff 35 d4 9e 00 00    	push   0x9ed4
+    5c6d:	e8 4e 09 00 00       	call   65c0 <printf>
+    exit();
+    5c72:	e8 dc 07 00 00       	call   6453 <exit>
+    printf(stdout, "failed sbrk leaked memory\n");
+    5c77:	50                   	push   %eax
+    5c78:	50                   	push   %eax
+    5c79:	68 3b 7d 00 00       	push   $0x7d3b
+    5c7e:	ff 35 d4 9e 00 00    	push   0x9ed4
+    5c84:	e8 37 09 00 00       	call   65c0 <printf>
+    exit();
+    5c89:	e8 c5 07 00 00       	call   6453 <exit>
+    printf(1, "pipe() failed\n");
+    5c8e:	52                   	push   %edx
+    5c8f:	52                   	push   %edx
+    5c90:	68 1c 6c 00 00       	push   $0x6c1c
+    5c95:	6a 01                	push   $0x1
+    5c97:	e8 24 09 00 00       	call   65c0 <printf>
+    exit();
+    5c9c:	e8 b2 07 00 00       	call   6453 <exit>
+    exit();
+    5ca1:	e8 ad 07 00 00       	call   6453 <exit>
+    printf(stdout, "sbrk test failed post-fork\n");
+    5ca6:	57                   	push   %edi
+    5ca7:	57                   	push   %edi
+    5ca8:	68 eb 7c 00 00       	push   $0x7ceb
+    5cad:	ff 35 d4 9e 00 00    	push   0x9ed4
+    5cb3:	e8 08 09 00 00       	call   65c0 <printf>
+    exit();
+    5cb8:	e8 96 07 00 00       	call   6453 <exit>
+    printf(stdout, "sbrk re-allocation failed, a %x c %x\n", a, c);
+    5cbd:	56                   	push   %esi
+    5cbe:	53                   	push   %ebx
+    5cbf:	68 80 8f 00 00       	push   $0x8f80
+    5cc4:	ff 35 d4 9e 00 00    	push   0x9ed4
+    5cca:	e8 f1 08 00 00       	call   65c0 <printf>
+    exit();
+    5ccf:	e8 7f 07 00 00       	call   6453 <exit>
+    printf(stdout, "sbrk deallocation produced wrong address, a %x c %x\n", a, c);
+    5cd4:	50                   	push   %eax
+    5cd5:	53                   	push   %ebx
+    5cd6:	68 48 8f 00 00       	push   $0x8f48
+    5cdb:	ff 35 d4 9e 00 00    	push   0x9ed4
+    5ce1:	e8 da 08 00 00       	call   65c0 <printf>
+    exit();
+    5ce6:	e8 68 07 00 00       	call   6453 <exit>
+    printf(stdout, "sbrk could not deallocate\n");
+    5ceb:	53                   	push   %ebx
+    5cec:	53                   	push   %ebx
+    5ced:	68 07 7d 00 00       	push   $0x7d07
+    5cf2:	ff 35 d4 9e 00 00    	push   0x9ed4
+    5cf8:	e8 c3 08 00 00       	call   65c0 <printf>
+    exit();
+    5cfd:	e8 51 07 00 00       	call   6453 <exit>
+    5d02:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    5d09:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00005d10 <validateint>:
+}
+    5d10:	c3                   	ret
+    5d11:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    5d18:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    5d1f:	90                   	nop
+
+00005d20 <validatetest>:
+{
+    5d20:	55                   	push   %ebp
+    5d21:	89 e5                	mov    %esp,%ebp
+    5d23:	56                   	push   %esi
+  for(p = 0; p <= (uint)hi; p += 4096){
+    5d24:	31 f6                	xor    %esi,%esi
+{
+    5d26:	53                   	push   %ebx
+  printf(stdout, "validate test\n");
+    5d27:	83 ec 08             	sub    $0x8,%esp
+    5d2a:	68 64 7d 00 00       	push   $0x7d64
+    5d2f:	ff 35 d4 9e 00 00    	push   0x9ed4
+    5d35:	e8 86 08 00 00       	call   65c0 <printf>
+    5d3a:	83 c4 10             	add    $0x10,%esp
+    5d3d:	8d 76 00             	lea    0x0(%esi),%esi
+    if((pid = fork()) == 0){
+    5d40:	e8 06 07 00 00       	call   644b <fork>
+    5d45:	89 c3                	mov    %eax,%ebx
+    5d47:	85 c0                	test   %eax,%eax
+    5d49:	74 63                	je     5dae <validatetest+0x8e>
+    sleep(0);
+    5d4b:	83 ec 0c             	sub    $0xc,%esp
+    5d4e:	6a 00                	push   $0x0
+    5d50:	e8 8e 07 00 00       	call   64e3 <sleep>
+    sleep(0);
+    5d55:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    5d5c:	e8 82 07 00 00       	call   64e3 <sleep>
+    kill(pid);
+    5d61:	89 1c 24             	mov    %ebx,(%esp)
+    5d64:	e8 1a 07 00 00       	call   6483 <kill>
+    wait();
+    5d69:	e8 ed 06 00 00       	call   645b <wait>
+    if(link("nosuchfile", (char*)p) != -1){
+    5d6e:	58                   	pop    %eax
+    5d6f:	5a                   	pop    %edx
+    5d70:	56                   	push   %esi
+    5d71:	68 dd 71 00 00       	push   $0x71dd
+    5d76:	e8 38 07 00 00       	call   64b3 <link>
+    5d7b:	83 c4 10             	add    $0x10,%esp
+    5d7e:	83 f8 ff             	cmp    $0xffffffff,%eax
+    5d81:	75 30                	jne    5db3 <validatetest+0x93>
+  for(p = 0; p <= (uint)hi; p += 4096){
+    5d83:	81 c6 00 10 00 00    	add    $0x1000,%esi
+    5d89:	81 fe 00 40 11 00    	cmp    $0x114000,%esi
+    5d8f:	75 af                	jne    5d40 <validatetest+0x20>
+  printf(stdout, "validate ok\n");
+    5d91:	83 ec 08             	sub    $0x8,%esp
+    5d94:	68 8c 7d 00 00       	push   $0x7d8c
+    5d99:	ff 35 d4 9e 00 00    	push   0x9ed4
+    5d9f:	e8 1c 08 00 00       	call   65c0 <printf>
+}
+    5da4:	83 c4 10             	add    $0x10,%esp
+    5da7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    5daa:	5b                   	pop    %ebx
+    5dab:	5e                   	pop    %esi
+    5dac:	5d                   	pop    %ebp
+    5dad:	c3                   	ret
+      exit();
+    5dae:	e8 a0 06 00 00       	call   6453 <exit>
+      printf(stdout, "link should not succeed\n");
+    5db3:	83 ec 08             	sub    $0x8,%esp
+    5db6:	68 73 7d 00 00       	push   $0x7d73
+    5dbb:	ff 35 d4 9e 00 00    	push   0x9ed4
+    5dc1:	e8 fa 07 00 00       	call   65c0 <printf>
+      exit();
+    5dc6:	e8 88 06 00 00       	call   6453 <exit>
+    5dcb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    5dcf:	90                   	nop
+
+00005dd0 <bsstest>:
+{
+    5dd0:	55                   	push   %ebp
+    5dd1:	89 e5                	mov    %esp,%ebp
+    5dd3:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "bss test\n");
+    5dd6:	68 99 7d 00 00       	push   $0x7d99
+    5ddb:	ff 35 d4 9e 00 00    	push   0x9ed4
+    5de1:	e8 da 07 00 00       	call   65c0 <printf>
+    5de6:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < sizeof(uninit); i++){
+    5de9:	31 c0                	xor    %eax,%eax
+    5deb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    5def:	90                   	nop
+    if(uninit[i] != '\0'){
+    5df0:	80 b8 00 9f 00 00 00 	cmpb   $0x0,0x9f00(%eax)
+    5df7:	75 22                	jne    5e1b <bsstest+0x4b>
+  for(i = 0; i < sizeof(uninit); i++){
+    5df9:	83 c0 01             	add    $0x1,%eax
+    5dfc:	3d 10 27 00 00       	cmp    $0x2710,%eax
+    5e01:	75 ed                	jne    5df0 <bsstest+0x20>
+  printf(stdout, "bss test ok\n");
+    5e03:	83 ec 08             	sub    $0x8,%esp
+    5e06:	68 b4 7d 00 00       	push   $0x7db4
+    5e0b:	ff 35 d4 9e 00 00    	push   0x9ed4
+    5e11:	e8 aa 07 00 00       	call   65c0 <printf>
+}
+    5e16:	83 c4 10             	add    $0x10,%esp
+    5e19:	c9                   	leave
+    5e1a:	c3                   	ret
+      printf(stdout, "bss test failed\n");
+    5e1b:	83 ec 08             	sub    $0x8,%esp
+    5e1e:	68 a3 7d 00 00       	push   $0x7da3
+    5e23:	ff 35 d4 9e 00 00    	push   0x9ed4
+    5e29:	e8 92 07 00 00       	call   65c0 <printf>
+      exit();
+    5e2e:	e8 20 06 00 00       	call   6453 <exit>
+    5e33:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    5e3a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00005e40 <bigargtest>:
+{
+    5e40:	55                   	push   %ebp
+    5e41:	89 e5                	mov    %esp,%ebp
+    5e43:	83 ec 14             	sub    $0x14,%esp
+  unlink("bigarg-ok");
+    5e46:	68 c1 7d 00 00       	push   $0x7dc1
+    5e4b:	e8 53 06 00 00       	call   64a3 <unlink>
+  pid = fork();
+    5e50:	e8 f6 05 00 00       	call   644b <fork>
+  if(pid == 0){
+    5e55:	83 c4 10             	add    $0x10,%esp
+    5e58:	85 c0                	test   %eax,%eax
+    5e5a:	74 44                	je     5ea0 <bigargtest+0x60>
+  } else if(pid < 0){
+    5e5c:	0f 88 c3 00 00 00    	js     5f25 <bigargtest+0xe5>
+  wait();
+    5e62:	e8 f4 05 00 00       	call   645b <wait>
+  fd = open("bigarg-ok", 0);
+    5e67:	83 ec 08             	sub    $0x8,%esp
+    5e6a:	6a 00                	push   $0x0
+    5e6c:	68 c1 7d 00 00       	push   $0x7dc1
+    5e71:	e8 1d 06 00 00       	call   6493 <open>
+  if(fd < 0){
+    5e76:	83 c4 10             	add    $0x10,%esp
+    5e79:	85 c0                	test   %eax,%eax
+    5e7b:	0f 88 8d 00 00 00    	js     5f0e <bigargtest+0xce>
+  close(fd);
+    5e81:	83 ec 0c             	sub    $0xc,%esp
+    5e84:	50                   	push   %eax
+    5e85:	e8 f1 05 00 00       	call   647b <close>
+  unlink("bigarg-ok");
+    5e8a:	c7 04 24 c1 7d 00 00 	movl   $0x7dc1,(%esp)
+    5e91:	e8 0d 06 00 00       	call   64a3 <unlink>
+}
+    5e96:	83 c4 10             	add    $0x10,%esp
+    5e99:	c9                   	leave
+    5e9a:	c3                   	ret
+    5e9b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    5e9f:	90                   	nop
+      args[i] = "bigargs test: failed\n                                                                                                                                                                                                       ";
+    5ea0:	c7 04 85 20 e6 00 00 	movl   $0x8ffc,0xe620(,%eax,4)
+    5ea7:	fc 8f 00 00 
+    for(i = 0; i < MAXARG-1; i++)
+    5eab:	83 c0 01             	add    $0x1,%eax
+    5eae:	83 f8 1f             	cmp    $0x1f,%eax
+    5eb1:	75 ed                	jne    5ea0 <bigargtest+0x60>
+    args[MAXARG-1] = 0;
+    5eb3:	31 c9                	xor    %ecx,%ecx
+    5eb5:	89 0d 9c e6 00 00    	mov    %ecx,0xe69c
+    printf(stdout, "bigarg test\n");
+    5ebb:	50                   	push   %eax
+    5ebc:	50                   	push   %eax
+    5ebd:	68 cb 7d 00 00       	push   $0x7dcb
+    5ec2:	ff 35 d4 9e 00 00    	push   0x9ed4
+    5ec8:	e8 f3 06 00 00       	call   65c0 <printf>
+    exec("echo", args);
+    5ecd:	58                   	pop    %eax
+    5ece:	5a                   	pop    %edx
+    5ecf:	68 20 e6 00 00       	push   $0xe620
+    5ed4:	68 55 72 00 00       	push   $0x7255
+    5ed9:	e8 ad 05 00 00       	call   648b <exec>
+    printf(stdout, "bigarg test ok\n");
+    5ede:	59                   	pop    %ecx
+    5edf:	58                   	pop    %eax
+    5ee0:	68 d8 7d 00 00       	push   $0x7dd8
+    5ee5:	ff 35 d4 9e 00 00    	push   0x9ed4
+    5eeb:	e8 d0 06 00 00       	call   65c0 <printf>
+    fd = open("bigarg-ok", O_CREATE);
+    5ef0:	58                   	pop    %eax
+    5ef1:	5a                   	pop    %edx
+    5ef2:	68 00 02 00 00       	push   $0x200
+    5ef7:	68 c1 7d 00 00       	push   $0x7dc1
+    5efc:	e8 92 05 00 00       	call   6493 <open>
+    close(fd);
+    5f01:	89 04 24             	mov    %eax,(%esp)
+    5f04:	e8 72 05 00 00       	call   647b <close>
+    exit();
+    5f09:	e8 45 05 00 00       	call   6453 <exit>
+    printf(stdout, "bigarg test failed!\n");
+    5f0e:	50                   	push   %eax
+    5f0f:	50                   	push   %eax
+    5f10:	68 01 7e 00 00       	push   $0x7e01
+    5f15:	ff 35 d4 9e 00 00    	push   0x9ed4
+    5f1b:	e8 a0 06 00 00       	call   65c0 <printf>
+    exit();
+    5f20:	e8 2e 05 00 00       	call   6453 <exit>
+    printf(stdout, "bigargtest: fork failed\n");
+    5f25:	52                   	push   %edx
+    5f26:	52                   	push   %edx
+    5f27:	68 e8 7d 00 00       	push   $0x7de8
+    5f2c:	ff 35 d4 9e 00 00    	push   0x9ed4
+    5f32:	e8 89 06 00 00       	call   65c0 <printf>
+    exit();
+    5f37:	e8 17 05 00 00       	call   6453 <exit>
+    5f3c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00005f40 <fsfull>:
+{
+    5f40:	55                   	push   %ebp
+    5f41:	89 e5                	mov    %esp,%ebp
+    5f43:	57                   	push   %edi
+    5f44:	56                   	push   %esi
+  for(nfiles = 0; ; nfiles++){
+    5f45:	31 f6                	xor    %esi,%esi
+{
+    5f47:	53                   	push   %ebx
+    5f48:	83 ec 54             	sub    $0x54,%esp
+  printf(1, "fsfull test\n");
+    5f4b:	68 16 7e 00 00       	push   $0x7e16
+    5f50:	6a 01                	push   $0x1
+    5f52:	e8 69 06 00 00       	call   65c0 <printf>
+    5f57:	83 c4 10             	add    $0x10,%esp
+    5f5a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    name[1] = '0' + nfiles / 1000;
+    5f60:	b8 d3 4d 62 10       	mov    $0x10624dd3,%eax
+    name[3] = '0' + (nfiles % 100) / 10;
+    5f65:	b9 cd cc cc cc       	mov    $0xcccccccd,%ecx
+    printf(1, "writing %s\n", name);
+    5f6a:	83 ec 04             	sub    $0x4,%esp
+    name[0] = 'f';
+    5f6d:	c6 45 a8 66          	movb   $0x66,-0x58(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    5f71:	f7 e6                	mul    %esi
+    name[5] = '\0';
+    5f73:	c6 45 ad 00          	movb   $0x0,-0x53(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    5f77:	c1 ea 06             	shr    $0x6,%edx
+    5f7a:	8d 42 30             	lea    0x30(%edx),%eax
+    5f7d:	88 45 a9             	mov    %al,-0x57(%ebp)
+    name[2] = '0' + (nfiles % 1000) / 100;
+    5f80:	69 c2 e8 03 00 00    	imul   $0x3e8,%edx,%eax
+    5f86:	89 f2                	mov    %esi,%edx
+    5f88:	29 c2                	sub    %eax,%edx
+    5f8a:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+    5f8f:	f7 e2                	mul    %edx
+    name[3] = '0' + (nfiles % 100) / 10;
+    5f91:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+    name[2] = '0' + (nfiles % 1000) / 100;
+    5f96:	c1 ea 05             	shr    $0x5,%edx
+    5f99:	83 c2 30             	add    $0x30,%edx
+    5f9c:	88 55 aa             	mov    %dl,-0x56(%ebp)
+    name[3] = '0' + (nfiles % 100) / 10;
+    5f9f:	f7 e6                	mul    %esi
+    5fa1:	c1 ea 05             	shr    $0x5,%edx
+    5fa4:	6b c2 64             	imul   $0x64,%edx,%eax
+    5fa7:	89 f2                	mov    %esi,%edx
+    5fa9:	29 c2                	sub    %eax,%edx
+    5fab:	89 d0                	mov    %edx,%eax
+    5fad:	f7 e1                	mul    %ecx
+    name[4] = '0' + (nfiles % 10);
+    5faf:	89 f0                	mov    %esi,%eax
+    name[3] = '0' + (nfiles % 100) / 10;
+    5fb1:	c1 ea 03             	shr    $0x3,%edx
+    5fb4:	83 c2 30             	add    $0x30,%edx
+    5fb7:	88 55 ab             	mov    %dl,-0x55(%ebp)
+    name[4] = '0' + (nfiles % 10);
+    5fba:	f7 e1                	mul    %ecx
+    5fbc:	89 f0                	mov    %esi,%eax
+    5fbe:	c1 ea 03             	shr    $0x3,%edx
+    5fc1:	8d 14 92             	lea    (%edx,%edx,4),%edx
+    5fc4:	01 d2                	add    %edx,%edx
+    5fc6:	29 d0                	sub    %edx,%eax
+    5fc8:	83 c0 30             	add    $0x30,%eax
+    5fcb:	88 45 ac             	mov    %al,-0x54(%ebp)
+    printf(1, "writing %s\n", name);
+    5fce:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    5fd1:	50                   	push   %eax
+    5fd2:	68 23 7e 00 00       	push   $0x7e23
+    5fd7:	6a 01                	push   $0x1
+    5fd9:	e8 e2 05 00 00       	call   65c0 <printf>
+    int fd = open(name, O_CREATE|O_RDWR);
+    5fde:	58                   	pop    %eax
+    5fdf:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    5fe2:	5a                   	pop    %edx
+    5fe3:	68 02 02 00 00       	push   $0x202
+    5fe8:	50                   	push   %eax
+    5fe9:	e8 a5 04 00 00       	call   6493 <open>
+    if(fd < 0){
+    5fee:	83 c4 10             	add    $0x10,%esp
+    int fd = open(name, O_CREATE|O_RDWR);
+    5ff1:	89 c7                	mov    %eax,%edi
+    if(fd < 0){
+    5ff3:	85 c0                	test   %eax,%eax
+    5ff5:	78 4f                	js     6046 <fsfull+0x106>
+    int total = 0;
+    5ff7:	31 db                	xor    %ebx,%ebx
+    5ff9:	eb 07                	jmp    6002 <fsfull+0xc2>
+    5ffb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    5fff:	90                   	nop
+      total += cc;
+    6000:	01 c3                	add    %eax,%ebx
+      int cc = write(fd, buf, 512);
+    6002:	83 ec 04             	sub    $0x4,%esp
+    6005:	68 00 02 00 00       	push   $0x200
+    600a:	68 20 c6 00 00       	push   $0xc620
+    600f:	57                   	push   %edi
+    6010:	e8 5e 04 00 00       	call   6473 <write>
+      if(cc < 512)
+    6015:	83 c4 10             	add    $0x10,%esp
+    6018:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+    601d:	7f e1                	jg     6000 <fsfull+0xc0>
+    printf(1, "wrote %d bytes\n", total);
+    601f:	83 ec 04             	sub    $0x4,%esp
+    6022:	53                   	push   %ebx
+    6023:	68 3f 7e 00 00       	push   $0x7e3f
+    6028:	6a 01                	push   $0x1
+    602a:	e8 91 05 00 00       	call   65c0 <printf>
+    close(fd);
+    602f:	89 3c 24             	mov    %edi,(%esp)
+    6032:	e8 44 04 00 00       	call   647b <close>
+    if(total == 0)
+    6037:	83 c4 10             	add    $0x10,%esp
+    603a:	85 db                	test   %ebx,%ebx
+    603c:	74 1e                	je     605c <fsfull+0x11c>
+  for(nfiles = 0; ; nfiles++){
+    603e:	83 c6 01             	add    $0x1,%esi
+    6041:	e9 1a ff ff ff       	jmp    5f60 <fsfull+0x20>
+      printf(1, "open %s failed\n", name);
+    6046:	83 ec 04             	sub    $0x4,%esp
+    6049:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    604c:	50                   	push   %eax
+    604d:	68 2f 7e 00 00       	push   $0x7e2f
+    6052:	6a 01                	push   $0x1
+    6054:	e8 67 05 00 00       	call   65c0 <printf>
+      break;
+    6059:	83 c4 10             	add    $0x10,%esp
+    name[1] = '0' + nfiles / 1000;
+    605c:	bf d3 4d 62 10       	mov    $0x10624dd3,%edi
+    name[2] = '0' + (nfiles % 1000) / 100;
+    6061:	bb 1f 85 eb 51       	mov    $0x51eb851f,%ebx
+    6066:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    606d:	8d 76 00             	lea    0x0(%esi),%esi
+    name[1] = '0' + nfiles / 1000;
+    6070:	89 f0                	mov    %esi,%eax
+    unlink(name);
+    6072:	83 ec 0c             	sub    $0xc,%esp
+    name[0] = 'f';
+    6075:	c6 45 a8 66          	movb   $0x66,-0x58(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    6079:	f7 e7                	mul    %edi
+    name[5] = '\0';
+    607b:	c6 45 ad 00          	movb   $0x0,-0x53(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    607f:	c1 ea 06             	shr    $0x6,%edx
+    6082:	8d 42 30             	lea    0x30(%edx),%eax
+    6085:	88 45 a9             	mov    %al,-0x57(%ebp)
+    name[2] = '0' + (nfiles % 1000) / 100;
+    6088:	69 c2 e8 03 00 00    	imul   $0x3e8,%edx,%eax
+    608e:	89 f2                	mov    %esi,%edx
+    6090:	29 c2                	sub    %eax,%edx
+    6092:	89 d0                	mov    %edx,%eax
+    6094:	f7 e3                	mul    %ebx
+    name[3] = '0' + (nfiles % 100) / 10;
+    6096:	89 f0                	mov    %esi,%eax
+    name[2] = '0' + (nfiles % 1000) / 100;
+    6098:	c1 ea 05             	shr    $0x5,%edx
+    609b:	83 c2 30             	add    $0x30,%edx
+    609e:	88 55 aa             	mov    %dl,-0x56(%ebp)
+    name[3] = '0' + (nfiles % 100) / 10;
+    60a1:	f7 e3                	mul    %ebx
+    60a3:	c1 ea 05             	shr    $0x5,%edx
+    60a6:	6b ca 64             	imul   $0x64,%edx,%ecx
+    60a9:	89 f2                	mov    %esi,%edx
+    60ab:	29 ca                	sub    %ecx,%edx
+    60ad:	b9 cd cc cc cc       	mov    $0xcccccccd,%ecx
+    60b2:	89 d0                	mov    %edx,%eax
+    60b4:	f7 e1                	mul    %ecx
+    name[4] = '0' + (nfiles % 10);
+    60b6:	89 f0                	mov    %esi,%eax
+    name[3] = '0' + (nfiles % 100) / 10;
+    60b8:	c1 ea 03             	shr    $0x3,%edx
+    60bb:	83 c2 30             	add    $0x30,%edx
+    60be:	88 55 ab             	mov    %dl,-0x55(%ebp)
+    name[4] = '0' + (nfiles % 10);
+    60c1:	f7 e1                	mul    %ecx
+    60c3:	89 f0                	mov    %esi,%eax
+    nfiles--;
+    60c5:	83 ee 01             	sub    $0x1,%esi
+    name[4] = '0' + (nfiles % 10);
+    60c8:	c1 ea 03             	shr    $0x3,%edx
+    60cb:	8d 14 92             	lea    (%edx,%edx,4),%edx
+    60ce:	01 d2                	add    %edx,%edx
+    60d0:	29 d0                	sub    %edx,%eax
+    60d2:	83 c0 30             	add    $0x30,%eax
+    60d5:	88 45 ac             	mov    %al,-0x54(%ebp)
+    unlink(name);
+    60d8:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    60db:	50                   	push   %eax
+    60dc:	e8 c2 03 00 00       	call   64a3 <unlink>
+  while(nfiles >= 0){
+    60e1:	83 c4 10             	add    $0x10,%esp
+    60e4:	83 fe ff             	cmp    $0xffffffff,%esi
+    60e7:	75 87                	jne    6070 <fsfull+0x130>
+  printf(1, "fsfull test finished\n");
+    60e9:	83 ec 08             	sub    $0x8,%esp
+    60ec:	68 4f 7e 00 00       	push   $0x7e4f
+    60f1:	6a 01                	push   $0x1
+    60f3:	e8 c8 04 00 00       	call   65c0 <printf>
+}
+    60f8:	83 c4 10             	add    $0x10,%esp
+    60fb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    60fe:	5b                   	pop    %ebx
+    60ff:	5e                   	pop    %esi
+    6100:	5f                   	pop    %edi
+    6101:	5d                   	pop    %ebp
+    6102:	c3                   	ret
+    6103:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    610a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00006110 <uio>:
+{
+    6110:	55                   	push   %ebp
+    6111:	89 e5                	mov    %esp,%ebp
+    6113:	83 ec 10             	sub    $0x10,%esp
+  printf(1, "uio test\n");
+    6116:	68 65 7e 00 00       	push   $0x7e65
+    611b:	6a 01                	push   $0x1
+    611d:	e8 9e 04 00 00       	call   65c0 <printf>
+  pid = fork();
+    6122:	e8 24 03 00 00       	call   644b <fork>
+  if(pid == 0){
+    6127:	83 c4 10             	add    $0x10,%esp
+    612a:	85 c0                	test   %eax,%eax
+    612c:	74 1b                	je     6149 <uio+0x39>
+  } else if(pid < 0){
+    612e:	78 3d                	js     616d <uio+0x5d>
+  wait();
+    6130:	e8 26 03 00 00       	call   645b <wait>
+  printf(1, "uio test done\n");
+    6135:	83 ec 08             	sub    $0x8,%esp
+    6138:	68 6f 7e 00 00       	push   $0x7e6f
+    613d:	6a 01                	push   $0x1
+    613f:	e8 7c 04 00 00       	call   65c0 <printf>
+}
+    6144:	83 c4 10             	add    $0x10,%esp
+    6147:	c9                   	leave
+    6148:	c3                   	ret
+    asm volatile("outb %0,%1"::"a"(val), "d" (port));
+    6149:	b8 09 00 00 00       	mov    $0x9,%eax
+    614e:	ba 70 00 00 00       	mov    $0x70,%edx
+    6153:	ee                   	out    %al,(%dx)
+    asm volatile("inb %1,%0" : "=a" (val) : "d" (port));
+    6154:	ba 71 00 00 00       	mov    $0x71,%edx
+    6159:	ec                   	in     (%dx),%al
+    printf(1, "uio: uio succeeded; test FAILED\n");
+    615a:	52                   	push   %edx
+    615b:	52                   	push   %edx
+    615c:	68 dc 90 00 00       	push   $0x90dc
+    6161:	6a 01                	push   $0x1
+    6163:	e8 58 04 00 00       	call   65c0 <printf>
+    exit();
+    6168:	e8 e6 02 00 00       	call   6453 <exit>
+    printf (1, "fork failed\n");
+    616d:	50                   	push   %eax
+    616e:	50                   	push   %eax
+    616f:	68 f4 7d 00 00       	push   $0x7df4
+    6174:	6a 01                	push   $0x1
+    6176:	e8 45 04 00 00       	call   65c0 <printf>
+    exit();
+    617b:	e8 d3 02 00 00       	call   6453 <exit>
+
+00006180 <argptest>:
+{
+    6180:	55                   	push   %ebp
+    6181:	89 e5                	mov    %esp,%ebp
+    6183:	53                   	push   %ebx
+    6184:	83 ec 0c             	sub    $0xc,%esp
+  fd = open("init", O_RDONLY);
+    6187:	6a 00                	push   $0x0
+    6189:	68 7e 7e 00 00       	push   $0x7e7e
+    618e:	e8 00 03 00 00       	call   6493 <open>
+  if (fd < 0) {
+    6193:	83 c4 10             	add    $0x10,%esp
+    6196:	85 c0                	test   %eax,%eax
+    6198:	78 39                	js     61d3 <argptest+0x53>
+  read(fd, sbrk(0) - 1, -1);
+    619a:	83 ec 0c             	sub    $0xc,%esp
+    619d:	89 c3                	mov    %eax,%ebx
+    619f:	6a 00                	push   $0x0
+    61a1:	e8 35 03 00 00       	call   64db <sbrk>
+    61a6:	83 c4 0c             	add    $0xc,%esp
+    61a9:	83 e8 01             	sub    $0x1,%eax
+    61ac:	6a ff                	push   $0xffffffff
+    61ae:	50                   	push   %eax
+    61af:	53                   	push   %ebx
+    61b0:	e8 b6 02 00 00       	call   646b <read>
+  close(fd);
+    61b5:	89 1c 24             	mov    %ebx,(%esp)
+    61b8:	e8 be 02 00 00       	call   647b <close>
+  printf(1, "arg test passed\n");
+    61bd:	58                   	pop    %eax
+    61be:	5a                   	pop    %edx
+    61bf:	68 90 7e 00 00       	push   $0x7e90
+    61c4:	6a 01                	push   $0x1
+    61c6:	e8 f5 03 00 00       	call   65c0 <printf>
+}
+    61cb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    61ce:	83 c4 10             	add    $0x10,%esp
+    61d1:	c9                   	leave
+    61d2:	c3                   	ret
+    printf(2, "open failed\n");
+    61d3:	51                   	push   %ecx
+    61d4:	51                   	push   %ecx
+    61d5:	68 83 7e 00 00       	push   $0x7e83
+    61da:	6a 02                	push   $0x2
+    61dc:	e8 df 03 00 00       	call   65c0 <printf>
+    exit();
+    61e1:	e8 6d 02 00 00       	call   6453 <exit>
+    61e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    61ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+000061f0 <rand>:
+  randstate = randstate * 1664525 + 1013904223;
+    61f0:	69 05 d0 9e 00 00 0d 	imul   $0x19660d,0x9ed0,%eax
+    61f7:	66 19 00 
+    61fa:	05 5f f3 6e 3c       	add    $0x3c6ef35f,%eax
+    61ff:	a3 d0 9e 00 00       	mov    %eax,0x9ed0
+}
+    6204:	c3                   	ret
+    6205:	66 90                	xchg   %ax,%ax
+    6207:	66 90                	xchg   %ax,%ax
+    6209:	66 90                	xchg   %ax,%ax
+    620b:	66 90                	xchg   %ax,%ax
+    620d:	66 90                	xchg   %ax,%ax
+    620f:	90                   	nop
+
+00006210 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+    6210:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+    6211:	31 c0                	xor    %eax,%eax
+{
+    6213:	89 e5                	mov    %esp,%ebp
+    6215:	53                   	push   %ebx
+    6216:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    6219:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+    621c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+    6220:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+    6224:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+    6227:	83 c0 01             	add    $0x1,%eax
+    622a:	84 d2                	test   %dl,%dl
+    622c:	75 f2                	jne    6220 <strcpy+0x10>
+    ;
+  return os;
+}
+    622e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    6231:	89 c8                	mov    %ecx,%eax
+    6233:	c9                   	leave
+    6234:	c3                   	ret
+    6235:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    623c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00006240 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+    6240:	55                   	push   %ebp
+    6241:	89 e5                	mov    %esp,%ebp
+    6243:	53                   	push   %ebx
+    6244:	8b 55 08             	mov    0x8(%ebp),%edx
+    6247:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+    624a:	0f b6 02             	movzbl (%edx),%eax
+    624d:	84 c0                	test   %al,%al
+    624f:	75 17                	jne    6268 <strcmp+0x28>
+    6251:	eb 3a                	jmp    628d <strcmp+0x4d>
+    6253:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    6257:	90                   	nop
+    6258:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+    625c:	83 c2 01             	add    $0x1,%edx
+    625f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+    6262:	84 c0                	test   %al,%al
+    6264:	74 1a                	je     6280 <strcmp+0x40>
+    p++, q++;
+    6266:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+    6268:	0f b6 19             	movzbl (%ecx),%ebx
+    626b:	38 c3                	cmp    %al,%bl
+    626d:	74 e9                	je     6258 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+    626f:	29 d8                	sub    %ebx,%eax
+}
+    6271:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    6274:	c9                   	leave
+    6275:	c3                   	ret
+    6276:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    627d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+    6280:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+    6284:	31 c0                	xor    %eax,%eax
+    6286:	29 d8                	sub    %ebx,%eax
+}
+    6288:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    628b:	c9                   	leave
+    628c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+    628d:	0f b6 19             	movzbl (%ecx),%ebx
+    6290:	31 c0                	xor    %eax,%eax
+    6292:	eb db                	jmp    626f <strcmp+0x2f>
+    6294:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    629b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    629f:	90                   	nop
+
+000062a0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+    62a0:	55                   	push   %ebp
+    62a1:	89 e5                	mov    %esp,%ebp
+    62a3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+    62a6:	80 3a 00             	cmpb   $0x0,(%edx)
+    62a9:	74 15                	je     62c0 <strlen+0x20>
+    62ab:	31 c0                	xor    %eax,%eax
+    62ad:	8d 76 00             	lea    0x0(%esi),%esi
+    62b0:	83 c0 01             	add    $0x1,%eax
+    62b3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+    62b7:	89 c1                	mov    %eax,%ecx
+    62b9:	75 f5                	jne    62b0 <strlen+0x10>
+    ;
+  return n;
+}
+    62bb:	89 c8                	mov    %ecx,%eax
+    62bd:	5d                   	pop    %ebp
+    62be:	c3                   	ret
+    62bf:	90                   	nop
+  for(n = 0; s[n]; n++)
+    62c0:	31 c9                	xor    %ecx,%ecx
+}
+    62c2:	5d                   	pop    %ebp
+    62c3:	89 c8                	mov    %ecx,%eax
+    62c5:	c3                   	ret
+    62c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    62cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000062d0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+    62d0:	55                   	push   %ebp
+    62d1:	89 e5                	mov    %esp,%ebp
+    62d3:	57                   	push   %edi
+    62d4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+    62d7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    62da:	8b 45 0c             	mov    0xc(%ebp),%eax
+    62dd:	89 d7                	mov    %edx,%edi
+    62df:	fc                   	cld
+    62e0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+    62e2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+    62e5:	89 d0                	mov    %edx,%eax
+    62e7:	c9                   	leave
+    62e8:	c3                   	ret
+    62e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000062f0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+    62f0:	55                   	push   %ebp
+    62f1:	89 e5                	mov    %esp,%ebp
+    62f3:	8b 45 08             	mov    0x8(%ebp),%eax
+    62f6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+    62fa:	0f b6 10             	movzbl (%eax),%edx
+    62fd:	84 d2                	test   %dl,%dl
+    62ff:	75 12                	jne    6313 <strchr+0x23>
+    6301:	eb 1d                	jmp    6320 <strchr+0x30>
+    6303:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    6307:	90                   	nop
+    6308:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+    630c:	83 c0 01             	add    $0x1,%eax
+    630f:	84 d2                	test   %dl,%dl
+    6311:	74 0d                	je     6320 <strchr+0x30>
+    if(*s == c)
+    6313:	38 d1                	cmp    %dl,%cl
+    6315:	75 f1                	jne    6308 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+    6317:	5d                   	pop    %ebp
+    6318:	c3                   	ret
+    6319:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+    6320:	31 c0                	xor    %eax,%eax
+}
+    6322:	5d                   	pop    %ebp
+    6323:	c3                   	ret
+    6324:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    632b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    632f:	90                   	nop
+
+00006330 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+    6330:	55                   	push   %ebp
+    6331:	89 e5                	mov    %esp,%ebp
+    6333:	57                   	push   %edi
+    6334:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+    6335:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+    6338:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+    6339:	31 db                	xor    %ebx,%ebx
+{
+    633b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+    633e:	eb 27                	jmp    6367 <gets+0x37>
+    cc = read(0, &c, 1);
+    6340:	83 ec 04             	sub    $0x4,%esp
+    6343:	6a 01                	push   $0x1
+    6345:	56                   	push   %esi
+    6346:	6a 00                	push   $0x0
+    6348:	e8 1e 01 00 00       	call   646b <read>
+    if(cc < 1)
+    634d:	83 c4 10             	add    $0x10,%esp
+    6350:	85 c0                	test   %eax,%eax
+    6352:	7e 1d                	jle    6371 <gets+0x41>
+      break;
+    buf[i++] = c;
+    6354:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+    6358:	8b 55 08             	mov    0x8(%ebp),%edx
+    635b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+    635f:	3c 0a                	cmp    $0xa,%al
+    6361:	74 10                	je     6373 <gets+0x43>
+    6363:	3c 0d                	cmp    $0xd,%al
+    6365:	74 0c                	je     6373 <gets+0x43>
+  for(i=0; i+1 < max; ){
+    6367:	89 df                	mov    %ebx,%edi
+    6369:	83 c3 01             	add    $0x1,%ebx
+    636c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+    636f:	7c cf                	jl     6340 <gets+0x10>
+    6371:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+    6373:	8b 45 08             	mov    0x8(%ebp),%eax
+    6376:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+    637a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    637d:	5b                   	pop    %ebx
+    637e:	5e                   	pop    %esi
+    637f:	5f                   	pop    %edi
+    6380:	5d                   	pop    %ebp
+    6381:	c3                   	ret
+    6382:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    6389:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00006390 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+    6390:	55                   	push   %ebp
+    6391:	89 e5                	mov    %esp,%ebp
+    6393:	56                   	push   %esi
+    6394:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+    6395:	83 ec 08             	sub    $0x8,%esp
+    6398:	6a 00                	push   $0x0
+    639a:	ff 75 08             	push   0x8(%ebp)
+    639d:	e8 f1 00 00 00       	call   6493 <open>
+  if(fd < 0)
+    63a2:	83 c4 10             	add    $0x10,%esp
+    63a5:	85 c0                	test   %eax,%eax
+    63a7:	78 27                	js     63d0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+    63a9:	83 ec 08             	sub    $0x8,%esp
+    63ac:	ff 75 0c             	push   0xc(%ebp)
+    63af:	89 c3                	mov    %eax,%ebx
+    63b1:	50                   	push   %eax
+    63b2:	e8 f4 00 00 00       	call   64ab <fstat>
+  close(fd);
+    63b7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+    63ba:	89 c6                	mov    %eax,%esi
+  close(fd);
+    63bc:	e8 ba 00 00 00       	call   647b <close>
+  return r;
+    63c1:	83 c4 10             	add    $0x10,%esp
+}
+    63c4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    63c7:	89 f0                	mov    %esi,%eax
+    63c9:	5b                   	pop    %ebx
+    63ca:	5e                   	pop    %esi
+    63cb:	5d                   	pop    %ebp
+    63cc:	c3                   	ret
+    63cd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+    63d0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    63d5:	eb ed                	jmp    63c4 <stat+0x34>
+    63d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    63de:	66 90                	xchg   %ax,%ax
+
+000063e0 <atoi>:
+
+int
+atoi(const char *s)
+{
+    63e0:	55                   	push   %ebp
+    63e1:	89 e5                	mov    %esp,%ebp
+    63e3:	53                   	push   %ebx
+    63e4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+    63e7:	0f be 02             	movsbl (%edx),%eax
+    63ea:	8d 48 d0             	lea    -0x30(%eax),%ecx
+    63ed:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+    63f0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+    63f5:	77 1e                	ja     6415 <atoi+0x35>
+    63f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    63fe:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+    6400:	83 c2 01             	add    $0x1,%edx
+    6403:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+    6406:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+    640a:	0f be 02             	movsbl (%edx),%eax
+    640d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+    6410:	80 fb 09             	cmp    $0x9,%bl
+    6413:	76 eb                	jbe    6400 <atoi+0x20>
+  return n;
+}
+    6415:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    6418:	89 c8                	mov    %ecx,%eax
+    641a:	c9                   	leave
+    641b:	c3                   	ret
+    641c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00006420 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+    6420:	55                   	push   %ebp
+    6421:	89 e5                	mov    %esp,%ebp
+    6423:	57                   	push   %edi
+    6424:	56                   	push   %esi
+    6425:	8b 45 10             	mov    0x10(%ebp),%eax
+    6428:	8b 55 08             	mov    0x8(%ebp),%edx
+    642b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+    642e:	85 c0                	test   %eax,%eax
+    6430:	7e 13                	jle    6445 <memmove+0x25>
+    6432:	01 d0                	add    %edx,%eax
+  dst = vdst;
+    6434:	89 d7                	mov    %edx,%edi
+    6436:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    643d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+    6440:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+    6441:	39 f8                	cmp    %edi,%eax
+    6443:	75 fb                	jne    6440 <memmove+0x20>
+  return vdst;
+}
+    6445:	5e                   	pop    %esi
+    6446:	89 d0                	mov    %edx,%eax
+    6448:	5f                   	pop    %edi
+    6449:	5d                   	pop    %ebp
+    644a:	c3                   	ret
+
+0000644b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+    644b:	b8 01 00 00 00       	mov    $0x1,%eax
+    6450:	cd 40                	int    $0x40
+    6452:	c3                   	ret
+
+00006453 <exit>:
+SYSCALL(exit)
+    6453:	b8 02 00 00 00       	mov    $0x2,%eax
+    6458:	cd 40                	int    $0x40
+    645a:	c3                   	ret
+
+0000645b <wait>:
+SYSCALL(wait)
+    645b:	b8 03 00 00 00       	mov    $0x3,%eax
+    6460:	cd 40                	int    $0x40
+    6462:	c3                   	ret
+
+00006463 <pipe>:
+SYSCALL(pipe)
+    6463:	b8 04 00 00 00       	mov    $0x4,%eax
+    6468:	cd 40                	int    $0x40
+    646a:	c3                   	ret
+
+0000646b <read>:
+SYSCALL(read)
+    646b:	b8 05 00 00 00       	mov    $0x5,%eax
+    6470:	cd 40                	int    $0x40
+    6472:	c3                   	ret
+
+00006473 <write>:
+SYSCALL(write)
+    6473:	b8 10 00 00 00       	mov    $0x10,%eax
+    6478:	cd 40                	int    $0x40
+    647a:	c3                   	ret
+
+0000647b <close>:
+SYSCALL(close)
+    647b:	b8 15 00 00 00       	mov    $0x15,%eax
+    6480:	cd 40                	int    $0x40
+    6482:	c3                   	ret
+
+00006483 <kill>:
+SYSCALL(kill)
+    6483:	b8 06 00 00 00       	mov    $0x6,%eax
+    6488:	cd 40                	int    $0x40
+    648a:	c3                   	ret
+
+0000648b <exec>:
+SYSCALL(exec)
+    648b:	b8 07 00 00 00       	mov    $0x7,%eax
+    6490:	cd 40                	int    $0x40
+    6492:	c3                   	ret
+
+00006493 <open>:
+SYSCALL(open)
+    6493:	b8 0f 00 00 00       	mov    $0xf,%eax
+    6498:	cd 40                	int    $0x40
+    649a:	c3                   	ret
+
+0000649b <mknod>:
+SYSCALL(mknod)
+    649b:	b8 11 00 00 00       	mov    $0x11,%eax
+    64a0:	cd 40                	int    $0x40
+    64a2:	c3                   	ret
+
+000064a3 <unlink>:
+SYSCALL(unlink)
+    64a3:	b8 12 00 00 00       	mov    $0x12,%eax
+    64a8:	cd 40                	int    $0x40
+    64aa:	c3                   	ret
+
+000064ab <fstat>:
+SYSCALL(fstat)
+    64ab:	b8 08 00 00 00       	mov    $0x8,%eax
+    64b0:	cd 40                	int    $0x40
+    64b2:	c3                   	ret
+
+000064b3 <link>:
+SYSCALL(link)
+    64b3:	b8 13 00 00 00       	mov    $0x13,%eax
+    64b8:	cd 40                	int    $0x40
+    64ba:	c3                   	ret
+
+000064bb <mkdir>:
+SYSCALL(mkdir)
+    64bb:	b8 14 00 00 00       	mov    $0x14,%eax
+    64c0:	cd 40                	int    $0x40
+    64c2:	c3                   	ret
+
+000064c3 <chdir>:
+SYSCALL(chdir)
+    64c3:	b8 09 00 00 00       	mov    $0x9,%eax
+    64c8:	cd 40                	int    $0x40
+    64ca:	c3                   	ret
+
+000064cb <dup>:
+SYSCALL(dup)
+    64cb:	b8 0a 00 00 00       	mov    $0xa,%eax
+    64d0:	cd 40                	int    $0x40
+    64d2:	c3                   	ret
+
+000064d3 <getpid>:
+SYSCALL(getpid)
+    64d3:	b8 0b 00 00 00       	mov    $0xb,%eax
+    64d8:	cd 40                	int    $0x40
+    64da:	c3                   	ret
+
+000064db <sbrk>:
+SYSCALL(sbrk)
+    64db:	b8 0c 00 00 00       	mov    $0xc,%eax
+    64e0:	cd 40                	int    $0x40
+    64e2:	c3                   	ret
+
+000064e3 <sleep>:
+SYSCALL(sleep)
+    64e3:	b8 0d 00 00 00       	mov    $0xd,%eax
+    64e8:	cd 40                	int    $0x40
+    64ea:	c3                   	ret
+
+000064eb <uptime>:
+SYSCALL(uptime)
+    64eb:	b8 0e 00 00 00       	mov    $0xe,%eax
+    64f0:	cd 40                	int    $0x40
+    64f2:	c3                   	ret
+
+000064f3 <getrss>:
+SYSCALL(getrss)
+    64f3:	b8 16 00 00 00       	mov    $0x16,%eax
+    64f8:	cd 40                	int    $0x40
+    64fa:	c3                   	ret
+
+000064fb <getNumFreePages>:
+SYSCALL(getNumFreePages)
+    64fb:	b8 17 00 00 00       	mov    $0x17,%eax
+    6500:	cd 40                	int    $0x40
+    6502:	c3                   	ret
+
+00006503 <getvmstat>:
+SYSCALL(getvmstat)
+    6503:	b8 18 00 00 00       	mov    $0x18,%eax
+    6508:	cd 40                	int    $0x40
+    650a:	c3                   	ret
+
+0000650b <vmtune>:
+SYSCALL(vmtune)
+    650b:	b8 19 00 00 00       	mov    $0x19,%eax
+    6510:	cd 40                	int    $0x40
+    6512:	c3                   	ret
+
+00006513 <spawn>:
+SYSCALL(spawn)
+    6513:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    6518:	cd 40                	int    $0x40
+    651a:	c3                   	ret
+    651b:	66 90                	xchg   %ax,%ax
+    651d:	66 90                	xchg   %ax,%ax
+    651f:	90                   	nop
+
+00006520 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+    6520:	55                   	push   %ebp
+    6521:	89 e5                	mov    %esp,%ebp
+    6523:	57                   	push   %edi
+    6524:	56                   	push   %esi
+    6525:	53                   	push   %ebx
+    6526:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+    6528:	89 d1                	mov    %edx,%ecx
+{
+    652a:	83 ec 3c             	sub    $0x3c,%esp
+    652d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+    6530:	85 d2                	test   %edx,%edx
+    6532:	0f 89 80 00 00 00    	jns    65b8 <printint+0x98>
+    6538:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+    653c:	74 7a                	je     65b8 <printint+0x98>
+    x = -xx;
+    653e:	f7 d9                	neg    %ecx
+    neg = 1;
+    6540:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+    6545:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+    6548:	31 f6                	xor    %esi,%esi
+    654a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+    6550:	89 c8                	mov    %ecx,%eax
+    6552:	31 d2                	xor    %edx,%edx
+    6554:	89 f7                	mov    %esi,%edi
+    6556:	f7 f3                	div    %ebx
+    6558:	8d 76 01             	lea    0x1(%esi),%esi
+    655b:	0f b6 92 8c 91 00 00 	movzbl 0x918c(%edx),%edx
+    6562:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+    6566:	89 ca                	mov    %ecx,%edx
+    6568:	89 c1                	mov    %eax,%ecx
+    656a:	39 da                	cmp    %ebx,%edx
+    656c:	73 e2                	jae    6550 <printint+0x30>
+  if(neg)
+    656e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+    6571:	85 c0                	test   %eax,%eax
+    6573:	74 07                	je     657c <printint+0x5c>
+    buf[i++] = '-';
+    6575:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+    657a:	89 f7                	mov    %esi,%edi
+    657c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+    657f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+    6582:	01 df                	add    %ebx,%edi
+    6584:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+    6588:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+    658b:	83 ec 04             	sub    $0x4,%esp
+    658e:	88 45 d7             	mov    %al,-0x29(%ebp)
+    6591:	8d 45 d7             	lea    -0x29(%ebp),%eax
+    6594:	6a 01                	push   $0x1
+    6596:	50                   	push   %eax
+    6597:	56                   	push   %esi
+    6598:	e8 d6 fe ff ff       	call   6473 <write>
+  while(--i >= 0)
+    659d:	89 f8                	mov    %edi,%eax
+    659f:	83 c4 10             	add    $0x10,%esp
+    65a2:	83 ef 01             	sub    $0x1,%edi
+    65a5:	39 d8                	cmp    %ebx,%eax
+    65a7:	75 df                	jne    6588 <printint+0x68>
+}
+    65a9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    65ac:	5b                   	pop    %ebx
+    65ad:	5e                   	pop    %esi
+    65ae:	5f                   	pop    %edi
+    65af:	5d                   	pop    %ebp
+    65b0:	c3                   	ret
+    65b1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+    65b8:	31 c0                	xor    %eax,%eax
+    65ba:	eb 89                	jmp    6545 <printint+0x25>
+    65bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000065c0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+    65c0:	55                   	push   %ebp
+    65c1:	89 e5                	mov    %esp,%ebp
+    65c3:	57                   	push   %edi
+    65c4:	56                   	push   %esi
+    65c5:	53                   	push   %ebx
+    65c6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+    65c9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+    65cc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+    65cf:	0f b6 1e             	movzbl (%esi),%ebx
+    65d2:	83 c6 01             	add    $0x1,%esi
+    65d5:	84 db                	test   %bl,%bl
+    65d7:	74 67                	je     6640 <printf+0x80>
+    65d9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+    65dc:	31 d2                	xor    %edx,%edx
+    65de:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+    65e1:	eb 34                	jmp    6617 <printf+0x57>
+    65e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    65e7:	90                   	nop
+    65e8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+    65eb:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+    65f0:	83 f8 25             	cmp    $0x25,%eax
+    65f3:	74 18                	je     660d <printf+0x4d>
+  write(fd, &c, 1);
+    65f5:	83 ec 04             	sub    $0x4,%esp
+    65f8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    65fb:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    65fe:	6a 01                	push   $0x1
+    6600:	50                   	push   %eax
+    6601:	57                   	push   %edi
+    6602:	e8 6c fe ff ff       	call   6473 <write>
+    6607:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+    660a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+    660d:	0f b6 1e             	movzbl (%esi),%ebx
+    6610:	83 c6 01             	add    $0x1,%esi
+    6613:	84 db                	test   %bl,%bl
+    6615:	74 29                	je     6640 <printf+0x80>
+    c = fmt[i] & 0xff;
+    6617:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+    661a:	85 d2                	test   %edx,%edx
+    661c:	74 ca                	je     65e8 <printf+0x28>
+      }
+    } else if(state == '%'){
+    661e:	83 fa 25             	cmp    $0x25,%edx
+    6621:	75 ea                	jne    660d <printf+0x4d>
+      if(c == 'd'){
+    6623:	83 f8 25             	cmp    $0x25,%eax
+    6626:	0f 84 24 01 00 00    	je     6750 <printf+0x190>
+    662c:	83 e8 63             	sub    $0x63,%eax
+    662f:	83 f8 15             	cmp    $0x15,%eax
+    6632:	77 1c                	ja     6650 <printf+0x90>
+    6634:	ff 24 85 34 91 00 00 	jmp    *0x9134(,%eax,4)
+    663b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    663f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+    6640:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    6643:	5b                   	pop    %ebx
+    6644:	5e                   	pop    %esi
+    6645:	5f                   	pop    %edi
+    6646:	5d                   	pop    %ebp
+    6647:	c3                   	ret
+    6648:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    664f:	90                   	nop
+  write(fd, &c, 1);
+    6650:	83 ec 04             	sub    $0x4,%esp
+    6653:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    6656:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+    665a:	6a 01                	push   $0x1
+    665c:	52                   	push   %edx
+    665d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    6660:	57                   	push   %edi
+    6661:	e8 0d fe ff ff       	call   6473 <write>
+    6666:	83 c4 0c             	add    $0xc,%esp
+    6669:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    666c:	6a 01                	push   $0x1
+    666e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    6671:	52                   	push   %edx
+    6672:	57                   	push   %edi
+    6673:	e8 fb fd ff ff       	call   6473 <write>
+        putc(fd, c);
+    6678:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    667b:	31 d2                	xor    %edx,%edx
+    667d:	eb 8e                	jmp    660d <printf+0x4d>
+    667f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+    6680:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    6683:	83 ec 0c             	sub    $0xc,%esp
+    6686:	b9 10 00 00 00       	mov    $0x10,%ecx
+    668b:	8b 13                	mov    (%ebx),%edx
+    668d:	6a 00                	push   $0x0
+    668f:	89 f8                	mov    %edi,%eax
+        ap++;
+    6691:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+    6694:	e8 87 fe ff ff       	call   6520 <printint>
+        ap++;
+    6699:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    669c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    669f:	31 d2                	xor    %edx,%edx
+    66a1:	e9 67 ff ff ff       	jmp    660d <printf+0x4d>
+    66a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    66ad:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+    66b0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    66b3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+    66b5:	83 c0 04             	add    $0x4,%eax
+    66b8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+    66bb:	85 db                	test   %ebx,%ebx
+    66bd:	0f 84 9d 00 00 00    	je     6760 <printf+0x1a0>
+        while(*s != 0){
+    66c3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+    66c6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+    66c8:	84 c0                	test   %al,%al
+    66ca:	0f 84 3d ff ff ff    	je     660d <printf+0x4d>
+    66d0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    66d3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+    66d6:	89 de                	mov    %ebx,%esi
+    66d8:	89 d3                	mov    %edx,%ebx
+    66da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+    66e0:	83 ec 04             	sub    $0x4,%esp
+    66e3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+    66e6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+    66e9:	6a 01                	push   $0x1
+    66eb:	53                   	push   %ebx
+    66ec:	57                   	push   %edi
+    66ed:	e8 81 fd ff ff       	call   6473 <write>
+        while(*s != 0){
+    66f2:	0f b6 06             	movzbl (%esi),%eax
+    66f5:	83 c4 10             	add    $0x10,%esp
+    66f8:	84 c0                	test   %al,%al
+    66fa:	75 e4                	jne    66e0 <printf+0x120>
+      state = 0;
+    66fc:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+    66ff:	31 d2                	xor    %edx,%edx
+    6701:	e9 07 ff ff ff       	jmp    660d <printf+0x4d>
+    6706:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    670d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+    6710:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    6713:	83 ec 0c             	sub    $0xc,%esp
+    6716:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    671b:	8b 13                	mov    (%ebx),%edx
+    671d:	6a 01                	push   $0x1
+    671f:	e9 6b ff ff ff       	jmp    668f <printf+0xcf>
+    6724:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+    6728:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+    672b:	83 ec 04             	sub    $0x4,%esp
+    672e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+    6731:	8b 03                	mov    (%ebx),%eax
+        ap++;
+    6733:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+    6736:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+    6739:	6a 01                	push   $0x1
+    673b:	52                   	push   %edx
+    673c:	57                   	push   %edi
+    673d:	e8 31 fd ff ff       	call   6473 <write>
+        ap++;
+    6742:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    6745:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    6748:	31 d2                	xor    %edx,%edx
+    674a:	e9 be fe ff ff       	jmp    660d <printf+0x4d>
+    674f:	90                   	nop
+  write(fd, &c, 1);
+    6750:	83 ec 04             	sub    $0x4,%esp
+    6753:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    6756:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    6759:	6a 01                	push   $0x1
+    675b:	e9 11 ff ff ff       	jmp    6671 <printf+0xb1>
+    6760:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+    6765:	bb 2a 91 00 00       	mov    $0x912a,%ebx
+    676a:	e9 61 ff ff ff       	jmp    66d0 <printf+0x110>
+    676f:	90                   	nop
+
+00006770 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    6770:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    6771:	a1 a0 e6 00 00       	mov    0xe6a0,%eax
+{
+    6776:	89 e5                	mov    %esp,%ebp
+    6778:	57                   	push   %edi
+    6779:	56                   	push   %esi
+    677a:	53                   	push   %ebx
+    677b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+    677e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    6781:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    6788:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    678a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    678c:	39 ca                	cmp    %ecx,%edx
+    678e:	73 30                	jae    67c0 <free+0x50>
+    6790:	39 c1                	cmp    %eax,%ecx
+    6792:	72 04                	jb     6798 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    6794:	39 c2                	cmp    %eax,%edx
+    6796:	72 f0                	jb     6788 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    6798:	8b 73 fc             	mov    -0x4(%ebx),%esi
+    679b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+    679e:	39 f8                	cmp    %edi,%eax
+    67a0:	74 2e                	je     67d0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    67a2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+    67a5:	8b 42 04             	mov    0x4(%edx),%eax
+    67a8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    67ab:	39 f1                	cmp    %esi,%ecx
+    67ad:	74 38                	je     67e7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    67af:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+    67b1:	5b                   	pop    %ebx
+  freep = p;
+    67b2:	89 15 a0 e6 00 00    	mov    %edx,0xe6a0
+}
+    67b8:	5e                   	pop    %esi
+    67b9:	5f                   	pop    %edi
+    67ba:	5d                   	pop    %ebp
+    67bb:	c3                   	ret
+    67bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    67c0:	39 c1                	cmp    %eax,%ecx
+    67c2:	72 d0                	jb     6794 <free+0x24>
+    67c4:	eb c2                	jmp    6788 <free+0x18>
+    67c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    67cd:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+    67d0:	03 70 04             	add    0x4(%eax),%esi
+    67d3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    67d6:	8b 02                	mov    (%edx),%eax
+    67d8:	8b 00                	mov    (%eax),%eax
+    67da:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+    67dd:	8b 42 04             	mov    0x4(%edx),%eax
+    67e0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    67e3:	39 f1                	cmp    %esi,%ecx
+    67e5:	75 c8                	jne    67af <free+0x3f>
+    p->s.size += bp->s.size;
+    67e7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+    67ea:	89 15 a0 e6 00 00    	mov    %edx,0xe6a0
+    p->s.size += bp->s.size;
+    67f0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    67f3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+    67f6:	89 0a                	mov    %ecx,(%edx)
+}
+    67f8:	5b                   	pop    %ebx
+    67f9:	5e                   	pop    %esi
+    67fa:	5f                   	pop    %edi
+    67fb:	5d                   	pop    %ebp
+    67fc:	c3                   	ret
+    67fd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00006800 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+    6800:	55                   	push   %ebp
+    6801:	89 e5                	mov    %esp,%ebp
+    6803:	57                   	push   %edi
+    6804:	56                   	push   %esi
+    6805:	53                   	push   %ebx
+    6806:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    6809:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+    680c:	8b 15 a0 e6 00 00    	mov    0xe6a0,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    6812:	8d 78 07             	lea    0x7(%eax),%edi
+    6815:	c1 ef 03             	shr    $0x3,%edi
+    6818:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+    681b:	85 d2                	test   %edx,%edx
+    681d:	0f 84 8d 00 00 00    	je     68b0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    6823:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    6825:	8b 48 04             	mov    0x4(%eax),%ecx
+    6828:	39 f9                	cmp    %edi,%ecx
+    682a:	73 64                	jae    6890 <malloc+0x90>
+  if(nu < 4096)
+    682c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    6831:	39 df                	cmp    %ebx,%edi
+    6833:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    6836:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    683d:	eb 0a                	jmp    6849 <malloc+0x49>
+    683f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    6840:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    6842:	8b 48 04             	mov    0x4(%eax),%ecx
+    6845:	39 f9                	cmp    %edi,%ecx
+    6847:	73 47                	jae    6890 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+    6849:	89 c2                	mov    %eax,%edx
+    684b:	39 05 a0 e6 00 00    	cmp    %eax,0xe6a0
+    6851:	75 ed                	jne    6840 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+    6853:	83 ec 0c             	sub    $0xc,%esp
+    6856:	56                   	push   %esi
+    6857:	e8 7f fc ff ff       	call   64db <sbrk>
+  if(p == (char*)-1)
+    685c:	83 c4 10             	add    $0x10,%esp
+    685f:	83 f8 ff             	cmp    $0xffffffff,%eax
+    6862:	74 1c                	je     6880 <malloc+0x80>
+  hp->s.size = nu;
+    6864:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+    6867:	83 ec 0c             	sub    $0xc,%esp
+    686a:	83 c0 08             	add    $0x8,%eax
+    686d:	50                   	push   %eax
+    686e:	e8 fd fe ff ff       	call   6770 <free>
+  return freep;
+    6873:	8b 15 a0 e6 00 00    	mov    0xe6a0,%edx
+      if((p = morecore(nunits)) == 0)
+    6879:	83 c4 10             	add    $0x10,%esp
+    687c:	85 d2                	test   %edx,%edx
+    687e:	75 c0                	jne    6840 <malloc+0x40>
+        return 0;
+  }
+}
+    6880:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    6883:	31 c0                	xor    %eax,%eax
+}
+    6885:	5b                   	pop    %ebx
+    6886:	5e                   	pop    %esi
+    6887:	5f                   	pop    %edi
+    6888:	5d                   	pop    %ebp
+    6889:	c3                   	ret
+    688a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    6890:	39 cf                	cmp    %ecx,%edi
+    6892:	74 4c                	je     68e0 <malloc+0xe0>
+        p->s.size -= nunits;
+    6894:	29 f9                	sub    %edi,%ecx
+    6896:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+    6899:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+    689c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+    689f:	89 15 a0 e6 00 00    	mov    %edx,0xe6a0
+}
+    68a5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    68a8:	83 c0 08             	add    $0x8,%eax
+}
+    68ab:	5b                   	pop    %ebx
+    68ac:	5e                   	pop    %esi
+    68ad:	5f                   	pop    %edi
+    68ae:	5d                   	pop    %ebp
+    68af:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+    68b0:	c7 05 a0 e6 00 00 a4 	movl   $0xe6a4,0xe6a0
+    68b7:	e6 00 00 
+    base.s.size = 0;
+    68ba:	b8 a4 e6 00 00       	mov    $0xe6a4,%eax
+    base.s.ptr = freep = prevp = &base;
+    68bf:	c7 05 a4 e6 00 00 a4 	movl   $0xe6a4,0xe6a4
+    68c6:	e6 00 00 
+    base.s.size = 0;
+    68c9:	c7 05 a8 e6 00 00 00 	movl   $0x0,0xe6a8
+    68d0:	00 00 00 
+    if(p->s.size >= nunits){
+    68d3:	e9 54 ff ff ff       	jmp    682c <malloc+0x2c>
+    68d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    68df:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    68e0:	8b 08                	mov    (%eax),%ecx
+    68e2:	89 0a                	mov    %ecx,(%edx)
+    68e4:	eb b9                	jmp    689f <malloc+0x9f>
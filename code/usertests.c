@@ -7,6 +7,7 @@
 #include "syscall.h"
 #include "traps.h"
 #include "memlayout.h"
+#include "vmstat.h"
 
 char buf[8192];
 char name[3];
@@ -457,6 +458,1205 @@ mem(void)
   }
 }
 
+// page allocator throughput: several processes fork and
+// grow/shrink their heaps concurrently. run with CPUS=1..8
+// and compare the rates to see how kalloc/kfree scale.
+#define ABPROCS 4
+#define ABPAGES 16
+#define ABROUNDS 200
+void
+allocbench(void)
+{
+  int i, j, k, t0, t;
+  char *a;
+
+  printf(stdout, "allocbench test\n");
+  t0 = uptime();
+  for(i = 0; i < ABPROCS; i++){
+    if(fork() == 0){
+      for(j = 0; j < ABROUNDS; j++){
+        a = sbrk(ABPAGES*4096);
+        if(a == (char*)0xffffffff){
+          printf(stdout, "allocbench sbrk failed\n");
+          exit();
+        }
+        for(k = 0; k < ABPAGES; k++)
+          a[k*4096] = k;
+        sbrk(-ABPAGES*4096);
+        if((j & 15) == 0 && fork() == 0)
+          exit();
+        if((j & 15) == 0)
+          wait();
+      }
+      exit();
+    }
+  }
+  for(i = 0; i < ABPROCS; i++)
+    wait();
+  t = uptime() - t0;
+  if(t == 0)
+    t = 1;
+  printf(stdout, "allocbench: %d pages in %d ticks, %d pages/tick\n",
+         ABPROCS*ABROUNDS*ABPAGES, t, ABPROCS*ABROUNDS*ABPAGES/t);
+  printf(stdout, "allocbench ok\n");
+}
+
+// the buddy statistics must add up to the free page count.
+void
+buddytest(void)
+{
+  struct vmstat st;
+  uint n;
+  int k;
+
+  printf(stdout, "buddy test\n");
+  if(getvmstat(&st) < 0){
+    printf(stdout, "getvmstat failed\n");
+    exit();
+  }
+  n = st.cachedpages;
+  for(k = 0; k <= VM_MAXORDER; k++)
+    n += st.buddyfree[k] << k;
+  if(n != st.freepages){
+    printf(stdout, "buddy lists hold %d pages, expected %d\n", n, st.freepages);
+    exit();
+  }
+  printf(stdout, "buddy test ok\n");
+}
+
+// the swap tests below overcommit memory by this many pages,
+// whatever memory the machine has; swap holds SWAPBLOCKS/8.
+#define OVERCOMMIT 128
+
+// swap-out throughput with many resident processes.
+// each swap-out updates the RSS of the page's sharers,
+// so this measures the cost of that bookkeeping.
+// the children fill their memory and then wait for each other
+// before sweeping it again, so that together they overcommit.
+#define SBPROCS 16
+void
+swapbench(void)
+{
+  struct vmstat st0, st1;
+  int i, j, k, t0, t, n, ready[2], go[2];
+  char *a, c;
+
+  printf(stdout, "swapbench test\n");
+  if(pipe(ready) < 0 || pipe(go) < 0){
+    printf(stdout, "swapbench pipe failed\n");
+    exit();
+  }
+  getvmstat(&st0);
+  n = (st0.freepages + OVERCOMMIT) / SBPROCS;
+  t0 = uptime();
+  for(i = 0; i < SBPROCS; i++){
+    if(fork() == 0){
+      close(ready[0]);
+      close(go[1]);
+      a = sbrk(n*4096);
+      if(a == (char*)0xffffffff){
+        printf(stdout, "swapbench sbrk failed\n");
+        exit();
+      }
+      for(k = 0; k < 4; k++){
+        for(j = 0; j < n; j++){
+          if(k > 0 && a[j*4096] != (char)(i+j)){
+            printf(stdout, "swapbench page %d corrupt\n", j);
+            exit();
+          }
+          a[j*4096] = i+j;
+        }
+        if(k == 0){
+          write(ready[1], "x", 1);
+          close(ready[1]);
+          read(go[0], &c, 1);
+        }
+      }
+      exit();
+    }
+  }
+  close(ready[1]);
+  close(go[0]);
+  for(i = 0; i < SBPROCS; i++){
+    if(read(ready[0], &c, 1) != 1){
+      printf(stdout, "swapbench: only %d children filled their memory\n", i);
+      exit();
+    }
+  }
+  close(ready[0]);
+  close(go[1]);
+  for(i = 0; i < SBPROCS; i++)
+    wait();
+  t = uptime() - t0;
+  getvmstat(&st1);
+  if(st1.swapouts == st0.swapouts || st1.swapins == st0.swapins){
+    printf(stdout, "swapbench: nothing was swapped\n");
+    exit();
+  }
+  if(t == 0)
+    t = 1;
+  printf(stdout, "swapbench: %d swap-outs %d swap-ins in %d ticks, %d swap-outs/tick\n",
+         st1.swapouts - st0.swapouts, st1.swapins - st0.swapins, t,
+         (st1.swapouts - st0.swapouts) / t);
+  printf(stdout, "swapbench ok\n");
+}
+
+// sequential swap throughput: one process sweeps an array
+// bigger than physical memory, so every sweep pushes some of
+// it out to swap and pulls it back in.
+void
+swapseqbench(void)
+{
+  struct vmstat st0, st1;
+  int i, k, t0, t, n, npages;
+  char *a;
+
+  printf(stdout, "swapseqbench test\n");
+  getvmstat(&st0);
+  npages = st0.freepages + OVERCOMMIT;
+  a = sbrk(npages*4096);
+  if(a == (char*)0xffffffff){
+    printf(stdout, "swapseqbench sbrk failed\n");
+    exit();
+  }
+  for(i = 0; i < npages; i++)
+    a[i*4096] = i;
+  getvmstat(&st0);
+  t0 = uptime();
+  for(k = 0; k < 2; k++){
+    for(i = 0; i < npages; i++){
+      if(a[i*4096] != (char)i){
+        printf(stdout, "swapseqbench page %d corrupt\n", i);
+        exit();
+      }
+    }
+  }
+  t = uptime() - t0;
+  getvmstat(&st1);
+  sbrk(-npages*4096);
+  if(st1.swapins == st0.swapins){
+    printf(stdout, "swapseqbench: nothing was swapped in\n");
+    exit();
+  }
+  if(t == 0)
+    t = 1;
+  n = (st1.swapouts - st0.swapouts) + (st1.swapins - st0.swapins);
+  printf(stdout, "swapseqbench: %d pages swapped in %d ticks, %d pages/tick\n",
+         n, t, n / t);
+  printf(stdout, "swapseqbench ok\n");
+}
+
+// the kswapd watermarks can be read and changed at run time,
+// and kswapd keeps up with a process that overcommits memory.
+void
+kswapdtest(void)
+{
+  struct vmstat st0, st1;
+  int low, high, i, n;
+  char *a;
+
+  printf(stdout, "kswapd test\n");
+  low = vmtune(VM_LOWWM, -1);
+  high = vmtune(VM_HIGHWM, -1);
+  if(low < 0 || high < low){
+    printf(stdout, "bad watermarks %d %d\n", low, high);
+    exit();
+  }
+  if(vmtune(VM_HIGHWM, high + 16) != high || vmtune(VM_HIGHWM, -1) != high + 16){
+    printf(stdout, "vmtune did not set high watermark\n");
+    exit();
+  }
+  vmtune(VM_HIGHWM, high);
+  if(vmtune(12345, 1) != -1){
+    printf(stdout, "vmtune accepted unknown param\n");
+    exit();
+  }
+
+  getvmstat(&st0);
+  n = st0.freepages + 64;
+  a = sbrk(n*4096);
+  if(a == (char*)0xffffffff){
+    printf(stdout, "kswapd test sbrk failed\n");
+    exit();
+  }
+  for(i = 0; i < n; i++)
+    a[i*4096] = 1;
+  getvmstat(&st1);
+  sbrk(-n*4096);
+  if(st1.kswapdwakeups == st0.kswapdwakeups){
+    printf(stdout, "kswapd never woke\n");
+    exit();
+  }
+  printf(stdout, "kswapd: %d pages by kswapd, %d direct\n",
+         st1.kswapdouts - st0.kswapdouts, st1.directouts - st0.directouts);
+  printf(stdout, "kswapd test ok\n");
+}
+
+// working-set benchmark: a hot set that fits in memory is
+// touched between passes over a cold array that does not.
+// a replacement policy that keeps the hot set resident takes
+// few faults beyond the cold misses.
+#define WSHOT 64
+void
+wsbench(void)
+{
+  struct vmstat st0, st1;
+  int i, k, t0, t, ncold;
+  char *hot, *cold;
+
+  printf(stdout, "wsbench test\n");
+  getvmstat(&st0);
+  ncold = st0.freepages + OVERCOMMIT - WSHOT;
+  hot = sbrk(WSHOT*4096);
+  cold = sbrk(ncold*4096);
+  if(hot == (char*)0xffffffff || cold == (char*)0xffffffff){
+    printf(stdout, "wsbench sbrk failed\n");
+    exit();
+  }
+  for(i = 0; i < ncold; i++)
+    cold[i*4096] = i;
+  getvmstat(&st0);
+  t0 = uptime();
+  for(k = 0; k < 4; k++){
+    for(i = 0; i < ncold; i++){
+      hot[(i % WSHOT)*4096] += 1;
+      if(cold[i*4096] != (char)i){
+        printf(stdout, "wsbench page %d corrupt\n", i);
+        exit();
+      }
+    }
+  }
+  t = uptime() - t0;
+  getvmstat(&st1);
+  sbrk(-(WSHOT+ncold)*4096);
+  if(st1.swapins == st0.swapins){
+    printf(stdout, "wsbench: the cold array was never swapped in\n");
+    exit();
+  }
+  printf(stdout, "wsbench: %d faults %d swap-ins in %d ticks\n",
+         st1.pgfaults - st0.pgfaults, st1.swapins - st0.swapins, t);
+  printf(stdout, "wsbench ok\n");
+}
+
+// fill memory and swap until sbrk() fails or the first write
+// to a new page cannot be backed; the kernel must fail the
+// allocation or kill the child instead of panicking, and give
+// every swap slot back when the process exits.
+void
+swapfulltest(void)
+{
+  struct vmstat st0, st1;
+  int pid, n;
+  char *a;
+
+  printf(stdout, "swapfull test\n");
+  getvmstat(&st0);
+  pid = fork();
+  if(pid < 0){
+    printf(stdout, "swapfull fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    n = 0;
+    while((a = sbrk(4096)) != (char*)0xffffffff){
+      *a = n;
+      n++;
+    }
+    printf(stdout, "swapfull: sbrk failed after %d pages\n", n);
+    exit();
+  }
+  wait();
+  getvmstat(&st1);
+  // our own and the shell's pages may have been swapped
+  // out meanwhile, but not hundreds of them.
+  if(st1.swapfree + 64 < st0.swapfree){
+    printf(stdout, "swapfull: %d swap slots leaked\n", st0.swapfree - st1.swapfree);
+    exit();
+  }
+  if(st1.oomfails == st0.oomfails){
+    printf(stdout, "swapfull: swap never filled\n");
+    exit();
+  }
+  printf(stdout, "swapfull test ok\n");
+}
+
+// read an array that does not fit in memory twice.  pages read
+// back in stay clean, so the second pass must be able to evict
+// them again without writing them.
+void
+swapcachetest(void)
+{
+  struct vmstat st0, st1;
+  int i, k, zs, npages;
+  char *a;
+
+  printf(stdout, "swapcache test\n");
+  zs = vmtune(VM_ZSWAP, 0);
+  getvmstat(&st0);
+  npages = st0.freepages + OVERCOMMIT;
+  a = sbrk(npages*4096);
+  if(a == (char*)0xffffffff){
+    printf(stdout, "swapcache sbrk failed\n");
+    exit();
+  }
+  for(i = 0; i < npages; i++)
+    a[i*4096] = i;
+  getvmstat(&st0);
+  for(k = 0; k < 2; k++){
+    for(i = 0; i < npages; i++){
+      if(a[i*4096] != (char)i){
+        printf(stdout, "swapcache page %d corrupt\n", i);
+        exit();
+      }
+    }
+  }
+  getvmstat(&st1);
+  sbrk(-npages*4096);
+  vmtune(VM_ZSWAP, zs);
+  if(st1.swapcleandrops == st0.swapcleandrops){
+    printf(stdout, "swapcache: clean pages were written again\n");
+    exit();
+  }
+  printf(stdout, "swapcache: %d swap-ins, %d swap-outs, %d without a write\n",
+         st1.swapins - st0.swapins, st1.swapouts - st0.swapouts,
+         st1.swapcleandrops - st0.swapcleandrops);
+  printf(stdout, "swapcache test ok\n");
+}
+
+// sweep an array that does not fit in memory with swap
+// readahead off and then on, and compare faults and time.
+void
+readaheadbench(void)
+{
+  struct vmstat st0, st1;
+  int i, k, t0, old, win, zs, npages;
+  char *a;
+
+  printf(stdout, "readahead bench\n");
+  zs = vmtune(VM_ZSWAP, 0);
+  getvmstat(&st0);
+  npages = st0.freepages + OVERCOMMIT;
+  a = sbrk(npages*4096);
+  if(a == (char*)0xffffffff){
+    printf(stdout, "readahead sbrk failed\n");
+    exit();
+  }
+  for(i = 0; i < npages; i++)
+    a[i*4096] = i;
+  old = vmtune(VM_READAHEAD, -1);
+  for(k = 0; k < 2; k++){
+    win = (k == 0) ? 1 : old;
+    vmtune(VM_READAHEAD, win);
+    getvmstat(&st0);
+    t0 = uptime();
+    for(i = 0; i < npages; i++){
+      if(a[i*4096] != (char)i){
+        printf(stdout, "readahead page %d corrupt\n", i);
+        exit();
+      }
+    }
+    getvmstat(&st1);
+    if(st1.swapins == st0.swapins){
+      printf(stdout, "readahead window %d: nothing was swapped in\n", win);
+      exit();
+    }
+    printf(stdout, "readahead window %d: %d faults %d swap-ins in %d ticks, "
+           "%d read ahead, %d hits %d misses\n", win,
+           st1.pgfaults - st0.pgfaults, st1.swapins - st0.swapins,
+           uptime() - t0, st1.rapages - st0.rapages,
+           st1.rahits - st0.rahits, st1.ramisses - st0.ramisses);
+  }
+  vmtune(VM_READAHEAD, old);
+  vmtune(VM_ZSWAP, zs);
+  sbrk(-npages*4096);
+  printf(stdout, "readahead bench ok\n");
+}
+
+// fill and then sweep an array that does not fit in memory,
+// with swap-out clustering off and then on.  clustering writes
+// neighbouring pages to neighbouring slots, which is what lets
+// readahead bring them back in one request.
+void
+clusterbench(void)
+{
+  struct vmstat st0, st1, st2;
+  int i, k, t0, t1, old, size, zs, npages;
+  char *a;
+
+  printf(stdout, "cluster bench\n");
+  zs = vmtune(VM_ZSWAP, 0);
+  old = vmtune(VM_CLUSTER, -1);
+  for(k = 0; k < 2; k++){
+    size = (k == 0) ? 1 : old;
+    vmtune(VM_CLUSTER, size);
+    getvmstat(&st0);
+    npages = st0.freepages + OVERCOMMIT;
+    t0 = uptime();
+    a = sbrk(npages*4096);
+    if(a == (char*)0xffffffff){
+      printf(stdout, "cluster sbrk failed\n");
+      exit();
+    }
+    for(i = 0; i < npages; i++)
+      a[i*4096] = i;
+    getvmstat(&st1);
+    t1 = uptime();
+    for(i = 0; i < npages; i++){
+      if(a[i*4096] != (char)i){
+        printf(stdout, "cluster page %d corrupt\n", i);
+        exit();
+      }
+    }
+    getvmstat(&st2);
+    sbrk(-npages*4096);
+    if(st1.swapouts == st0.swapouts){
+      printf(stdout, "cluster size %d: nothing was swapped out\n", size);
+      exit();
+    }
+    if(size > 1 && st1.clusters == st0.clusters){
+      printf(stdout, "cluster size %d: no swap-out was clustered\n", size);
+      exit();
+    }
+    printf(stdout, "cluster size %d: fill %d ticks, %d swap-outs in %d clusters; "
+           "sweep %d ticks, %d faults\n", size, t1 - t0,
+           st1.swapouts - st0.swapouts, st1.clusters - st0.clusters,
+           uptime() - t1, st2.pgfaults - st1.pgfaults);
+  }
+  vmtune(VM_CLUSTER, old);
+  vmtune(VM_ZSWAP, zs);
+  printf(stdout, "cluster bench ok\n");
+}
+
+// sweep a mostly empty array that does not fit in memory with
+// the compressed swap pool off and then on.  with it on, most
+// swap-ins should be served from the pool.
+void
+zswapbench(void)
+{
+  struct vmstat st0, st1;
+  int i, k, t0, old, npages;
+  char *a;
+
+  printf(stdout, "zswap bench\n");
+  old = vmtune(VM_ZSWAP, -1);
+  for(k = 0; k < 2; k++){
+    vmtune(VM_ZSWAP, k);
+    getvmstat(&st0);
+    npages = st0.freepages + OVERCOMMIT;
+    a = sbrk(npages*4096);
+    if(a == (char*)0xffffffff){
+      printf(stdout, "zswap sbrk failed\n");
+      exit();
+    }
+    getvmstat(&st0);
+    t0 = uptime();
+    for(i = 0; i < npages; i++)
+      a[i*4096] = i;
+    for(i = 0; i < npages; i++){
+      if(a[i*4096] != (char)i){
+        printf(stdout, "zswap page %d corrupt\n", i);
+        exit();
+      }
+    }
+    getvmstat(&st1);
+    sbrk(-npages*4096);
+    printf(stdout, "zswap %s: %d ticks, %d swap-ins, %d from the pool, "
+           "%d stored in %d bytes\n", k ? "on" : "off", uptime() - t0,
+           st1.swapins - st0.swapins, st1.zswaphits - st0.zswaphits,
+           st1.zswapstored, st1.zswapbytes);
+    if(st1.swapins == st0.swapins){
+      printf(stdout, "zswap %s: nothing was swapped in\n", k ? "on" : "off");
+      exit();
+    }
+    if(k == 1 && st1.zswaphits == st0.zswaphits){
+      printf(stdout, "zswap: no swap-in came from the pool\n");
+      exit();
+    }
+  }
+  vmtune(VM_ZSWAP, old);
+  printf(stdout, "zswap bench ok\n");
+}
+
+// new heap pages cost nothing until touched, share the zero
+// page until written, and same-filled pages go to swap without
+// any I/O.
+#define ZPPAGES 256
+
+void
+zeropagetest(void)
+{
+  struct vmstat st0, st1;
+  int i, j, n;
+  char *a;
+
+  printf(stdout, "zero page test\n");
+  getvmstat(&st0);
+  a = sbrk(ZPPAGES*4096);
+  if(a == (char*)0xffffffff){
+    printf(stdout, "zero page sbrk failed\n");
+    exit();
+  }
+  getvmstat(&st1);
+  if(st1.freepages + 16 < st0.freepages){
+    printf(stdout, "zero page: sbrk allocated memory\n");
+    exit();
+  }
+  for(i = 0; i < ZPPAGES; i++){
+    for(j = 0; j < 4096; j += 512){
+      if(a[i*4096 + j] != 0){
+        printf(stdout, "zero page not zero\n");
+        exit();
+      }
+    }
+  }
+  getvmstat(&st1);
+  if(st1.zeromapped < st0.zeromapped + ZPPAGES){
+    printf(stdout, "zero page: reads did not map the zero page\n");
+    exit();
+  }
+  for(i = 0; i < ZPPAGES; i += 2)
+    a[i*4096] = 1;
+  getvmstat(&st1);
+  if(st1.zerocows < st0.zerocows + ZPPAGES/2){
+    printf(stdout, "zero page: writes did not get their own pages\n");
+    exit();
+  }
+  sbrk(-ZPPAGES*4096);
+
+  getvmstat(&st0);
+  n = st0.freepages + OVERCOMMIT;
+  a = sbrk(n*4096);
+  if(a == (char*)0xffffffff){
+    printf(stdout, "zero page sbrk failed\n");
+    exit();
+  }
+  getvmstat(&st0);
+  for(i = 0; i < n; i++)
+    memset(a + i*4096, i, 4096);
+  for(i = 0; i < n; i++){
+    if(a[i*4096 + 4095] != (char)i){
+      printf(stdout, "same-filled page %d corrupt\n", i);
+      exit();
+    }
+  }
+  getvmstat(&st1);
+  sbrk(-n*4096);
+  if(st1.swapouts > st0.swapouts && st1.fillouts == st0.fillouts){
+    printf(stdout, "zero page: same-filled pages were written out\n");
+    exit();
+  }
+  printf(stdout, "zero page: %d swap-outs, %d same-filled, %d filled back in\n",
+         st1.swapouts - st0.swapouts, st1.fillouts - st0.fillouts,
+         st1.fillins - st0.fillins);
+  printf(stdout, "zero page test ok\n");
+}
+
+// sbrk only reserves address space, so its cost must not grow
+// with the size asked for.  touch one page per megabyte to show
+// that pages still appear on demand.
+#define SLROUNDS 100
+
+void
+sbrklatency(void)
+{
+  struct vmstat st0, st1;
+  int mb, r, i, t0;
+  char *a;
+
+  printf(stdout, "sbrk latency test\n");
+  for(mb = 1; mb <= 64; mb *= 2){
+    getvmstat(&st0);
+    t0 = uptime();
+    for(r = 0; r < SLROUNDS; r++){
+      a = sbrk(mb*1024*1024);
+      if(a == (char*)0xffffffff){
+        printf(stdout, "sbrk %d MB failed\n", mb);
+        exit();
+      }
+      if(r == 0){
+        for(i = 0; i < mb; i++)
+          a[i*1024*1024] = i;
+        for(i = 0; i < mb; i++){
+          if(a[i*1024*1024] != (char)i){
+            printf(stdout, "sbrk %d MB: page %d corrupt\n", mb, i);
+            exit();
+          }
+        }
+      }
+      sbrk(-mb*1024*1024);
+    }
+    getvmstat(&st1);
+    printf(stdout, "sbrk %d MB: %d ticks for %d rounds, %d pages faulted in\n",
+           mb, uptime() - t0, SLROUNDS, st1.lazyalloc - st0.lazyalloc);
+  }
+  printf(stdout, "sbrk latency test ok\n");
+}
+
+// Run path as echo with argument "ok", piping its output back.
+// Returns 0 if it printed "ok".
+int
+runecho(char *path)
+{
+  char *args[] = { "echo", "ok", 0 };
+  char buf[8];
+  int fds[2], n, pid;
+
+  if(pipe(fds) != 0){
+    printf(stdout, "pipe() failed\n");
+    exit();
+  }
+  pid = fork();
+  if(pid < 0){
+    printf(stdout, "fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    close(1);
+    dup(fds[1]);
+    close(fds[0]);
+    close(fds[1]);
+    exec(path, args);
+    printf(stdout, "exec %s failed\n", path);
+    exit();
+  }
+  close(fds[1]);
+  n = read(fds[0], buf, sizeof(buf));
+  close(fds[0]);
+  wait();
+  if(n != 3 || buf[0] != 'o' || buf[1] != 'k' || buf[2] != '\n')
+    return -1;
+  return 0;
+}
+
+// fork+exec a short program many times.  exec reads no program
+// pages up front, so each run should fault in only the pages it
+// touches, and after the first, find them in the page cache.
+#define EXROUNDS 50
+
+void
+execbench(void)
+{
+  struct vmstat st0, st1;
+  int r, t0;
+
+  printf(stdout, "exec bench\n");
+  getvmstat(&st0);
+  t0 = uptime();
+  for(r = 0; r < EXROUNDS; r++){
+    if(runecho("echo") != 0){
+      printf(stdout, "exec bench: bad output from echo\n");
+      exit();
+    }
+  }
+  getvmstat(&st1);
+  printf(stdout, "exec bench: %d ticks for %d execs, %d program pages read, %d shared\n",
+         uptime() - t0, EXROUNDS, st1.filepages - st0.filepages,
+         st1.fileshared - st0.fileshared);
+  printf(stdout, "exec bench ok\n");
+}
+
+// Latency of fork+exit and of fork+exec.  Both build a page
+// directory for the child, so both pay for setting up the
+// kernel's half of the address space.
+#define FEROUNDS 200
+
+void
+forkexecbench(void)
+{
+  int r, pid, t0;
+
+  printf(stdout, "fork+exec bench\n");
+  t0 = uptime();
+  for(r = 0; r < FEROUNDS; r++){
+    pid = fork();
+    if(pid < 0){
+      printf(stdout, "fork failed\n");
+      exit();
+    }
+    if(pid == 0)
+      exit();
+    wait();
+  }
+  printf(stdout, "fork+exec bench: %d ticks for %d forks\n", uptime() - t0, FEROUNDS);
+  t0 = uptime();
+  for(r = 0; r < FEROUNDS; r++){
+    if(runecho("echo") != 0){
+      printf(stdout, "fork+exec bench: bad output from echo\n");
+      exit();
+    }
+  }
+  printf(stdout, "fork+exec bench: %d ticks for %d fork+execs\n", uptime() - t0, FEROUNDS);
+  printf(stdout, "fork+exec bench ok\n");
+}
+
+// fork() of a process with a big, mostly untouched heap should
+// cost about what fork() of a small one does.
+#define SFMB 64
+
+void
+sparseforkbench(void)
+{
+  char *a;
+  int r, pid, t0;
+
+  printf(stdout, "sparse fork bench\n");
+  a = sbrk(SFMB*1024*1024);
+  if(a == (char*)0xffffffff){
+    printf(stdout, "sbrk failed\n");
+    exit();
+  }
+  a[0] = 1;
+  a[SFMB*1024*1024 - 1] = 1;
+  t0 = uptime();
+  for(r = 0; r < FEROUNDS; r++){
+    pid = fork();
+    if(pid < 0){
+      printf(stdout, "fork failed\n");
+      exit();
+    }
+    if(pid == 0)
+      exit();
+    wait();
+  }
+  printf(stdout, "sparse fork bench: %d ticks for %d forks with a %d MB heap\n",
+         uptime() - t0, FEROUNDS, SFMB);
+  sbrk(-SFMB*1024*1024);
+  printf(stdout, "sparse fork bench ok\n");
+}
+
+// fork() shares page tables until one side faults through them.
+// Parent, child and grandchild must each still see only their
+// own writes, also after the child shrinks its heap through the
+// middle of a shared table.  The pages touched straddle a 4MB
+// boundary, so they live in two page tables.
+#define PTHALF 64
+
+void
+ptsharetest(void)
+{
+  struct vmstat st0, st1;
+  char *a, *b, *top;
+  int i, pid, t0;
+
+  printf(stdout, "shared page table test\n");
+  a = sbrk(0);
+  b = (char*)(((uint)a + 4*1024*1024) & ~(4*1024*1024 - 1));
+  top = b + PTHALF*4096;
+  if(sbrk(top - a) == (char*)0xffffffff){
+    printf(stdout, "sbrk failed\n");
+    exit();
+  }
+  for(i = -PTHALF; i < PTHALF; i++)
+    b[i*4096] = 'p';
+  getvmstat(&st0);
+  pid = fork();
+  if(pid < 0){
+    printf(stdout, "fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    // Cut the upper table in half first.
+    sbrk(-(PTHALF/2)*4096);
+    for(i = -PTHALF; i < PTHALF/2; i++){
+      if(b[i*4096] != 'p'){
+        printf(stdout, "shared page table: child sees %c\n", b[i*4096]);
+        exit();
+      }
+      b[i*4096] = 'c';
+    }
+    pid = fork();
+    if(pid == 0){
+      for(i = -PTHALF; i < PTHALF/2; i++){
+        if(b[i*4096] != 'c'){
+          printf(stdout, "shared page table: grandchild sees %c\n", b[i*4096]);
+          exit();
+        }
+        b[i*4096] = 'g';
+      }
+      exit();
+    }
+    wait();
+    for(i = -PTHALF; i < PTHALF/2; i++){
+      if(b[i*4096] != 'c'){
+        printf(stdout, "shared page table: child sees %c after grandchild\n", b[i*4096]);
+        exit();
+      }
+    }
+    exit();
+  }
+  wait();
+  for(i = -PTHALF; i < PTHALF; i++){
+    if(b[i*4096] != 'p'){
+      printf(stdout, "shared page table: parent sees %c\n", b[i*4096]);
+      exit();
+    }
+  }
+  getvmstat(&st1);
+  if(st1.ptshares == st0.ptshares){
+    printf(stdout, "shared page table: fork shared no page tables\n");
+    exit();
+  }
+  t0 = uptime();
+  for(i = 0; i < FEROUNDS; i++){
+    pid = fork();
+    if(pid < 0){
+      printf(stdout, "fork failed\n");
+      exit();
+    }
+    if(pid == 0)
+      exit();
+    wait();
+  }
+  printf(stdout, "shared page table: %d ticks for %d forks of %d touched pages\n",
+         uptime() - t0, FEROUNDS, 2*PTHALF);
+  sbrk(-(top - a));
+  printf(stdout, "shared page table test ok\n");
+}
+
+// spawn() starts a program in a new process without copying the
+// caller, and hands it the given descriptors as 0, 1 and 2.
+// Launching through it should not get slower as the parent grows,
+// unlike fork+exec.
+#define SPBIG 256
+
+int
+spawnecho(void)
+{
+  char *args[] = { "echo", "ok", 0 };
+  char buf[8];
+  int p[2], fds[3], n, pid;
+
+  if(pipe(p) != 0){
+    printf(stdout, "pipe() failed\n");
+    exit();
+  }
+  fds[0] = 0;
+  fds[1] = p[1];
+  fds[2] = 2;
+  pid = spawn("echo", args, fds);
+  close(p[1]);
+  if(pid < 0){
+    close(p[0]);
+    return -1;
+  }
+  n = read(p[0], buf, sizeof(buf));
+  close(p[0]);
+  if(wait() != pid)
+    return -1;
+  if(n != 3 || buf[0] != 'o' || buf[1] != 'k' || buf[2] != '\n')
+    return -1;
+  return 0;
+}
+
+void
+spawnbench(void)
+{
+  char *args[] = { "echo", "ok", 0 };
+  int fds[3], i, r, t0, big;
+  char *a;
+
+  printf(stdout, "spawn bench\n");
+  fds[0] = 0;
+  fds[1] = 1;
+  fds[2] = 2;
+  if(spawn("nosuchfile", args, fds) >= 0){
+    printf(stdout, "spawn of a missing file succeeded\n");
+    exit();
+  }
+  fds[1] = NOFILE;
+  if(spawn("echo", args, fds) >= 0){
+    printf(stdout, "spawn with a bad fd succeeded\n");
+    exit();
+  }
+  for(big = 0; big <= SPBIG; big += SPBIG){
+    a = sbrk(big*4096);
+    for(i = 0; i < big; i++)
+      a[i*4096] = 1;
+    t0 = uptime();
+    for(r = 0; r < FEROUNDS; r++){
+      if(spawnecho() != 0){
+        printf(stdout, "spawn bench: bad output from echo\n");
+        exit();
+      }
+    }
+    printf(stdout, "spawn bench: %d ticks for %d spawns, %d extra pages\n",
+           uptime() - t0, FEROUNDS, big);
+    t0 = uptime();
+    for(r = 0; r < FEROUNDS; r++){
+      if(runecho("echo") != 0){
+        printf(stdout, "spawn bench: bad output from echo\n");
+        exit();
+      }
+    }
+    printf(stdout, "spawn bench: %d ticks for %d fork+execs, %d extra pages\n",
+           uptime() - t0, FEROUNDS, big);
+    sbrk(-big*4096);
+  }
+  printf(stdout, "spawn bench ok\n");
+}
+
+// Breaking copy-on-write sharing flushes just the written page
+// from the TLB with invlpg, not the whole TLB, and each side
+// still sees only its own writes.
+#define TLBPAGES 32
+
+void
+tlbtest(void)
+{
+  struct vmstat st0, st1;
+  char *a;
+  int i, pid;
+
+  printf(stdout, "tlb test\n");
+  a = sbrk(TLBPAGES*4096);
+  if(a == (char*)0xffffffff){
+    printf(stdout, "sbrk failed\n");
+    exit();
+  }
+  for(i = 0; i < TLBPAGES; i++)
+    a[i*4096] = 'p';
+  pid = fork();
+  if(pid < 0){
+    printf(stdout, "fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    for(i = 0; i < TLBPAGES; i++)
+      if(a[i*4096] != 'p'){
+        printf(stdout, "tlb test: child sees %c\n", a[i*4096]);
+        exit();
+      }
+    getvmstat(&st0);
+    for(i = 0; i < TLBPAGES; i++){
+      a[i*4096] = 'c';
+      if(a[i*4096] != 'c'){
+        printf(stdout, "tlb test: child lost its write\n");
+        exit();
+      }
+    }
+    getvmstat(&st1);
+    if(st1.tlbinvlpgs - st0.tlbinvlpgs < TLBPAGES){
+      printf(stdout, "tlb test: %d invlpgs for %d copies\n",
+             st1.tlbinvlpgs - st0.tlbinvlpgs, TLBPAGES);
+      exit();
+    }
+    exit();
+  }
+  wait();
+  for(i = 0; i < TLBPAGES; i++)
+    if(a[i*4096] != 'p'){
+      printf(stdout, "tlb test: parent sees %c\n", a[i*4096]);
+      exit();
+    }
+  sbrk(-TLBPAGES*4096);
+  printf(stdout, "tlb test ok\n");
+}
+
+// Repeat runs of a binary map its pages from the page cache
+// instead of reading them, and rewriting the binary drops them.
+void
+pcachetest(void)
+{
+  struct vmstat st0, st1;
+  char buf[512];
+  int in, out, n, r;
+
+  printf(stdout, "page cache test\n");
+  unlink("pcecho");
+  in = open("echo", 0);
+  out = open("pcecho", O_CREATE|O_RDWR);
+  if(in < 0 || out < 0){
+    printf(stdout, "page cache test: cannot copy echo\n");
+    exit();
+  }
+  while((n = read(in, buf, sizeof(buf))) > 0){
+    if(write(out, buf, n) != n){
+      printf(stdout, "page cache test: write failed\n");
+      exit();
+    }
+  }
+  close(in);
+
+  if(runecho("pcecho") != 0){
+    printf(stdout, "page cache test: pcecho failed\n");
+    exit();
+  }
+  getvmstat(&st0);
+  for(r = 0; r < 10; r++){
+    if(runecho("pcecho") != 0){
+      printf(stdout, "page cache test: pcecho failed\n");
+      exit();
+    }
+  }
+  getvmstat(&st1);
+  if(st1.filepages != st0.filepages || st1.fileshared == st0.fileshared){
+    printf(stdout, "page cache test: %d pages read, %d shared on repeat runs\n",
+           st1.filepages - st0.filepages, st1.fileshared - st0.fileshared);
+    exit();
+  }
+
+  // Write the first block back unchanged: the cached pages go.
+  close(out);
+  out = open("pcecho", O_RDWR);
+  if(out < 0 || (n = read(out, buf, sizeof(buf))) != sizeof(buf)){
+    printf(stdout, "page cache test: reread failed\n");
+    exit();
+  }
+  close(out);
+  out = open("pcecho", O_RDWR);
+  getvmstat(&st0);
+  if(write(out, buf, n) != n){
+    printf(stdout, "page cache test: rewrite failed\n");
+    exit();
+  }
+  close(out);
+  getvmstat(&st1);
+  if(st1.pcacheinvalidates == st0.pcacheinvalidates){
+    printf(stdout, "page cache test: rewrite kept cached pages\n");
+    exit();
+  }
+  if(runecho("pcecho") != 0){
+    printf(stdout, "page cache test: pcecho failed after rewrite\n");
+    exit();
+  }
+  unlink("pcecho");
+
+  // But not a binary that is running, such as this one.
+  out = open("/usertests", O_RDWR);
+  if(out < 0 || read(out, buf, sizeof(buf)) != sizeof(buf)){
+    printf(stdout, "page cache test: cannot read usertests\n");
+    exit();
+  }
+  if(write(out, buf, sizeof(buf)) >= 0){
+    printf(stdout, "page cache test: wrote to a running binary\n");
+    exit();
+  }
+  close(out);
+  printf(stdout, "page cache test ok\n");
+}
+
+// Children share the parent's pages copy-on-write, then write
+// them, fork and exit all at once, so that on a multiprocessor
+// (make qemu CPUS=8) copy-on-write breaks, fork and exit of
+// sharers of the same frames race in the reverse map.
+#define RSPROCS 8
+#define RSPAGES 64
+#define RSROUNDS 20
+
+void
+rmapstress(void)
+{
+  char *a;
+  int i, j, r, pid, gpid;
+
+  printf(stdout, "rmap stress test\n");
+  a = sbrk(RSPAGES*4096);
+  if(a == (char*)0xffffffff){
+    printf(stdout, "sbrk failed\n");
+    exit();
+  }
+  for(i = 0; i < RSPAGES; i++)
+    a[i*4096] = 'p';
+  for(j = 0; j < RSPROCS; j++){
+    pid = fork();
+    if(pid < 0){
+      printf(stdout, "fork failed\n");
+      exit();
+    }
+    if(pid > 0)
+      continue;
+    for(r = 0; r < RSROUNDS; r++){
+      for(i = 0; i < RSPAGES; i++){
+        if(a[i*4096] != (r == 0 ? 'p' : 'a' + j)){
+          printf(stdout, "rmap stress: child %d sees %c\n", j, a[i*4096]);
+          exit();
+        }
+      }
+      gpid = fork();
+      if(gpid < 0){
+        printf(stdout, "fork failed\n");
+        exit();
+      }
+      if(gpid == 0){
+        // Break half the pages, leave the rest to exit.
+        for(i = 0; i < RSPAGES; i += 2)
+          a[i*4096] = 'z';
+        exit();
+      }
+      for(i = 0; i < RSPAGES; i++)
+        a[i*4096] = 'a' + j;
+      wait();
+    }
+    exit();
+  }
+  for(j = 0; j < RSPROCS; j++)
+    wait();
+  for(i = 0; i < RSPAGES; i++){
+    if(a[i*4096] != 'p'){
+      printf(stdout, "rmap stress: parent sees %c\n", a[i*4096]);
+      exit();
+    }
+  }
+  sbrk(-RSPAGES*4096);
+  printf(stdout, "rmap stress test ok\n");
+}
+
+// How long a copy-on-write break takes as the number of processes
+// sharing the page grows.  Taking the writer out of the page's
+// reverse map should not cost more with more sharers.
+#define CBPAGES 512
+#define CBROUNDS 10
+
+void
+cowbench(void)
+{
+  char *a, c;
+  int i, j, n, r, fds[2], pid;
+  uint t, ticks;
+
+  printf(stdout, "cow break benchmark\n");
+  a = sbrk(CBPAGES*4096);
+  if(a == (char*)0xffffffff){
+    printf(stdout, "sbrk failed\n");
+    exit();
+  }
+  for(i = 0; i < CBPAGES; i++)
+    a[i*4096] = 'c';
+  for(n = 2; n <= 32; n *= 2){
+    ticks = 0;
+    for(r = 0; r < CBROUNDS; r++){
+      if(pipe(fds) != 0){
+        printf(stdout, "pipe() failed\n");
+        exit();
+      }
+      for(j = 1; j < n; j++){
+        pid = fork();
+        if(pid < 0){
+          printf(stdout, "fork failed\n");
+          exit();
+        }
+        if(pid == 0){
+          // Keep the pages shared until the parent is done.
+          close(fds[1]);
+          read(fds[0], &c, 1);
+          exit();
+        }
+      }
+      close(fds[0]);
+      t = uptime();
+      for(i = 0; i < CBPAGES; i++)
+        a[i*4096] = 'a' + r;
+      ticks += uptime() - t;
+      close(fds[1]);
+      for(j = 1; j < n; j++)
+        wait();
+    }
+    printf(stdout, "%d sharers: %d ticks for %d cow breaks\n", n, ticks, CBPAGES*CBROUNDS);
+  }
+  sbrk(-CBPAGES*4096);
+  printf(stdout, "cow break benchmark ok\n");
+}
+
 // More file system tests
 
 // two processes write to the same file descriptor
@@ -1780,6 +2980,28 @@ main(int argc, char *argv[])
   iputtest();
 
   mem();
+  allocbench();
+  buddytest();
+  swapbench();
+  swapseqbench();
+  kswapdtest();
+  wsbench();
+  swapfulltest();
+  swapcachetest();
+  readaheadbench();
+  clusterbench();
+  zswapbench();
+  zeropagetest();
+  sbrklatency();
+  execbench();
+  pcachetest();
+  rmapstress();
+  cowbench();
+  forkexecbench();
+  sparseforkbench();
+  ptsharetest();
+  spawnbench();
+  tlbtest();
   pipe1();
   preempt();
   exitwait();
@@ -6,6 +6,7 @@
 #include "mmu.h"
 #include "proc.h"
 #include "elf.h"
+#include "vmstat.h"
 
 extern char data[];  // defined by kernel.ld
 pde_t *kpgdir;  // for use in scheduler()
@@ -47,8 +48,15 @@ walkpgdir(pde_t *pgdir, const void *va, int alloc)
   } else {
     if(!alloc || (pgtab = (pte_t*)kalloc()) == ZERO)
       return ZERO;
+    // User page tables get back-pointers for the reverse map.
+    if((uint)va < KERNBASE && pt_shadow_alloc(pgtab, (uint)va) < 0){
+      kfree((char*)pgtab);
+      return ZERO;
+    }
     // Make sure all those PTE_P bits are zero.
     memset(pgtab, 0, PGSIZE);
+    // The page table belongs to whoever owns the directory.
+    set_pt_owner(pgtab, pt_owner(pgdir));
     // The permissions here are overly generous, but they can
     // be further restricted by the permissions in the page table
     // entries, if necessary.
@@ -139,13 +147,44 @@ mappages(pde_t *pgdir, void *va, uint size, uint pa, int perm, int var1 , int va
 //   KERNBASE..KERNBASE+EXTMEM: mapped to 0..EXTMEM (for I/O space)
 //   KERNBASE+EXTMEM..data: mapped to EXTMEM..V2P(data)
 //                for the kernel's instructions and r/o data
-//   data..KERNBASE+PHYSTOP: mapped to V2P(data)..PHYSTOP,
+//   data..KERNBASE+phystop: mapped to V2P(data)..phystop,
 //                                  rw data + free physical memory
 //   0xfe000000..0: mapped direct (devices such as ioapic)
 //
 // The kernel allocates physical memory for its heap and for user memory
-// between V2P(end) and the end of physical memory (PHYSTOP)
-// (directly addressable from end..P2V(PHYSTOP)).
+// between V2P(end) and the end of physical memory (phystop, which
+// meminit() finds, up to PHYSTOP)
+// (directly addressable from end..P2V(phystop)).
+
+#define BIGPGSIZE (PGSIZE*NPTENTRIES)   // bytes mapped by a PTE_PS entry
+
+// Like mappages(), for the kernel's part of the address space:
+// every 4MB-aligned stretch is mapped by one PTE_PS entry in the
+// page directory itself, and only the ends by page tables.
+static int
+kmappages(pde_t *pgdir, char *va, uint size, uint pa, int perm)
+{
+  uint n;
+
+  while(size > 0){
+    if((uint)va % BIGPGSIZE == 0 && pa % BIGPGSIZE == 0 && size >= BIGPGSIZE){
+      if(pgdir[PDX(va)] & PTE_P)
+        panic("remap");
+      pgdir[PDX(va)] = pa | perm | PTE_P | PTE_PS;
+      n = BIGPGSIZE;
+    } else {
+      n = BIGPGSIZE - (uint)va % BIGPGSIZE;
+      if(n > size)
+        n = size;
+      if(mappages(pgdir, va, n, pa, perm, ZERO, ZERO) < 0)
+        return -1;
+    }
+    va += n;
+    pa += n;
+    size -= n;
+  }
+  return 0;
+}
 
 // This table defines the kernel's mappings, which are present in
 // every process's page table.
@@ -161,33 +200,46 @@ static struct kmap {
  { (void*)DEVSPACE, DEVSPACE,      0,         PTE_W}, // more devices
 };
 
-// Set up kernel part of a page table.
+// Set up kernel part of a page table.  The kernel's page
+// tables are built once, in kpgdir, and every page directory
+// points at the same ones, so this only copies kpgdir's entries
+// for KERNBASE and up.  freevm() frees just the user half.
 pde_t*
 setupkvm(void)
 {
   pde_t *pgdir;
-  struct kmap *k;
 
   if((pgdir = (pde_t*)kalloc()) == ZERO)
     return ZERO;
-  memset(pgdir, 0, PGSIZE);
-  if (P2V(PHYSTOP) > (void*)DEVSPACE)
-    panic("PHYSTOP too high");
-  for(k = kmap; k < &kmap[NELEM(kmap)]; k++)
-    if(mappages(pgdir, k->virt, k->phys_end - k->phys_start,
-                (uint)k->phys_start, k->perm, ZERO, ZERO) < 0) {
-      freevm(pgdir);
-      return ZERO;
-    }
+  memset(pgdir, 0, PDX(KERNBASE) * sizeof(pde_t));
+  memmove(&pgdir[PDX(KERNBASE)], &kpgdir[PDX(KERNBASE)],
+          (NPDENTRIES - PDX(KERNBASE)) * sizeof(pde_t));
+  set_pt_owner(pgdir, ZERO);
   return pgdir;
 }
 
 // Allocate one page table for the machine for the kernel address
-// space for scheduler processes.
+// space for scheduler processes, and build the kernel mappings
+// that setupkvm() shares with every process.
 void
 kvmalloc(void)
 {
-  kpgdir = setupkvm();
+  struct kmap *k;
+  uint pend;
+
+  if((kpgdir = (pde_t*)kalloc()) == ZERO)
+    panic("kvmalloc");
+  memset(kpgdir, 0, PGSIZE);
+  set_pt_owner(kpgdir, ZERO);
+  if (P2V(PHYSTOP) > (void*)DEVSPACE)
+    panic("PHYSTOP too high");
+  for(k = kmap; k < &kmap[NELEM(kmap)]; k++){
+    // Map memory only as far as there is some.
+    pend = k->phys_end == PHYSTOP ? phystop : k->phys_end;
+    if(kmappages(kpgdir, k->virt, pend - k->phys_start,
+                 (uint)k->phys_start, k->perm) < 0)
+      panic("kvmalloc");
+  }
   switchkvm();
 }
 
@@ -239,32 +291,9 @@ inituvm(pde_t *pgdir, char *init, uint sz)
   memmove(mem, init, sz);
 }
 
-// Load a program segment into pgdir.  addr must be page-aligned
-// and the pages from addr to addr+sz must already be mapped.
-int
-loaduvm(pde_t *pgdir, char *addr, struct inode *ip, uint offset, uint sz)
-{
-  uint i, pa, n;
-  pte_t *pte;
-
-  if((uint) addr % PGSIZE != 0)
-    panic("loaduvm: addr must be page aligned");
-  for(i = 0; i < sz; i += PGSIZE){
-    if((pte = walkpgdir(pgdir, addr+i, 0)) == ZERO)
-      panic("loaduvm: address should exist");
-    pa = PTE_ADDR(*pte);
-    if(sz - i < PGSIZE)
-      n = sz - i;
-    else
-      n = PGSIZE;
-    if(readi(ip, P2V(pa), offset+i, n) != n)
-      return -1;
-  }
-  return ZERO;
-}
-
 // Allocate page tables and physical memory to grow process from oldsz to
 // newsz, which need not be page aligned.  Returns new size or 0 on error.
+// The caller counts the pages in the process's RSS.
 int
 allocuvm(pde_t *pgdir, uint oldsz, uint newsz)
 {
@@ -285,19 +314,52 @@ allocuvm(pde_t *pgdir, uint oldsz, uint newsz)
       return ZERO;
     }
     memset(mem, 0, PGSIZE);
-    if(mappages(pgdir, (char*)a, PGSIZE, V2P(mem), PTE_W|PTE_U,1,1) < 0){
+    // Start out referenced, so CLOCK passes over it once.
+    if(mappages(pgdir, (char*)a, PGSIZE, V2P(mem), PTE_W|PTE_U|PTE_A,1,1) < 0){
       cprintf("allocuvm out of memory (2)\n");
       deallocuvm(pgdir, newsz, oldsz);
       kfree(mem);
       return ZERO;
     }
-    // cprintf("Old value of rss: %d\n", myproc()->rss);
-    myproc()->rss += PGSIZE; 
-    // cprintf("New value of rss: %d\n", myproc()->rss);
   }
   return newsz;
 }
 
+// Unmap whatever the user PTE at pte maps, freeing the page if
+// nothing else maps it, and take it off p's RSS if p is not 0.
+// Returns -1 if kswapd moved the page since the caller looked:
+// look again.
+static int
+freepte(pte_t *pte, struct proc *p)
+{
+  uint pa;
+  int left;
+
+  if((*pte & PTE_P) != 0){
+    pa = PTE_ADDR(*pte);
+    if(pa == ZERO)
+      panic("kfree");
+    if(is_zeropage(pa)){
+      zeropage_ref(-1);
+      *pte = ZERO;
+      return 0;
+    }
+    if((left = dec_rmap(pte)) < 0)
+      return -1;
+    if(left == 0)
+      kfree(P2V(pa));
+    if(p)
+      p->rss -= PGSIZE;
+    *pte = ZERO;
+  } else if(*pte & PTE_SWAPPED){
+    // -1 if swapped back in by another sharer.
+    if(flush(pte) < 0)
+      return -1;
+    *pte = ZERO;
+  }
+  return 0;
+}
+
 // Deallocate user pages to bring the process size from oldsz to
 // newsz.  oldsz and newsz need not be page-aligned, nor does newsz
 // need to be less than oldsz.  oldsz can be larger than the actual
@@ -305,94 +367,69 @@ allocuvm(pde_t *pgdir, uint oldsz, uint newsz)
 int
 deallocuvm(pde_t *pgdir, uint oldsz, uint newsz)
 {
-  pte_t *pte;
-  uint a, pa;
+  return deallocuvm_proc(myproc(), pgdir, oldsz, newsz);
+}
 
-  if(newsz >= oldsz)
-    return oldsz;
+// Before [newsz, oldsz) is unmapped, let go of the page tables
+// the range covers that fork() left shared, and split the one it
+// may cover only in part.  Returns -1 if there is no memory for
+// the split.
+static int
+unsharerange(struct proc *p, pde_t *pgdir, uint oldsz, uint newsz)
+{
+  pde_t *pde;
+  uint a;
 
-  a = PGROUNDUP(newsz);
-  for(; a  < oldsz; a += PGSIZE){
-    pte = walkpgdir(pgdir, (char*)a, 0);
-    if(!pte)
-      a = PGADDR(PDX(a) + ONE, ZERO, ZERO) - PGSIZE;
-    else if((*pte & PTE_P) != 0){
-      pa = PTE_ADDR(*pte);
-      if(pa == ZERO)
-        panic("kfree");
-      char *v = P2V(pa);
-      dec_rmap(pte);
-      kfree(v);
-      // if(myproc()->rss > 0){
-      myproc()->rss -= PGSIZE;
-      // }
-      *pte = ZERO;
-    }
-    else{
-      if(*pte & PTE_SWAPPED){
-        flush(pte);
-        *pte = ZERO;
-      }
-    }
+  for(a = PGROUNDUP(newsz); a < oldsz; a = PGADDR(PDX(a) + 1, 0, 0)){
+    pde = &pgdir[PDX(a)];
+    if(!(*pde & PTE_P) || (*pde & PTE_W))
+      continue;
+    if(a % BIGPGSIZE == 0){
+      // Nothing is mapped past oldsz, so the range covers all
+      // the table maps.  If p was its last user it stays, is
+      // p's with the pages in it, and is emptied below like any
+      // other; otherwise p's RSS never counted them.
+      if(pt_unshare(P2V(PTE_ADDR(*pde))))
+        *pde = 0;
+      else
+        pt_claim(P2V(PTE_ADDR(*pde)), p);
+    } else if(ptsplit(pgdir, a, p) < 0)
+      return -1;
   }
-  return newsz;
+  return 0;
 }
 
 int
 deallocuvm_proc(struct proc* p,pde_t *pgdir, uint oldsz, uint newsz)
 {
   pte_t *pte;
-  uint a, pa;
+  uint a;
 
   if(newsz >= oldsz)
     return oldsz;
+  if(unsharerange(p, pgdir, oldsz, newsz) < 0)
+    return 0;
 
   a = PGROUNDUP(newsz);
   for(; a  < oldsz; a += PGSIZE){
     pte = walkpgdir(pgdir, (char*)a, 0);
     if(!pte)
       a = PGADDR(PDX(a) + ONE, ZERO, ZERO) - PGSIZE;
-    else if((*pte & PTE_P) != 0){
-      pa = PTE_ADDR(*pte);
-      if(pa == ZERO)
-        panic("kfree");
-      char *v = P2V(pa);
-      dec_rmap(pte);
-      kfree(v);
-      // if(myproc()->rss > 0){
-      p->rss -= PGSIZE;
-      // }
-      *pte = ZERO;
-    }
-    else{
-      if(*pte & PTE_SWAPPED){
-        flush(pte);
-        *pte = ZERO;
-      }
-    }
+    else if(freepte(pte, p) < 0)
+      // kswapd took the page since we looked: look again.
+      a -= PGSIZE;
   }
   return newsz;
 }
 // Free a page table and all the physical memory pages
-// in the user part.
+// in the user part.  The kernel part belongs to kpgdir.
 void
 freevm(pde_t *pgdir)
 {
-  uint i;
-
-  if(pgdir == ZERO)
-    panic("freevm: no pgdir");
-  deallocuvm(pgdir, KERNBASE, 0);
-  for(i = 0; i < NPDENTRIES; i++){
-    if(pgdir[i] & PTE_P){
-      char * v = P2V(PTE_ADDR(pgdir[i]));
-      kfree(v);
-    }
-  }
-  kfree((char*)pgdir);
+  freevm_proc(myproc(), pgdir);
 }
 
-
+// freevm() for pgdir, whose pages count towards p's RSS.
 void
 freevm_proc(struct proc* p, pde_t *pgdir)
 {
@@ -401,9 +438,10 @@ freevm_proc(struct proc* p, pde_t *pgdir)
   if(pgdir == ZERO)
     panic("freevm: no pgdir");
   deallocuvm_proc(p,pgdir, KERNBASE, 0);
-  for(i = 0; i < NPDENTRIES; i++){
+  for(i = 0; i < PDX(KERNBASE); i++){
     if(pgdir[i] & PTE_P){
       char * v = P2V(PTE_ADDR(pgdir[i]));
+      pt_shadow_free(v);
       kfree(v);
     }
   }
@@ -422,81 +460,142 @@ clearpteu(pde_t *pgdir, char *uva)
   *pte &= ~PTE_U;
 }
 
+// Page tables are shared on fork.  copyuvm() points the child's
+// page directory at the parent's page tables and clears PTE_W in
+// both directories' entries for them, so fork() costs one entry
+// per 4MB whatever the size of the process.  Any fault through a
+// shared table first calls ptsplit(), which gives the process a
+// copy of the table whose pages are shared copy-on-write, or
+// just makes the entry writable again once no one else uses the
+// table.  So a child that execs or exits at once never copies a
+// page table, and the parent then keeps its own.
+static struct {
+  uint shares;
+  uint splits;
+  uint reuses;
+} ptstat;
+
+// Copy the user PTE at pte into npte, sharing the page.
+// Returns -1 if kswapd moved the page since the caller looked,
+// or -2 if the reverse map had no room for npte.
+static int
+copypte(pte_t *pte, pte_t *npte)
+{
+  if(*pte == ZERO)
+    return 0;
+  if(!(*pte & PTE_P) && (*pte & PTE_SWAPPED)){
+    *pte &= ~PTE_W;
+    *npte = *pte;
+    if(inc_swap_table(pte, npte, ZERO) < 0){
+      // Swapped back in by another sharer since we looked.
+      *npte = ZERO;
+      return -1;
+    }
+    return 0;
+  }
+  if(!(*pte & PTE_P))
+    panic("copypte: page not present");
+  if(is_zeropage(PTE_ADDR(*pte))){
+    // Shared already, and not counted in anyone's RSS.
+    *npte = *pte;
+    zeropage_ref(1);
+    return 0;
+  }
+  // -1 if swapped out since we looked, -2 if out of rmap nodes.
+  return share_rmap(pte, npte);
+}
+
+// Give p a page table of its own for va, whose page table fork()
+// left shared.  The pages p now maps privately count towards its
+// RSS.  Returns 0, or -1 if there is no memory.
+int
+ptsplit(pde_t *pgdir, uint va, struct proc *p)
+{
+  pde_t *pde;
+  pte_t *pt, *npt;
+  int i, j, r, n;
+
+  pde = &pgdir[PDX(va)];
+  pt = (pte_t*)P2V(PTE_ADDR(*pde));
+  if(!pt_shared(pt)){
+    // The others have gone: the table is p's alone.
+    *pde |= PTE_W;
+    pt_claim(pt, p);
+    ptstat.reuses++;
+  } else {
+    if((npt = (pte_t*)kalloc()) == ZERO)
+      return -1;
+    if(pt_shadow_alloc(npt, va) < 0){
+      kfree((char*)npt);
+      return -1;
+    }
+    memset(npt, 0, PGSIZE);
+    set_pt_owner(npt, p);
+    n = 0;
+    for(j = 0; j < NPTENTRIES; j++){
+      if((r = copypte(&pt[j], &npt[j])) == -1)
+        j--;
+      else if(r < 0){
+        // Out of rmap nodes: undo the copies made so far.
+        for(i = 0; i < j; i++)
+          if(freepte(&npt[i], ZERO) < 0)
+            i--;
+        pt_shadow_free(npt);
+        kfree((char*)npt);
+        return -1;
+      } else if((npt[j] & PTE_P) && !is_zeropage(PTE_ADDR(npt[j])))
+        n++;
+    }
+    if(p)
+      p->rss += n * PGSIZE;
+    if(!pt_unshare(pt)){
+      // The others went while we copied: drop the old table.
+      pt_claim(pt, 0);
+      for(j = 0; j < NPTENTRIES; j++)
+        if(freepte(&pt[j], ZERO) < 0)
+          j--;
+      pt_shadow_free(pt);
+      kfree((char*)pt);
+    }
+    *pde = V2P(npt) | PTE_P | PTE_W | PTE_U;
+    ptstat.splits++;
+  }
+  if(myproc() && pgdir == myproc()->pgdir)
+    lcr3(V2P(pgdir));
+  return 0;
+}
+
 // Given a parent process's page table, create a copy
-// of it for a child.
+// of it for a child, sharing the parent's page tables.
 pde_t*
 copyuvm(pde_t *pgdir, uint sz, struct proc* p)
 {
   pde_t *d;
-  pte_t *pte;
-  uint pa, i, flags;
-  // char *mem;
+  uint di;
 
   if((d = setupkvm()) == ZERO)
     return ZERO;
-  for(i = 0; i < sz; i += PGSIZE){
-   
-    if((pte = walkpgdir(pgdir, (void *) i, ZERO)) == ZERO)
-      panic("copyuvm: pte should exist");
-    if(!(*pte & PTE_P) && (*pte & PTE_SWAPPED)){
-        // Need to map the page 
-        // cprintf("Swapped page found\n");
-        pa = PTE_ADDR(*pte);
-        flags = PTE_FLAGS(*pte);
-        *pte &= ~PTE_W;
-        flags &= ~PTE_W;
-        // cprintf ("Page %x\n", pa);
-        if(mappages(d, (void*)i, PGSIZE, pa , flags,2,2) < 0) {
-          goto bad;
-        }
-        pte_t* baccha = walkpgdir(d, (void*)i, ZERO);
-        // *baccha |= PTE_SWAPPED;
-        inc_swap_table(pte,baccha,ZERO);
-    }
-    else if(!(*pte & PTE_P) && !(*pte & PTE_SWAPPED))
-      panic("copyuvm: page not present");
-    else{
-    p->rss += PGSIZE;
-    *pte &= ~PTE_W;
-    pa = PTE_ADDR(*pte);
-    flags = PTE_FLAGS(*pte);
-    // if((mem = kalloc()) == ZERO)
-      // goto bad;
-    // memmove(mem, (char*)P2V(pa), PGSIZE);
-    if(mappages(d, (void*)i, PGSIZE, pa , flags,1,1) < 0) {
-      // kfree(mem);
-      goto bad;
-    }
-    }
-  lcr3(V2P(pgdir));
+  for(di = 0; di < PDX(KERNBASE) && PGADDR(di, 0, 0) < sz; di++){
+    if(!(pgdir[di] & PTE_P))
+      continue;
+    pt_share(P2V(PTE_ADDR(pgdir[di])));
+    pgdir[di] &= ~PTE_W;
+    d[di] = pgdir[di];
+    ptstat.shares++;
   }
+  // The parent's entries lost PTE_W: one flush covers them all.
+  lcr3(V2P(pgdir));
+  set_pt_owner(d, p);
   return d;
-
-bad:
-  freevm(d);
-  return ZERO;
 }
 
-// void zombie_kill(pde_t* pgdir){
-  // return;
-  // for(int i = 0; i < NPDENTRIES; i++)
-  //       {
-  //         if(pgdir[i] & PTE_P)
-  //         {
-  //           pte_t* pte = (pte_t*)P2V(PTE_ADDR(pgdir[i]));
-  //           for(int j = 0; j < NPTENTRIES; j++)
-  //           {
-  //             if(!(pte[j] & PTE_P) && (pte[j] & PTE_SWAPPED))
-  //             {
-  //               clear_swap_slot(&pte[j]);
-  //               pte[j] = 0;
-  //               // cprintf("Freeing swap slot %d\n", swap_slot_no);
-  //             }
-  //           }
-  //         }
-  //       }
-// }
-
+void
+ptsharestat(struct vmstat *st)
+{
+  st->ptshares = ptstat.shares;
+  st->ptsplits = ptstat.splits;
+  st->ptreuses = ptstat.reuses;
+}
 
 //PAGEBREAK!
 // Map user virtual address to kernel address.
@@ -505,7 +604,9 @@ uva2ka(pde_t *pgdir, char *uva)
 {
   pte_t *pte;
 
-  pte = walkpgdir(pgdir, uva, 0);
+  // sbrk() reserves address space without page tables.
+  if((pte = walkpgdir(pgdir, uva, 0)) == ZERO)
+    return ZERO;
   if((*pte & PTE_P) == ZERO)
     return ZERO;
   if((*pte & PTE_U) == ZERO)
@@ -539,6 +640,32 @@ copyout(pde_t *pgdir, uint va, void *p, uint len)
   return ZERO;
 }
 
+// Copy n bytes from src to dst, either of which may be a user
+// address, checked against the size of the current process, that
+// is not mapped yet.  System calls touch user memory only through
+// here: if the page fault cannot bring a page in, trap() resumes
+// at copyuser_fault and this returns -1 instead of panicking.
+// Returns 0 otherwise.  Not to be called holding a spinlock.
+int
+copyuser(void *dst, void *src, uint n)
+{
+  int r;
+
+  asm volatile(".globl copyuser_insn\n"
+               "copyuser_insn:\n"
+               "  rep movsb\n"
+               "  xorl %0, %0\n"
+               "  jmp 1f\n"
+               ".globl copyuser_fault\n"
+               "copyuser_fault:\n"
+               "  movl $-1, %0\n"
+               "1:\n"
+               : "=a" (r), "+D" (dst), "+S" (src), "+c" (n)
+               :
+               : "memory", "cc");
+  return r;
+}
+
 //PAGEBREAK!
 // Blank page.
 //PAGEBREAK!
@@ -0,0 +1,1436 @@
+
+_vmstat:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+         st.tlbinvlpgs, st.tlbfulls, st.tlbipis, st.tlbdeferred);
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+  int interval, count;
+
+  interval = 0;
+   f:	31 f6                	xor    %esi,%esi
+{
+  11:	53                   	push   %ebx
+  count = 1;
+  12:	bb 01 00 00 00       	mov    $0x1,%ebx
+{
+  17:	51                   	push   %ecx
+  18:	83 ec 18             	sub    $0x18,%esp
+  1b:	8b 39                	mov    (%ecx),%edi
+  1d:	8b 51 04             	mov    0x4(%ecx),%edx
+  if(argc > 1){
+  20:	83 ff 01             	cmp    $0x1,%edi
+  23:	7f 46                	jg     6b <main+0x6b>
+  }
+  if(argc > 2)
+    count = atoi(argv[2]);
+
+  while(count != 0){
+    vmstat();
+  25:	e8 86 00 00 00       	call   b0 <vmstat>
+    if(count > 0)
+  2a:	85 db                	test   %ebx,%ebx
+  2c:	7f 33                	jg     61 <main+0x61>
+      count--;
+    if(count != 0)
+      sleep(interval);
+  2e:	83 ec 0c             	sub    $0xc,%esp
+  31:	56                   	push   %esi
+  32:	e8 0c 06 00 00       	call   643 <sleep>
+  37:	83 c4 10             	add    $0x10,%esp
+    vmstat();
+  3a:	e8 71 00 00 00       	call   b0 <vmstat>
+    if(count > 0)
+  3f:	85 db                	test   %ebx,%ebx
+  41:	7e eb                	jle    2e <main+0x2e>
+    if(count != 0)
+  43:	83 eb 01             	sub    $0x1,%ebx
+  46:	74 1e                	je     66 <main+0x66>
+  48:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  4f:	90                   	nop
+      sleep(interval);
+  50:	83 ec 0c             	sub    $0xc,%esp
+  53:	56                   	push   %esi
+  54:	e8 ea 05 00 00       	call   643 <sleep>
+    vmstat();
+  59:	e8 52 00 00 00       	call   b0 <vmstat>
+  5e:	83 c4 10             	add    $0x10,%esp
+    if(count != 0)
+  61:	83 eb 01             	sub    $0x1,%ebx
+  64:	75 ea                	jne    50 <main+0x50>
+  }
+  exit();
+  66:	e8 48 05 00 00       	call   5b3 <exit>
+    interval = atoi(argv[1]);
+  6b:	83 ec 0c             	sub    $0xc,%esp
+  6e:	ff 72 04             	push   0x4(%edx)
+  71:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  74:	e8 c7 04 00 00       	call   540 <atoi>
+  if(argc > 2)
+  79:	83 c4 10             	add    $0x10,%esp
+    interval = atoi(argv[1]);
+  7c:	89 c6                	mov    %eax,%esi
+  if(argc > 2)
+  7e:	83 ff 02             	cmp    $0x2,%edi
+  81:	74 19                	je     9c <main+0x9c>
+    count = atoi(argv[2]);
+  83:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  86:	83 ec 0c             	sub    $0xc,%esp
+  89:	ff 72 08             	push   0x8(%edx)
+  8c:	e8 af 04 00 00       	call   540 <atoi>
+  while(count != 0){
+  91:	83 c4 10             	add    $0x10,%esp
+    count = atoi(argv[2]);
+  94:	89 c3                	mov    %eax,%ebx
+  while(count != 0){
+  96:	85 c0                	test   %eax,%eax
+  98:	75 8b                	jne    25 <main+0x25>
+  9a:	eb ca                	jmp    66 <main+0x66>
+    count = -1;
+  9c:	83 cb ff             	or     $0xffffffff,%ebx
+  9f:	eb 84                	jmp    25 <main+0x25>
+  a1:	66 90                	xchg   %ax,%ax
+  a3:	66 90                	xchg   %ax,%ax
+  a5:	66 90                	xchg   %ax,%ax
+  a7:	66 90                	xchg   %ax,%ax
+  a9:	66 90                	xchg   %ax,%ax
+  ab:	66 90                	xchg   %ax,%ax
+  ad:	66 90                	xchg   %ax,%ax
+  af:	90                   	nop
+
+000000b0 <vmstat>:
+{
+  b0:	55                   	push   %ebp
+  b1:	89 e5                	mov    %esp,%ebp
+  b3:	56                   	push   %esi
+  b4:	53                   	push   %ebx
+  if(getvmstat(&st) < 0){
+  b5:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+{
+  bb:	81 ec 1c 01 00 00    	sub    $0x11c,%esp
+  if(getvmstat(&st) < 0){
+  c1:	50                   	push   %eax
+  c2:	e8 9c 05 00 00       	call   663 <getvmstat>
+  c7:	83 c4 10             	add    $0x10,%esp
+  ca:	85 c0                	test   %eax,%eax
+  cc:	0f 88 88 02 00 00    	js     35a <vmstat+0x2aa>
+  printf(1, "free %d cached %d\n", st.freepages, st.cachedpages);
+  d2:	ff b5 f4 fe ff ff    	push   -0x10c(%ebp)
+  d8:	8d 9d f8 fe ff ff    	lea    -0x108(%ebp),%ebx
+  de:	8d b5 24 ff ff ff    	lea    -0xdc(%ebp),%esi
+  e4:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  ea:	68 62 0a 00 00       	push   $0xa62
+  ef:	6a 01                	push   $0x1
+  f1:	e8 2a 06 00 00       	call   720 <printf>
+  printf(1, "buddy");
+  f6:	58                   	pop    %eax
+  f7:	5a                   	pop    %edx
+  f8:	68 75 0a 00 00       	push   $0xa75
+  fd:	6a 01                	push   $0x1
+  ff:	e8 1c 06 00 00       	call   720 <printf>
+  for(k = 0; k <= VM_MAXORDER; k++)
+ 104:	83 c4 10             	add    $0x10,%esp
+ 107:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 10e:	66 90                	xchg   %ax,%ax
+    printf(1, " %d", st.buddyfree[k]);
+ 110:	83 ec 04             	sub    $0x4,%esp
+ 113:	ff 33                	push   (%ebx)
+  for(k = 0; k <= VM_MAXORDER; k++)
+ 115:	83 c3 04             	add    $0x4,%ebx
+    printf(1, " %d", st.buddyfree[k]);
+ 118:	68 7b 0a 00 00       	push   $0xa7b
+ 11d:	6a 01                	push   $0x1
+ 11f:	e8 fc 05 00 00       	call   720 <printf>
+  for(k = 0; k <= VM_MAXORDER; k++)
+ 124:	83 c4 10             	add    $0x10,%esp
+ 127:	39 f3                	cmp    %esi,%ebx
+ 129:	75 e5                	jne    110 <vmstat+0x60>
+  printf(1, "\n");
+ 12b:	83 ec 08             	sub    $0x8,%esp
+ 12e:	68 73 0a 00 00       	push   $0xa73
+ 133:	6a 01                	push   $0x1
+ 135:	e8 e6 05 00 00       	call   720 <printf>
+  printf(1, "swapouts %d swapins %d\n", st.swapouts, st.swapins);
+ 13a:	ff b5 28 ff ff ff    	push   -0xd8(%ebp)
+ 140:	ff b5 24 ff ff ff    	push   -0xdc(%ebp)
+ 146:	68 7f 0a 00 00       	push   $0xa7f
+ 14b:	6a 01                	push   $0x1
+ 14d:	e8 ce 05 00 00       	call   720 <printf>
+  printf(1, "kswapd wm %d/%d wakeups %d outs %d direct %d\n",
+ 152:	83 c4 1c             	add    $0x1c,%esp
+ 155:	ff b5 3c ff ff ff    	push   -0xc4(%ebp)
+ 15b:	ff b5 38 ff ff ff    	push   -0xc8(%ebp)
+ 161:	ff b5 34 ff ff ff    	push   -0xcc(%ebp)
+ 167:	ff b5 30 ff ff ff    	push   -0xd0(%ebp)
+ 16d:	ff b5 2c ff ff ff    	push   -0xd4(%ebp)
+ 173:	68 c0 0a 00 00       	push   $0xac0
+ 178:	6a 01                	push   $0x1
+ 17a:	e8 a1 05 00 00       	call   720 <printf>
+  printf(1, "pgfaults %d clock scanned %d cleared %d\n",
+ 17f:	83 c4 14             	add    $0x14,%esp
+ 182:	ff b5 48 ff ff ff    	push   -0xb8(%ebp)
+ 188:	ff b5 44 ff ff ff    	push   -0xbc(%ebp)
+ 18e:	ff b5 40 ff ff ff    	push   -0xc0(%ebp)
+ 194:	68 f0 0a 00 00       	push   $0xaf0
+ 199:	6a 01                	push   $0x1
+ 19b:	e8 80 05 00 00       	call   720 <printf>
+  printf(1, "swap free %d/%d oom %d\n", st.swapfree, st.swapslots, st.oomfails);
+ 1a0:	83 c4 14             	add    $0x14,%esp
+ 1a3:	ff b5 54 ff ff ff    	push   -0xac(%ebp)
+ 1a9:	ff b5 4c ff ff ff    	push   -0xb4(%ebp)
+ 1af:	ff b5 50 ff ff ff    	push   -0xb0(%ebp)
+ 1b5:	68 97 0a 00 00       	push   $0xa97
+ 1ba:	6a 01                	push   $0x1
+ 1bc:	e8 5f 05 00 00       	call   720 <printf>
+  printf(1, "swapcache %d clean drops %d read waits %d\n",
+ 1c1:	83 c4 14             	add    $0x14,%esp
+ 1c4:	ff b5 60 ff ff ff    	push   -0xa0(%ebp)
+ 1ca:	ff b5 5c ff ff ff    	push   -0xa4(%ebp)
+ 1d0:	ff b5 58 ff ff ff    	push   -0xa8(%ebp)
+ 1d6:	68 1c 0b 00 00       	push   $0xb1c
+ 1db:	6a 01                	push   $0x1
+ 1dd:	e8 3e 05 00 00       	call   720 <printf>
+  printf(1, "readahead window %d pages %d hits %d misses %d\n",
+ 1e2:	83 c4 18             	add    $0x18,%esp
+ 1e5:	ff b5 70 ff ff ff    	push   -0x90(%ebp)
+ 1eb:	ff b5 6c ff ff ff    	push   -0x94(%ebp)
+ 1f1:	ff b5 68 ff ff ff    	push   -0x98(%ebp)
+ 1f7:	ff b5 64 ff ff ff    	push   -0x9c(%ebp)
+ 1fd:	68 48 0b 00 00       	push   $0xb48
+ 202:	6a 01                	push   $0x1
+ 204:	e8 17 05 00 00       	call   720 <printf>
+  printf(1, "cluster size %d clusters %d pages %d\n",
+ 209:	83 c4 14             	add    $0x14,%esp
+ 20c:	ff b5 7c ff ff ff    	push   -0x84(%ebp)
+ 212:	ff b5 78 ff ff ff    	push   -0x88(%ebp)
+ 218:	ff b5 74 ff ff ff    	push   -0x8c(%ebp)
+ 21e:	68 78 0b 00 00       	push   $0xb78
+ 223:	6a 01                	push   $0x1
+ 225:	e8 f6 04 00 00       	call   720 <printf>
+  printf(1, "zswap pool %d pages, %d stored in %d bytes",
+ 22a:	83 c4 14             	add    $0x14,%esp
+ 22d:	ff 75 88             	push   -0x78(%ebp)
+ 230:	ff 75 84             	push   -0x7c(%ebp)
+ 233:	ff 75 80             	push   -0x80(%ebp)
+ 236:	68 a0 0b 00 00       	push   $0xba0
+ 23b:	6a 01                	push   $0x1
+ 23d:	e8 de 04 00 00       	call   720 <printf>
+  if(st.zswapbytes > 0)
+ 242:	8b 4d 88             	mov    -0x78(%ebp),%ecx
+ 245:	83 c4 20             	add    $0x20,%esp
+ 248:	85 c9                	test   %ecx,%ecx
+ 24a:	0f 85 e8 00 00 00    	jne    338 <vmstat+0x288>
+  printf(1, "\n");
+ 250:	83 ec 08             	sub    $0x8,%esp
+ 253:	68 73 0a 00 00       	push   $0xa73
+ 258:	6a 01                	push   $0x1
+ 25a:	e8 c1 04 00 00       	call   720 <printf>
+  printf(1, "zswap hits %d/%d swap-ins, rejects %d writebacks %d\n",
+ 25f:	58                   	pop    %eax
+ 260:	5a                   	pop    %edx
+ 261:	ff 75 94             	push   -0x6c(%ebp)
+ 264:	ff 75 90             	push   -0x70(%ebp)
+ 267:	ff b5 28 ff ff ff    	push   -0xd8(%ebp)
+ 26d:	ff 75 8c             	push   -0x74(%ebp)
+ 270:	68 cc 0b 00 00       	push   $0xbcc
+ 275:	6a 01                	push   $0x1
+ 277:	e8 a4 04 00 00       	call   720 <printf>
+  printf(1, "zero page mapped %d cow %d, same-filled out %d in %d\n",
+ 27c:	83 c4 18             	add    $0x18,%esp
+ 27f:	ff 75 a4             	push   -0x5c(%ebp)
+ 282:	ff 75 a0             	push   -0x60(%ebp)
+ 285:	ff 75 9c             	push   -0x64(%ebp)
+ 288:	ff 75 98             	push   -0x68(%ebp)
+ 28b:	68 04 0c 00 00       	push   $0xc04
+ 290:	6a 01                	push   $0x1
+ 292:	e8 89 04 00 00       	call   720 <printf>
+  printf(1, "lazy heap faults read %d write %d\n", st.lazyzero, st.lazyalloc);
+ 297:	83 c4 20             	add    $0x20,%esp
+ 29a:	ff 75 ac             	push   -0x54(%ebp)
+ 29d:	ff 75 a8             	push   -0x58(%ebp)
+ 2a0:	68 3c 0c 00 00       	push   $0xc3c
+ 2a5:	6a 01                	push   $0x1
+ 2a7:	e8 74 04 00 00       	call   720 <printf>
+  printf(1, "program pages read %d (%d bytes), shared %d, reclaimed %d\n",
+ 2ac:	59                   	pop    %ecx
+ 2ad:	5b                   	pop    %ebx
+ 2ae:	ff 75 bc             	push   -0x44(%ebp)
+ 2b1:	ff 75 b8             	push   -0x48(%ebp)
+ 2b4:	ff 75 b4             	push   -0x4c(%ebp)
+ 2b7:	ff 75 b0             	push   -0x50(%ebp)
+ 2ba:	68 60 0c 00 00       	push   $0xc60
+ 2bf:	6a 01                	push   $0x1
+ 2c1:	e8 5a 04 00 00       	call   720 <printf>
+  printf(1, "page cache %d pages, hits %d misses %d drops %d invalidates %d\n",
+ 2c6:	83 c4 1c             	add    $0x1c,%esp
+ 2c9:	ff 75 d0             	push   -0x30(%ebp)
+ 2cc:	ff 75 cc             	push   -0x34(%ebp)
+ 2cf:	ff 75 c8             	push   -0x38(%ebp)
+ 2d2:	ff 75 c4             	push   -0x3c(%ebp)
+ 2d5:	ff 75 c0             	push   -0x40(%ebp)
+ 2d8:	68 9c 0c 00 00       	push   $0xc9c
+ 2dd:	6a 01                	push   $0x1
+ 2df:	e8 3c 04 00 00       	call   720 <printf>
+  printf(1, "rmap %d KB, %d chain nodes in use\n", st.rmapkb, st.rmapnodes);
+ 2e4:	83 c4 20             	add    $0x20,%esp
+ 2e7:	ff 75 d4             	push   -0x2c(%ebp)
+ 2ea:	ff 75 d8             	push   -0x28(%ebp)
+ 2ed:	68 dc 0c 00 00       	push   $0xcdc
+ 2f2:	6a 01                	push   $0x1
+ 2f4:	e8 27 04 00 00       	call   720 <printf>
+  printf(1, "page tables shared by fork %d, split %d, reused %d\n",
+ 2f9:	5e                   	pop    %esi
+ 2fa:	ff 75 e4             	push   -0x1c(%ebp)
+ 2fd:	ff 75 e0             	push   -0x20(%ebp)
+ 300:	ff 75 dc             	push   -0x24(%ebp)
+ 303:	68 00 0d 00 00       	push   $0xd00
+ 308:	6a 01                	push   $0x1
+ 30a:	e8 11 04 00 00       	call   720 <printf>
+  printf(1, "tlb invlpg %d, full flushes %d, shootdown ipis %d, not needed %d\n",
+ 30f:	83 c4 18             	add    $0x18,%esp
+ 312:	ff 75 f4             	push   -0xc(%ebp)
+ 315:	ff 75 f0             	push   -0x10(%ebp)
+ 318:	ff 75 ec             	push   -0x14(%ebp)
+ 31b:	ff 75 e8             	push   -0x18(%ebp)
+ 31e:	68 34 0d 00 00       	push   $0xd34
+ 323:	6a 01                	push   $0x1
+ 325:	e8 f6 03 00 00       	call   720 <printf>
+}
+ 32a:	83 c4 20             	add    $0x20,%esp
+ 32d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 330:	5b                   	pop    %ebx
+ 331:	5e                   	pop    %esi
+ 332:	5d                   	pop    %ebp
+ 333:	c3                   	ret
+ 334:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    printf(1, " (ratio %d:1)", st.zswapstored * 4096 / st.zswapbytes);
+ 338:	8b 45 84             	mov    -0x7c(%ebp),%eax
+ 33b:	31 d2                	xor    %edx,%edx
+ 33d:	83 ec 04             	sub    $0x4,%esp
+ 340:	c1 e0 0c             	shl    $0xc,%eax
+ 343:	f7 f1                	div    %ecx
+ 345:	50                   	push   %eax
+ 346:	68 af 0a 00 00       	push   $0xaaf
+ 34b:	6a 01                	push   $0x1
+ 34d:	e8 ce 03 00 00       	call   720 <printf>
+ 352:	83 c4 10             	add    $0x10,%esp
+ 355:	e9 f6 fe ff ff       	jmp    250 <vmstat+0x1a0>
+    printf(2, "vmstat: getvmstat failed\n");
+ 35a:	51                   	push   %ecx
+ 35b:	51                   	push   %ecx
+ 35c:	68 48 0a 00 00       	push   $0xa48
+ 361:	6a 02                	push   $0x2
+ 363:	e8 b8 03 00 00       	call   720 <printf>
+    exit();
+ 368:	e8 46 02 00 00       	call   5b3 <exit>
+ 36d:	66 90                	xchg   %ax,%ax
+ 36f:	90                   	nop
+
+00000370 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 370:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 371:	31 c0                	xor    %eax,%eax
+{
+ 373:	89 e5                	mov    %esp,%ebp
+ 375:	53                   	push   %ebx
+ 376:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 379:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 37c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 380:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 384:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 387:	83 c0 01             	add    $0x1,%eax
+ 38a:	84 d2                	test   %dl,%dl
+ 38c:	75 f2                	jne    380 <strcpy+0x10>
+    ;
+  return os;
+}
+ 38e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 391:	89 c8                	mov    %ecx,%eax
+ 393:	c9                   	leave
+ 394:	c3                   	ret
+ 395:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 39c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000003a0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 3a0:	55                   	push   %ebp
+ 3a1:	89 e5                	mov    %esp,%ebp
+ 3a3:	53                   	push   %ebx
+ 3a4:	8b 55 08             	mov    0x8(%ebp),%edx
+ 3a7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 3aa:	0f b6 02             	movzbl (%edx),%eax
+ 3ad:	84 c0                	test   %al,%al
+ 3af:	75 17                	jne    3c8 <strcmp+0x28>
+ 3b1:	eb 3a                	jmp    3ed <strcmp+0x4d>
+ 3b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3b7:	90                   	nop
+ 3b8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 3bc:	83 c2 01             	add    $0x1,%edx
+ 3bf:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 3c2:	84 c0                	test   %al,%al
+ 3c4:	74 1a                	je     3e0 <strcmp+0x40>
+    p++, q++;
+ 3c6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 3c8:	0f b6 19             	movzbl (%ecx),%ebx
+ 3cb:	38 c3                	cmp    %al,%bl
+ 3cd:	74 e9                	je     3b8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 3cf:	29 d8                	sub    %ebx,%eax
+}
+ 3d1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3d4:	c9                   	leave
+ 3d5:	c3                   	ret
+ 3d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3dd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 3e0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 3e4:	31 c0                	xor    %eax,%eax
+ 3e6:	29 d8                	sub    %ebx,%eax
+}
+ 3e8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3eb:	c9                   	leave
+ 3ec:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 3ed:	0f b6 19             	movzbl (%ecx),%ebx
+ 3f0:	31 c0                	xor    %eax,%eax
+ 3f2:	eb db                	jmp    3cf <strcmp+0x2f>
+ 3f4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3ff:	90                   	nop
+
+00000400 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 400:	55                   	push   %ebp
+ 401:	89 e5                	mov    %esp,%ebp
+ 403:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 406:	80 3a 00             	cmpb   $0x0,(%edx)
+ 409:	74 15                	je     420 <strlen+0x20>
+ 40b:	31 c0                	xor    %eax,%eax
+ 40d:	8d 76 00             	lea    0x0(%esi),%esi
+ 410:	83 c0 01             	add    $0x1,%eax
+ 413:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 417:	89 c1                	mov    %eax,%ecx
+ 419:	75 f5                	jne    410 <strlen+0x10>
+    ;
+  return n;
+}
+ 41b:	89 c8                	mov    %ecx,%eax
+ 41d:	5d                   	pop    %ebp
+ 41e:	c3                   	ret
+ 41f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 420:	31 c9                	xor    %ecx,%ecx
+}
+ 422:	5d                   	pop    %ebp
+ 423:	89 c8                	mov    %ecx,%eax
+ 425:	c3                   	ret
+ 426:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 42d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000430 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 430:	55                   	push   %ebp
+ 431:	89 e5                	mov    %esp,%ebp
+ 433:	57                   	push   %edi
+ 434:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 437:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 43a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 43d:	89 d7                	mov    %edx,%edi
+ 43f:	fc                   	cld
+ 440:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 442:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 445:	89 d0                	mov    %edx,%eax
+ 447:	c9                   	leave
+ 448:	c3                   	ret
+ 449:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000450 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 450:	55                   	push   %ebp
+ 451:	89 e5                	mov    %esp,%ebp
+ 453:	8b 45 08             	mov    0x8(%ebp),%eax
+ 456:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 45a:	0f b6 10             	movzbl (%eax),%edx
+ 45d:	84 d2                	test   %dl,%dl
+ 45f:	75 12                	jne    473 <strchr+0x23>
+ 461:	eb 1d                	jmp    480 <strchr+0x30>
+ 463:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 467:	90                   	nop
+ 468:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 46c:	83 c0 01             	add    $0x1,%eax
+ 46f:	84 d2                	test   %dl,%dl
+ 471:	74 0d                	je     480 <strchr+0x30>
+    if(*s == c)
+ 473:	38 d1                	cmp    %dl,%cl
+ 475:	75 f1                	jne    468 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 477:	5d                   	pop    %ebp
+ 478:	c3                   	ret
+ 479:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 480:	31 c0                	xor    %eax,%eax
+}
+ 482:	5d                   	pop    %ebp
+ 483:	c3                   	ret
+ 484:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 48b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 48f:	90                   	nop
+
+00000490 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 490:	55                   	push   %ebp
+ 491:	89 e5                	mov    %esp,%ebp
+ 493:	57                   	push   %edi
+ 494:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 495:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 498:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 499:	31 db                	xor    %ebx,%ebx
+{
+ 49b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 49e:	eb 27                	jmp    4c7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 4a0:	83 ec 04             	sub    $0x4,%esp
+ 4a3:	6a 01                	push   $0x1
+ 4a5:	56                   	push   %esi
+ 4a6:	6a 00                	push   $0x0
+ 4a8:	e8 1e 01 00 00       	call   5cb <read>
+    if(cc < 1)
+ 4ad:	83 c4 10             	add    $0x10,%esp
+ 4b0:	85 c0                	test   %eax,%eax
+ 4b2:	7e 1d                	jle    4d1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 4b4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 4b8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 4bb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 4bf:	3c 0a                	cmp    $0xa,%al
+ 4c1:	74 10                	je     4d3 <gets+0x43>
+ 4c3:	3c 0d                	cmp    $0xd,%al
+ 4c5:	74 0c                	je     4d3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 4c7:	89 df                	mov    %ebx,%edi
+ 4c9:	83 c3 01             	add    $0x1,%ebx
+ 4cc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 4cf:	7c cf                	jl     4a0 <gets+0x10>
+ 4d1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 4d3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4d6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 4da:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 4dd:	5b                   	pop    %ebx
+ 4de:	5e                   	pop    %esi
+ 4df:	5f                   	pop    %edi
+ 4e0:	5d                   	pop    %ebp
+ 4e1:	c3                   	ret
+ 4e2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000004f0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 4f0:	55                   	push   %ebp
+ 4f1:	89 e5                	mov    %esp,%ebp
+ 4f3:	56                   	push   %esi
+ 4f4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 4f5:	83 ec 08             	sub    $0x8,%esp
+ 4f8:	6a 00                	push   $0x0
+ 4fa:	ff 75 08             	push   0x8(%ebp)
+ 4fd:	e8 f1 00 00 00       	call   5f3 <open>
+  if(fd < 0)
+ 502:	83 c4 10             	add    $0x10,%esp
+ 505:	85 c0                	test   %eax,%eax
+ 507:	78 27                	js     530 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 509:	83 ec 08             	sub    $0x8,%esp
+ 50c:	ff 75 0c             	push   0xc(%ebp)
+ 50f:	89 c3                	mov    %eax,%ebx
+ 511:	50                   	push   %eax
+ 512:	e8 f4 00 00 00       	call   60b <fstat>
+  close(fd);
+ 517:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 51a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 51c:	e8 ba 00 00 00       	call   5db <close>
+  return r;
+ 521:	83 c4 10             	add    $0x10,%esp
+}
+ 524:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 527:	89 f0                	mov    %esi,%eax
+ 529:	5b                   	pop    %ebx
+ 52a:	5e                   	pop    %esi
+ 52b:	5d                   	pop    %ebp
+ 52c:	c3                   	ret
+ 52d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 530:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 535:	eb ed                	jmp    524 <stat+0x34>
+ 537:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 53e:	66 90                	xchg   %ax,%ax
+
+00000540 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 540:	55                   	push   %ebp
+ 541:	89 e5                	mov    %esp,%ebp
+ 543:	53                   	push   %ebx
+ 544:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 547:	0f be 02             	movsbl (%edx),%eax
+ 54a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 54d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 550:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 555:	77 1e                	ja     575 <atoi+0x35>
+ 557:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 55e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 560:	83 c2 01             	add    $0x1,%edx
+ 563:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 566:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 56a:	0f be 02             	movsbl (%edx),%eax
+ 56d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 570:	80 fb 09             	cmp    $0x9,%bl
+ 573:	76 eb                	jbe    560 <atoi+0x20>
+  return n;
+}
+ 575:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 578:	89 c8                	mov    %ecx,%eax
+ 57a:	c9                   	leave
+ 57b:	c3                   	ret
+ 57c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000580 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 580:	55                   	push   %ebp
+ 581:	89 e5                	mov    %esp,%ebp
+ 583:	57                   	push   %edi
+ 584:	56                   	push   %esi
+ 585:	8b 45 10             	mov    0x10(%ebp),%eax
+ 588:	8b 55 08             	mov    0x8(%ebp),%edx
+ 58b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 58e:	85 c0                	test   %eax,%eax
+ 590:	7e 13                	jle    5a5 <memmove+0x25>
+ 592:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 594:	89 d7                	mov    %edx,%edi
+ 596:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 59d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 5a0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 5a1:	39 f8                	cmp    %edi,%eax
+ 5a3:	75 fb                	jne    5a0 <memmove+0x20>
+  return vdst;
+}
+ 5a5:	5e                   	pop    %esi
+ 5a6:	89 d0                	mov    %edx,%eax
+ 5a8:	5f                   	pop    %edi
+ 5a9:	5d                   	pop    %ebp
+ 5aa:	c3                   	ret
+
+000005ab <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 5ab:	b8 01 00 00 00       	mov    $0x1,%eax
+ 5b0:	cd 40                	int    $0x40
+ 5b2:	c3                   	ret
+
+000005b3 <exit>:
+SYSCALL(exit)
+ 5b3:	b8 02 00 00 00       	mov    $0x2,%eax
+ 5b8:	cd 40                	int    $0x40
+ 5ba:	c3                   	ret
+
+000005bb <wait>:
+SYSCALL(wait)
+ 5bb:	b8 03 00 00 00       	mov    $0x3,%eax
+ 5c0:	cd 40                	int    $0x40
+ 5c2:	c3                   	ret
+
+000005c3 <pipe>:
+SYSCALL(pipe)
+ 5c3:	b8 04 00 00 00       	mov    $0x4,%eax
+ 5c8:	cd 40                	int    $0x40
+ 5ca:	c3                   	ret
+
+000005cb <read>:
+SYSCALL(read)
+ 5cb:	b8 05 00 00 00       	mov    $0x5,%eax
+ 5d0:	cd 40                	int    $0x40
+ 5d2:	c3                   	ret
+
+000005d3 <write>:
+SYSCALL(write)
+ 5d3:	b8 10 00 00 00       	mov    $0x10,%eax
+ 5d8:	cd 40                	int    $0x40
+ 5da:	c3                   	ret
+
+000005db <close>:
+SYSCALL(close)
+ 5db:	b8 15 00 00 00       	mov    $0x15,%eax
+ 5e0:	cd 40                	int    $0x40
+ 5e2:	c3                   	ret
+
+000005e3 <kill>:
+SYSCALL(kill)
+ 5e3:	b8 06 00 00 00       	mov    $0x6,%eax
+ 5e8:	cd 40                	int    $0x40
+ 5ea:	c3                   	ret
+
+000005eb <exec>:
+SYSCALL(exec)
+ 5eb:	b8 07 00 00 00       	mov    $0x7,%eax
+ 5f0:	cd 40                	int    $0x40
+ 5f2:	c3                   	ret
+
+000005f3 <open>:
+SYSCALL(open)
+ 5f3:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 5f8:	cd 40                	int    $0x40
+ 5fa:	c3                   	ret
+
+000005fb <mknod>:
+SYSCALL(mknod)
+ 5fb:	b8 11 00 00 00       	mov    $0x11,%eax
+ 600:	cd 40                	int    $0x40
+ 602:	c3                   	ret
+
+00000603 <unlink>:
+SYSCALL(unlink)
+ 603:	b8 12 00 00 00       	mov    $0x12,%eax
+ 608:	cd 40                	int    $0x40
+ 60a:	c3                   	ret
+
+0000060b <fstat>:
+SYSCALL(fstat)
+ 60b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 610:	cd 40                	int    $0x40
+ 612:	c3                   	ret
+
+00000613 <link>:
+SYSCALL(link)
+ 613:	b8 13 00 00 00       	mov    $0x13,%eax
+ 618:	cd 40                	int    $0x40
+ 61a:	c3                   	ret
+
+0000061b <mkdir>:
+SYSCALL(mkdir)
+ 61b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 620:	cd 40                	int    $0x40
+ 622:	c3                   	ret
+
+00000623 <chdir>:
+SYSCALL(chdir)
+ 623:	b8 09 00 00 00       	mov    $0x9,%eax
+ 628:	cd 40                	int    $0x40
+ 62a:	c3                   	ret
+
+0000062b <dup>:
+SYSCALL(dup)
+ 62b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 630:	cd 40                	int    $0x40
+ 632:	c3                   	ret
+
+00000633 <getpid>:
+SYSCALL(getpid)
+ 633:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 638:	cd 40                	int    $0x40
+ 63a:	c3                   	ret
+
+0000063b <sbrk>:
+SYSCALL(sbrk)
+ 63b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 640:	cd 40                	int    $0x40
+ 642:	c3                   	ret
+
+00000643 <sleep>:
+SYSCALL(sleep)
+ 643:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 648:	cd 40                	int    $0x40
+ 64a:	c3                   	ret
+
+0000064b <uptime>:
+SYSCALL(uptime)
+ 64b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 650:	cd 40                	int    $0x40
+ 652:	c3                   	ret
+
+00000653 <getrss>:
+SYSCALL(getrss)
+ 653:	b8 16 00 00 00       	mov    $0x16,%eax
+ 658:	cd 40                	int    $0x40
+ 65a:	c3                   	ret
+
+0000065b <getNumFreePages>:
+SYSCALL(getNumFreePages)
+ 65b:	b8 17 00 00 00       	mov    $0x17,%eax
+ 660:	cd 40                	int    $0x40
+ 662:	c3                   	ret
+
+00000663 <getvmstat>:
+SYSCALL(getvmstat)
+ 663:	b8 18 00 00 00       	mov    $0x18,%eax
+ 668:	cd 40                	int    $0x40
+ 66a:	c3                   	ret
+
+0000066b <vmtune>:
+SYSCALL(vmtune)
+ 66b:	b8 19 00 00 00       	mov    $0x19,%eax
+ 670:	cd 40                	int    $0x40
+ 672:	c3                   	ret
+
+00000673 <spawn>:
+SYSCALL(spawn)
+ 673:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 678:	cd 40                	int    $0x40
+ 67a:	c3                   	ret
+ 67b:	66 90                	xchg   %ax,%ax
+ 67d:	66 90                	xchg   %ax,%ax
+ 67f:	90                   	nop
+
+00000680 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 680:	55                   	push   %ebp
+ 681:	89 e5                	mov    %esp,%ebp
+ 683:	57                   	push   %edi
+ 684:	56                   	push   %esi
+ 685:	53                   	push   %ebx
+ 686:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 688:	89 d1                	mov    %edx,%ecx
+{
+ 68a:	83 ec 3c             	sub    $0x3c,%esp
+ 68d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 690:	85 d2                	test   %edx,%edx
+ 692:	0f 89 80 00 00 00    	jns    718 <printint+0x98>
+ 698:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 69c:	74 7a                	je     718 <printint+0x98>
+    x = -xx;
+ 69e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 6a0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 6a5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 6a8:	31 f6                	xor    %esi,%esi
+ 6aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 6b0:	89 c8                	mov    %ecx,%eax
+ 6b2:	31 d2                	xor    %edx,%edx
+ 6b4:	89 f7                	mov    %esi,%edi
+ 6b6:	f7 f3                	div    %ebx
+ 6b8:	8d 76 01             	lea    0x1(%esi),%esi
+ 6bb:	0f b6 92 d8 0d 00 00 	movzbl 0xdd8(%edx),%edx
+ 6c2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 6c6:	89 ca                	mov    %ecx,%edx
+ 6c8:	89 c1                	mov    %eax,%ecx
+ 6ca:	39 da                	cmp    %ebx,%edx
+ 6cc:	73 e2                	jae    6b0 <printint+0x30>
+  if(neg)
+ 6ce:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 6d1:	85 c0                	test   %eax,%eax
+ 6d3:	74 07                	je     6dc <printint+0x5c>
+    buf[i++] = '-';
+ 6d5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 6da:	89 f7                	mov    %esi,%edi
+ 6dc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 6df:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 6e2:	01 df                	add    %ebx,%edi
+ 6e4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 6e8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 6eb:	83 ec 04             	sub    $0x4,%esp
+ 6ee:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 6f1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 6f4:	6a 01                	push   $0x1
+ 6f6:	50                   	push   %eax
+ 6f7:	56                   	push   %esi
+ 6f8:	e8 d6 fe ff ff       	call   5d3 <write>
+  while(--i >= 0)
+ 6fd:	89 f8                	mov    %edi,%eax
+ 6ff:	83 c4 10             	add    $0x10,%esp
+ 702:	83 ef 01             	sub    $0x1,%edi
+ 705:	39 d8                	cmp    %ebx,%eax
+ 707:	75 df                	jne    6e8 <printint+0x68>
+}
+ 709:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 70c:	5b                   	pop    %ebx
+ 70d:	5e                   	pop    %esi
+ 70e:	5f                   	pop    %edi
+ 70f:	5d                   	pop    %ebp
+ 710:	c3                   	ret
+ 711:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 718:	31 c0                	xor    %eax,%eax
+ 71a:	eb 89                	jmp    6a5 <printint+0x25>
+ 71c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000720 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 720:	55                   	push   %ebp
+ 721:	89 e5                	mov    %esp,%ebp
+ 723:	57                   	push   %edi
+ 724:	56                   	push   %esi
+ 725:	53                   	push   %ebx
+ 726:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 729:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 72c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 72f:	0f b6 1e             	movzbl (%esi),%ebx
+ 732:	83 c6 01             	add    $0x1,%esi
+ 735:	84 db                	test   %bl,%bl
+ 737:	74 67                	je     7a0 <printf+0x80>
+ 739:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 73c:	31 d2                	xor    %edx,%edx
+ 73e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 741:	eb 34                	jmp    777 <printf+0x57>
+ 743:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 747:	90                   	nop
+ 748:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 74b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 750:	83 f8 25             	cmp    $0x25,%eax
+ 753:	74 18                	je     76d <printf+0x4d>
+  write(fd, &c, 1);
+ 755:	83 ec 04             	sub    $0x4,%esp
+ 758:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 75b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 75e:	6a 01                	push   $0x1
+ 760:	50                   	push   %eax
+ 761:	57                   	push   %edi
+ 762:	e8 6c fe ff ff       	call   5d3 <write>
+ 767:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 76a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 76d:	0f b6 1e             	movzbl (%esi),%ebx
+ 770:	83 c6 01             	add    $0x1,%esi
+ 773:	84 db                	test   %bl,%bl
+ 775:	74 29                	je     7a0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 777:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 77a:	85 d2                	test   %edx,%edx
+ 77c:	74 ca                	je     748 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 77e:	83 fa 25             	cmp    $0x25,%edx
+ 781:	75 ea                	jne    76d <printf+0x4d>
+      if(c == 'd'){
+ 783:	83 f8 25             	cmp    $0x25,%eax
+ 786:	0f 84 24 01 00 00    	je     8b0 <printf+0x190>
+ 78c:	83 e8 63             	sub    $0x63,%eax
+ 78f:	83 f8 15             	cmp    $0x15,%eax
+ 792:	77 1c                	ja     7b0 <printf+0x90>
+ 794:	ff 24 85 80 0d 00 00 	jmp    *0xd80(,%eax,4)
+ 79b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 79f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 7a0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 7a3:	5b                   	pop    %ebx
+ 7a4:	5e                   	pop    %esi
+ 7a5:	5f                   	pop    %edi
+ 7a6:	5d                   	pop    %ebp
+ 7a7:	c3                   	ret
+ 7a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7af:	90                   	nop
+  write(fd, &c, 1);
+ 7b0:	83 ec 04             	sub    $0x4,%esp
+ 7b3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 7b6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 7ba:	6a 01                	push   $0x1
+ 7bc:	52                   	push   %edx
+ 7bd:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 7c0:	57                   	push   %edi
+ 7c1:	e8 0d fe ff ff       	call   5d3 <write>
+ 7c6:	83 c4 0c             	add    $0xc,%esp
+ 7c9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 7cc:	6a 01                	push   $0x1
+ 7ce:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 7d1:	52                   	push   %edx
+ 7d2:	57                   	push   %edi
+ 7d3:	e8 fb fd ff ff       	call   5d3 <write>
+        putc(fd, c);
+ 7d8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 7db:	31 d2                	xor    %edx,%edx
+ 7dd:	eb 8e                	jmp    76d <printf+0x4d>
+ 7df:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 7e0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 7e3:	83 ec 0c             	sub    $0xc,%esp
+ 7e6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 7eb:	8b 13                	mov    (%ebx),%edx
+ 7ed:	6a 00                	push   $0x0
+ 7ef:	89 f8                	mov    %edi,%eax
+        ap++;
+ 7f1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 7f4:	e8 87 fe ff ff       	call   680 <printint>
+        ap++;
+ 7f9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 7fc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 7ff:	31 d2                	xor    %edx,%edx
+ 801:	e9 67 ff ff ff       	jmp    76d <printf+0x4d>
+ 806:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 80d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 810:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 813:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 815:	83 c0 04             	add    $0x4,%eax
+ 818:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 81b:	85 db                	test   %ebx,%ebx
+ 81d:	0f 84 9d 00 00 00    	je     8c0 <printf+0x1a0>
+        while(*s != 0){
+ 823:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 826:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 828:	84 c0                	test   %al,%al
+ 82a:	0f 84 3d ff ff ff    	je     76d <printf+0x4d>
+ 830:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 833:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 836:	89 de                	mov    %ebx,%esi
+ 838:	89 d3                	mov    %edx,%ebx
+ 83a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 840:	83 ec 04             	sub    $0x4,%esp
+ 843:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 846:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 849:	6a 01                	push   $0x1
+ 84b:	53                   	push   %ebx
+ 84c:	57                   	push   %edi
+ 84d:	e8 81 fd ff ff       	call   5d3 <write>
+        while(*s != 0){
+ 852:	0f b6 06             	movzbl (%esi),%eax
+ 855:	83 c4 10             	add    $0x10,%esp
+ 858:	84 c0                	test   %al,%al
+ 85a:	75 e4                	jne    840 <printf+0x120>
+      state = 0;
+ 85c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 85f:	31 d2                	xor    %edx,%edx
+ 861:	e9 07 ff ff ff       	jmp    76d <printf+0x4d>
+ 866:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 86d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 870:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 873:	83 ec 0c             	sub    $0xc,%esp
+ 876:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 87b:	8b 13                	mov    (%ebx),%edx
+ 87d:	6a 01                	push   $0x1
+ 87f:	e9 6b ff ff ff       	jmp    7ef <printf+0xcf>
+ 884:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 888:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 88b:	83 ec 04             	sub    $0x4,%esp
+ 88e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 891:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 893:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 896:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 899:	6a 01                	push   $0x1
+ 89b:	52                   	push   %edx
+ 89c:	57                   	push   %edi
+ 89d:	e8 31 fd ff ff       	call   5d3 <write>
+        ap++;
+ 8a2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 8a5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 8a8:	31 d2                	xor    %edx,%edx
+ 8aa:	e9 be fe ff ff       	jmp    76d <printf+0x4d>
+ 8af:	90                   	nop
+  write(fd, &c, 1);
+ 8b0:	83 ec 04             	sub    $0x4,%esp
+ 8b3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 8b6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 8b9:	6a 01                	push   $0x1
+ 8bb:	e9 11 ff ff ff       	jmp    7d1 <printf+0xb1>
+ 8c0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 8c5:	bb 76 0d 00 00       	mov    $0xd76,%ebx
+ 8ca:	e9 61 ff ff ff       	jmp    830 <printf+0x110>
+ 8cf:	90                   	nop
+
+000008d0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 8d0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 8d1:	a1 b0 10 00 00       	mov    0x10b0,%eax
+{
+ 8d6:	89 e5                	mov    %esp,%ebp
+ 8d8:	57                   	push   %edi
+ 8d9:	56                   	push   %esi
+ 8da:	53                   	push   %ebx
+ 8db:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 8de:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 8e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8e8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 8ea:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 8ec:	39 ca                	cmp    %ecx,%edx
+ 8ee:	73 30                	jae    920 <free+0x50>
+ 8f0:	39 c1                	cmp    %eax,%ecx
+ 8f2:	72 04                	jb     8f8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 8f4:	39 c2                	cmp    %eax,%edx
+ 8f6:	72 f0                	jb     8e8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 8f8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 8fb:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 8fe:	39 f8                	cmp    %edi,%eax
+ 900:	74 2e                	je     930 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 902:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 905:	8b 42 04             	mov    0x4(%edx),%eax
+ 908:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 90b:	39 f1                	cmp    %esi,%ecx
+ 90d:	74 38                	je     947 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 90f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 911:	5b                   	pop    %ebx
+  freep = p;
+ 912:	89 15 b0 10 00 00    	mov    %edx,0x10b0
+}
+ 918:	5e                   	pop    %esi
+ 919:	5f                   	pop    %edi
+ 91a:	5d                   	pop    %ebp
+ 91b:	c3                   	ret
+ 91c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 920:	39 c1                	cmp    %eax,%ecx
+ 922:	72 d0                	jb     8f4 <free+0x24>
+ 924:	eb c2                	jmp    8e8 <free+0x18>
+ 926:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 92d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 930:	03 70 04             	add    0x4(%eax),%esi
+ 933:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 936:	8b 02                	mov    (%edx),%eax
+ 938:	8b 00                	mov    (%eax),%eax
+ 93a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 93d:	8b 42 04             	mov    0x4(%edx),%eax
+ 940:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 943:	39 f1                	cmp    %esi,%ecx
+ 945:	75 c8                	jne    90f <free+0x3f>
+    p->s.size += bp->s.size;
+ 947:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 94a:	89 15 b0 10 00 00    	mov    %edx,0x10b0
+    p->s.size += bp->s.size;
+ 950:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 953:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 956:	89 0a                	mov    %ecx,(%edx)
+}
+ 958:	5b                   	pop    %ebx
+ 959:	5e                   	pop    %esi
+ 95a:	5f                   	pop    %edi
+ 95b:	5d                   	pop    %ebp
+ 95c:	c3                   	ret
+ 95d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000960 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 960:	55                   	push   %ebp
+ 961:	89 e5                	mov    %esp,%ebp
+ 963:	57                   	push   %edi
+ 964:	56                   	push   %esi
+ 965:	53                   	push   %ebx
+ 966:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 969:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 96c:	8b 15 b0 10 00 00    	mov    0x10b0,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 972:	8d 78 07             	lea    0x7(%eax),%edi
+ 975:	c1 ef 03             	shr    $0x3,%edi
+ 978:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 97b:	85 d2                	test   %edx,%edx
+ 97d:	0f 84 8d 00 00 00    	je     a10 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 983:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 985:	8b 48 04             	mov    0x4(%eax),%ecx
+ 988:	39 f9                	cmp    %edi,%ecx
+ 98a:	73 64                	jae    9f0 <malloc+0x90>
+  if(nu < 4096)
+ 98c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 991:	39 df                	cmp    %ebx,%edi
+ 993:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 996:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 99d:	eb 0a                	jmp    9a9 <malloc+0x49>
+ 99f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 9a0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 9a2:	8b 48 04             	mov    0x4(%eax),%ecx
+ 9a5:	39 f9                	cmp    %edi,%ecx
+ 9a7:	73 47                	jae    9f0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 9a9:	89 c2                	mov    %eax,%edx
+ 9ab:	39 05 b0 10 00 00    	cmp    %eax,0x10b0
+ 9b1:	75 ed                	jne    9a0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ 9b3:	83 ec 0c             	sub    $0xc,%esp
+ 9b6:	56                   	push   %esi
+ 9b7:	e8 7f fc ff ff       	call   63b <sbrk>
+  if(p == (char*)-1)
+ 9bc:	83 c4 10             	add    $0x10,%esp
+ 9bf:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 9c2:	74 1c                	je     9e0 <malloc+0x80>
+  hp->s.size = nu;
+ 9c4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 9c7:	83 ec 0c             	sub    $0xc,%esp
+ 9ca:	83 c0 08             	add    $0x8,%eax
+ 9cd:	50                   	push   %eax
+ 9ce:	e8 fd fe ff ff       	call   8d0 <free>
+  return freep;
+ 9d3:	8b 15 b0 10 00 00    	mov    0x10b0,%edx
+      if((p = morecore(nunits)) == 0)
+ 9d9:	83 c4 10             	add    $0x10,%esp
+ 9dc:	85 d2                	test   %edx,%edx
+ 9de:	75 c0                	jne    9a0 <malloc+0x40>
+        return 0;
+  }
+}
+ 9e0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 9e3:	31 c0                	xor    %eax,%eax
+}
+ 9e5:	5b                   	pop    %ebx
+ 9e6:	5e                   	pop    %esi
+ 9e7:	5f                   	pop    %edi
+ 9e8:	5d                   	pop    %ebp
+ 9e9:	c3                   	ret
+ 9ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 9f0:	39 cf                	cmp    %ecx,%edi
+ 9f2:	74 4c                	je     a40 <malloc+0xe0>
+        p->s.size -= nunits;
+ 9f4:	29 f9                	sub    %edi,%ecx
+ 9f6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 9f9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 9fc:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ 9ff:	89 15 b0 10 00 00    	mov    %edx,0x10b0
+}
+ a05:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ a08:	83 c0 08             	add    $0x8,%eax
+}
+ a0b:	5b                   	pop    %ebx
+ a0c:	5e                   	pop    %esi
+ a0d:	5f                   	pop    %edi
+ a0e:	5d                   	pop    %ebp
+ a0f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ a10:	c7 05 b0 10 00 00 b4 	movl   $0x10b4,0x10b0
+ a17:	10 00 00 
+    base.s.size = 0;
+ a1a:	b8 b4 10 00 00       	mov    $0x10b4,%eax
+    base.s.ptr = freep = prevp = &base;
+ a1f:	c7 05 b4 10 00 00 b4 	movl   $0x10b4,0x10b4
+ a26:	10 00 00 
+    base.s.size = 0;
+ a29:	c7 05 b8 10 00 00 00 	movl   $0x0,0x10b8
+ a30:	00 00 00 
+    if(p->s.size >= nunits){
+ a33:	e9 54 ff ff ff       	jmp    98c <malloc+0x2c>
+ a38:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a3f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ a40:	8b 08                	mov    (%eax),%ecx
+ a42:	89 0a                	mov    %ecx,(%edx)
+ a44:	eb b9                	jmp    9ff <malloc+0x9f>
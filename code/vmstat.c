@@ -0,0 +1,80 @@
+// Print virtual memory statistics.
+// usage: vmstat [interval ticks [count]]
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "vmstat.h"
+
+void
+vmstat(void)
+{
+  struct vmstat st;
+  int k;
+
+  if(getvmstat(&st) < 0){
+    printf(2, "vmstat: getvmstat failed\n");
+    exit();
+  }
+  printf(1, "free %d cached %d\n", st.freepages, st.cachedpages);
+  printf(1, "buddy");
+  for(k = 0; k <= VM_MAXORDER; k++)
+    printf(1, " %d", st.buddyfree[k]);
+  printf(1, "\n");
+  printf(1, "swapouts %d swapins %d\n", st.swapouts, st.swapins);
+  printf(1, "kswapd wm %d/%d wakeups %d outs %d direct %d\n",
+         st.lowwm, st.highwm, st.kswapdwakeups, st.kswapdouts, st.directouts);
+  printf(1, "pgfaults %d clock scanned %d cleared %d\n",
+         st.pgfaults, st.clockscanned, st.clockcleared);
+  printf(1, "swap free %d/%d oom %d\n", st.swapfree, st.swapslots, st.oomfails);
+  printf(1, "swapcache %d clean drops %d read waits %d\n",
+         st.swapcached, st.swapcleandrops, st.swapreadwaits);
+  printf(1, "readahead window %d pages %d hits %d misses %d\n",
+         st.rawindow, st.rapages, st.rahits, st.ramisses);
+  printf(1, "cluster size %d clusters %d pages %d\n",
+         st.clustersize, st.clusters, st.clusterpages);
+  printf(1, "zswap pool %d pages, %d stored in %d bytes",
+         st.zswappages, st.zswapstored, st.zswapbytes);
+  if(st.zswapbytes > 0)
+    printf(1, " (ratio %d:1)", st.zswapstored * 4096 / st.zswapbytes);
+  printf(1, "\n");
+  printf(1, "zswap hits %d/%d swap-ins, rejects %d writebacks %d\n",
+         st.zswaphits, st.swapins, st.zswaprejects, st.zswapwritebacks);
+  printf(1, "zero page mapped %d cow %d, same-filled out %d in %d\n",
+         st.zeromapped, st.zerocows, st.fillouts, st.fillins);
+  printf(1, "lazy heap faults read %d write %d\n", st.lazyzero, st.lazyalloc);
+  printf(1, "program pages read %d (%d bytes), shared %d, reclaimed %d\n",
+         st.filepages, st.filebytes, st.fileshared, st.filereclaims);
+  printf(1, "page cache %d pages, hits %d misses %d drops %d invalidates %d\n",
+         st.pcachepages, st.pcachehits, st.pcachemisses, st.pcachedrops,
+         st.pcacheinvalidates);
+  printf(1, "rmap %d KB, %d chain nodes in use\n", st.rmapkb, st.rmapnodes);
+  printf(1, "page tables shared by fork %d, split %d, reused %d\n",
+         st.ptshares, st.ptsplits, st.ptreuses);
+  printf(1, "tlb invlpg %d, full flushes %d, shootdown ipis %d, not needed %d\n",
+         st.tlbinvlpgs, st.tlbfulls, st.tlbipis, st.tlbdeferred);
+}
+
+int
+main(int argc, char *argv[])
+{
+  int interval, count;
+
+  interval = 0;
+  count = 1;
+  if(argc > 1){
+    interval = atoi(argv[1]);
+    count = -1;
+  }
+  if(argc > 2)
+    count = atoi(argv[2]);
+
+  while(count != 0){
+    vmstat();
+    if(count > 0)
+      count--;
+    if(count != 0)
+      sleep(interval);
+  }
+  exit();
+}
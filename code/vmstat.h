@@ -0,0 +1,70 @@
+// Virtual memory statistics, filled in by getvmstat().
+// Both the kernel and user programs use this header file.
+
+#define VM_MAXORDER 10  // largest buddy block is 2^VM_MAXORDER pages
+
+// Tunables for vmtune(param, value).
+#define VM_LOWWM    1   // kswapd wakes below this many free pages
+#define VM_HIGHWM   2   // kswapd evicts until this many are free
+#define VM_READAHEAD 3  // pages read per swap-in fault, 1 for none
+#define VM_CLUSTER  4   // pages written per swap-out, 1 for none
+#define VM_ZSWAP    5   // 1 to compress swapped pages in memory first
+
+struct vmstat {
+  uint freepages;                 // Free pages, including CPU caches
+  uint cachedpages;               // Free pages held in per-CPU caches
+  uint buddyfree[VM_MAXORDER+1];  // Free buddy blocks of each order
+  uint swapouts;                  // Pages written out to swap
+  uint swapins;                   // Pages read back from swap
+  uint lowwm;                     // kswapd low watermark (pages)
+  uint highwm;                    // kswapd high watermark (pages)
+  uint kswapdwakeups;             // Times kswapd woke to reclaim
+  uint kswapdouts;                // Pages swapped out by kswapd
+  uint directouts;                // Pages swapped out inside kalloc()
+  uint pgfaults;                  // Page faults taken
+  uint clockscanned;              // Mapped frames the CLOCK hand passed
+  uint clockcleared;              // Frames given a second chance
+  uint swapslots;                 // Page-sized slots on the swap disk
+  uint swapfree;                  // Swap slots not in use
+  uint oomfails;                  // Allocations failed with nothing to evict
+  uint swapcached;                // Frames still holding their swap slot
+  uint swapcleandrops;            // Swap-outs that skipped the disk write
+  uint swapreadwaits;             // Faults that waited for another's read
+  uint rawindow;                  // Swap readahead window (pages)
+  uint rapages;                   // Pages read ahead of a fault
+  uint rahits;                    // Read-ahead pages used before CLOCK came by
+  uint ramisses;                  // Read-ahead pages still untouched then
+  uint clustersize;               // Most pages one swap-out may write
+  uint clusters;                  // Swap-outs that wrote more than one page
+  uint clusterpages;              // Pages written by those swap-outs
+  uint zswappages;                // Size of the compressed swap pool
+  uint zswapstored;               // Swapped pages held compressed
+  uint zswapbytes;                // Their compressed size
+  uint zswaphits;                 // Swap-ins served from the pool
+  uint zswaprejects;              // Pages that did not compress enough
+  uint zswapwritebacks;           // Pages moved to disk to make room
+  uint zeromapped;                // Heap pages mapping the shared zero page
+  uint zerocows;                  // Zero-page mappings given a page by a write
+  uint fillouts;                  // Same-filled pages swapped out with no I/O
+  uint fillins;                   // Same-filled pages swapped back in
+  uint lazyzero;                  // Reserved heap pages first touched by a read
+  uint lazyalloc;                 // Reserved heap pages first touched by a write
+  uint filepages;                 // Program pages read in by a fault
+  uint filebytes;                 // File data read for them
+  uint fileshared;                // Program page faults served by the page cache
+  uint filereclaims;              // Mapped page-cache frames reclaimed
+  uint pcachepages;               // Frames in the page cache
+  uint pcachehits;                // Page-cache lookups that found the page
+  uint pcachemisses;              // and that did not
+  uint pcachedrops;               // Frames given back under memory pressure
+  uint pcacheinvalidates;         // Frames dropped because the file changed
+  uint rmapnodes;                 // Reverse-map chain nodes in use
+  uint rmapkb;                    // Reverse-map memory, in KB
+  uint ptshares;                  // Page tables shared by fork()
+  uint ptsplits;                  // Shared page tables copied on a fault
+  uint ptreuses;                  // and taken back whole by their last user
+  uint tlbinvlpgs;                // Pages flushed from a TLB one at a time
+  uint tlbfulls;                  // Whole TLB flushes for too many pages
+  uint tlbipis;                   // Shootdown IPIs sent to other CPUs
+  uint tlbdeferred;               // PTE changes needing no flush at all
+};
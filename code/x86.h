@@ -130,6 +130,15 @@ xchg(volatile uint *addr, uint newval)
   return result;
 }
 
+// Index of the lowest set bit; val must not be 0.
+static inline uint
+bsfl(uint val)
+{
+  uint idx;
+  asm volatile("bsfl %1,%0" : "=r" (idx) : "rm" (val) : "cc");
+  return idx;
+}
+
 static inline uint
 rcr2(void)
 {
@@ -138,6 +147,20 @@ rcr2(void)
   return val;
 }
 
+static inline uint
+rcr3(void)
+{
+  uint val;
+  asm volatile("movl %%cr3,%0" : "=r" (val));
+  return val;
+}
+
+static inline void
+invlpg(void *addr)
+{
+  asm volatile("invlpg (%0)" : : "r" (addr) : "memory");
+}
+
 static inline void
 lcr3(uint val)
 {
@@ -0,0 +1,278 @@
+// Compressed swap pool.
+//
+// A page on its way to swap is first compressed into a pool of
+// memory carved out of one buddy block, and only goes to the disk
+// if it does not compress well or the pool is full.  A fault on
+// such a page is then a decompression instead of a disk read.
+//
+// The pool is cut into ZCHUNK-byte chunks; a compressed page takes
+// a run of consecutive chunks, found in a bitmap.  Entries are
+// indexed by swap slot, so a slot's data is either in the pool or
+// on the disk, never both.  When the pool is full the oldest entry
+// is written back to its slot on disk to make room.
+//
+// The compressor is a word-level run-length coder: zero-filled and
+// same-filled pages shrink to a couple of words, and so do the
+// mostly empty pages most programs leave behind.
+//
+// Everything here is called with the swap map lock held
+// (see charizard.c).
+
+#include "types.h"
+#include "param.h"
+#include "defs.h"
+#include "mmu.h"
+#include "fs.h"
+#include "vmstat.h"
+
+#define NSLOTS (SWAPBLOCKS/(PGSIZE/BSIZE))
+#define ZORDER 5                        // pool is 2^ZORDER pages
+#define ZCHUNK 128                      // allocation unit, in bytes
+#define NZCHUNK ((PGSIZE << ZORDER) / ZCHUNK)
+#define ZMAXLEN (PGSIZE / 2)            // store only if at least halved
+#define ZWORDS (PGSIZE / 4)
+#define ZRUN 0x80000000                 // header: run of one word
+
+struct zentry {
+  short chunk;                          // first chunk, -1 if not in pool
+  ushort len;                           // compressed length, in bytes
+  uint stamp;                           // store order, for write-back
+};
+
+static struct {
+  int enabled;
+  char *pool;
+  uint *buf;                            // compression output
+  char *wb;                             // page being written back
+  uint map[NZCHUNK / 32];               // set bit = chunk in use
+  struct zentry ent[NSLOTS];
+  uint stamp;
+  uint stored;
+  uint bytes;
+  uint hits;
+  uint rejects;
+  uint writebacks;
+} zswap;
+
+static int
+nchunks(int len)
+{
+  return (len + ZCHUNK - 1) / ZCHUNK;
+}
+
+// Compress the page at src into dst, at most max words.
+// Returns the number of words written, or -1 if it did not fit.
+static int
+zcompress(uint *src, uint *dst, int max)
+{
+  int i, j, o;
+
+  i = o = 0;
+  while(i < ZWORDS){
+    for(j = i + 1; j < ZWORDS && src[j] == src[i]; j++)
+      ;
+    if(j - i >= 2){
+      if(o + 2 > max)
+        return -1;
+      dst[o++] = ZRUN | (j - i);
+      dst[o++] = src[i];
+      i = j;
+      continue;
+    }
+    // Literals, up to the start of the next run.
+    for(j = i + 1; j < ZWORDS && !(j + 1 < ZWORDS && src[j] == src[j+1]); j++)
+      ;
+    if(o + 1 + (j - i) > max)
+      return -1;
+    dst[o++] = j - i;
+    memmove(dst + o, src + i, (j - i) * 4);
+    o += j - i;
+    i = j;
+  }
+  return o;
+}
+
+static void
+zdecompress(uint *src, uint *dst)
+{
+  int i, n;
+
+  i = 0;
+  while(i < ZWORDS){
+    n = *src & ~ZRUN;
+    if(*src++ & ZRUN){
+      while(n-- > 0)
+        dst[i++] = *src;
+      src++;
+    } else {
+      memmove(dst + i, src, n * 4);
+      src += n;
+      i += n;
+    }
+  }
+}
+
+// First fit for n consecutive free chunks.
+static int
+zalloc(int n)
+{
+  int c, run;
+
+  run = 0;
+  for(c = 0; c < NZCHUNK; c++){
+    if(zswap.map[c / 32] == 0xffffffff){
+      run = 0;
+      c = (c / 32) * 32 + 31;
+      continue;
+    }
+    if(zswap.map[c / 32] & (1U << (c % 32))){
+      run = 0;
+      continue;
+    }
+    if(++run == n){
+      c = c - n + 1;
+      for(run = 0; run < n; run++)
+        zswap.map[(c + run) / 32] |= 1U << ((c + run) % 32);
+      return c;
+    }
+  }
+  return -1;
+}
+
+static void
+zfree(int c, int n)
+{
+  while(n-- > 0){
+    zswap.map[c / 32] &= ~(1U << (c % 32));
+    c++;
+  }
+}
+
+void
+zswapinit(void)
+{
+  int i;
+
+  for(i = 0; i < NSLOTS; i++)
+    zswap.ent[i].chunk = -1;
+  zswap.pool = kalloc_order(ZORDER);
+  zswap.buf = (uint*)kalloc();
+  zswap.wb = kalloc();
+  if(zswap.pool == 0 || zswap.buf == 0 || zswap.wb == 0)
+    panic("zswapinit");
+  zswap.enabled = 1;
+}
+
+int
+zswap_has(int slot)
+{
+  return zswap.ent[slot].chunk >= 0;
+}
+
+// Compress page into the pool as the contents of slot.
+// Returns 0 if stored, -1 if the page does not compress well
+// enough (or the pool is off), -2 if the pool has no room.
+int
+zswap_store(int slot, char *page)
+{
+  int n, len, c;
+
+  if(!zswap.enabled)
+    return -1;
+  if(zswap.ent[slot].chunk >= 0)
+    panic("zswap_store");
+  if((n = zcompress((uint*)page, zswap.buf, ZMAXLEN / 4)) < 0){
+    zswap.rejects++;
+    return -1;
+  }
+  len = n * 4;
+  if((c = zalloc(nchunks(len))) < 0)
+    return -2;
+  memmove(zswap.pool + c * ZCHUNK, zswap.buf, len);
+  zswap.ent[slot].chunk = c;
+  zswap.ent[slot].len = len;
+  zswap.ent[slot].stamp = zswap.stamp++;
+  zswap.stored++;
+  zswap.bytes += len;
+  return 0;
+}
+
+// Forget slot's entry, if any.
+void
+zswap_drop(int slot)
+{
+  struct zentry *e;
+
+  e = &zswap.ent[slot];
+  if(e->chunk < 0)
+    return;
+  zfree(e->chunk, nchunks(e->len));
+  zswap.stored--;
+  zswap.bytes -= e->len;
+  e->chunk = -1;
+}
+
+// Decompress slot's entry into page and drop it.
+// Returns 0, or -1 if slot is not in the pool.
+int
+zswap_load(int slot, char *page)
+{
+  struct zentry *e;
+
+  e = &zswap.ent[slot];
+  if(e->chunk < 0)
+    return -1;
+  zdecompress((uint*)(zswap.pool + e->chunk * ZCHUNK), (uint*)page);
+  zswap_drop(slot);
+  zswap.hits++;
+  return 0;
+}
+
+// Make room by taking the oldest entry out of the pool.
+// Returns its slot, or -1 if the pool is empty; *page is then
+// the decompressed contents, which the caller must write to the
+// slot on disk before the next call.
+int
+zswap_evict(char **page)
+{
+  int i, slot;
+
+  slot = -1;
+  for(i = 0; i < NSLOTS; i++){
+    if(zswap.ent[i].chunk < 0)
+      continue;
+    if(slot < 0 || zswap.stamp - zswap.ent[i].stamp > zswap.stamp - zswap.ent[slot].stamp)
+      slot = i;
+  }
+  if(slot >= 0){
+    zdecompress((uint*)(zswap.pool + zswap.ent[slot].chunk * ZCHUNK), (uint*)zswap.wb);
+    *page = zswap.wb;
+    zswap_drop(slot);
+    zswap.writebacks++;
+  }
+  return slot;
+}
+
+// Turn storing on (nonzero) or off (0), or leave it as it is
+// if on is negative.  Returns the old setting.
+int
+zswap_enable(int on)
+{
+  int old;
+
+  old = zswap.enabled;
+  if(on >= 0)
+    zswap.enabled = (on != 0);
+  return old;
+}
+
+void
+zswapstat(struct vmstat *st)
+{
+  st->zswappages = 1 << ZORDER;
+  st->zswapstored = zswap.stored;
+  st->zswapbytes = zswap.bytes;
+  st->zswaphits = zswap.hits;
+  st->zswaprejects = zswap.rejects;
+  st->zswapwritebacks = zswap.writebacks;
+}